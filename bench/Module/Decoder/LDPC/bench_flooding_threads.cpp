@@ -0,0 +1,119 @@
+/*
+ * Micro-benchmark of the intra-frame multithreaded flooding BP decoder: latency of the decoding of one frame of a long
+ * LDPC code (N = 64800, R = 1/2, variable nodes of degree 3) with 1 to 'max_threads' threads. The decoded frames are
+ * compared with the ones of the single-threaded decoding (they have to be identical).
+ *
+ * usage: aff3ct-bench-ldpc-threads [n_runs] [max_threads]
+ */
+#include <cmath>
+#include <chrono>
+#include <random>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <algorithm>
+
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Code/LDPC/Update_rule/NMS/Update_rule_NMS.hpp"
+#include "Tools/Code/LDPC/Update_rule/SPA/Update_rule_SPA.hpp"
+#include "Module/Decoder/LDPC/BP/Flooding/Decoder_LDPC_BP_flooding_threads.hpp"
+
+using namespace aff3ct;
+
+// random (3,6)-regular parity matrix, the double edges drawn by the socket permutation are dropped
+tools::Sparse_matrix random_H(const int N, const int M, std::mt19937 &gen)
+{
+	const auto dv = 3;
+	std::vector<int> sockets(N * dv);
+	for (auto i = 0; i < N * dv; i++)
+		sockets[i] = i / dv;
+	std::shuffle(sockets.begin(), sockets.end(), gen);
+
+	tools::Sparse_matrix H(N, M);
+	for (size_t s = 0; s < sockets.size(); s++)
+	{
+		const auto c = (int)(s % M);
+		if (!H.at(sockets[s], c))
+			H.add_connection(sockets[s], c);
+	}
+
+	return H;
+}
+
+template <class Update_rule>
+void bench(const std::string &name, const tools::Sparse_matrix &H, const Update_rule &up_rule, const int n_runs,
+           const int max_threads)
+{
+	const auto N     = (int)H.get_n_rows();
+	const auto K     = N - (int)H.get_n_cols();
+	const auto n_ite = 10;
+
+	std::vector<uint32_t> info_bits_pos(K);
+	for (auto i = 0; i < K; i++)
+		info_bits_pos[i] = i;
+
+	// BPSK all-zero codeword on an AWGN channel (Eb/N0 = 1.5 dB)
+	std::mt19937 gen(1234);
+	const auto sigma = std::sqrt(1.f / (2.f * 0.5f * std::pow(10.f, 0.15f)));
+	std::normal_distribution<float> noise(0.f, sigma);
+	std::vector<float> Y_N(N);
+	for (auto &y : Y_N)
+		y = 2.f * (1.f + noise(gen)) / (sigma * sigma);
+
+	std::vector<int> V_N_ref(N), V_N(N);
+	double t_ref = 0.;
+	for (auto n_threads = 1; n_threads <= max_threads; n_threads <<= 1)
+	{
+		// the syndrome detection is disabled: each decoding performs 'n_ite' iterations
+		module::Decoder_LDPC_BP_flooding_threads<int,float,Update_rule> decoder(K, N, n_ite, H, info_bits_pos, up_rule,
+		                                                                        n_threads, false);
+
+		decoder.decode_siho_cw(Y_N, V_N); // warm-up
+		const auto t_start = std::chrono::steady_clock::now();
+		for (auto r = 0; r < n_runs; r++)
+		{
+			decoder.reset();
+			decoder.decode_siho_cw(Y_N, V_N);
+		}
+		const auto t_stop = std::chrono::steady_clock::now();
+
+		const auto t = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(t_stop - t_start).count() /
+		               (double)n_runs / 1000.;
+		if (n_threads == 1)
+		{
+			t_ref = t;
+			V_N_ref = V_N;
+		}
+
+		std::cout << std::setw( 6) << name      << " | "
+		          << std::setw( 7) << N         << " | "
+		          << std::setw( 7) << n_threads << " | "
+		          << std::setw(12) << std::fixed << std::setprecision(1) << t << " | "
+		          << std::setw( 7) << std::fixed << std::setprecision(2) << (t_ref / t) << " | "
+		          << (V_N == V_N_ref ? "ok" : "MISMATCH") << std::endl;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	const auto n_runs      = argc > 1 ? std::atoi(argv[1]) : 20;
+	const auto max_threads = argc > 2 ? std::atoi(argv[2]) : 32;
+
+	const auto N = 64800, M = N / 2;
+	std::mt19937 gen(42);
+	const auto H = random_H(N, M, gen);
+
+	std::cout << "# " << std::setw(4) << "rule"         << " | "
+	          << std::setw( 7) << "N"                   << " | "
+	          << std::setw( 7) << "threads"             << " | "
+	          << std::setw(12) << "latency (us)"        << " | "
+	          << std::setw( 7) << "speedup"             << " | "
+	          << "check" << std::endl;
+
+	bench("NMS", H, tools::Update_rule_NMS<float>(0.75f                     ), n_runs, max_threads);
+	bench("SPA", H, tools::Update_rule_SPA<float>((int)H.get_cols_max_degree()), n_runs, max_threads);
+
+	return EXIT_SUCCESS;
+}
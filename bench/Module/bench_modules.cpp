@@ -0,0 +1,437 @@
+/*
+ * Micro-benchmark of the tasks of the modules: for representative (K, N, type) configurations, a communication chain
+ * (source, encoder, modulator, channel, filter, demodulator, quantizer and decoder) is built through the factories,
+ * as the simulator does, and each task is timed in steady state (warm-up, then repeated trials). For each task
+ * the median latency per call and the information throughput (K * n_frames bits per call) are reported.
+ *
+ * The results are written in a JSON file ('--json'). When a baseline is given ('--baseline', a JSON file written by a
+ * previous run on the same machine), the throughput of each task is compared with the baseline and the program returns
+ * EXIT_FAILURE if a task is slower than the baseline by more than the tolerance ('--tolerance', 0.1 = 10%).
+ *
+ * usage: aff3ct-bench [--warmup n] [--trials n] [--calls n] [--filter str] [--json path] [--baseline path]
+ *                     [--tolerance t]
+ */
+#include <map>
+#include <regex>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <iostream>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+
+#include <mipp.h>
+
+#include "Tools/types.h"
+#include "Tools/general_utils.h"
+#include "Tools/Noise/Sigma.hpp"
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Arguments/Argument_handler.hpp"
+#include "Factory/Factory.hpp"
+#include "Factory/Module/Source/Source.hpp"
+#include "Factory/Module/Modem/Modem.hpp"
+#include "Factory/Module/Channel/Channel.hpp"
+#include "Factory/Module/Quantizer/Quantizer.hpp"
+#include "Factory/Module/Codec/Polar/Codec_polar.hpp"
+#include "Factory/Module/Codec/LDPC/Codec_LDPC.hpp"
+
+using namespace aff3ct;
+
+struct Bench_case
+{
+	std::string                                       name;
+	int                                               prec;     // precision of the B, R and Q types (8, 16, 32, 64)
+	bool                                              inter;    // inter-frame SIMD: one frame per element of a register
+	float                                             ebn0;     // in dB
+	std::function<factory::Codec_SIHO::parameters*()> new_cdc;
+	std::vector<std::string>                          cdc_args;
+	std::vector<std::string>                          mdm_args;
+	std::vector<std::string>                          qnt_args; // only for the fixed-point precisions
+};
+
+struct Result
+{
+	std::string name;
+	std::string task;
+	std::string type;
+	int         K;
+	int         N;
+	int         n_frames;
+	int         simd_width; // number of elements of type Q in a SIMD register
+	double      latency;    // median latency per call in us
+	double      throughput; // information throughput in Mb/s
+};
+
+struct Options
+{
+	int         n_warmup  = 10;
+	int         n_trials  = 5;
+	int         n_calls   = 20;
+	float       tolerance = 0.1f;
+	std::string filter;
+	std::string json_path = "aff3ct-bench.json";
+	std::string baseline_path;
+};
+
+std::vector<Bench_case> get_cases()
+{
+	auto polar = []() { return new factory::Codec_polar::parameters(); };
+	auto ldpc  = []() { return new factory::Codec_LDPC ::parameters(); };
+
+	const std::vector<std::string> polar_sc_fast = {"--dec-type", "SC", "--dec-implem", "FAST"};
+	const std::vector<std::string> ldpc_hl_nms   = {"--enc-type", "LDPC_DVBS2", "--dec-type", "BP_HORIZONTAL_LAYERED",
+	                                                "--dec-implem", "NMS", "--dec-ite", "10", "--dec-no-synd"};
+	const std::vector<std::string> ldpc_fl_spa   = {"--enc-type", "LDPC_DVBS2", "--dec-type", "BP_FLOODING",
+	                                                "--dec-implem", "SPA", "--dec-ite", "10", "--dec-no-synd"};
+
+	auto concat = [](std::vector<std::string> a, const std::vector<std::string> &b)
+	{
+		a.insert(a.end(), b.begin(), b.end());
+		return a;
+	};
+
+	const std::vector<std::string> bpsk  = {"--mdm-type", "BPSK", "--mdm-implem", "FAST"};
+	const std::vector<std::string> qam16 = {"--mdm-type", "QAM", "--mdm-bps", "4"};
+
+	// the name of a case is its identifier in the baselines: it should not be changed
+	return {
+	{"polar_sc_fast_2048_1723_32",   32, false, 4.0f, polar, concat({"-K", "1723", "-N", "2048"}, polar_sc_fast), bpsk,
+	 {}},
+	{"polar_sc_fast_2048_1723_8",     8, false, 4.0f, polar, concat({"-K", "1723", "-N", "2048"}, polar_sc_fast), bpsk,
+	 {"--qnt-bits", "6", "--qnt-dec", "1"}},
+	{"polar_sc_fast_32768_29492_32", 32, false, 4.0f, polar, concat({"-K", "29492", "-N", "32768"}, polar_sc_fast),
+	 bpsk, {}},
+	{"ldpc_hl_nms_inter_16200_14400_32", 32, true, 4.0f, ldpc,
+	 concat({"-K", "14400", "-N", "16200", "--dec-simd", "INTER"}, ldpc_hl_nms), bpsk, {}},
+	{"ldpc_hl_nms_inter_16200_14400_16", 16, true, 4.0f, ldpc,
+	 concat({"-K", "14400", "-N", "16200", "--dec-simd", "INTER"}, ldpc_hl_nms), bpsk,
+	 {"--qnt-bits", "6", "--qnt-dec", "2"}},
+	{"ldpc_fl_spa_16200_14400_qam16_32", 32, false, 6.0f, ldpc, concat({"-K", "14400", "-N", "16200"}, ldpc_fl_spa),
+	 qam16, {}},
+	};
+}
+
+// parses the arguments of the factories as the launchers do (description, parsing of a command line and storage)
+void store_args(const std::vector<factory::Factory::parameters*> &params, const std::vector<std::string> &cmd)
+{
+	std::vector<const char*> argv = {"aff3ct-bench"};
+	for (auto &a : cmd)
+		argv.push_back(a.c_str());
+
+	tools::Argument_handler ah((int)argv.size(), argv.data());
+	const auto args = factory::Factory::get_description(params);
+
+	std::vector<std::string> warnings, errors;
+	const auto vals = ah.parse_arguments(args, warnings, errors);
+	if (!errors.empty())
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, errors[0]);
+
+	auto p = params;
+	factory::Factory::store(p, vals);
+}
+
+template <typename B, typename R, typename Q>
+void bench(const Bench_case &c, const Options &opt, std::vector<Result> &results)
+{
+	using namespace module;
+
+	const auto n_frames = c.inter ? mipp::N<Q>() : 1;
+	const auto F        = std::to_string(n_frames);
+
+	std::unique_ptr<factory::Codec_SIHO::parameters> p_cdc(c.new_cdc());
+	auto cdc_args = c.cdc_args;
+	cdc_args.insert(cdc_args.end(), {"--enc-fra", F});
+	store_args({p_cdc.get()}, cdc_args);
+
+	const auto K = p_cdc->K;
+	const auto N = p_cdc->N;
+
+	factory::Source::parameters p_src;
+	store_args({&p_src}, {"--src-info-bits", std::to_string(K), "--src-fra", F});
+
+	factory::Modem::parameters p_mdm;
+	auto mdm_args = c.mdm_args;
+	mdm_args.insert(mdm_args.end(), {"--mdm-fra-size", std::to_string(N), "--mdm-fra", F});
+	store_args({&p_mdm}, mdm_args);
+
+	factory::Channel::parameters p_chn;
+	std::vector<std::string> chn_args = {"--chn-type", "AWGN", "--chn-fra-size", std::to_string(p_mdm.N_mod),
+	                                     "--chn-fra", F};
+	if (p_mdm.complex)
+		chn_args.push_back("--chn-complex");
+	store_args({&p_chn}, chn_args);
+
+	factory::Quantizer::parameters p_qnt;
+	auto qnt_args = c.qnt_args;
+	qnt_args.insert(qnt_args.end(), {"--qnt-size", std::to_string(N), "--qnt-fra", F});
+	store_args({&p_qnt}, qnt_args);
+	if (!std::is_integral<Q>())
+		p_qnt.type = "NO";
+
+	std::unique_ptr<Source   <B    >> src(p_src .template build<B    >());
+	std::unique_ptr<Codec_SIHO<B,Q >> cdc(p_cdc->template build<B,Q  >());
+	std::unique_ptr<Modem    <B,R,R>> mdm(p_mdm .template build<B,R,R>());
+	std::unique_ptr<Channel  <R    >> chn(p_chn .template build<R    >());
+	std::unique_ptr<Quantizer<R,Q  >> qnt(p_qnt .template build<R,Q  >());
+
+	auto &enc = *cdc->get_encoder();
+	auto &dec = *cdc->get_decoder_siho();
+
+	const auto bit_rate = (float)K / (float)N;
+	const auto esn0     = tools::ebn0_to_esn0 (c.ebn0, bit_rate, p_mdm.bps);
+	const auto sigma    = tools::esn0_to_sigma(esn0, p_mdm.cpm_upf);
+	const tools::Sigma<R> noise((R)sigma, (R)c.ebn0, (R)esn0);
+	chn->set_noise(noise);
+	mdm->set_noise(noise);
+	cdc->set_noise(noise);
+
+	std::vector<Module*> modules = {src.get(), &enc, mdm.get(), chn.get(), qnt.get(), &dec};
+	for (auto m : modules)
+		for (auto &t : m->tasks)
+		{
+			t->set_autoalloc(true);
+			t->set_stats(true);
+		}
+
+	  enc [enc::sck::encode       ::U_K ]((*src)[src::sck::generate  ::U_K ]);
+	(*mdm)[mdm::sck::modulate     ::X_N1]( enc  [enc::sck::encode    ::X_N ]);
+	(*chn)[chn::sck::add_noise    ::X_N ]((*mdm)[mdm::sck::modulate  ::X_N2]);
+	(*mdm)[mdm::sck::filter       ::Y_N1]((*chn)[chn::sck::add_noise ::Y_N ]);
+	(*mdm)[mdm::sck::demodulate   ::Y_N1]((*mdm)[mdm::sck::filter    ::Y_N2]);
+	(*qnt)[qnt::sck::process      ::Y_N1]((*mdm)[mdm::sck::demodulate::Y_N2]);
+	  dec [dec::sck::decode_siho  ::Y_N ]((*qnt)[qnt::sck::process   ::Y_N2]);
+
+	// the tasks in the order of the communication chain
+	const std::vector<std::pair<Module*,Task*>> chain =
+	{
+		{src.get(), &(*src)[src::tsk::generate   ]},
+		{&enc,      &  enc [enc::tsk::encode     ]},
+		{mdm.get(), &(*mdm)[mdm::tsk::modulate   ]},
+		{chn.get(), &(*chn)[chn::tsk::add_noise  ]},
+		{mdm.get(), &(*mdm)[mdm::tsk::filter     ]},
+		{mdm.get(), &(*mdm)[mdm::tsk::demodulate ]},
+		{qnt.get(), &(*qnt)[qnt::tsk::process    ]},
+		{&dec,      &  dec [dec::tsk::decode_siho]},
+	};
+
+	for (auto w = 0; w < opt.n_warmup; w++)
+		for (auto &t : chain)
+			t.second->exec();
+
+	std::vector<std::vector<double>> latencies(chain.size()); // in us, for each trial
+	for (auto r = 0; r < opt.n_trials; r++)
+	{
+		for (auto &t : chain)
+			t.second->reset_stats();
+
+		for (auto i = 0; i < opt.n_calls; i++)
+			for (auto &t : chain)
+				t.second->exec();
+
+		for (size_t t = 0; t < chain.size(); t++)
+			latencies[t].push_back((double)chain[t].second->get_duration_total().count() /
+			                       (double)chain[t].second->get_n_calls() / 1000.);
+	}
+
+	std::stringstream type;
+	type << "B" << sizeof(B) * 8 << "_R" << sizeof(R) * 8 << "_Q" << sizeof(Q) * 8;
+
+	for (size_t t = 0; t < chain.size(); t++)
+	{
+		auto &l = latencies[t];
+		std::sort(l.begin(), l.end());
+		const auto latency = l[l.size() / 2];
+
+		Result res;
+		res.name       = c.name;
+		res.task       = chain[t].first->get_name() + "::" + chain[t].second->get_name();
+		res.type       = type.str();
+		res.K          = K;
+		res.N          = N;
+		res.n_frames   = n_frames;
+		res.simd_width = mipp::N<Q>();
+		res.latency    = latency;
+		res.throughput = (double)(K * n_frames) / latency; // bits per us = Mb/s
+		results.push_back(res);
+	}
+}
+
+void run(const Bench_case &c, const Options &opt, std::vector<Result> &results)
+{
+#ifdef AFF3CT_MULTI_PREC
+	switch (c.prec)
+	{
+		case  8: bench<B_8,  R_8,  Q_8 >(c, opt, results); return;
+		case 16: bench<B_16, R_16, Q_16>(c, opt, results); return;
+		case 32: bench<B_32, R_32, Q_32>(c, opt, results); return;
+		case 64: bench<B_64, R_64, Q_64>(c, opt, results); return;
+		default: break;
+	}
+#else
+	// only the precision of the library is instantiated
+	if (c.prec == (int)sizeof(Q) * 8)
+		bench<B,R,Q>(c, opt, results);
+#endif
+}
+
+// the baseline is read line by line: one result per line (see 'write_json')
+std::map<std::string,double> read_baseline(const std::string &path)
+{
+	std::ifstream file(path);
+	if (!file.is_open())
+	{
+		std::stringstream message;
+		message << "Impossible to open the baseline file ('path' = " << path << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const std::regex re("\"name\": \"([^\"]*)\", \"task\": \"([^\"]*)\".*\"throughput\": ([-+0-9.eE]+)");
+
+	std::map<std::string,double> baseline;
+	std::string line;
+	std::smatch m;
+	while (std::getline(file, line))
+		if (std::regex_search(line, m, re))
+			baseline[m[1].str() + "|" + m[2].str()] = std::stod(m[3].str());
+
+	return baseline;
+}
+
+void write_json(const std::string &path, const std::vector<Result> &results)
+{
+	std::ofstream file(path);
+	if (!file.is_open())
+	{
+		std::stringstream message;
+		message << "Impossible to open the JSON file ('path' = " << path << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	file << "{" << std::endl;
+	file << "  \"simd\": \"" << mipp::InstructionFullType << "\"," << std::endl;
+	file << "  \"units\": {\"latency\": \"us\", \"throughput\": \"Mb/s\"}," << std::endl;
+	file << "  \"results\": [" << std::endl;
+	for (size_t r = 0; r < results.size(); r++)
+	{
+		auto &res = results[r];
+		file << "    {\"name\": \""      << res.name       << "\", "
+		     <<      "\"task\": \""      << res.task       << "\", "
+		     <<      "\"type\": \""      << res.type       << "\", "
+		     <<      "\"K\": "           << res.K          << ", "
+		     <<      "\"N\": "           << res.N          << ", "
+		     <<      "\"n_frames\": "    << res.n_frames   << ", "
+		     <<      "\"simd_width\": "  << res.simd_width << ", "
+		     <<      "\"latency\": "     << std::setprecision(6) << res.latency    << ", "
+		     <<      "\"throughput\": "  << std::setprecision(6) << res.throughput << "}"
+		     << (r +1 < results.size() ? "," : "") << std::endl;
+	}
+	file << "  ]" << std::endl;
+	file << "}" << std::endl;
+}
+
+Options read_options(int argc, char** argv)
+{
+	Options opt;
+	for (auto i = 1; i < argc; i++)
+	{
+		const std::string arg = argv[i];
+		if (i +1 >= argc)
+		{
+			std::stringstream message;
+			message << "The option has no value ('arg' = " << arg << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		const std::string val = argv[++i];
+		     if (arg == "--warmup"   ) opt.n_warmup      = std::stoi(val);
+		else if (arg == "--trials"   ) opt.n_trials      = std::stoi(val);
+		else if (arg == "--calls"    ) opt.n_calls       = std::stoi(val);
+		else if (arg == "--tolerance") opt.tolerance     = std::stof(val);
+		else if (arg == "--filter"   ) opt.filter        = val;
+		else if (arg == "--json"     ) opt.json_path     = val;
+		else if (arg == "--baseline" ) opt.baseline_path = val;
+		else
+		{
+			std::stringstream message;
+			message << "Unknown option ('arg' = " << arg << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	if (opt.n_trials < 1 || opt.n_calls < 1 || opt.n_warmup < 0)
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "'trials' and 'calls' have to be greater than 0.");
+
+	return opt;
+}
+
+int main(int argc, char** argv)
+{
+	try
+	{
+		const auto opt = read_options(argc, argv);
+
+		std::map<std::string,double> baseline;
+		if (!opt.baseline_path.empty())
+			baseline = read_baseline(opt.baseline_path);
+
+		std::cout << "# SIMD: " << mipp::InstructionFullType << std::endl;
+		std::cout << "# " << std::setw(32) << "case"            << " | "
+		          << std::setw(48) << "task"                    << " | "
+		          << std::setw(12) << "latency (us)"            << " | "
+		          << std::setw(10) << "Mb/s"                    << " | "
+		          << "vs baseline" << std::endl;
+
+		auto n_regressions = 0;
+		std::vector<Result> results;
+		for (auto &c : get_cases())
+		{
+			if (!opt.filter.empty() && c.name.find(opt.filter) == std::string::npos)
+				continue;
+
+			const auto first = results.size();
+			run(c, opt, results);
+
+			for (auto r = first; r < results.size(); r++)
+			{
+				auto &res = results[r];
+				std::cout << "  " << std::setw(32) << res.name << " | "
+				          << std::setw(48) << res.task << " | "
+				          << std::setw(12) << std::fixed << std::setprecision(2) << res.latency    << " | "
+				          << std::setw(10) << std::fixed << std::setprecision(2) << res.throughput << " | ";
+
+				auto it = baseline.find(res.name + "|" + res.task);
+				if (it == baseline.end())
+					std::cout << "-" << std::endl;
+				else
+				{
+					const auto ratio = res.throughput / it->second;
+					const auto regression = ratio < 1. - (double)opt.tolerance;
+					n_regressions += regression ? 1 : 0;
+					std::cout << std::setprecision(2) << ratio << "x" << (regression ? " REGRESSION" : "") << std::endl;
+				}
+			}
+		}
+
+		write_json(opt.json_path, results);
+
+		if (n_regressions)
+		{
+			std::cerr << n_regressions << " task(s) slower than the baseline (tolerance: " << opt.tolerance << ")."
+			          << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+	catch (std::exception const& e)
+	{
+		std::cerr << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
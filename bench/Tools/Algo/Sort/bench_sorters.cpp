@@ -0,0 +1,143 @@
+/*
+ * Micro-benchmark of the partial sorts used by the SCL and Chase decoders: compares the LC_sorter (tree-based) with
+ * the Bitonic_sorter (sorting networks) on the (n_elmts, K) couples met in the decoders. The LC_sorter is only
+ * reliable when n_elmts is a power of 2, the results of the Bitonic_sorter are checked against std::partial_sort.
+ *
+ * usage: aff3ct-bench-sort [n_runs]
+ */
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <algorithm>
+
+#include "Tools/Algo/Sort/LC_sorter.hpp"
+#include "Tools/Algo/Sort/Bitonic_sorter.hpp"
+
+using namespace aff3ct;
+
+template <typename T>
+std::string type_name();
+
+template <> std::string type_name<int8_t >() { return "int8";  }
+template <> std::string type_name<int16_t>() { return "int16"; }
+template <> std::string type_name<float  >() { return "float"; }
+
+template <typename T, class F>
+double time_ns(F &&f, const int n_runs)
+{
+	const auto t_start = std::chrono::steady_clock::now();
+	for (auto r = 0; r < n_runs; r++)
+		f(r);
+	const auto t_stop = std::chrono::steady_clock::now();
+
+	return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(t_stop - t_start).count() / (double)n_runs;
+}
+
+template <typename T>
+void bench(const std::string &use_case, const int n_elmts, const int K, const bool abs, const int n_runs)
+{
+	const auto n_frames = 64;
+	std::mt19937 gen(n_elmts * 31 + K);
+	std::uniform_int_distribution<int> dist(-100, 100);
+
+	// LC_sorter::partial_sort_destructive modifies its input: each run works on a fresh copy of the values
+	std::vector<T> values(n_frames * n_elmts), tmp(n_elmts);
+	for (auto &v : values)
+		v = (T)dist(gen);
+	if (!abs)
+		for (auto &v : values)
+			v = (T)std::abs(v);
+
+	std::vector<int> pos_lc(K), pos_bi(K);
+	tools::LC_sorter     <T> lc(n_elmts);
+	tools::Bitonic_sorter<T> bi(n_elmts);
+
+	auto n_mismatches = 0;
+	for (auto f = 0; f < n_frames; f++)
+	{
+		const auto v = values.data() + f * n_elmts;
+		for (auto i = 0; i < n_elmts; i++)
+			tmp[i] = abs ? (T)std::abs(v[i]) : v[i];
+		if (abs) bi.partial_sort_abs(v, pos_bi, n_elmts, K);
+		else     bi.partial_sort    (v, pos_bi, n_elmts, K);
+
+		// the selected values are compared with a reference (the ties can be broken differently)
+		std::partial_sort(tmp.begin(), tmp.begin() + K, tmp.end());
+		for (auto k = 0; k < K; k++)
+			if ((T)std::abs(v[pos_bi[k]]) != tmp[k])
+				n_mismatches++;
+	}
+
+	const auto t_lc = time_ns<T>([&](const int r)
+	{
+		const auto v = values.data() + (r % n_frames) * n_elmts;
+		for (auto i = 0; i < n_elmts; i++)
+			tmp[i] = abs ? (T)std::abs(v[i]) : v[i];
+		lc.partial_sort_destructive(tmp.data(), pos_lc, n_elmts, K);
+	}, n_runs);
+
+	const auto t_bi = time_ns<T>([&](const int r)
+	{
+		const auto v = values.data() + (r % n_frames) * n_elmts;
+		if (abs) bi.partial_sort_abs(v, pos_bi, n_elmts, K);
+		else     bi.partial_sort    (v, pos_bi, n_elmts, K);
+	}, n_runs);
+
+	std::cout << std::setw(16) << use_case          << " | "
+	          << std::setw( 6) << type_name<T>()    << " | "
+	          << std::setw( 6) << n_elmts           << " | "
+	          << std::setw( 3) << K                 << " | "
+	          << std::setw(10) << std::fixed << std::setprecision(1) << t_lc << " | "
+	          << std::setw(10) << std::fixed << std::setprecision(1) << t_bi << " | "
+	          << std::setw( 7) << std::fixed << std::setprecision(2) << (t_lc / t_bi) << " | "
+	          << (n_mismatches ? "MISMATCH" : "ok") << std::endl;
+}
+
+template <typename T>
+void bench_all(const int n_runs)
+{
+	// path selection in the SCL decoders: the L best metrics among 2L (or 4L) candidates
+	for (auto L = 2; L <= 32; L <<= 1)
+	{
+		bench<T>("SCL path sel.", 2 * L, L, false, n_runs);
+		bench<T>("SCL path sel.", 4 * L, L, false, n_runs);
+	}
+
+	// SPC nodes of the SCL decoders: the 2 (or 4) least reliable LLRs
+	for (auto n = 8; n <= 1024; n <<= 2)
+	{
+		bench<T>("SCL SPC node", n, 2, true, n_runs);
+		bench<T>("SCL SPC node", n, 4, true, n_runs);
+	}
+
+	// Chase decoders: the p least reliable positions of a BCH frame
+	for (auto N : {31, 63, 127, 255})
+		for (auto p : {3, 4, 5})
+			bench<T>("Chase", N, p, true, n_runs);
+}
+
+int main(int argc, char** argv)
+{
+	const auto n_runs = argc > 1 ? std::atoi(argv[1]) : 100000;
+
+	std::cout << "# SIMD: " << mipp::InstructionFullType << std::endl;
+	std::cout << "# " << std::setw(14) << "use case" << " | "
+	          << std::setw( 6) << "type"     << " | "
+	          << std::setw( 6) << "n"        << " | "
+	          << std::setw( 3) << "K"        << " | "
+	          << std::setw(10) << "LC (ns)"  << " | "
+	          << std::setw(10) << "bit. (ns)"<< " | "
+	          << std::setw( 7) << "speedup"  << " | "
+	          << "check" << std::endl;
+
+	bench_all<int8_t >(n_runs);
+	bench_all<int16_t>(n_runs);
+	bench_all<float  >(n_runs);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,209 @@
+/*
+ * Micro-benchmark of the table-driven fixed-point SPA update rules (Update_rule_SPA_table and its SIMD version):
+ * accuracy of the check node outputs against the exact SPA (computed in double precision) and throughput of the check
+ * node updates compared with the floating-point SPA rule. The LLRs are drawn from a Gaussian distribution, quantized
+ * with 'n_frac_bits' fractional bits and saturated to +/-8. The errors are given in LLR units.
+ *
+ * usage: aff3ct-bench-spa-table [n_runs]
+ */
+#include <cmath>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <limits>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <algorithm>
+#include <mipp.h>
+
+#include "Tools/Code/LDPC/Update_rule/SPA/Update_rule_SPA.hpp"
+#include "Tools/Code/LDPC/Update_rule/SPA_table/Update_rule_SPA_table.hpp"
+#include "Tools/Code/LDPC/Update_rule/SPA_table/Update_rule_SPA_table_simd.hpp"
+
+using namespace aff3ct;
+
+template <typename T>
+std::string type_name();
+
+template <> std::string type_name<int8_t >() { return "int8";  }
+template <> std::string type_name<int16_t>() { return "int16"; }
+
+template <class F>
+double time_ns(F &&f, const int n_runs)
+{
+	const auto t_start = std::chrono::steady_clock::now();
+	for (auto r = 0; r < n_runs; r++)
+		f(r);
+	const auto t_stop = std::chrono::steady_clock::now();
+
+	return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(t_stop - t_start).count() / (double)n_runs;
+}
+
+// check node update of one node (or of mipp::N<R>() nodes with the SIMD rules, one node per lane)
+template <typename R, class U>
+inline void chk_node(U &up_rule, const R *in, R *out, const int chk_degree)
+{
+	up_rule.begin_chk_node_in(0, chk_degree);
+	for (auto v = 0; v < chk_degree; v++)
+		up_rule.compute_chk_node_in(v, in[v]);
+	up_rule.end_chk_node_in();
+
+	up_rule.begin_chk_node_out(0, chk_degree);
+	for (auto v = 0; v < chk_degree; v++)
+		out[v] = up_rule.compute_chk_node_out(v, in[v]);
+	up_rule.end_chk_node_out();
+}
+
+// exact check node output (without the division of the SPA rule, ill-conditioned when an input is null)
+double spa_exact(const std::vector<double> &llrs, const int j)
+{
+	auto prod = 1.0;
+	auto sign = false;
+	for (auto i = 0; i < (int)llrs.size(); i++)
+		if (i != j)
+		{
+			prod *= std::tanh(std::abs(llrs[i]) * 0.5);
+			sign ^= std::signbit(llrs[i]);
+		}
+
+	const auto res = 2.0 * std::atanh(std::min(prod, 1.0 - 1e-15));
+	return sign ? -res : res;
+}
+
+template <typename R>
+void bench(const int chk_degree, const int n_frac_bits, const int n_runs)
+{
+	const auto n_nodes = 1024;
+	const auto scale   = (double)(1 << n_frac_bits);
+	const auto sat     = (int)std::min((double)std::numeric_limits<R>::max(), 8.0 * scale - 1.0);
+
+	std::mt19937 gen(chk_degree * 31 + n_frac_bits);
+	std::normal_distribution<double> dist(2.0, 2.0);
+
+	// the nodes are interleaved by blocks of mipp::N<R>() for the SIMD rule (one node per lane)
+	const auto n_lanes = mipp::N<R>();
+	std::vector<double> llrs(n_nodes * chk_degree);
+	mipp::vector<R> qnt(n_nodes * chk_degree), out(n_nodes * chk_degree);
+	std::vector<float> flt(n_nodes * chk_degree), flt_out(n_nodes * chk_degree);
+	for (auto n = 0; n < n_nodes; n++)
+		for (auto v = 0; v < chk_degree; v++)
+		{
+			const auto q = (int)std::max(-(double)sat, std::min((double)sat, std::round(dist(gen) * scale)));
+			const auto i = ((n / n_lanes) * chk_degree + v) * n_lanes + n % n_lanes;
+			qnt[i]                    = (R)q;
+			llrs[n * chk_degree + v]  = (double)q / scale;
+			flt [n * chk_degree + v]  = (float)q / (float)scale;
+		}
+
+	tools::Update_rule_SPA_table<R> up_table(chk_degree, n_frac_bits);
+	tools::Update_rule_SPA<float>   up_float(chk_degree);
+
+	// accuracy of the scalar rule (the outputs are compared with the exact SPA saturated like the quantized LLRs)
+	std::vector<double> node(chk_degree);
+	std::vector<R> in_n(chk_degree), out_n(chk_degree);
+	auto err_sum = 0.0, err_max = 0.0;
+	for (auto n = 0; n < n_nodes; n++)
+	{
+		for (auto v = 0; v < chk_degree; v++)
+		{
+			node[v] = llrs[n * chk_degree + v];
+			in_n[v] = qnt[((n / n_lanes) * chk_degree + v) * n_lanes + n % n_lanes];
+		}
+		chk_node<R>(up_table, in_n.data(), out_n.data(), chk_degree);
+		for (auto v = 0; v < chk_degree; v++)
+		{
+			const auto ref = std::max(-sat / scale, std::min(sat / scale, spa_exact(node, v)));
+			const auto err = std::abs((double)out_n[v] / scale - ref);
+			err_sum += err;
+			err_max  = std::max(err_max, err);
+		}
+	}
+
+	const auto n_edges = (double)(n_nodes * chk_degree);
+	const auto t_float = time_ns([&](const int r)
+	{
+		for (auto n = 0; n < n_nodes; n++)
+			chk_node<float>(up_float, flt.data() + n * chk_degree, flt_out.data() + n * chk_degree, chk_degree);
+	}, n_runs) / n_edges;
+
+	const auto t_table = time_ns([&](const int r)
+	{
+		for (auto n = 0; n < n_nodes; n++)
+		{
+			for (auto v = 0; v < chk_degree; v++)
+				in_n[v] = qnt[((n / n_lanes) * chk_degree + v) * n_lanes + n % n_lanes];
+			chk_node<R>(up_table, in_n.data(), out_n.data(), chk_degree);
+		}
+	}, n_runs) / n_edges;
+
+	auto t_simd = 0.0;
+	auto n_mismatches = 0;
+#ifdef __cpp_aligned_new
+	tools::Update_rule_SPA_table_simd<R> up_simd(chk_degree, n_frac_bits);
+	std::vector<mipp::Reg<R>> in_r(chk_degree), out_r(chk_degree);
+	const auto simd_nodes = [&]()
+	{
+		for (auto b = 0; b < n_nodes / n_lanes; b++)
+		{
+			for (auto v = 0; v < chk_degree; v++)
+				in_r[v] = mipp::Reg<R>(qnt.data() + (b * chk_degree + v) * n_lanes);
+			chk_node<mipp::Reg<R>>(up_simd, in_r.data(), out_r.data(), chk_degree);
+			for (auto v = 0; v < chk_degree; v++)
+				out_r[v].store(out.data() + (b * chk_degree + v) * n_lanes);
+		}
+	};
+
+	// the SIMD rule has to give the same results than the scalar rule
+	simd_nodes();
+	for (auto n = 0; n < n_nodes; n++)
+	{
+		for (auto v = 0; v < chk_degree; v++)
+			in_n[v] = qnt[((n / n_lanes) * chk_degree + v) * n_lanes + n % n_lanes];
+		chk_node<R>(up_table, in_n.data(), out_n.data(), chk_degree);
+		for (auto v = 0; v < chk_degree; v++)
+			if (out_n[v] != out[((n / n_lanes) * chk_degree + v) * n_lanes + n % n_lanes])
+				n_mismatches++;
+	}
+
+	t_simd = time_ns([&](const int r) { simd_nodes(); }, n_runs) / n_edges;
+#endif
+
+	std::cout << std::setw( 7) << type_name<R>()    << " | "
+	          << std::setw( 6) << chk_degree        << " | "
+	          << std::setw( 4) << n_frac_bits       << " | "
+	          << std::setw(10) << std::fixed << std::setprecision(4) << (err_sum / n_edges) << " | "
+	          << std::setw(10) << std::fixed << std::setprecision(4) << err_max             << " | "
+	          << std::setw(10) << std::fixed << std::setprecision(2) << t_float             << " | "
+	          << std::setw(10) << std::fixed << std::setprecision(2) << t_table             << " | "
+	          << std::setw(10) << std::fixed << std::setprecision(2) << t_simd              << " | "
+	          << (n_mismatches ? "MISMATCH" : "ok") << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+	const auto n_runs = argc > 1 ? std::atoi(argv[1]) : 200;
+
+	std::cout << "# SIMD: " << mipp::InstructionFullType << std::endl;
+	std::cout << "# " << std::setw(5) << "type" << " | "
+	          << std::setw( 6) << "degree"       << " | "
+	          << std::setw( 4) << "frac"         << " | "
+	          << std::setw(10) << "mean err."    << " | "
+	          << std::setw(10) << "max err."     << " | "
+	          << std::setw(10) << "float (ns)"   << " | "
+	          << std::setw(10) << "table (ns)"   << " | "
+	          << std::setw(10) << "simd (ns)"    << " | "
+	          << "check" << std::endl;
+
+	for (auto chk_degree : {6, 8, 12, 20, 32})
+	{
+		for (auto n_frac_bits : {1, 2, 3})
+			bench<int8_t >(chk_degree, n_frac_bits, n_runs);
+		for (auto n_frac_bits : {2, 3, 4, 5})
+			bench<int16_t>(chk_degree, n_frac_bits, n_runs);
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -137,7 +137,7 @@ def check_keys(keys_file, aff3ct_path, doc_path):
 			not_in_doc_keys.append(k)
 
 	# manages special key exceptions
-	exceptions_not_in_doc_keys = ["factory::Frozenbits_generator::parameters::p+pb-path"]
+	exceptions_not_in_doc_keys = []
 	exceptions_doc_keys = ["factory::BFER::parameters::p+mpi-comm-freq", "factory::Launcher::parameters::except-a2l"]
 	for e in exceptions_not_in_doc_keys:
 		if e in not_in_doc_keys: not_in_doc_keys.remove(e)
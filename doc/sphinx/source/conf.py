@@ -329,6 +329,7 @@ rst_epilog = """
 .. |MWBF|      replace:: :abbr:`MWBF     (Modified Weighted Bit Flipping)`
 .. |NEON|      replace:: :abbr:`NEON     (ARM SIMD instructions)`
 .. |NMS|       replace:: :abbr:`NMS      (Normalized Min-Sum)`
+.. |NUMA|      replace:: :abbr:`NUMA     (Non-Uniform Memory Access)`
 .. |OMS|       replace:: :abbr:`OMS      (Offset Min-Sum)`
 .. |ONMS|      replace:: :abbr:`ONMS     (Offset Normalized Min-Sum)`
 .. |OOK|       replace:: :abbr:`OOK      (On-Off Keying)`
@@ -370,6 +371,7 @@ rst_epilog = """
 .. |SSE4.1|    replace:: :abbr:`SSE4.1   (Streaming SIMD Extensions 4.1)`
 .. |SSE4.2|    replace:: :abbr:`SSE4.2   (Streaming SIMD Extensions 4.2)`
 .. |STD|       replace:: :abbr:`STD      (Standard)`
+.. |TLB|       replace:: :abbr:`TLB      (Translation Lookaside Buffer)`
 .. |TPC|       replace:: :abbr:`TPC      (Turbo Product Code)`
 .. |TV|        replace:: :abbr:`TV       (Tal & Vardy)`
 .. |version|   replace:: """ + version + """
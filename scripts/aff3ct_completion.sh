@@ -54,11 +54,15 @@ _aff3ct() {
 		      --mdm-cpm-k --mdm-cpm-std --mdm-const-path --mdm-max --mdm-psi  \
 		      --mdm-ite --mdm-no-sig2                                         \
 		      --chn-type --chn-implem --chn-path --chn-blk-fad --qnt-type     \
+		      --chn-is-scale --chn-is-shift --mnt-ci-width --mnt-ci-level     \
+		      --mnt-ci-method --mnt-ci-min-fe --mnt-mpi-async                 \
 		      --qnt-dec --qnt-bits --qnt-range --dec-type --dec-implem        \
 		      --ter-no --ter-freq --sim-seed --sim-mpi-comm --sim-pyber       \
 		      --sim-no-colors --sim-err-trk --sim-err-trk-rev                 \
 		      --sim-err-trk-path --sim-debug-prec --sim-no-legend --except-a2l\
-		      --except-no-bt"
+		      --except-no-bt --sim-trace-path --sim-hw-counters             \
+		      --sim-pin-policy --sim-pin-cpus --sim-huge-pages --sim-chk-path  \
+		      --sim-chk-freq --sim-resume"
 	fi
 
 	# add contents of Launcher_BFER.cpp
@@ -99,7 +103,7 @@ _aff3ct() {
 	if [[ ${codetype} == "POLAR"      && ${simutype} == "GEN" ]]
 	then
 		opts="$opts --enc-fb-awgn-path --enc-fb-gen-method --dec-snr \
-		      --dec-gen-path --sim-pb-path"
+		      --dec-gen-path"
 	fi
 
 	# add contents of Launcher_BFER_RA.cpp
@@ -126,8 +130,9 @@ _aff3ct() {
 	if [[ ${codetype} == "POLAR"      && ${simutype} == "BFER" || \
 	      ${codetype} == "POLAR"      && ${simutype} == "BFERI" ]]
 	then
-		opts="$opts --sim-pb-path --enc-fb-awgn-path --enc-fb-gen-method \
-		      --enc-fb-sigma --dec-type -D --dec-ite -i --dec-implem"
+		opts="$opts --enc-fb-awgn-path --enc-fb-gen-method \
+		      --enc-fb-sigma --dec-type -D --dec-ite -i --dec-implem \
+		      --dec-early-term"
 	fi
 
 	# add contents of Launcher_BFER_polar.cpp
@@ -164,7 +169,7 @@ _aff3ct() {
 	# add contents of Launcher_EXIT_polar.cpp
 	if [[ ${codetype} == "POLAR"      && ${simutype} == "EXIT" ]]
 	then
-		opts="$opts --sim-pb-path --enc-fb-sigma --enc-fb-awgn-path        \
+		opts="$opts --enc-fb-sigma --enc-fb-awgn-path        \
 		      --enc-fb-gen-method --dec-type -D --dec-implem  --dec-ite -i \
 		      --dec-lists -L"
 	fi
@@ -174,7 +179,7 @@ _aff3ct() {
 	      ${codetype} == "LDPC"       && ${simutype} == "BFERI" ]]
 	then
 		opts="$opts --dec-type -D --dec-implem --dec-ite -i --dec-h-path \
-		--dec-no-synd --dec-off --dec-norm --dec-synd-depth --dec-simd"
+		--dec-no-synd --dec-off --dec-norm --dec-synd-depth --dec-simd --dec-compact-msg"
 	fi
 
 	# add contents of Launcher_BFER_uncoded.cpp
@@ -201,6 +206,8 @@ _aff3ct() {
 		--snr-min-max | -M | --sim-snr-step | -s | --sim-stop-time |           \
 		--sim-threads | -t | --sim-inter-lvl | --enc-info-bits | -K |          \
 		--enc-cw-size | -N | --mdm-ite | --chn-gain-occur |                    \
+		--chn-is-scale | --chn-is-shift | --mnt-ci-width | --mnt-ci-level |    \
+		--sim-pin-cpus | --sim-chk-freq | --mnt-ci-min-fe |                    \
 		--mdm-bps | --mdm-ups | --mdm-cpm-L | --mdm-cpm-p | --mdm-cpm-k |      \
 		--qnt-dec | --qnt-bits | --qnt-range | --qnt-type |                    \
 		--sim-benchs | -b | --sim-debug-limit | --sim-debug-prec |             \
@@ -217,10 +224,11 @@ _aff3ct() {
 		# awaiting nothing
 		-v | --version | -h | --help |  -H | --Help | --mdm-no-sig2 |      \
 		--sim-debug | --sim-debug-fe | --sim-stats | --sim-no-legend |     \
-		--sim-coset | -c | enc-no-buff | --enc-no-sys | --dec-no-synd |    \
+		--sim-coset | -c | enc-no-buff | --enc-no-sys | --dec-no-synd | --dec-compact-msg |    \
 		--crc-rate | --sim-err-trk | --sim-err-trk-rev | --itl-uni |       \
 		--dec-partial-adaptive | --dec-fnc | --dec-sc | --except-a2l |     \
-		--except-no-bt | --ter-no                                          )
+		--except-no-bt | --ter-no | --sim-hw-counters | --sim-huge-pages | \
+		--mnt-mpi-async | --sim-resume)
 			COMPREPLY=( $(compgen -W "${opts}" -- ${cur}) )
 			;;
 
@@ -298,9 +306,9 @@ _aff3ct() {
 			COMPREPLY=( $(compgen -W "${params}" -- ${cur}) )
 			;;
 
-		--enc-fb-awgn-path | --dec-gen-path | --sim-pb-path | --itl-path | \
+		--enc-fb-awgn-path | --dec-gen-path | --itl-path | \
 		--mdm-const-path | --src-path | --enc-path | --chn-path |          \
-		--dec-h-path | --sim-err-trk-path)
+		--dec-h-path | --sim-err-trk-path | --sim-trace-path | --sim-chk-path)
 			_filedir
 			;;
 
@@ -324,7 +332,7 @@ _aff3ct() {
 			;;
 
 		--chn-implem)
-			local params="STD FAST GSL MKL"
+			local params="STD FAST SPARSE GSL MKL"
 			COMPREPLY=( $(compgen -W "${params}" -- ${cur}) )
 			;;
 
@@ -333,6 +341,16 @@ _aff3ct() {
 			COMPREPLY=( $(compgen -W "${params}" -- ${cur}) )
 			;;
 
+		--mnt-ci-method)
+			local params="WILSON CP"
+			COMPREPLY=( $(compgen -W "${params}" -- ${cur}) )
+			;;
+
+		--sim-pin-policy)
+			local params="NONE COMPACT SCATTER LIST"
+			COMPREPLY=( $(compgen -W "${params}" -- ${cur}) )
+			;;
+
 		--crc-type)
 			local params="STD FAST INTER"
 			COMPREPLY=( $(compgen -W "${params}" -- ${cur}) )
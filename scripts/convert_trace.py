@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+
+# Convert the legacy AFF3CT user files (--src-path, --chn-path) into the binary trace format (AFF3CTTR) that is
+# memory-mapped once and shared between all the threads and processes of a node.
+#
+# Trace layout (little-endian):
+#   char     magic[8]    = "AFF3CTTR"
+#   uint32_t version     = 1
+#   uint32_t data_type   (0 = int8, 1 = float32, 2 = float64)
+#   uint64_t n_frames
+#   uint64_t frame_size
+#   uint64_t data_offset = 64
+#   [padding up to 64 bytes]
+#   n_frames * frame_size values
+
+import os
+import sys
+import struct
+import argparse
+import itertools
+
+MAGIC       = b"AFF3CTTR"
+VERSION     = 1
+HEADER_SIZE = 64
+DATA_TYPES  = {"int8": (0, "b"), "float32": (1, "f"), "float64": (2, "d")}
+
+parser = argparse.ArgumentParser(prog='aff3ct-convert-trace', formatter_class=argparse.ArgumentDefaultsHelpFormatter)
+parser.add_argument('input',  action='store', type=str, help='Path to the legacy file.')
+parser.add_argument('output', action='store', type=str, help='Path to the binary trace to write.')
+parser.add_argument('--kind', action='store', dest='kind', type=str, default="noise",
+                    choices=["source", "noise", "gains"],
+                    help='"source" for --src-path files, "noise" for --chn-path USER* files, "gains" for RAYLEIGH_USER.')
+parser.add_argument('--type', action='store', dest='dataType', type=str, default=None,
+                    choices=list(DATA_TYPES.keys()),
+                    help='Stored data type (default: int8 for "source", float32 else).')
+
+# the files are converted record by record: they are never loaded as a whole in memory
+CHUNK_SIZE = 1 << 16 # number of values packed per write
+
+def read_text_tokens(path):
+	with open(path, "r") as f:
+		for line in f:
+			for t in line.split():
+				yield t
+
+def check_count(values, n_values, path):
+	n = 0
+	for v in values:
+		yield v
+		n += 1
+	if n != n_values:
+		sys.exit("Not enough data in '" + path + "'.")
+
+def read_source(path):
+	tokens = read_text_tokens(path)
+	n_frames, frame_size = int(next(tokens)), int(next(tokens))
+	values = (1 if int(t) != 0 else 0 for t in itertools.islice(tokens, n_frames * frame_size))
+	return n_frames, frame_size, check_count(values, n_frames * frame_size, path)
+
+def read_noise_binary(path, n_values, fmt):
+	size = struct.calcsize(fmt)
+	with open(path, "rb") as f:
+		f.seek(8)
+		while n_values > 0:
+			n = min(n_values, CHUNK_SIZE)
+			for v in struct.unpack("<" + str(n) + fmt, f.read(n * size)):
+				yield v
+			n_values -= n
+
+def read_noise(path):
+	# the legacy channel files are either in binary (32-bit header + float32/float64 values) or in ASCII, the binary
+	# files are recognized by their size
+	payload_size = os.path.getsize(path) - 8
+	if payload_size >= 0:
+		with open(path, "rb") as f:
+			n_frames, frame_size = struct.unpack("<Ii", f.read(8))
+		n_values = n_frames * frame_size
+		if n_values > 0 and payload_size in (n_values * 8, n_values * 4):
+			fmt = "d" if payload_size == n_values * 8 else "f"
+			return n_frames, frame_size, read_noise_binary(path, n_values, fmt)
+
+	try:
+		tokens = read_text_tokens(path)
+		n_frames, frame_size = int(next(tokens)), int(next(tokens))
+	except (UnicodeDecodeError, ValueError, StopIteration):
+		sys.exit("Can't detect the format of '" + path + "'.")
+	values = (float(t) for t in itertools.islice(tokens, n_frames * frame_size))
+	return n_frames, frame_size, check_count(values, n_frames * frame_size, path)
+
+def read_gains(path):
+	# the number of gains is only known at the end of the file
+	return None, 1, (float(t) for t in read_text_tokens(path))
+
+def write_trace(path, data_type, n_frames, frame_size, values):
+	code, fmt = DATA_TYPES[data_type]
+	with open(path, "wb") as f:
+		# the header is written at the end, when the number of values is known
+		f.write(b"\0" * HEADER_SIZE)
+		n_values = 0
+		chunk = []
+		for v in values:
+			chunk.append(v)
+			if len(chunk) == CHUNK_SIZE:
+				f.write(struct.pack("<" + str(len(chunk)) + fmt, *chunk))
+				n_values += len(chunk)
+				chunk = []
+		if chunk:
+			f.write(struct.pack("<" + str(len(chunk)) + fmt, *chunk))
+			n_values += len(chunk)
+
+		if n_frames is None:
+			n_frames = n_values // frame_size
+		header = struct.pack("<8sIIQQQ", MAGIC, VERSION, code, n_frames, frame_size, HEADER_SIZE)
+		f.seek(0)
+		f.write(header)
+	return n_frames
+
+if __name__ == "__main__":
+	args = parser.parse_args()
+
+	readers = {"source": read_source, "noise": read_noise, "gains": read_gains}
+	n_frames, frame_size, values = readers[args.kind](args.input)
+
+	data_type = args.dataType
+	if data_type is None:
+		data_type = "int8" if args.kind == "source" else "float32"
+
+	try:
+		n_frames = write_trace(args.output, data_type, n_frames, frame_size, values)
+	except SystemExit:
+		os.remove(args.output) # the input file is incomplete, the trace is not valid
+		raise
+	print("'" + args.output + "' written (" + str(n_frames) + " frames of " + str(frame_size) + " " + data_type +
+	      " values).")
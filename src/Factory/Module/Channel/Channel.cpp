@@ -9,6 +9,7 @@
 #include "Module/Channel/AWGN/Channel_AWGN_LLR.hpp"
 #include "Module/Channel/Rayleigh/Channel_Rayleigh_LLR.hpp"
 #include "Module/Channel/Rayleigh/Channel_Rayleigh_LLR_user.hpp"
+#include "Module/Channel/Rayleigh/Channel_Rayleigh_LLR_Jakes.hpp"
 #include "Module/Channel/Optical/Channel_optical.hpp"
 #include "Module/Channel/Binary_erasure/Channel_binary_erasure.hpp"
 #include "Module/Channel/Binary_symmetric/Channel_binary_symmetric.hpp"
@@ -17,6 +18,7 @@
 #include "Tools/Algo/Draw_generator/Gaussian_noise_generator/Fast/Gaussian_noise_generator_fast.hpp"
 #include "Tools/Algo/Draw_generator/Event_generator/Standard/Event_generator_std.hpp"
 #include "Tools/Algo/Draw_generator/Event_generator/Fast/Event_generator_fast.hpp"
+#include "Tools/Algo/Draw_generator/Event_generator/Sparse/Event_generator_sparse.hpp"
 #include "Tools/Algo/Draw_generator/User_pdf_noise_generator/Standard/User_pdf_noise_generator_std.hpp"
 #include "Tools/Algo/Draw_generator/User_pdf_noise_generator/Fast/User_pdf_noise_generator_fast.hpp"
 #ifdef AFF3CT_CHANNEL_MKL
@@ -64,11 +66,11 @@ void Channel::parameters
 		tools::Integer(tools::Positive(), tools::Non_zero()));
 
 	tools::add_arg(args, p, class_name+"p+type",
-		tools::Text(tools::Including_set("NO", "AWGN", "RAYLEIGH", "RAYLEIGH_USER", "BEC", "BSC", "OPTICAL", "USER",
+		tools::Text(tools::Including_set("NO", "AWGN", "RAYLEIGH", "RAYLEIGH_USER", "RAYLEIGH_JAKES", "BEC", "BSC", "OPTICAL", "USER",
 		                                 "USER_ADD", "USER_BEC", "USER_BSC")));
 
 	tools::add_arg(args, p, class_name+"p+implem",
-		tools::Text(tools::Including_set("STD", "FAST")));
+		tools::Text(tools::Including_set("STD", "FAST", "SPARSE")));
 
 #ifdef AFF3CT_CHANNEL_GSL
 	tools::add_options(args.at({p+"-implem"}), 0, "GSL");
@@ -97,6 +99,21 @@ void Channel::parameters
 
 	tools::add_arg(args, p, class_name+"p+gain-occur",
 		tools::Integer(tools::Positive(), tools::Non_zero()));
+
+	tools::add_arg(args, p, class_name+"p+doppler",
+		tools::Real(tools::Positive(), tools::Max(0.5f)));
+
+	tools::add_arg(args, p, class_name+"p+sin",
+		tools::Integer(tools::Positive(), tools::Non_zero()));
+
+	tools::add_arg(args, p, class_name+"p+rice",
+		tools::Real(tools::Positive()));
+
+	tools::add_arg(args, p, class_name+"p+is-scale",
+		tools::Real(tools::Positive(), tools::Non_zero()));
+
+	tools::add_arg(args, p, class_name+"p+is-shift",
+		tools::Real(tools::Positive()));
 }
 
 void Channel::parameters
@@ -108,6 +125,7 @@ void Channel::parameters
 	if(vals.exist({p+"-fra",      "F"})) this->n_frames     = vals.to_int ({p+"-fra",      "F"});
 	if(vals.exist({p+"-seed",     "S"})) this->seed         = vals.to_int ({p+"-seed",     "S"});
 	if(vals.exist({p+"-gain-occur"   })) this->gain_occur   = vals.to_int ({p+"-gain-occur"   });
+	if(vals.exist({p+"-sin"          })) this->n_sin        = vals.to_int ({p+"-sin"          });
 	if(vals.exist({p+"-type"         })) this->type         = vals.at     ({p+"-type"         });
 	if(vals.exist({p+"-implem"       })) this->implem       = vals.at     ({p+"-implem"       });
 	if(vals.exist({p+"-path"         })) this->path         = vals.to_file({p+"-path"         });
@@ -115,6 +133,19 @@ void Channel::parameters
 	if(vals.exist({p+"-add-users"    })) this->add_users    = true;
 	if(vals.exist({p+"-complex"      })) this->complex      = true;
 	if(vals.exist({p+"-noise"        })) this->noise        = vals.to_float({p+"-noise"      });
+	if(vals.exist({p+"-doppler"      })) this->doppler      = vals.to_float({p+"-doppler"    });
+	if(vals.exist({p+"-rice"         })) this->rice_k       = vals.to_float({p+"-rice"       });
+	if(vals.exist({p+"-is-scale"     })) this->is_scale     = vals.to_float({p+"-is-scale"   });
+	if(vals.exist({p+"-is-shift"     })) this->is_shift     = vals.to_float({p+"-is-shift"   });
+
+	// only the AWGN channel draws its noise from the biased distribution of the importance sampling
+	if ((vals.exist({p+"-is-scale"}) || vals.exist({p+"-is-shift"})) && this->type != "AWGN")
+	{
+		std::stringstream message;
+		message << "The importance sampling ('" << p << "-is-scale' and '" << p << "-is-shift') is only supported "
+		        << "by the 'AWGN' channel ('type' = " << this->type << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
 }
 
 void Channel::parameters
@@ -137,12 +168,25 @@ void Channel::parameters
 	if (this->type == "RAYLEIGH_USER")
 		headers[p].push_back(std::make_pair("Gain occurrences", std::to_string(this->gain_occur)));
 
+	if (this->type == "RAYLEIGH_JAKES")
+	{
+		headers[p].push_back(std::make_pair("Normalized Doppler (fd.Ts)", std::to_string(this->doppler)));
+		headers[p].push_back(std::make_pair("Number of sinusoids", std::to_string(this->n_sin)));
+		headers[p].push_back(std::make_pair("Rician K-factor", std::to_string(this->rice_k)));
+	}
+
 	if (this->type.find("RAYLEIGH") != std::string::npos)
 		headers[p].push_back(std::make_pair("Block fading policy", this->block_fading));
 
 	if ((this->type != "NO" && this->type != "USER" && this->type != "USER_ADD") && full)
 		headers[p].push_back(std::make_pair("Seed", std::to_string(this->seed)));
 
+	if (this->type == "AWGN" && (this->is_scale != 1.f || this->is_shift != 0.f))
+	{
+		headers[p].push_back(std::make_pair("Importance sampling (scale)", std::to_string(this->is_scale)));
+		headers[p].push_back(std::make_pair("Importance sampling (shift)", std::to_string(this->is_shift)));
+	}
+
 	headers[p].push_back(std::make_pair("Complex", this->complex ? "on" : "off"));
 	headers[p].push_back(std::make_pair("Add users", this->add_users ? "on" : "off"));
 }
@@ -152,13 +196,14 @@ module::Channel<R>* Channel::parameters
 ::build_event() const
 {
 	std::unique_ptr<tools::Event_generator<R>> n;
-	     if (implem == "STD" ) n.reset(new tools::Event_generator_std <R>(seed));
-	else if (implem == "FAST") n.reset(new tools::Event_generator_fast<R>(seed));
+	     if (implem == "STD"   ) n.reset(new tools::Event_generator_std   <R>(seed));
+	else if (implem == "FAST"  ) n.reset(new tools::Event_generator_fast  <R>(seed));
+	else if (implem == "SPARSE") n.reset(new tools::Event_generator_sparse<R>(seed));
 #ifdef AFF3CT_CHANNEL_MKL
-	else if (implem == "MKL" ) n.reset(new tools::Event_generator_MKL<R>(seed));
+	else if (implem == "MKL"   ) n.reset(new tools::Event_generator_MKL   <R>(seed));
 #endif
 #ifdef AFF3CT_CHANNEL_GSL
-	else if (implem == "GSL" ) n.reset(new tools::Event_generator_GSL<R>(seed));
+	else if (implem == "GSL"   ) n.reset(new tools::Event_generator_GSL   <R>(seed));
 #endif
 	else
 		throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
@@ -185,9 +230,24 @@ module::Channel<R>* Channel::parameters
 	else
 		throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 
-	if (type == "AWGN"         ) return new module::Channel_AWGN_LLR         <R>(N,                std::move(n),             add_users, tools::Sigma<R>((R)noise), n_frames);
-	if (type == "RAYLEIGH"     ) return new module::Channel_Rayleigh_LLR     <R>(N, complex,       std::move(n),             add_users, tools::Sigma<R>((R)noise), n_frames);
-	if (type == "RAYLEIGH_USER") return new module::Channel_Rayleigh_LLR_user<R>(N, complex, path, std::move(n), gain_occur, add_users, tools::Sigma<R>((R)noise), n_frames);
+	if (type == "AWGN"          )
+	{
+		std::unique_ptr<module::Channel_AWGN_LLR<R>> chn(
+			new module::Channel_AWGN_LLR<R>(N, std::move(n), add_users, tools::Sigma<R>((R)noise), n_frames));
+		chn->set_importance_sampling((R)is_scale, (R)is_shift);
+		return chn.release();
+	}
+	if (type == "RAYLEIGH"      ) return new module::Channel_Rayleigh_LLR     <R>(N, complex,       std::move(n),             add_users, tools::Sigma<R>((R)noise), n_frames);
+	if (type == "RAYLEIGH_USER" ) return new module::Channel_Rayleigh_LLR_user<R>(N, complex, path, std::move(n), gain_occur, add_users, tools::Sigma<R>((R)noise), n_frames);
+	if (type == "RAYLEIGH_JAKES")
+	{
+		if (add_users)
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, "The 'RAYLEIGH_JAKES' channel does not "
+			                                                            "support the users addition ('add_users').");
+
+		return new module::Channel_Rayleigh_LLR_Jakes<R>(N, complex, (R)doppler, std::move(n), n_sin, (R)rice_k, seed,
+		                                                 tools::Sigma<R>((R)noise), n_frames);
+	}
 
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 }
@@ -34,7 +34,12 @@ struct Channel : public Factory
 		int         n_frames     = 1;
 		int         seed         = 0;
 		int         gain_occur   = 1;
+		int         n_sin        = 16;
 		float       noise        = -1.f;
+		float       doppler      = 0.01f;
+		float       rice_k       = 0.f;
+		float       is_scale     = 1.f;
+		float       is_shift     = 0.f;
 
 		// ---------------------------------------------------------------------------------------------------- METHODS
 		explicit parameters(const std::string &p = Channel_prefix);
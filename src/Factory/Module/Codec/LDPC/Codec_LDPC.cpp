@@ -138,7 +138,7 @@ module::Codec_LDPC<B,Q>* Codec_LDPC::parameters
 {
 	return new module::Codec_LDPC<B,Q>(dynamic_cast<const Encoder_LDPC  ::parameters&>(*enc),
 	                                   dynamic_cast<const Decoder_LDPC  ::parameters&>(*dec),
-	                                   dynamic_cast<Puncturer_LDPC::parameters*>(pct.get()));
+	                                   dynamic_cast<const Puncturer_LDPC::parameters*>(pct.get()));
 }
 
 template <typename B, typename Q>
@@ -2,6 +2,7 @@
 
 #include "Module/Decoder/Generic/ML/Decoder_maximum_likelihood_std.hpp"
 #include "Module/Decoder/Generic/ML/Decoder_maximum_likelihood_naive.hpp"
+#include "Module/Decoder/Generic/ML/Decoder_maximum_likelihood_fast.hpp"
 #include "Module/Decoder/Generic/Chase/Decoder_chase_std.hpp"
 
 #include "Decoder.hpp"
@@ -45,7 +46,7 @@ void Decoder::parameters
 		tools::Text(tools::Including_set("ML", "CHASE")));
 
 	tools::add_arg(args, p, class_name+"p+implem",
-		tools::Text(tools::Including_set("STD", "NAIVE")));
+		tools::Text(tools::Including_set("STD", "NAIVE", "FAST")));
 
 	tools::add_arg(args, p, class_name+"p+hamming",
 		tools::None());
@@ -55,6 +56,9 @@ void Decoder::parameters
 
 	tools::add_arg(args, p, class_name+"p+seed",
 		tools::Integer(tools::Positive()));
+
+	tools::add_arg(args, p, class_name+"p+threads",
+		tools::Integer(tools::Positive(), tools::Non_zero()));
 }
 
 void Decoder::parameters
@@ -67,6 +71,7 @@ void Decoder::parameters
 	if(vals.exist({p+"-fra",       "F"})) this->n_frames   = vals.to_int({p+"-fra",       "F"});
 	if(vals.exist({p+"-flips"         })) this->flips      = vals.to_int({p+"-flips"         });
 	if(vals.exist({p+"-seed"          })) this->seed       = vals.to_int({p+"-seed"          });
+	if(vals.exist({p+"-threads"       })) this->n_threads  = vals.to_int({p+"-threads"       });
 	if(vals.exist({p+"-type",      "D"})) this->type       = vals.at    ({p+"-type",      "D"});
 	if(vals.exist({p+"-implem"        })) this->implem     = vals.at    ({p+"-implem"        });
 	if(vals.exist({p+"-no-sys"        })) this->systematic = false;
@@ -91,6 +96,8 @@ void Decoder::parameters
 		headers[p].push_back(std::make_pair("Distance", this->hamming ? "Hamming" : "Euclidean"));
 	if(this->type == "CHASE")
 		headers[p].push_back(std::make_pair("Max flips", std::to_string(this->flips)));
+	if(this->n_threads > 1)
+		headers[p].push_back(std::make_pair("Intra-frame threads", std::to_string(this->n_threads)));
 
 	if (full) headers[p].push_back(std::make_pair("Seed", std::to_string(this->seed)));
 }
@@ -105,6 +112,7 @@ module::Decoder_SIHO<B,Q>* Decoder::parameters
 		{
 			if (this->implem == "STD"  ) return new module::Decoder_ML_std  <B,Q>(this->K, this->N_cw, *encoder, this->hamming, this->n_frames);
 			if (this->implem == "NAIVE") return new module::Decoder_ML_naive<B,Q>(this->K, this->N_cw, *encoder, this->hamming, this->n_frames);
+			if (this->implem == "FAST" ) return new module::Decoder_ML_fast <B,Q>(this->K, this->N_cw, *encoder, this->hamming, this->n_threads, this->n_frames);
 		}
 		else if (this->type == "CHASE")
 		{
@@ -34,6 +34,7 @@ struct Decoder : Factory
 		int         tail_length = 0;
 		int         flips       = 3;
 		int         seed        = 0;
+		int         n_threads   = 1;
 
 		// deduced parameters
 		float       R           = -1.f;
@@ -1,3 +1,6 @@
+#include <sstream>
+#include <type_traits>
+
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Documentation/documentation.h"
 #include "Tools/Arguments/Splitter/Splitter.hpp"
@@ -6,11 +9,13 @@
 #include "Tools/Code/LDPC/Matrix_handler/LDPC_matrix_handler.hpp"
 
 #include "Module/Decoder/LDPC/BP/Flooding/Decoder_LDPC_BP_flooding.hpp"
+#include "Module/Decoder/LDPC/BP/Flooding/Decoder_LDPC_BP_flooding_threads.hpp"
 #include "Module/Decoder/LDPC/BP/Horizontal_layered/Decoder_LDPC_BP_horizontal_layered.hpp"
 #include "Module/Decoder/LDPC/BP/Vertical_layered/Decoder_LDPC_BP_vertical_layered.hpp"
 
 #include "Tools/Code/LDPC/Update_rule/SPA/Update_rule_SPA.hpp"
 #include "Tools/Code/LDPC/Update_rule/LSPA/Update_rule_LSPA.hpp"
+#include "Tools/Code/LDPC/Update_rule/SPA_table/Update_rule_SPA_table.hpp"
 #include "Tools/Code/LDPC/Update_rule/MS/Update_rule_MS.hpp"
 #include "Tools/Code/LDPC/Update_rule/OMS/Update_rule_OMS.hpp"
 #include "Tools/Code/LDPC/Update_rule/NMS/Update_rule_NMS.hpp"
@@ -22,6 +27,7 @@
 #include "Module/Decoder/LDPC/BP/Flooding/Decoder_LDPC_BP_flooding_inter.hpp"
 #include "Tools/Code/LDPC/Update_rule/SPA/Update_rule_SPA_simd.hpp"
 #include "Tools/Code/LDPC/Update_rule/LSPA/Update_rule_LSPA_simd.hpp"
+#include "Tools/Code/LDPC/Update_rule/SPA_table/Update_rule_SPA_table_simd.hpp"
 #include "Tools/Code/LDPC/Update_rule/MS/Update_rule_MS_simd.hpp"
 #include "Tools/Code/LDPC/Update_rule/OMS/Update_rule_OMS_simd.hpp"
 #include "Tools/Code/LDPC/Update_rule/NMS/Update_rule_NMS_simd.hpp"
@@ -32,10 +38,14 @@
 #include "Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_A.hpp"
 #include "Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_B.hpp"
 #include "Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_E.hpp"
+#include "Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_A_inter.hpp"
+#include "Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_B_inter.hpp"
+#include "Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_E_inter.hpp"
 #include "Module/Decoder/LDPC/BP/Flooding/SPA/Decoder_LDPC_BP_flooding_SPA.hpp"
 #include "Module/Decoder/LDPC/BP/Peeling/Decoder_LDPC_BP_peeling.hpp"
 #include "Module/Decoder/LDPC/BF/OMWBF/Decoder_LDPC_bit_flipping_OMWBF.hpp"
 #include "Module/Decoder/LDPC/BF/PPBF/Decoder_LDPC_probabilistic_parallel_bit_flipping.hpp"
+#include "Module/Decoder/LDPC/BF/PPBF/Decoder_LDPC_probabilistic_parallel_bit_flipping_inter.hpp"
 
 #include "Decoder_LDPC.hpp"
 
@@ -122,6 +132,9 @@ void Decoder_LDPC::parameters
 
 	tools::add_arg(args, p, class_name+"p+ppbf-proba",
 		tools::List<float,Real_splitter>(tools::Real(), tools::Length(1)));
+
+	tools::add_arg(args, p, class_name+"p+compact-msg",
+		tools::None());
 }
 
 void Decoder_LDPC::parameters
@@ -140,6 +153,7 @@ void Decoder_LDPC::parameters
 	if(vals.exist({p+"-norm"       })) this->norm_factor     = vals.to_float({p+"-norm"       });
 	if(vals.exist({p+"-ppbf-proba" })) this->ppbf_proba      = vals.to_list<float>({p+"-ppbf-proba"});
 	if(vals.exist({p+"-no-synd"    })) this->enable_syndrome = false;
+	if(vals.exist({p+"-compact-msg"})) this->compact_msg     = true;
 
 	if (!this->H_path.empty())
 	{
@@ -153,6 +167,19 @@ void Decoder_LDPC::parameters
 	}
 
 	Decoder::parameters::store(vals);
+
+	// the compact messages are only implemented in the min-sum based horizontal layered INTER decoder
+	if (this->compact_msg && !((this->type == "BP_HORIZONTAL_LAYERED" || this->type == "BP_HORIZONTAL_LAYERED_LEGACY") &&
+	                           this->simd_strategy == "INTER" &&
+	                           (this->implem == "MS" || this->implem == "NMS" || this->implem == "OMS")))
+	{
+		std::stringstream message;
+		message << "The compact messages are only available for the 'MS', 'NMS' and 'OMS' implementations of the "
+		        << "'BP_HORIZONTAL_LAYERED' decoder with the 'INTER' SIMD strategy ('type' = " << this->type
+		        << ", 'implem' = " << this->implem << ", 'simd_strategy' = "
+		        << (this->simd_strategy.empty() ? "none" : this->simd_strategy) << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
 }
 
 void Decoder_LDPC::parameters
@@ -190,6 +217,10 @@ void Decoder_LDPC::parameters
 		if (this->implem == "AMS")
 			headers[p].push_back(std::make_pair("Min type", this->min));
 
+		if (this->type == "BP_HORIZONTAL_LAYERED" && this->simd_strategy == "INTER" &&
+		    (this->implem == "MS" || this->implem == "NMS" || this->implem == "OMS"))
+			headers[p].push_back(std::make_pair("Compact messages", this->compact_msg ? "on" : "off"));
+
 		if (this->implem == "PPBF")
 		{
 			std::stringstream bern_str;
@@ -208,16 +239,36 @@ void Decoder_LDPC::parameters
 
 template <typename B, typename Q>
 module::Decoder_SISO_SIHO<B,Q>* Decoder_LDPC::parameters
-::build_siso(const tools::Sparse_matrix &H, const std::vector<unsigned> &info_bits_pos,
+::build_siso(const std::shared_ptr<const tools::Sparse_matrix> &H, const std::vector<unsigned> &info_bits_pos,
              const std::unique_ptr<module::Encoder<B>>& encoder) const
 {
-	if (this->type == "BP_FLOODING" && this->simd_strategy.empty())
+	if (this->type == "BP_FLOODING" && this->simd_strategy.empty() && this->n_threads > 1)
 	{
-		const auto max_CN_degree = H.get_cols_max_degree();
+		const auto max_CN_degree = H->get_cols_max_degree();
+
+		if (this->implem == "MS"  )  return new module::Decoder_LDPC_BP_flooding_threads<B,Q,tools::Update_rule_MS  <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_MS  <Q                           >(                 ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "OMS" )  return new module::Decoder_LDPC_BP_flooding_threads<B,Q,tools::Update_rule_OMS <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_OMS <Q                           >((Q)this->offset  ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "NMS" )  return new module::Decoder_LDPC_BP_flooding_threads<B,Q,tools::Update_rule_NMS <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_NMS <Q                           >(this->norm_factor), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (std::is_integral<Q>::value && (this->implem == "SPA" || this->implem == "LSPA"))
+			return new module::Decoder_LDPC_BP_flooding_threads<B,Q,tools::Update_rule_SPA_table<Q>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_SPA_table<Q>(max_CN_degree, this->qnt_decimals), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "SPA" )  return new module::Decoder_LDPC_BP_flooding_threads<B,Q,tools::Update_rule_SPA <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_SPA <Q                           >(max_CN_degree    ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "LSPA")  return new module::Decoder_LDPC_BP_flooding_threads<B,Q,tools::Update_rule_LSPA<Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_LSPA<Q                           >(max_CN_degree    ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "AMS" )
+		{
+			if (this->min == "MIN" ) return new module::Decoder_LDPC_BP_flooding_threads<B,Q,tools::Update_rule_AMS <Q,tools::min             <Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS <Q,tools::min             <Q>>(                 ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+			if (this->min == "MINL") return new module::Decoder_LDPC_BP_flooding_threads<B,Q,tools::Update_rule_AMS <Q,tools::min_star_linear2<Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS <Q,tools::min_star_linear2<Q>>(                 ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+			if (this->min == "MINS") return new module::Decoder_LDPC_BP_flooding_threads<B,Q,tools::Update_rule_AMS <Q,tools::min_star        <Q>>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_AMS <Q,tools::min_star        <Q>>(                 ), this->n_threads, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		}
+	}
+	else if (this->type == "BP_FLOODING" && this->simd_strategy.empty())
+	{
+		const auto max_CN_degree = H->get_cols_max_degree();
 
 		if (this->implem == "MS"  )  return new module::Decoder_LDPC_BP_flooding<B,Q,tools::Update_rule_MS  <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_MS  <Q                           >(                 ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		if (this->implem == "OMS" )  return new module::Decoder_LDPC_BP_flooding<B,Q,tools::Update_rule_OMS <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_OMS <Q                           >((Q)this->offset  ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		if (this->implem == "NMS" )  return new module::Decoder_LDPC_BP_flooding<B,Q,tools::Update_rule_NMS <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_NMS <Q                           >(this->norm_factor), this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (std::is_integral<Q>::value && (this->implem == "SPA" || this->implem == "LSPA"))
+			return new module::Decoder_LDPC_BP_flooding<B,Q,tools::Update_rule_SPA_table<Q>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_SPA_table<Q>(max_CN_degree, this->qnt_decimals), this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		if (this->implem == "SPA" )  return new module::Decoder_LDPC_BP_flooding<B,Q,tools::Update_rule_SPA <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_SPA <Q                           >(max_CN_degree    ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		if (this->implem == "LSPA")  return new module::Decoder_LDPC_BP_flooding<B,Q,tools::Update_rule_LSPA<Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_LSPA<Q                           >(max_CN_degree    ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		if (this->implem == "AMS" )
@@ -229,11 +280,13 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_LDPC::parameters
 	}
 	else if (this->type == "BP_HORIZONTAL_LAYERED" && this->simd_strategy.empty())
 	{
-		const auto max_CN_degree = H.get_cols_max_degree();
+		const auto max_CN_degree = H->get_cols_max_degree();
 
 		if (this->implem == "MS"  )  return new module::Decoder_LDPC_BP_horizontal_layered<B,Q,tools::Update_rule_MS  <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_MS  <Q                           >(                 ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		if (this->implem == "OMS" )  return new module::Decoder_LDPC_BP_horizontal_layered<B,Q,tools::Update_rule_OMS <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_OMS <Q                           >((Q)this->offset  ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		if (this->implem == "NMS" )  return new module::Decoder_LDPC_BP_horizontal_layered<B,Q,tools::Update_rule_NMS <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_NMS <Q                           >(this->norm_factor), this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (std::is_integral<Q>::value && (this->implem == "SPA" || this->implem == "LSPA"))
+			return new module::Decoder_LDPC_BP_horizontal_layered<B,Q,tools::Update_rule_SPA_table<Q>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_SPA_table<Q>(max_CN_degree, this->qnt_decimals), this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		if (this->implem == "SPA" )  return new module::Decoder_LDPC_BP_horizontal_layered<B,Q,tools::Update_rule_SPA <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_SPA <Q                           >(max_CN_degree    ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		if (this->implem == "LSPA")  return new module::Decoder_LDPC_BP_horizontal_layered<B,Q,tools::Update_rule_LSPA<Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_LSPA<Q                           >(max_CN_degree    ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		if (this->implem == "AMS" )
@@ -245,11 +298,13 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_LDPC::parameters
 	}
 	else if (this->type == "BP_VERTICAL_LAYERED" && this->simd_strategy.empty())
 	{
-		const auto max_CN_degree = H.get_cols_max_degree();
+		const auto max_CN_degree = H->get_cols_max_degree();
 
 		if (this->implem == "MS"  )  return new module::Decoder_LDPC_BP_vertical_layered<B,Q,tools::Update_rule_MS  <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_MS  <Q                           >(                 ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		if (this->implem == "OMS" )  return new module::Decoder_LDPC_BP_vertical_layered<B,Q,tools::Update_rule_OMS <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_OMS <Q                           >((Q)this->offset  ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		if (this->implem == "NMS" )  return new module::Decoder_LDPC_BP_vertical_layered<B,Q,tools::Update_rule_NMS <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_NMS <Q                           >(this->norm_factor), this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (std::is_integral<Q>::value && (this->implem == "SPA" || this->implem == "LSPA"))
+			return new module::Decoder_LDPC_BP_vertical_layered<B,Q,tools::Update_rule_SPA_table<Q>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_SPA_table<Q>(max_CN_degree, this->qnt_decimals), this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		if (this->implem == "SPA" )  return new module::Decoder_LDPC_BP_vertical_layered<B,Q,tools::Update_rule_SPA <Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_SPA <Q                           >(max_CN_degree    ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		if (this->implem == "LSPA")  return new module::Decoder_LDPC_BP_vertical_layered<B,Q,tools::Update_rule_LSPA<Q                           >>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_LSPA<Q                           >(max_CN_degree    ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		if (this->implem == "AMS" )
@@ -261,14 +316,16 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_LDPC::parameters
 	}
 	else if (this->type == "BIT_FLIPPING")
 	{
-		     if (this->implem == "WBF" ) return new module::Decoder_LDPC_bit_flipping_OMWBF<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, 0.f              , this->enable_syndrome, this->syndrome_depth, this->n_frames);
-		     if (this->implem == "MWBF") return new module::Decoder_LDPC_bit_flipping_OMWBF<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->mwbf_factor, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		     if (this->implem == "WBF" ) return new module::Decoder_LDPC_bit_flipping_OMWBF<B,Q>(this->K, this->N_cw, this->n_ite, *H, info_bits_pos, 0.f              , this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		     if (this->implem == "MWBF") return new module::Decoder_LDPC_bit_flipping_OMWBF<B,Q>(this->K, this->N_cw, this->n_ite, *H, info_bits_pos, this->mwbf_factor, this->enable_syndrome, this->syndrome_depth, this->n_frames);
 	}
 #ifdef __cpp_aligned_new
-	else if (this->type == "BP_HORIZONTAL_LAYERED" && this->simd_strategy == "INTER")
+	else if (this->type == "BP_HORIZONTAL_LAYERED" && this->simd_strategy == "INTER" && !this->compact_msg)
 	{
-		const auto max_CN_degree = H.get_cols_max_degree();
+		const auto max_CN_degree = H->get_cols_max_degree();
 
+		if (std::is_integral<Q>::value && (this->implem == "SPA" || this->implem == "LSPA"))
+			return new module::Decoder_LDPC_BP_horizontal_layered_inter<B,Q,tools::Update_rule_SPA_table_simd<Q>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_SPA_table_simd<Q>(max_CN_degree, this->qnt_decimals), this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		if (this->implem == "SPA" ) return new module::Decoder_LDPC_BP_horizontal_layered_inter<B,Q,tools::Update_rule_SPA_simd <Q>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_SPA_simd <Q>(max_CN_degree), this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		if (this->implem == "LSPA") return new module::Decoder_LDPC_BP_horizontal_layered_inter<B,Q,tools::Update_rule_LSPA_simd<Q>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_LSPA_simd<Q>(max_CN_degree), this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		if (this->implem == "MS"  ) return new module::Decoder_LDPC_BP_horizontal_layered_inter<B,Q,tools::Update_rule_MS_simd  <Q>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_MS_simd  <Q>(             ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
@@ -300,20 +357,22 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_LDPC::parameters
 	}
 #endif
 #ifdef __cpp_aligned_new
-	else if (this->type == "BP_HORIZONTAL_LAYERED_LEGACY" && this->simd_strategy == "INTER")
+	else if ((this->type == "BP_HORIZONTAL_LAYERED_LEGACY" || (this->type == "BP_HORIZONTAL_LAYERED" && this->compact_msg)) && this->simd_strategy == "INTER")
 #else
 	else if (this->type == "BP_HORIZONTAL_LAYERED" && this->simd_strategy == "INTER")
 #endif
 	{
-		if (this->implem == "MS" ) return new module::Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, 1.f              , (Q)0           , this->enable_syndrome, this->syndrome_depth, this->n_frames);
-		if (this->implem == "NMS") return new module::Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->norm_factor, (Q)0           , this->enable_syndrome, this->syndrome_depth, this->n_frames);
-		if (this->implem == "OMS") return new module::Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, 1.f              , (Q)this->offset, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		if (this->implem == "MS" ) return new module::Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, 1.f              , (Q)0           , this->enable_syndrome, this->syndrome_depth, this->n_frames, this->compact_msg);
+		if (this->implem == "NMS") return new module::Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->norm_factor, (Q)0           , this->enable_syndrome, this->syndrome_depth, this->n_frames, this->compact_msg);
+		if (this->implem == "OMS") return new module::Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, 1.f              , (Q)this->offset, this->enable_syndrome, this->syndrome_depth, this->n_frames, this->compact_msg);
 	}
 #ifdef __cpp_aligned_new
 	else if (this->type == "BP_FLOODING" && this->simd_strategy == "INTER")
 	{
-		const auto max_CN_degree = H.get_cols_max_degree();
+		const auto max_CN_degree = H->get_cols_max_degree();
 
+		if (std::is_integral<Q>::value && (this->implem == "SPA" || this->implem == "LSPA"))
+			return new module::Decoder_LDPC_BP_flooding_inter<B,Q,tools::Update_rule_SPA_table_simd<Q>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_SPA_table_simd<Q>(max_CN_degree, this->qnt_decimals), this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		if (this->implem == "SPA" ) return new module::Decoder_LDPC_BP_flooding_inter<B,Q,tools::Update_rule_SPA_simd <Q>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_SPA_simd <Q>(max_CN_degree), this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		if (this->implem == "LSPA") return new module::Decoder_LDPC_BP_flooding_inter<B,Q,tools::Update_rule_LSPA_simd<Q>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_LSPA_simd<Q>(max_CN_degree), this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		if (this->implem == "MS"  ) return new module::Decoder_LDPC_BP_flooding_inter<B,Q,tools::Update_rule_MS_simd  <Q>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_MS_simd  <Q>(             ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
@@ -347,8 +406,10 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_LDPC::parameters
 #ifdef __cpp_aligned_new
 	else if (this->type == "BP_VERTICAL_LAYERED" && this->simd_strategy == "INTER")
 	{
-		const auto max_CN_degree = H.get_cols_max_degree();
+		const auto max_CN_degree = H->get_cols_max_degree();
 
+		if (std::is_integral<Q>::value && (this->implem == "SPA" || this->implem == "LSPA"))
+			return new module::Decoder_LDPC_BP_vertical_layered_inter<B,Q,tools::Update_rule_SPA_table_simd<Q>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_SPA_table_simd<Q>(max_CN_degree, this->qnt_decimals), this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		if (this->implem == "SPA" ) return new module::Decoder_LDPC_BP_vertical_layered_inter<B,Q,tools::Update_rule_SPA_simd <Q>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_SPA_simd <Q>(max_CN_degree), this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		if (this->implem == "LSPA") return new module::Decoder_LDPC_BP_vertical_layered_inter<B,Q,tools::Update_rule_LSPA_simd<Q>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_LSPA_simd<Q>(max_CN_degree), this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		if (this->implem == "MS"  ) return new module::Decoder_LDPC_BP_vertical_layered_inter<B,Q,tools::Update_rule_MS_simd  <Q>>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, tools::Update_rule_MS_simd  <Q>(             ), this->enable_syndrome, this->syndrome_depth, this->n_frames);
@@ -389,7 +450,7 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_LDPC::parameters
 
 template <typename B, typename Q>
 module::Decoder_SIHO<B,Q>* Decoder_LDPC::parameters
-::build(const tools::Sparse_matrix &H, const std::vector<unsigned> &info_bits_pos,
+::build(const std::shared_ptr<const tools::Sparse_matrix> &H, const std::vector<unsigned> &info_bits_pos,
         const std::unique_ptr<module::Encoder<B>>& encoder) const
 {
 	try
@@ -404,13 +465,20 @@ module::Decoder_SIHO<B,Q>* Decoder_LDPC::parameters
 			if (this->implem == "GALB") return new module::Decoder_LDPC_BP_flooding_GALB<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->enable_syndrome, this->syndrome_depth, this->n_frames);
 			if (this->implem == "GALE") return new module::Decoder_LDPC_BP_flooding_GALE<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		}
+		else if ((this->type == "BP" || this->type == "BP_FLOODING") && this->simd_strategy == "INTER")
+		{
+			if (this->implem == "GALA") return new module::Decoder_LDPC_BP_flooding_GALA_inter<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+			if (this->implem == "GALB") return new module::Decoder_LDPC_BP_flooding_GALB_inter<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+			if (this->implem == "GALE") return new module::Decoder_LDPC_BP_flooding_GALE_inter<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->enable_syndrome, this->syndrome_depth, this->n_frames);
+		}
 		else if (this->type == "BP_PEELING")
 		{
 			if (this->implem == "STD") return new module::Decoder_LDPC_BP_peeling<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->enable_syndrome, this->syndrome_depth, this->n_frames);
 		}
 		else if (this->type == "BIT_FLIPPING")
 		{
-		    if (this->implem == "PPBF") return new module::Decoder_LDPC_PPBF<B,Q>(this->K, this->N_cw, this->n_ite, H, info_bits_pos, this->ppbf_proba,  this->enable_syndrome, this->syndrome_depth, this->seed, this->n_frames);
+		    if (this->implem == "PPBF" && this->simd_strategy == "INTER") return new module::Decoder_LDPC_PPBF_inter<B,Q>(this->K, this->N_cw, this->n_ite, *H, info_bits_pos, this->ppbf_proba,  this->enable_syndrome, this->syndrome_depth, this->seed, this->n_frames);
+		    if (this->implem == "PPBF") return new module::Decoder_LDPC_PPBF<B,Q>(this->K, this->N_cw, this->n_ite, *H, info_bits_pos, this->ppbf_proba,  this->enable_syndrome, this->syndrome_depth, this->seed, this->n_frames);
 		}
 		return build_siso<B,Q>(H, info_bits_pos);
 	}
@@ -418,7 +486,8 @@ module::Decoder_SIHO<B,Q>* Decoder_LDPC::parameters
 
 template <typename B, typename Q>
 module::Decoder_SISO_SIHO<B,Q>* Decoder_LDPC
-::build_siso(const parameters& params, const tools::Sparse_matrix &H, const std::vector<unsigned> &info_bits_pos,
+::build_siso(const parameters& params, const std::shared_ptr<const tools::Sparse_matrix> &H,
+             const std::vector<unsigned> &info_bits_pos,
              const std::unique_ptr<module::Encoder<B>>& encoder)
 {
 	return params.template build_siso<B,Q>(H, info_bits_pos, encoder);
@@ -426,7 +495,8 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_LDPC
 
 template <typename B, typename Q>
 module::Decoder_SIHO<B,Q>* Decoder_LDPC
-::build(const parameters& params, const tools::Sparse_matrix &H, const std::vector<unsigned> &info_bits_pos,
+::build(const parameters& params, const std::shared_ptr<const tools::Sparse_matrix> &H,
+        const std::vector<unsigned> &info_bits_pos,
         const std::unique_ptr<module::Encoder<B>>& encoder)
 {
 	return params.template build<B,Q>(H, info_bits_pos, encoder);
@@ -435,31 +505,31 @@ module::Decoder_SIHO<B,Q>* Decoder_LDPC
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef AFF3CT_MULTI_PREC
-template aff3ct::module::Decoder_SISO_SIHO<B_8 ,Q_8 >* aff3ct::factory::Decoder_LDPC::parameters::build_siso<B_8 ,Q_8 >(const aff3ct::tools::Sparse_matrix&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_8 >>&) const;
-template aff3ct::module::Decoder_SISO_SIHO<B_16,Q_16>* aff3ct::factory::Decoder_LDPC::parameters::build_siso<B_16,Q_16>(const aff3ct::tools::Sparse_matrix&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_16>>&) const;
-template aff3ct::module::Decoder_SISO_SIHO<B_32,Q_32>* aff3ct::factory::Decoder_LDPC::parameters::build_siso<B_32,Q_32>(const aff3ct::tools::Sparse_matrix&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_32>>&) const;
-template aff3ct::module::Decoder_SISO_SIHO<B_64,Q_64>* aff3ct::factory::Decoder_LDPC::parameters::build_siso<B_64,Q_64>(const aff3ct::tools::Sparse_matrix&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_64>>&) const;
-template aff3ct::module::Decoder_SISO_SIHO<B_8 ,Q_8 >* aff3ct::factory::Decoder_LDPC::build_siso<B_8 ,Q_8 >(const aff3ct::factory::Decoder_LDPC::parameters&, const aff3ct::tools::Sparse_matrix&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_8 >>&);
-template aff3ct::module::Decoder_SISO_SIHO<B_16,Q_16>* aff3ct::factory::Decoder_LDPC::build_siso<B_16,Q_16>(const aff3ct::factory::Decoder_LDPC::parameters&, const aff3ct::tools::Sparse_matrix&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_16>>&);
-template aff3ct::module::Decoder_SISO_SIHO<B_32,Q_32>* aff3ct::factory::Decoder_LDPC::build_siso<B_32,Q_32>(const aff3ct::factory::Decoder_LDPC::parameters&, const aff3ct::tools::Sparse_matrix&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_32>>&);
-template aff3ct::module::Decoder_SISO_SIHO<B_64,Q_64>* aff3ct::factory::Decoder_LDPC::build_siso<B_64,Q_64>(const aff3ct::factory::Decoder_LDPC::parameters&, const aff3ct::tools::Sparse_matrix&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_64>>&);
+template aff3ct::module::Decoder_SISO_SIHO<B_8 ,Q_8 >* aff3ct::factory::Decoder_LDPC::parameters::build_siso<B_8 ,Q_8 >(const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_8 >>&) const;
+template aff3ct::module::Decoder_SISO_SIHO<B_16,Q_16>* aff3ct::factory::Decoder_LDPC::parameters::build_siso<B_16,Q_16>(const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_16>>&) const;
+template aff3ct::module::Decoder_SISO_SIHO<B_32,Q_32>* aff3ct::factory::Decoder_LDPC::parameters::build_siso<B_32,Q_32>(const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_32>>&) const;
+template aff3ct::module::Decoder_SISO_SIHO<B_64,Q_64>* aff3ct::factory::Decoder_LDPC::parameters::build_siso<B_64,Q_64>(const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_64>>&) const;
+template aff3ct::module::Decoder_SISO_SIHO<B_8 ,Q_8 >* aff3ct::factory::Decoder_LDPC::build_siso<B_8 ,Q_8 >(const aff3ct::factory::Decoder_LDPC::parameters&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_8 >>&);
+template aff3ct::module::Decoder_SISO_SIHO<B_16,Q_16>* aff3ct::factory::Decoder_LDPC::build_siso<B_16,Q_16>(const aff3ct::factory::Decoder_LDPC::parameters&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_16>>&);
+template aff3ct::module::Decoder_SISO_SIHO<B_32,Q_32>* aff3ct::factory::Decoder_LDPC::build_siso<B_32,Q_32>(const aff3ct::factory::Decoder_LDPC::parameters&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_32>>&);
+template aff3ct::module::Decoder_SISO_SIHO<B_64,Q_64>* aff3ct::factory::Decoder_LDPC::build_siso<B_64,Q_64>(const aff3ct::factory::Decoder_LDPC::parameters&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_64>>&);
 #else
-template aff3ct::module::Decoder_SISO_SIHO<B,Q>* aff3ct::factory::Decoder_LDPC::parameters::build_siso<B,Q>(const aff3ct::tools::Sparse_matrix&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B>>& ) const;
-template aff3ct::module::Decoder_SISO_SIHO<B,Q>* aff3ct::factory::Decoder_LDPC::build_siso<B,Q>(const aff3ct::factory::Decoder_LDPC::parameters&, const aff3ct::tools::Sparse_matrix&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B>>& );
+template aff3ct::module::Decoder_SISO_SIHO<B,Q>* aff3ct::factory::Decoder_LDPC::parameters::build_siso<B,Q>(const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B>>& ) const;
+template aff3ct::module::Decoder_SISO_SIHO<B,Q>* aff3ct::factory::Decoder_LDPC::build_siso<B,Q>(const aff3ct::factory::Decoder_LDPC::parameters&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B>>& );
 #endif
 
 #include "Tools/types.h"
 #ifdef AFF3CT_MULTI_PREC
-template aff3ct::module::Decoder_SIHO<B_8 ,Q_8 >* aff3ct::factory::Decoder_LDPC::parameters::build<B_8 ,Q_8 >(const aff3ct::tools::Sparse_matrix&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_8 >>&) const;
-template aff3ct::module::Decoder_SIHO<B_16,Q_16>* aff3ct::factory::Decoder_LDPC::parameters::build<B_16,Q_16>(const aff3ct::tools::Sparse_matrix&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_16>>&) const;
-template aff3ct::module::Decoder_SIHO<B_32,Q_32>* aff3ct::factory::Decoder_LDPC::parameters::build<B_32,Q_32>(const aff3ct::tools::Sparse_matrix&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_32>>&) const;
-template aff3ct::module::Decoder_SIHO<B_64,Q_64>* aff3ct::factory::Decoder_LDPC::parameters::build<B_64,Q_64>(const aff3ct::tools::Sparse_matrix&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_64>>&) const;
-template aff3ct::module::Decoder_SIHO<B_8 ,Q_8 >* aff3ct::factory::Decoder_LDPC::build<B_8 ,Q_8 >(const aff3ct::factory::Decoder_LDPC::parameters&, const aff3ct::tools::Sparse_matrix&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_8 >>&);
-template aff3ct::module::Decoder_SIHO<B_16,Q_16>* aff3ct::factory::Decoder_LDPC::build<B_16,Q_16>(const aff3ct::factory::Decoder_LDPC::parameters&, const aff3ct::tools::Sparse_matrix&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_16>>&);
-template aff3ct::module::Decoder_SIHO<B_32,Q_32>* aff3ct::factory::Decoder_LDPC::build<B_32,Q_32>(const aff3ct::factory::Decoder_LDPC::parameters&, const aff3ct::tools::Sparse_matrix&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_32>>&);
-template aff3ct::module::Decoder_SIHO<B_64,Q_64>* aff3ct::factory::Decoder_LDPC::build<B_64,Q_64>(const aff3ct::factory::Decoder_LDPC::parameters&, const aff3ct::tools::Sparse_matrix&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_64>>&);
+template aff3ct::module::Decoder_SIHO<B_8 ,Q_8 >* aff3ct::factory::Decoder_LDPC::parameters::build<B_8 ,Q_8 >(const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_8 >>&) const;
+template aff3ct::module::Decoder_SIHO<B_16,Q_16>* aff3ct::factory::Decoder_LDPC::parameters::build<B_16,Q_16>(const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_16>>&) const;
+template aff3ct::module::Decoder_SIHO<B_32,Q_32>* aff3ct::factory::Decoder_LDPC::parameters::build<B_32,Q_32>(const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_32>>&) const;
+template aff3ct::module::Decoder_SIHO<B_64,Q_64>* aff3ct::factory::Decoder_LDPC::parameters::build<B_64,Q_64>(const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_64>>&) const;
+template aff3ct::module::Decoder_SIHO<B_8 ,Q_8 >* aff3ct::factory::Decoder_LDPC::build<B_8 ,Q_8 >(const aff3ct::factory::Decoder_LDPC::parameters&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_8 >>&);
+template aff3ct::module::Decoder_SIHO<B_16,Q_16>* aff3ct::factory::Decoder_LDPC::build<B_16,Q_16>(const aff3ct::factory::Decoder_LDPC::parameters&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_16>>&);
+template aff3ct::module::Decoder_SIHO<B_32,Q_32>* aff3ct::factory::Decoder_LDPC::build<B_32,Q_32>(const aff3ct::factory::Decoder_LDPC::parameters&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_32>>&);
+template aff3ct::module::Decoder_SIHO<B_64,Q_64>* aff3ct::factory::Decoder_LDPC::build<B_64,Q_64>(const aff3ct::factory::Decoder_LDPC::parameters&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B_64>>&);
 #else
-template aff3ct::module::Decoder_SIHO<B,Q>* aff3ct::factory::Decoder_LDPC::parameters::build<B,Q>(const aff3ct::tools::Sparse_matrix&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B>>& ) const;
-template aff3ct::module::Decoder_SIHO<B,Q>* aff3ct::factory::Decoder_LDPC::build<B,Q>(const aff3ct::factory::Decoder_LDPC::parameters&, const aff3ct::tools::Sparse_matrix&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B>>& );
+template aff3ct::module::Decoder_SIHO<B,Q>* aff3ct::factory::Decoder_LDPC::parameters::build<B,Q>(const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B>>& ) const;
+template aff3ct::module::Decoder_SIHO<B,Q>* aff3ct::factory::Decoder_LDPC::build<B,Q>(const aff3ct::factory::Decoder_LDPC::parameters&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::vector<unsigned>&, const std::unique_ptr<module::Encoder<B>>& );
 #endif
 // ==================================================================================== explicit template instantiation
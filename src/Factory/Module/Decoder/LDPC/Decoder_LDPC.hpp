@@ -1,6 +1,7 @@
 #ifndef FACTORY_DECODER_LDPC_HPP
 #define FACTORY_DECODER_LDPC_HPP
 
+#include <memory>
 #include <vector>
 #include <string>
 
@@ -35,8 +36,10 @@ struct Decoder_LDPC : public Decoder
 		float       offset          = 0.f;
 		float       mwbf_factor     = 1.f;
 		bool        enable_syndrome = true;
+		bool        compact_msg     = false;
 		int         syndrome_depth  = 1;
 		int         n_ite           = 10;
+		int         qnt_decimals    = 2; // fractional bits of the quantized LLRs (set from the quantizer parameters)
 
 		std::vector<float> ppbf_proba;
 
@@ -52,24 +55,25 @@ struct Decoder_LDPC : public Decoder
 
 		// builder
 		template <typename B = int, typename Q = float>
-		module::Decoder_SIHO<B,Q>* build(const tools::Sparse_matrix &H,
+		module::Decoder_SIHO<B,Q>* build(const std::shared_ptr<const tools::Sparse_matrix> &H,
 		                                 const std::vector<unsigned> &info_bits_pos,
 		                                 const std::unique_ptr<module::Encoder<B>>& encoder = nullptr) const;
 
 		template <typename B = int, typename Q = float>
-		module::Decoder_SISO_SIHO<B,Q>* build_siso(const tools::Sparse_matrix &H,
+		module::Decoder_SISO_SIHO<B,Q>* build_siso(const std::shared_ptr<const tools::Sparse_matrix> &H,
 		                                           const std::vector<unsigned> &info_bits_pos,
 		                                           const std::unique_ptr<module::Encoder<B>>& encoder = nullptr) const;
 	};
 
 	template <typename B = int, typename Q = float>
-	static module::Decoder_SIHO<B,Q>* build(const parameters& params, const tools::Sparse_matrix &H,
+	static module::Decoder_SIHO<B,Q>* build(const parameters& params,
+	                                        const std::shared_ptr<const tools::Sparse_matrix> &H,
 	                                        const std::vector<unsigned> &info_bits_pos,
 	                                        const std::unique_ptr<module::Encoder<B>>& encoder = nullptr);
 
 	template <typename B = int, typename Q = float>
 	static module::Decoder_SISO_SIHO<B,Q>* build_siso(const parameters& params,
-	                                                  const tools::Sparse_matrix &H,
+	                                                  const std::shared_ptr<const tools::Sparse_matrix> &H,
 	                                                  const std::vector<unsigned> &info_bits_pos,
 	                                                  const std::unique_ptr<module::Encoder<B>>& encoder = nullptr);
 };
@@ -6,8 +6,10 @@
 #include "Module/Decoder/Polar/SC/Decoder_polar_SC_fast_sys.hpp"
 #include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_naive.hpp"
 #include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_naive_sys.hpp"
+#include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_fast_sys.hpp"
 #include "Module/Decoder/Polar/SCF/Decoder_polar_SCF_naive.hpp"
 #include "Module/Decoder/Polar/SCF/Decoder_polar_SCF_naive_sys.hpp"
+#include "Module/Decoder/Polar/SCF/Decoder_polar_SCF_fast_sys.hpp"
 #include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_naive.hpp"
 #include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_naive_sys.hpp"
 #include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_fast_sys.hpp"
@@ -96,6 +98,9 @@ void Decoder_polar::parameters
 
 	tools::add_arg(args, p, class_name+"p+no-sys",
 		tools::None());
+
+	tools::add_arg(args, p, class_name+"p+early-term",
+		tools::None());
 }
 
 void Decoder_polar::parameters
@@ -110,6 +115,7 @@ void Decoder_polar::parameters
 	if(vals.exist({p+"-simd"            })) this->simd_strategy = vals.at    ({p+"-simd"       });
 	if(vals.exist({p+"-polar-nodes"     })) this->polar_nodes   = vals.at    ({p+"-polar-nodes"});
 	if(vals.exist({p+"-partial-adaptive"})) this->full_adaptive = false;
+	if(vals.exist({p+"-early-term"      })) this->early_term    = true;
 
 	// force 1 iteration max if not SCAN (and polar code)
 	if (this->type != "SCAN") this->n_ite = 1;
@@ -128,7 +134,11 @@ void Decoder_polar::parameters
 			headers[p].push_back(std::make_pair("SIMD strategy", this->simd_strategy));
 
 		if (this->type == "SCAN")
+		{
 			headers[p].push_back(std::make_pair("Num. of iterations (i)", std::to_string(this->n_ite)));
+			if (this->implem == "FAST")
+				headers[p].push_back(std::make_pair("Early termination", this->early_term ? "on" : "off"));
+		}
 
 		if (this->type == "SCF")
 			headers[p].push_back(std::make_pair("Num. of flips", std::to_string(this->flips)));
@@ -144,6 +154,8 @@ void Decoder_polar::parameters
 		}
 
 		if ((this->type == "SC"      ||
+		     this->type == "SCAN"    ||
+		     this->type == "SCF"     ||
 		     this->type == "SCL"     ||
 		     this->type == "ASCL"    ||
 		     this->type == "SCL_MEM" ||
@@ -159,6 +171,27 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_polar::parameters
 	if (this->type == "SCAN" && this->systematic)
 	{
 		if (this->implem == "NAIVE") return new module::Decoder_polar_SCAN_naive_sys<B, Q, tools::f_LLR<Q>, tools::v_LLR<Q>, tools::h_LLR<B,Q>>(this->K, this->N_cw, this->n_ite, frozen_bits, this->n_frames);
+		if (this->implem == "FAST")
+		{
+			if (this->simd_strategy == "INTER")
+			{
+#ifdef API_POLAR_DYNAMIC
+				using API_polar = tools::API_polar_dynamic_inter<B,Q>;
+#else
+				using API_polar = tools::API_polar_static_inter<B,Q>;
+#endif
+				return _build_scan_fast<B,Q,API_polar>(frozen_bits, encoder);
+			}
+			else if (this->simd_strategy == "INTRA")
+			{
+				if (typeid(B) == typeid(signed char) || typeid(B) == typeid(short) || typeid(B) == typeid(int))
+					return _build_scan_fast<B,Q,tools::API_polar_dynamic_intra<B,Q>>(frozen_bits, encoder);
+			}
+			else if (this->simd_strategy.empty())
+			{
+				return _build_scan_fast<B,Q,tools::API_polar_dynamic_seq<B,Q>>(frozen_bits, encoder);
+			}
+		}
 	}
 	else if (this->type == "SCAN" && !this->systematic)
 	{
@@ -168,6 +201,16 @@ module::Decoder_SISO_SIHO<B,Q>* Decoder_polar::parameters
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 }
 
+template <typename B, typename Q, class API_polar>
+module::Decoder_SISO_SIHO<B,Q>* Decoder_polar::parameters
+::_build_scan_fast(const std::vector<bool> &frozen_bits, const std::unique_ptr<module::Encoder<B>>& encoder) const
+{
+	int idx_r0, idx_r1;
+	auto polar_patterns = tools::Nodes_parser<>::parse_uptr(this->polar_nodes, idx_r0, idx_r1);
+
+	return new module::Decoder_polar_SCAN_fast_sys<B, Q, API_polar>(this->K, this->N_cw, this->n_ite, frozen_bits, std::move(polar_patterns), idx_r0, idx_r1, this->early_term, this->n_frames);
+}
+
 template <typename B, typename Q, class API_polar>
 module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
 ::_build(const std::vector<bool> &frozen_bits, module::CRC<B> *crc, const std::unique_ptr<module::Encoder<B>>& encoder) const
@@ -245,6 +288,21 @@ module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 }
 
+template <typename B, typename Q, class API_polar>
+module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
+::_build_scf_fast(const std::vector<bool> &frozen_bits, module::CRC<B> *crc, const std::unique_ptr<module::Encoder<B>>& encoder) const
+{
+	if (this->implem == "FAST" && this->systematic && crc != nullptr && crc->get_size() > 0)
+	{
+		int idx_r0, idx_r1;
+		auto polar_patterns = tools::Nodes_parser<>::parse_uptr(this->polar_nodes, idx_r0, idx_r1);
+
+		if (this->type == "SCF") return new module::Decoder_polar_SCF_fast_sys<B, Q, API_polar>(this->K, this->N_cw, frozen_bits, std::move(polar_patterns), idx_r0, idx_r1, *crc, this->flips, this->n_frames);
+	}
+
+	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
+}
+
 template <typename B, typename Q>
 module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
 ::build(const std::vector<bool> &frozen_bits, module::CRC<B> *crc, const std::unique_ptr<module::Encoder<B>>& encoder) const
@@ -255,6 +313,9 @@ module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
 	}
 	catch (tools::cannot_allocate const&)
 	{
+		if (this->type == "SCAN" && this->implem == "FAST" && (crc == nullptr || crc->get_size() == 0))
+			return this->template build_siso<B,Q>(frozen_bits, encoder);
+
 		if (this->type.find("SCL") != std::string::npos && this->implem == "FAST")
 		{
 			if (this->simd_strategy == "INTRA")
@@ -278,6 +339,19 @@ module::Decoder_SIHO<B,Q>* Decoder_polar::parameters
 			}
 		}
 
+		if (this->type == "SCF" && this->implem == "FAST")
+		{
+			if (this->simd_strategy == "INTRA")
+			{
+				if (typeid(B) == typeid(signed char) || typeid(B) == typeid(short) || typeid(B) == typeid(int))
+					return _build_scf_fast<B,Q,tools::API_polar_dynamic_intra<B,Q>>(frozen_bits, crc, encoder);
+			}
+			else if (this->simd_strategy.empty())
+			{
+				return _build_scf_fast<B,Q,tools::API_polar_dynamic_seq<B,Q>>(frozen_bits, crc, encoder);
+			}
+		}
+
 		if (this->simd_strategy == "INTER" && this->type == "SC" && this->implem == "FAST")
 		{
 			if (typeid(B) == typeid(signed char))
@@ -28,6 +28,7 @@ struct Decoder_polar : public Decoder
 		std::string simd_strategy = "";
 		std::string polar_nodes   = "{R0,R0L,R1,REP,REPL,SPC}";
 		bool        full_adaptive = true;
+		bool        early_term    = false;
 		int         n_ite         = 1;
 		int         L             = 8;
 		int         T             = 8;
@@ -65,6 +66,15 @@ struct Decoder_polar : public Decoder
 		                                           module::CRC<B> *crc = nullptr,
 		                                           const std::unique_ptr<module::Encoder<B>>& encoder = nullptr) const;
 
+		template <typename B = int, typename Q = float, class API_polar>
+		module::Decoder_SIHO<B,Q>* _build_scf_fast(const std::vector<bool> &frozen_bits,
+		                                           module::CRC<B> *crc = nullptr,
+		                                           const std::unique_ptr<module::Encoder<B>>& encoder = nullptr) const;
+
+		template <typename B = int, typename Q = float, class API_polar>
+		module::Decoder_SISO_SIHO<B,Q>* _build_scan_fast(const std::vector<bool> &frozen_bits,
+		                                                 const std::unique_ptr<module::Encoder<B>>& encoder = nullptr) const;
+
 		template <typename B = int, typename Q = float, class API_polar>
 		module::Decoder_SIHO<B,Q>* _build_gen(module::CRC<B> *crc = nullptr,
 		                                      const std::unique_ptr<module::Encoder<B>>& encoder = nullptr) const;
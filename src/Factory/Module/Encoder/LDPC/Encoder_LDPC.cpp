@@ -121,7 +121,7 @@ void Encoder_LDPC::parameters
 
 template <typename B>
 module::Encoder_LDPC<B>* Encoder_LDPC::parameters
-::build(const tools::Sparse_matrix &G, const tools::Sparse_matrix &H) const
+::build(const std::shared_ptr<const tools::Sparse_matrix> &G, const std::shared_ptr<const tools::Sparse_matrix> &H) const
 {
 	if (this->type == "LDPC"    ) return new module::Encoder_LDPC         <B>(this->K, this->N_cw, G, this->n_frames);
 	if (this->type == "LDPC_H"  ) return new module::Encoder_LDPC_from_H  <B>(this->K, this->N_cw, H, this->G_method, this->G_save_path, this->n_frames);
@@ -133,7 +133,8 @@ module::Encoder_LDPC<B>* Encoder_LDPC::parameters
 
 template <typename B>
 module::Encoder_LDPC<B>* Encoder_LDPC::parameters
-::build(const tools::Sparse_matrix &G, const tools::Sparse_matrix &H, const tools::dvbs2_values& dvbs2) const
+::build(const std::shared_ptr<const tools::Sparse_matrix> &G, const std::shared_ptr<const tools::Sparse_matrix> &H,
+        const tools::dvbs2_values& dvbs2) const
 {
 	if (this->type == "LDPC_DVBS2") return new module::Encoder_LDPC_DVBS2<B>(dvbs2, this->n_frames);
 
@@ -142,18 +143,18 @@ module::Encoder_LDPC<B>* Encoder_LDPC::parameters
 
 template <typename B>
 module::Encoder_LDPC<B>* Encoder_LDPC
-::build(const parameters           &params,
-        const tools::Sparse_matrix &G,
-        const tools::Sparse_matrix &H)
+::build(const parameters                                  &params,
+        const std::shared_ptr<const tools::Sparse_matrix> &G,
+        const std::shared_ptr<const tools::Sparse_matrix> &H)
 {
 	return params.template build<B>(G, H);
 }
 
 template <typename B>
 module::Encoder_LDPC<B>* Encoder_LDPC
-::build(const parameters           &params,
-        const tools::Sparse_matrix &G,
-        const tools::Sparse_matrix &H,
+::build(const parameters                                  &params,
+        const std::shared_ptr<const tools::Sparse_matrix> &G,
+        const std::shared_ptr<const tools::Sparse_matrix> &H,
         const tools::dvbs2_values& dvbs2)
 {
 	return params.template build<B>(G, H, dvbs2);
@@ -162,28 +163,28 @@ module::Encoder_LDPC<B>* Encoder_LDPC
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef AFF3CT_MULTI_PREC
-template aff3ct::module::Encoder_LDPC<B_8 >* aff3ct::factory::Encoder_LDPC::parameters::build<B_8 >(const aff3ct::tools::Sparse_matrix&, const aff3ct::tools::Sparse_matrix&) const;
-template aff3ct::module::Encoder_LDPC<B_16>* aff3ct::factory::Encoder_LDPC::parameters::build<B_16>(const aff3ct::tools::Sparse_matrix&, const aff3ct::tools::Sparse_matrix&) const;
-template aff3ct::module::Encoder_LDPC<B_32>* aff3ct::factory::Encoder_LDPC::parameters::build<B_32>(const aff3ct::tools::Sparse_matrix&, const aff3ct::tools::Sparse_matrix&) const;
-template aff3ct::module::Encoder_LDPC<B_64>* aff3ct::factory::Encoder_LDPC::parameters::build<B_64>(const aff3ct::tools::Sparse_matrix&, const aff3ct::tools::Sparse_matrix&) const;
-template aff3ct::module::Encoder_LDPC<B_8 >* aff3ct::factory::Encoder_LDPC::build<B_8 >(const aff3ct::factory::Encoder_LDPC::parameters&, const aff3ct::tools::Sparse_matrix&, const aff3ct::tools::Sparse_matrix&);
-template aff3ct::module::Encoder_LDPC<B_16>* aff3ct::factory::Encoder_LDPC::build<B_16>(const aff3ct::factory::Encoder_LDPC::parameters&, const aff3ct::tools::Sparse_matrix&, const aff3ct::tools::Sparse_matrix&);
-template aff3ct::module::Encoder_LDPC<B_32>* aff3ct::factory::Encoder_LDPC::build<B_32>(const aff3ct::factory::Encoder_LDPC::parameters&, const aff3ct::tools::Sparse_matrix&, const aff3ct::tools::Sparse_matrix&);
-template aff3ct::module::Encoder_LDPC<B_64>* aff3ct::factory::Encoder_LDPC::build<B_64>(const aff3ct::factory::Encoder_LDPC::parameters&, const aff3ct::tools::Sparse_matrix&, const aff3ct::tools::Sparse_matrix&);
-
-template aff3ct::module::Encoder_LDPC<B_8 >* aff3ct::factory::Encoder_LDPC::parameters::build<B_8 >(const aff3ct::tools::Sparse_matrix&, const aff3ct::tools::Sparse_matrix&, const tools::dvbs2_values&) const;
-template aff3ct::module::Encoder_LDPC<B_16>* aff3ct::factory::Encoder_LDPC::parameters::build<B_16>(const aff3ct::tools::Sparse_matrix&, const aff3ct::tools::Sparse_matrix&, const tools::dvbs2_values&) const;
-template aff3ct::module::Encoder_LDPC<B_32>* aff3ct::factory::Encoder_LDPC::parameters::build<B_32>(const aff3ct::tools::Sparse_matrix&, const aff3ct::tools::Sparse_matrix&, const tools::dvbs2_values&) const;
-template aff3ct::module::Encoder_LDPC<B_64>* aff3ct::factory::Encoder_LDPC::parameters::build<B_64>(const aff3ct::tools::Sparse_matrix&, const aff3ct::tools::Sparse_matrix&, const tools::dvbs2_values&) const;
-template aff3ct::module::Encoder_LDPC<B_8 >* aff3ct::factory::Encoder_LDPC::build<B_8 >(const aff3ct::factory::Encoder_LDPC::parameters&, const aff3ct::tools::Sparse_matrix&, const aff3ct::tools::Sparse_matrix&, const tools::dvbs2_values&);
-template aff3ct::module::Encoder_LDPC<B_16>* aff3ct::factory::Encoder_LDPC::build<B_16>(const aff3ct::factory::Encoder_LDPC::parameters&, const aff3ct::tools::Sparse_matrix&, const aff3ct::tools::Sparse_matrix&, const tools::dvbs2_values&);
-template aff3ct::module::Encoder_LDPC<B_32>* aff3ct::factory::Encoder_LDPC::build<B_32>(const aff3ct::factory::Encoder_LDPC::parameters&, const aff3ct::tools::Sparse_matrix&, const aff3ct::tools::Sparse_matrix&, const tools::dvbs2_values&);
-template aff3ct::module::Encoder_LDPC<B_64>* aff3ct::factory::Encoder_LDPC::build<B_64>(const aff3ct::factory::Encoder_LDPC::parameters&, const aff3ct::tools::Sparse_matrix&, const aff3ct::tools::Sparse_matrix&, const tools::dvbs2_values&);
+template aff3ct::module::Encoder_LDPC<B_8 >* aff3ct::factory::Encoder_LDPC::parameters::build<B_8 >(const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&) const;
+template aff3ct::module::Encoder_LDPC<B_16>* aff3ct::factory::Encoder_LDPC::parameters::build<B_16>(const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&) const;
+template aff3ct::module::Encoder_LDPC<B_32>* aff3ct::factory::Encoder_LDPC::parameters::build<B_32>(const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&) const;
+template aff3ct::module::Encoder_LDPC<B_64>* aff3ct::factory::Encoder_LDPC::parameters::build<B_64>(const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&) const;
+template aff3ct::module::Encoder_LDPC<B_8 >* aff3ct::factory::Encoder_LDPC::build<B_8 >(const aff3ct::factory::Encoder_LDPC::parameters&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&);
+template aff3ct::module::Encoder_LDPC<B_16>* aff3ct::factory::Encoder_LDPC::build<B_16>(const aff3ct::factory::Encoder_LDPC::parameters&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&);
+template aff3ct::module::Encoder_LDPC<B_32>* aff3ct::factory::Encoder_LDPC::build<B_32>(const aff3ct::factory::Encoder_LDPC::parameters&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&);
+template aff3ct::module::Encoder_LDPC<B_64>* aff3ct::factory::Encoder_LDPC::build<B_64>(const aff3ct::factory::Encoder_LDPC::parameters&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&);
+
+template aff3ct::module::Encoder_LDPC<B_8 >* aff3ct::factory::Encoder_LDPC::parameters::build<B_8 >(const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const tools::dvbs2_values&) const;
+template aff3ct::module::Encoder_LDPC<B_16>* aff3ct::factory::Encoder_LDPC::parameters::build<B_16>(const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const tools::dvbs2_values&) const;
+template aff3ct::module::Encoder_LDPC<B_32>* aff3ct::factory::Encoder_LDPC::parameters::build<B_32>(const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const tools::dvbs2_values&) const;
+template aff3ct::module::Encoder_LDPC<B_64>* aff3ct::factory::Encoder_LDPC::parameters::build<B_64>(const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const tools::dvbs2_values&) const;
+template aff3ct::module::Encoder_LDPC<B_8 >* aff3ct::factory::Encoder_LDPC::build<B_8 >(const aff3ct::factory::Encoder_LDPC::parameters&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const tools::dvbs2_values&);
+template aff3ct::module::Encoder_LDPC<B_16>* aff3ct::factory::Encoder_LDPC::build<B_16>(const aff3ct::factory::Encoder_LDPC::parameters&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const tools::dvbs2_values&);
+template aff3ct::module::Encoder_LDPC<B_32>* aff3ct::factory::Encoder_LDPC::build<B_32>(const aff3ct::factory::Encoder_LDPC::parameters&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const tools::dvbs2_values&);
+template aff3ct::module::Encoder_LDPC<B_64>* aff3ct::factory::Encoder_LDPC::build<B_64>(const aff3ct::factory::Encoder_LDPC::parameters&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const tools::dvbs2_values&);
 #else
-template aff3ct::module::Encoder_LDPC<B>* aff3ct::factory::Encoder_LDPC::parameters::build<B>(const aff3ct::tools::Sparse_matrix&, const aff3ct::tools::Sparse_matrix&) const;
-template aff3ct::module::Encoder_LDPC<B>* aff3ct::factory::Encoder_LDPC::build<B>(const aff3ct::factory::Encoder_LDPC::parameters&, const aff3ct::tools::Sparse_matrix&, const aff3ct::tools::Sparse_matrix&);
+template aff3ct::module::Encoder_LDPC<B>* aff3ct::factory::Encoder_LDPC::parameters::build<B>(const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&) const;
+template aff3ct::module::Encoder_LDPC<B>* aff3ct::factory::Encoder_LDPC::build<B>(const aff3ct::factory::Encoder_LDPC::parameters&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&);
 
-template aff3ct::module::Encoder_LDPC<B>* aff3ct::factory::Encoder_LDPC::parameters::build<B>(const aff3ct::tools::Sparse_matrix&, const aff3ct::tools::Sparse_matrix&, const tools::dvbs2_values&) const;
-template aff3ct::module::Encoder_LDPC<B>* aff3ct::factory::Encoder_LDPC::build<B>(const aff3ct::factory::Encoder_LDPC::parameters&, const aff3ct::tools::Sparse_matrix&, const aff3ct::tools::Sparse_matrix&, const tools::dvbs2_values&);
+template aff3ct::module::Encoder_LDPC<B>* aff3ct::factory::Encoder_LDPC::parameters::build<B>(const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const tools::dvbs2_values&) const;
+template aff3ct::module::Encoder_LDPC<B>* aff3ct::factory::Encoder_LDPC::build<B>(const aff3ct::factory::Encoder_LDPC::parameters&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const std::shared_ptr<const aff3ct::tools::Sparse_matrix>&, const tools::dvbs2_values&);
 #endif
 // ==================================================================================== explicit template instantiation
@@ -45,19 +45,23 @@ struct Encoder_LDPC : public Encoder
 
 		// builder
 		template <typename B = int>
-		module::Encoder_LDPC<B>* build(const tools::Sparse_matrix &G, const tools::Sparse_matrix &H) const;
+		module::Encoder_LDPC<B>* build(const std::shared_ptr<const tools::Sparse_matrix> &G,
+		                               const std::shared_ptr<const tools::Sparse_matrix> &H) const;
 		template <typename B = int>
-		module::Encoder_LDPC<B>* build(const tools::Sparse_matrix &G, const tools::Sparse_matrix &H,
+		module::Encoder_LDPC<B>* build(const std::shared_ptr<const tools::Sparse_matrix> &G,
+		                               const std::shared_ptr<const tools::Sparse_matrix> &H,
 		                               const tools::dvbs2_values& dvbs2) const;
 	};
 
 	template <typename B = int>
-	static module::Encoder_LDPC<B>* build(const parameters &params, const tools::Sparse_matrix &G,
-	                                                                const tools::Sparse_matrix &H);
+	static module::Encoder_LDPC<B>* build(const parameters &params,
+	                                      const std::shared_ptr<const tools::Sparse_matrix> &G,
+	                                      const std::shared_ptr<const tools::Sparse_matrix> &H);
 	template <typename B = int>
-	static module::Encoder_LDPC<B>* build(const parameters &params, const tools::Sparse_matrix &G,
-	                                                                const tools::Sparse_matrix &H,
-	                                                                const tools::dvbs2_values& dvbs2);
+	static module::Encoder_LDPC<B>* build(const parameters &params,
+	                                      const std::shared_ptr<const tools::Sparse_matrix> &G,
+	                                      const std::shared_ptr<const tools::Sparse_matrix> &H,
+	                                      const tools::dvbs2_values& dvbs2);
 };
 }
 }
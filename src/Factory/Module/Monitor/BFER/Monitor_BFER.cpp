@@ -1,3 +1,5 @@
+#include <memory>
+
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Documentation/documentation.h"
 
@@ -50,6 +52,18 @@ void Monitor_BFER::parameters
 
 	tools::add_arg(args, p, class_name+"p+err-hist-path",
 		tools::File(tools::openmode::write));
+
+	tools::add_arg(args, p, class_name+"p+ci-width",
+		tools::Real(tools::Positive(), tools::Non_zero()));
+
+	tools::add_arg(args, p, class_name+"p+ci-level",
+		tools::Real(tools::Positive(), tools::Non_zero(), tools::Max(0.9999f)));
+
+	tools::add_arg(args, p, class_name+"p+ci-method",
+		tools::Text(tools::Including_set("WILSON", "CP")));
+
+	tools::add_arg(args, p, class_name+"p+ci-min-fe",
+		tools::Integer(tools::Positive(), tools::Non_zero()));
 }
 
 void Monitor_BFER::parameters
@@ -65,6 +79,10 @@ void Monitor_BFER::parameters
 	if(vals.exist({p+"-err-hist"      })) this->err_hist       = vals.to_int({p+"-err-hist"      });
 	if(vals.exist({p+"-err-hist-path" })) this->err_hist_path  = vals.at    ({p+"-err-hist-path" });
 	if(vals.exist({p+"-max-fra",   "n"})) this->max_frame      = vals.to_int({p+"-max-fra",   "n"});
+	if(vals.exist({p+"-ci-width"      })) this->ci_width       = vals.to_float({p+"-ci-width"   });
+	if(vals.exist({p+"-ci-level"      })) this->ci_level       = vals.to_float({p+"-ci-level"   });
+	if(vals.exist({p+"-ci-method"     })) this->ci_method      = vals.at      ({p+"-ci-method"  });
+	if(vals.exist({p+"-ci-min-fe"     })) this->ci_min_fe      = vals.to_int  ({p+"-ci-min-fe"  });
 }
 
 void Monitor_BFER::parameters
@@ -75,6 +93,13 @@ void Monitor_BFER::parameters
 	auto p = this->get_prefix();
 
 	headers[p].push_back(std::make_pair("Frame error count (e)", std::to_string(this->n_frame_errors)));
+	if (this->ci_width != 0.f)
+	{
+		headers[p].push_back(std::make_pair("Confidence interval width", std::to_string(this->ci_width)));
+		headers[p].push_back(std::make_pair("Confidence level", std::to_string(this->ci_level)));
+		headers[p].push_back(std::make_pair("Confidence interval method", this->ci_method));
+		headers[p].push_back(std::make_pair("Confidence min frame errors", std::to_string(this->ci_min_fe)));
+	}
 	if (full) headers[p].push_back(std::make_pair("Size (K)",          std::to_string(this->K       )));
 	if (full) headers[p].push_back(std::make_pair("Inter frame level", std::to_string(this->n_frames)));
 
@@ -86,7 +111,15 @@ template <typename B>
 module::Monitor_BFER<B>* Monitor_BFER::parameters
 ::build(bool count_unknown_values) const
 {
-	if (this->type == "STD") return new module::Monitor_BFER<B>(this->K, this->n_frame_errors, this->max_frame, count_unknown_values, this->n_frames);
+	if (this->type == "STD")
+	{
+		std::unique_ptr<module::Monitor_BFER<B>> mnt(
+			new module::Monitor_BFER<B>(this->K, this->n_frame_errors, this->max_frame, count_unknown_values, this->n_frames));
+		mnt->set_ci_criterion(this->ci_width, this->ci_level, this->ci_method == "CP" ? tools::CI_method::CLOPPER_PEARSON
+		                                                                             : tools::CI_method::WILSON,
+		                      (unsigned)this->ci_min_fe);
+		return mnt.release();
+	}
 
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 }
@@ -25,10 +25,14 @@ struct Monitor_BFER : public Monitor
 		// optional parameters
 		std::string type           = "STD";
 		std::string err_hist_path  = "hist";
+		std::string ci_method      = "WILSON";
 		int         err_hist       = -1;
 		int         n_frame_errors = 100;
 		int         max_frame      = 0;
 		int         n_frames       = 1;
+		float       ci_width       = 0.f;
+		float       ci_level       = 0.95f;
+		int         ci_min_fe      = 10;
 
 		// ---------------------------------------------------------------------------------------------------- METHODS
 		explicit parameters(const std::string &p = Monitor_BFER_prefix);
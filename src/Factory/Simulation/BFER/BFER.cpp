@@ -2,6 +2,7 @@
 
 #include "Tools/Documentation/documentation.h"
 #include "Tools/Math/utils.h"
+#include "Tools/Exception/exception.hpp"
 
 #include "BFER.hpp"
 
@@ -113,6 +114,18 @@ void BFER::parameters
 	tools::add_arg(args, p, class_name+"p+coded",
 		tools::None());
 
+	tools::add_arg(args, p, class_name+"p+chk-path",
+		tools::File(tools::openmode::read_write),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+chk-freq",
+		tools::Integer(tools::Positive(), tools::Non_zero()),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+resume",
+		tools::None(),
+		tools::arg_rank::ADV);
+
 	auto pter = ter->get_prefix();
 
 	tools::add_arg(args, pter, class_name+"p+sigma",
@@ -126,6 +139,9 @@ void BFER::parameters
 #ifdef AFF3CT_MPI
 	tools::add_arg(args, pmnt, class_name+"p+mpi-comm-freq",
 		tools::Integer(tools::Positive(), tools::Non_zero()));
+
+	tools::add_arg(args, pmnt, class_name+"p+mpi-async",
+		tools::None());
 #else
 	tools::add_arg(args, pmnt, class_name+"p+red-lazy",
 		tools::None());
@@ -154,6 +170,12 @@ void BFER::parameters
 	if(vals.exist({p+"-err-trk"      })) this->err_track_enable    = true;
 	if(vals.exist({p+"-coset",    "c"})) this->coset               = true;
 	if(vals.exist({p+"-coded",       })) this->coded_monitoring    = true;
+	if(vals.exist({p+"-chk-path"     })) this->chk_path            = vals.to_file({p+"-chk-path"});
+	if(vals.exist({p+"-chk-freq"     })) this->chk_freq            = seconds(vals.to_int({p+"-chk-freq"}));
+	if(vals.exist({p+"-resume"       })) this->resume              = true;
+
+	if (this->resume && this->chk_path.empty())
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "The resume requires a checkpoint file.");
 
 	if (this->err_track_revert)
 	{
@@ -171,6 +193,7 @@ void BFER::parameters
 
 #ifdef AFF3CT_MPI
 	if(vals.exist({pmnt+"-mpi-comm-freq"})) this->mnt_mpi_comm_freq = milliseconds(vals.to_int({pmnt+"-mpi-comm-freq"}));
+	if(vals.exist({pmnt+"-mpi-async"    })) this->mnt_mpi_async     = true;
 #else
 	if(vals.exist({pmnt+"-red-lazy"})) this->mnt_red_lazy = true;
 	if(vals.exist({pmnt+"-red-lazy-freq"}))
@@ -197,6 +220,7 @@ void BFER::parameters
 	std::string pmnt = mnt_er->get_prefix();
 #ifdef AFF3CT_MPI
 	headers[pmnt].push_back(std::make_pair("MPI comm. freq. (ms)", std::to_string(this->mnt_mpi_comm_freq.count())));
+	headers[pmnt].push_back(std::make_pair("MPI async. reduction", this->mnt_mpi_async ? "on" : "off"));
 #else
 	headers[pmnt].push_back(std::make_pair("Lazy reduction", this->mnt_red_lazy ? "on" : "off"));
 	if (this->mnt_red_lazy)
@@ -222,6 +246,13 @@ void BFER::parameters
 		headers[p].push_back(std::make_pair("Bad frames base path", path));
 	}
 
+	if (!this->chk_path.empty())
+	{
+		headers[p].push_back(std::make_pair("Checkpoint path", this->chk_path));
+		headers[p].push_back(std::make_pair("Checkpoint freq. (s)", std::to_string(this->chk_freq.count())));
+		headers[p].push_back(std::make_pair("Resume", this->resume ? "yes" : "no"));
+	}
+
 	if (this->src != nullptr && this->cdc != nullptr)
 	{
 		const auto bit_rate = (float)this->src->K / (float)this->cdc->N;
@@ -29,6 +29,7 @@ struct BFER : Simulation
 		// ------------------------------------------------------------------------------------------------- PARAMETERS
 		// optional parameters
 		std::string err_track_path      = "error_tracker";
+		std::string chk_path            = "";
 		int         err_track_threshold = 0;
 		bool        err_track_revert    = false;
 		bool        err_track_enable    = false;
@@ -36,9 +37,13 @@ struct BFER : Simulation
 		bool        coded_monitoring    = false;
 		bool        ter_sigma           = false;
 		bool        mnt_mutinfo         = false;
+		bool        resume              = false;
+
+		std::chrono::seconds chk_freq = std::chrono::seconds(600);
 
 #ifdef AFF3CT_MPI
 		std::chrono::milliseconds mnt_mpi_comm_freq = std::chrono::milliseconds(1000);
+		bool                      mnt_mpi_async     = false;
 #else
 		std::chrono::milliseconds mnt_red_lazy_freq = std::chrono::milliseconds(0);
 		bool                      mnt_red_lazy      = false;
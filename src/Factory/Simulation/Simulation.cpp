@@ -77,9 +77,33 @@ void Simulation::parameters
 	tools::add_arg(args, p, class_name+"p+stats",
 		tools::None());
 
+	tools::add_arg(args, p, class_name+"p+hw-counters",
+		tools::None(),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+cache-dir",
+		tools::Folder(tools::openmode::read_write),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+trace-path",
+		tools::File(tools::openmode::write),
+		tools::arg_rank::ADV);
+
 	tools::add_arg(args, p, class_name+"p+threads,t",
 		tools::Integer(tools::Positive()));
 
+	tools::add_arg(args, p, class_name+"p+pin-policy",
+		tools::Text(tools::Including_set("NONE", "COMPACT", "SCATTER", "LIST")),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+pin-cpus",
+		tools::List<int>(tools::Integer(tools::Positive()), tools::Length(1)),
+		tools::arg_rank::ADV);
+
+	tools::add_arg(args, p, class_name+"p+huge-pages",
+		tools::None(),
+		tools::arg_rank::ADV);
+
 	tools::add_arg(args, p, class_name+"p+seed,S",
 		tools::Integer(tools::Positive()));
 }
@@ -96,10 +120,17 @@ void Simulation::parameters
 	auto p = this->get_prefix();
 
 	if(vals.exist({p+"-meta"          })) this->meta        =         vals.at    ({p+"-meta"        });
+	if(vals.exist({p+"-cache-dir"     })) this->cache_dir   =         vals.to_folder({p+"-cache-dir" });
+	if(vals.exist({p+"-trace-path"    })) this->trace_path  =         vals.to_file({p+"-trace-path"  });
 	if(vals.exist({p+"-stop-time"     })) this->stop_time   = seconds(vals.to_int({p+"-stop-time"   }));
 	if(vals.exist({p+"-max-fra",   "n"})) this->max_frame   =         vals.to_int({p+"-max-fra", "n"});
 	if(vals.exist({p+"-seed",      "S"})) this->global_seed =         vals.to_int({p+"-seed",    "S"});
 	if(vals.exist({p+"-stats"         })) this->statistics  = true;
+	if(vals.exist({p+"-hw-counters"   }))
+	{
+		this->statistics  = true;
+		this->hw_counters = true;
+	}
 	if(vals.exist({p+"-dbg"           })) this->debug       = true;
 	if(vals.exist({p+"-crit-nostop"   })) this->crit_nostop = true;
 	if(vals.exist({p+"-dbg-limit", "d"}))
@@ -126,6 +157,21 @@ void Simulation::parameters
 	if(vals.exist({p+"-threads", "t"}) && vals.to_int({p+"-threads", "t"}) > 0)
 		if(vals.exist({p+"-threads", "t"})) this->n_threads = vals.to_int({p+"-threads", "t"});
 
+	if(vals.exist({p+"-pin-cpus"      }))
+	{
+		this->pin_policy = "LIST";
+		this->pin_cpus   = vals.to_list<int>({p+"-pin-cpus"});
+	}
+	if(vals.exist({p+"-pin-policy"    })) this->pin_policy  = vals.at({p+"-pin-policy"});
+	if(vals.exist({p+"-huge-pages"    })) this->huge_pages  = true;
+
+	if (this->pin_policy == "LIST" && this->pin_cpus.empty())
+	{
+		std::stringstream message;
+		message << "The LIST pinning policy requires a list of CPUs ('pin_policy' = " << this->pin_policy << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
 #ifdef AFF3CT_MPI
 	MPI_Comm_size(MPI_COMM_WORLD, &this->mpi_size);
 	MPI_Comm_rank(MPI_COMM_WORLD, &this->mpi_rank);
@@ -169,6 +215,8 @@ void Simulation::parameters
 
 	headers[p].push_back(std::make_pair("Seed", std::to_string(this->global_seed)));
 	headers[p].push_back(std::make_pair("Statistics", this->statistics ? "on" : "off"));
+	if (this->hw_counters)
+		headers[p].push_back(std::make_pair("Hardware counters", "on"));
 	headers[p].push_back(std::make_pair("Debug mode", this->debug ? "on" : "off"));
 	if (this->debug)
 	{
@@ -183,6 +231,27 @@ void Simulation::parameters
 
 	headers[p].push_back(std::make_pair("Multi-threading (t)", threads));
 
+	if (this->pin_policy != "NONE")
+	{
+		std::string pinning = this->pin_policy;
+		if (this->pin_policy == "LIST")
+		{
+			pinning += " {";
+			for (size_t c = 0; c < this->pin_cpus.size(); c++)
+				pinning += std::to_string(this->pin_cpus[c]) + (c < this->pin_cpus.size() -1 ? "," : "}");
+		}
+		headers[p].push_back(std::make_pair("Thread pinning", pinning));
+	}
+
+	if (this->huge_pages)
+		headers[p].push_back(std::make_pair("Huge pages", "on"));
+
+	if (!this->cache_dir.empty())
+		headers[p].push_back(std::make_pair("Cache directory", this->cache_dir));
+
+	if (!this->trace_path.empty())
+		headers[p].push_back(std::make_pair("Trace path", this->trace_path));
+
 #ifdef AFF3CT_MPI
 	headers[p].push_back(std::make_pair("MPI size", std::to_string(this->mpi_size)));
 #endif
@@ -28,10 +28,16 @@ struct Simulation : Launcher
 		// optional parameters
 		std::chrono::seconds stop_time       = std::chrono::seconds(0);
 		std::string          meta            = "";
+		std::string          cache_dir       = "";
+		std::string          trace_path      = "";
+		std::string          pin_policy      = "NONE";
+		std::vector<int>     pin_cpus;
+		bool                 huge_pages      = false;
 		unsigned             max_frame       = 0;
 		bool                 debug           = false;
 		bool                 debug_hex       = false;
 		bool                 statistics      = false;
+		bool                 hw_counters     = false;
 		bool                 crit_nostop     = false;
 		int                  n_threads       = 1;
 		int                  local_seed      = 0;
@@ -55,11 +55,6 @@ void Frozenbits_generator::parameters
 
 	tools::add_arg(args, p, class_name+"p+awgn-path",
 		tools::Path(tools::openmode::read));
-
-#ifdef AFF3CT_POLAR_BOUNDS
-	tools::add_arg(args, p, class_name+"p+pb-path",
-		tools::File(tools::openmode::read));
-#endif
 }
 
 void Frozenbits_generator::parameters
@@ -72,10 +67,6 @@ void Frozenbits_generator::parameters
 	if(vals.exist({p+"-noise"         })) this->noise      = vals.to_float({p+"-noise"         });
 	if(vals.exist({p+"-awgn-path"     })) this->path_fb    = vals.to_path ({p+"-awgn-path"     });
 	if(vals.exist({p+"-gen-method"    })) this->type       = vals.at      ({p+"-gen-method"    });
-
-#ifdef AFF3CT_POLAR_BOUNDS
-	if(vals.exist({p+"-pb-path"})) this->path_pb = vals.to_file({p+"-pb-path"});
-#endif
 }
 
 void Frozenbits_generator::parameters
@@ -87,10 +78,6 @@ void Frozenbits_generator::parameters
 	if (full) headers[p].push_back(std::make_pair("Info. bits (K)", std::to_string(this->K)));
 	if (full) headers[p].push_back(std::make_pair("Codeword size (N)", std::to_string(this->N_cw)));
 	headers[p].push_back(std::make_pair("Noise", this->noise == -1.0f ? "adaptive" : std::to_string(this->noise)));
-#ifdef AFF3CT_POLAR_BOUNDS
-	if (this->type == "TV")
-		headers[p].push_back(std::make_pair("PB path", this->path_pb));
-#endif
 	if (this->type == "TV" || this->type == "FILE")
 		headers[p].push_back(std::make_pair("Path", this->path_fb));
 }
@@ -98,11 +85,11 @@ void Frozenbits_generator::parameters
 tools::Frozenbits_generator* Frozenbits_generator::parameters
 ::build() const
 {
-	if (this->type == "GA"  ) return new tools::Frozenbits_generator_GA  (this->K, this->N_cw                              );
-	if (this->type == "TV"  ) return new tools::Frozenbits_generator_TV  (this->K, this->N_cw, this->path_fb, this->path_pb);
-	if (this->type == "FILE") return new tools::Frozenbits_generator_file(this->K, this->N_cw, this->path_fb               );
-	if (this->type == "5G")   return new tools::Frozenbits_generator_5G  (this->K, this->N_cw                              );
-	if (this->type == "BEC")  return new tools::Frozenbits_generator_BEC (this->K, this->N_cw                              );
+	if (this->type == "GA"  ) return new tools::Frozenbits_generator_GA  (this->K, this->N_cw               );
+	if (this->type == "TV"  ) return new tools::Frozenbits_generator_TV  (this->K, this->N_cw, this->path_fb);
+	if (this->type == "FILE") return new tools::Frozenbits_generator_file(this->K, this->N_cw, this->path_fb);
+	if (this->type == "5G")   return new tools::Frozenbits_generator_5G  (this->K, this->N_cw               );
+	if (this->type == "BEC")  return new tools::Frozenbits_generator_BEC (this->K, this->N_cw               );
 
 	throw tools::cannot_allocate(__FILE__, __LINE__, __func__);
 }
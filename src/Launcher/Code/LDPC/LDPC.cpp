@@ -4,6 +4,7 @@
 #include "Launcher/Simulation/BFER_std.hpp"
 #include "Launcher/Simulation/BFER_ite.hpp"
 
+#include "Tools/Perf/Bit_slice/Bit_slice.hpp"
 #include "Factory/Module/Codec/LDPC/Codec_LDPC.hpp"
 
 #include "LDPC.hpp"
@@ -58,7 +59,14 @@ void LDPC<L,B,R,Q>
 	params_cdc->store(this->arg_vals);
 
 	if (dec_ldpc->simd_strategy == "INTER")
-		this->params.src->n_frames = mipp::N<Q>();
+	{
+		// the hard decision decoders are bit-sliced: one frame per bit of the words
+		if (dec_ldpc->implem == "GALA" || dec_ldpc->implem == "GALB" || dec_ldpc->implem == "GALE" ||
+		    dec_ldpc->implem == "PPBF")
+			this->params.src->n_frames = tools::Bit_slice<>::n_lanes;
+		else
+			this->params.src->n_frames = mipp::N<Q>();
+	}
 
 	if (std::is_same<Q,int8_t>() || std::is_same<Q,int16_t>())
 	{
@@ -68,6 +76,9 @@ void LDPC<L,B,R,Q>
 
 	L::store_args();
 
+	// the fixed-point SPA/LSPA update rules need the format of the quantized LLRs
+	dec_ldpc->qnt_decimals = this->params.qnt->n_decimals;
+
 	params_cdc->enc->n_frames = this->params.src->n_frames;
 	if (params_cdc->pct != nullptr)
 	params_cdc->pct->n_frames = this->params.src->n_frames;
@@ -1,3 +1,4 @@
+#include <cmath>
 #include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
@@ -14,7 +15,10 @@ Channel_AWGN_LLR<R>
                    const tools::Sigma<R>& noise, const int n_frames)
 : Channel<R>(N, noise, n_frames),
   add_users(add_users),
-  noise_generator(std::move(_ng))
+  noise_generator(std::move(_ng)),
+  is_scale((R)1),
+  is_shift((R)0),
+  is_weights(n_frames, 1.0)
 {
 	const std::string name = "Channel_AWGN_LLR";
 	this->set_name(name);
@@ -61,10 +65,19 @@ void Channel_AWGN_LLR<R>
 		const auto f_start = (frame_id < 0) ? 0 : frame_id % this->n_frames;
 		const auto f_stop  = (frame_id < 0) ? this->n_frames : f_start +1;
 
+		const auto sigma = this->n->get_noise() * this->is_scale;
 		if (frame_id < 0)
-			noise_generator->generate(this->noise, this->n->get_noise());
+			noise_generator->generate(this->noise, sigma);
 		else
-			noise_generator->generate(this->noise.data() + f_start * this->N, this->N, this->n->get_noise());
+			noise_generator->generate(this->noise.data() + f_start * this->N, this->N, sigma);
+
+		if (this->is_importance_sampling())
+			for (auto f = f_start; f < f_stop; f++)
+			{
+				for (auto n = 0; n < this->N; n++)
+					this->noise[f * this->N +n] -= this->is_shift * X_N[f * this->N +n];
+				this->compute_is_weight(X_N, f);
+			}
 
 		for (auto f = f_start; f < f_stop; f++)
 			for (auto n = 0; n < this->N; n++)
@@ -72,6 +85,70 @@ void Channel_AWGN_LLR<R>
 	}
 }
 
+template <typename R>
+void Channel_AWGN_LLR<R>
+::compute_is_weight(const R *X_N, const int frame_id)
+{
+	// log of the ratio between the true density N(0, sigma^2) and the biased density N(m, (scale * sigma)^2)
+	const auto sigma   = (double)this->n->get_noise();
+	const auto scale   = (double)this->is_scale;
+	const auto inv_2v  = 1.0 / (2.0 * sigma * sigma);
+	const auto inv_2vb = inv_2v / (scale * scale);
+	const auto noise   = this->noise.data() + frame_id * this->N;
+	const auto X       = X_N                + frame_id * this->N;
+
+	auto log_w = (double)this->N * std::log(scale);
+	for (auto n = 0; n < this->N; n++)
+	{
+		const auto z = (double)noise[n];
+		const auto d = z + (double)this->is_shift * (double)X[n];
+		log_w += d * d * inv_2vb - z * z * inv_2v;
+	}
+
+	this->is_weights[frame_id] = std::exp(log_w);
+}
+
+template <typename R>
+void Channel_AWGN_LLR<R>
+::set_importance_sampling(const R scale, const R shift)
+{
+	if (scale <= (R)0)
+	{
+		std::stringstream message;
+		message << "'scale' has to be greater than 0 ('scale' = " << scale << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (shift < (R)0)
+	{
+		std::stringstream message;
+		message << "'shift' has to be positive ('shift' = " << shift << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (add_users && (scale != (R)1 || shift != (R)0))
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "The importance sampling can't be used when the "
+		                                                            "users are added.");
+
+	this->is_scale = scale;
+	this->is_shift = shift;
+	std::fill(this->is_weights.begin(), this->is_weights.end(), 1.0);
+}
+
+template <typename R>
+bool Channel_AWGN_LLR<R>
+::is_importance_sampling() const
+{
+	return this->is_scale != (R)1 || this->is_shift != (R)0;
+}
+
+template <typename R>
+const std::vector<double>& Channel_AWGN_LLR<R>
+::get_is_weights() const
+{
+	return this->is_weights;
+}
+
 template<typename R>
 void Channel_AWGN_LLR<R>::check_noise()
 {
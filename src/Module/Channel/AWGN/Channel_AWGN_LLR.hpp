@@ -16,6 +16,10 @@ private:
 	const bool add_users;
 	std::unique_ptr<tools::Gaussian_gen<R>> noise_generator;
 
+	R                   is_scale;   // importance sampling: scaling factor of the noise standard deviation
+	R                   is_shift;   // importance sampling: shift of the noise mean toward the decision threshold
+	std::vector<double> is_weights; // importance sampling: likelihood ratio of each frame
+
 public:
 	Channel_AWGN_LLR(const int N, std::unique_ptr<tools::Gaussian_gen<R>>&& noise_generator,
 	                 const bool add_users = false,
@@ -30,8 +34,29 @@ public:
 
 	void add_noise(const R *X_N, R *Y_N, const int frame_id = -1); using Channel<R>::add_noise;
 
+	/*!
+	 * \brief Enables the importance sampling: the noise is drawn from a biased distribution
+	 *        N(-shift * X, (scale * sigma)^2) instead of N(0, sigma^2) and the likelihood ratio between the true and
+	 *        the biased densities is computed for each frame (see 'get_is_weights()').
+	 *
+	 * \param scale: scaling factor of the noise standard deviation (1 = no scaling).
+	 * \param shift: shift of the noise mean toward the decision threshold (0 = no shift).
+	 */
+	void set_importance_sampling(const R scale, const R shift);
+
+	bool is_importance_sampling() const;
+
+	/*!
+	 * \brief Gets the likelihood ratios of the frames processed by the last 'add_noise' call (1 without importance
+	 *        sampling).
+	 */
+	const std::vector<double>& get_is_weights() const;
+
 protected:
 	virtual void check_noise();
+
+private:
+	void compute_is_weight(const R *X_N, const int frame_id);
 };
 }
 }
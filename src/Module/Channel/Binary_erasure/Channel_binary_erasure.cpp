@@ -1,4 +1,5 @@
 #include <type_traits>
+#include <algorithm>
 #include "Channel_binary_erasure.hpp"
 #include "Tools/Algo/Draw_generator/Event_generator/Standard/Event_generator_std.hpp"
 
@@ -17,7 +18,7 @@ template<typename R>
 Channel_binary_erasure<R>
 ::Channel_binary_erasure(const int N, std::unique_ptr<tools::Event_generator<R>>&& event_generator,
                          const tools::Event_probability<R> &noise, const int n_frames)
-: Channel<R>(N, noise, n_frames), event_generator(std::move(event_generator))
+: Channel<R>(N, noise, n_frames), event_generator(std::move(event_generator)), event_positions(n_frames)
 {
 	const std::string name = "Channel_binary_erasure";
 	this->set_name(name);
@@ -32,6 +33,27 @@ void Channel_binary_erasure<R>
 	auto event_draw = (E*)(this->noise.data() + this->N * frame_id);
 
 	const auto event_probability = this->n->get_noise();
+
+	if (event_generator->is_sparse())
+	{
+		// only the erased positions are touched: the events of the previous draw of this frame are cleared
+		auto &positions = this->event_positions[frame_id];
+		for (auto i : positions)
+			event_draw[i] = (E)false;
+
+		event_generator->generate_positions(positions, (unsigned)this->N, event_probability);
+
+		// the other symbols are the input ones: nothing to do when the channel is applied in place
+		if (Y_N != X_N)
+			std::copy(X_N, X_N + this->N, Y_N);
+		for (auto i : positions)
+		{
+			event_draw[i] = (E)true;
+			Y_N       [i] = tools::unknown_symbol_val<R>();
+		}
+		return;
+	}
+
 	event_generator->generate(event_draw, (unsigned)this->N, event_probability);
 
 	const mipp::Reg<R> r_erased = tools::unknown_symbol_val<R>();
@@ -19,6 +19,7 @@ class Channel_binary_symmetric : public Channel<R>
 {
 protected:
 	std::unique_ptr<tools::Event_generator<R>> event_generator;
+	std::vector<std::vector<unsigned>>         event_positions; // the events of each frame (sparse generators)
 
 	using E = typename tools::matching_types<R>::B; //Event type
 
@@ -0,0 +1,285 @@
+#include <cmath>
+#include <random>
+#include <cstdint>
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Algo/Draw_generator/Gaussian_noise_generator/Standard/Gaussian_noise_generator_std.hpp"
+
+#include "Channel_Rayleigh_LLR_Jakes.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename R>
+Channel_Rayleigh_LLR_Jakes<R>
+::Channel_Rayleigh_LLR_Jakes(const int N, const bool complex, const R doppler,
+                             std::unique_ptr<tools::Gaussian_gen<R>>&& _ng, const int n_sin, const R rice_k,
+                             const int seed, const tools::Noise<R>& noise, const int n_frames)
+: Channel<R>(N, noise, n_frames),
+  complex(complex),
+  doppler(doppler),
+  n_sin(n_sin),
+  rice_k(rice_k),
+  n_gains(complex ? N / 2 : N),
+  noise_generator(std::move(_ng)),
+  w_los((R)0),
+  phi_los((R)0),
+  time(0)
+{
+	const std::string name = "Channel_Rayleigh_LLR_Jakes";
+	this->set_name(name);
+
+	if (noise_generator == nullptr)
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "'noise_generator' can't be NULL.");
+
+	this->init(seed);
+}
+
+template <typename R>
+Channel_Rayleigh_LLR_Jakes<R>
+::Channel_Rayleigh_LLR_Jakes(const int N, const bool complex, const R doppler, const int n_sin, const R rice_k,
+                             const int seed, const tools::Noise<R>& noise, const int n_frames)
+: Channel<R>(N, noise, n_frames),
+  complex(complex),
+  doppler(doppler),
+  n_sin(n_sin),
+  rice_k(rice_k),
+  n_gains(complex ? N / 2 : N),
+  noise_generator(new tools::Gaussian_noise_generator_std<R>(seed)),
+  w_los((R)0),
+  phi_los((R)0),
+  time(0)
+{
+	const std::string name = "Channel_Rayleigh_LLR_Jakes";
+	this->set_name(name);
+
+	this->init(seed);
+}
+
+template <typename R>
+void Channel_Rayleigh_LLR_Jakes<R>
+::init(const int seed)
+{
+	if (complex && this->N % 2)
+	{
+		std::stringstream message;
+		message << "'N' has to be divisible by 2 ('N' = " << this->N << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (doppler < (R)0 || doppler > (R)0.5)
+	{
+		std::stringstream message;
+		message << "'doppler' has to be in [0;0.5] ('doppler' = " << doppler << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (n_sin <= 0)
+	{
+		std::stringstream message;
+		message << "'n_sin' has to be greater than 0 ('n_sin' = " << n_sin << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (rice_k < (R)0)
+	{
+		std::stringstream message;
+		message << "'rice_k' has to be positive ('rice_k' = " << rice_k << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const auto n_regs = (n_gains + mipp::nElReg<R>() -1) / mipp::nElReg<R>();
+	this->h_re.resize(n_regs * mipp::nElReg<R>());
+	this->h_im.resize(n_regs * mipp::nElReg<R>());
+
+	this->w_re  .resize(n_sin);
+	this->w_im  .resize(n_sin);
+	this->phi_re.resize(n_sin);
+	this->phi_im.resize(n_sin);
+
+	this->draw_sinusoids(seed);
+}
+
+template <typename R>
+void Channel_Rayleigh_LLR_Jakes<R>
+::set_seed(const int seed)
+{
+	this->noise_generator->set_seed(seed);
+	this->draw_sinusoids(seed);
+}
+
+template <typename R>
+void Channel_Rayleigh_LLR_Jakes<R>
+::draw_sinusoids(const int seed)
+{
+	const double pi = 3.14159265358979323846;
+	const double wd = 2.0 * pi * (double)doppler;
+
+	// the sinusoids are drawn from a stream distinct of the noise one: with 'seed +1' the sinusoids of a thread would
+	// be correlated with the noise of the next thread (the seeds of the threads are consecutive)
+	std::seed_seq seq = {(uint32_t)seed, (uint32_t)0x4a616b65};
+	std::mt19937 rd_engine(seq);
+	std::uniform_real_distribution<double> dist(-pi, pi);
+
+	const auto theta = dist(rd_engine);
+	for (auto m = 0; m < n_sin; m++)
+	{
+		const auto alpha = (2.0 * pi * (m +1) - pi + theta) / (4.0 * n_sin);
+		this->w_re  [m] = (R)(wd * std::cos(alpha));
+		this->w_im  [m] = (R)(wd * std::sin(alpha));
+		this->phi_re[m] = (R)dist(rd_engine);
+		this->phi_im[m] = (R)dist(rd_engine);
+	}
+
+	this->w_los   = (R)(wd * std::cos(dist(rd_engine)));
+	this->phi_los = (R)dist(rd_engine);
+	this->time    = 0;
+}
+
+template <typename R>
+void Channel_Rayleigh_LLR_Jakes<R>
+::generate_gains(const unsigned long long t0)
+{
+	constexpr double two_pi = 2.0 * 3.14159265358979323846;
+	const auto L = mipp::nElReg<R>();
+
+	const auto scale_diffuse = (R)(std::sqrt(1.0 / ((double)rice_k + 1.0)) / std::sqrt((double)n_sin));
+	const auto scale_los     = (R)std::sqrt((double)rice_k / ((double)rice_k + 1.0));
+
+	std::fill(this->h_re.begin(), this->h_re.end(), (R)0);
+	std::fill(this->h_im.begin(), this->h_im.end(), (R)0);
+
+	mipp::vector<R> c0(L), s0(L);
+
+	// sum_m cos(w_m * t + phi_m) computed by rotating the phasor exp(j (w_m t + phi_m)) of 'L' symbols per register
+	auto accumulate = [&](const R w, const R phi, const R amp, const bool cplx)
+	{
+		for (auto l = 0; l < L; l++)
+		{
+			// the exact phase is reduced modulo 2 pi in double precision to keep the accuracy on long simulations
+			const auto phase = std::fmod((double)w * (double)(t0 + l) + (double)phi, two_pi);
+			c0[l] = (R)std::cos(phase) * amp;
+			s0[l] = (R)std::sin(phase) * amp;
+		}
+
+		const mipp::Reg<R> r_cL = (R)std::cos((double)w * L);
+		const mipp::Reg<R> r_sL = (R)std::sin((double)w * L);
+
+		mipp::Reg<R> r_c = c0.data();
+		mipp::Reg<R> r_s = s0.data();
+
+		for (auto i = 0; i < (int)this->h_re.size(); i += L)
+		{
+			if (cplx)
+			{
+				const mipp::Reg<R> r_re = &this->h_re[i];
+				const mipp::Reg<R> r_im = &this->h_im[i];
+				(r_re + r_c).store(&this->h_re[i]);
+				(r_im + r_s).store(&this->h_im[i]);
+			}
+			else
+			{
+				const mipp::Reg<R> r_acc = &this->h_re[i];
+				(r_acc + r_c).store(&this->h_re[i]);
+			}
+
+			const auto r_c_next = r_c * r_cL - r_s * r_sL;
+			const auto r_s_next = r_s * r_cL + r_c * r_sL;
+			r_c = r_c_next;
+			r_s = r_s_next;
+		}
+	};
+
+	// in-phase component
+	for (auto m = 0; m < n_sin; m++)
+		accumulate(this->w_re[m], this->phi_re[m], scale_diffuse, false);
+
+	// quadrature component: accumulate in 'h_re' after a swap to reuse the same kernel
+	std::swap(this->h_re, this->h_im);
+	for (auto m = 0; m < n_sin; m++)
+		accumulate(this->w_im[m], this->phi_im[m], scale_diffuse, false);
+	std::swap(this->h_re, this->h_im);
+
+	// line-of-sight component
+	if (rice_k > (R)0)
+		accumulate(this->w_los, this->phi_los, scale_los, true);
+}
+
+template <typename R>
+void Channel_Rayleigh_LLR_Jakes<R>
+::add_noise_wg(const R *X_N, R *H_N, R *Y_N, const int frame_id)
+{
+	this->check_noise();
+
+	const auto f_start = (frame_id < 0) ? 0 : frame_id % this->n_frames;
+	const auto f_stop  = (frame_id < 0) ? this->n_frames : f_start +1;
+
+	if (frame_id < 0)
+		noise_generator->generate(this->noise, this->n->get_noise());
+	else
+		noise_generator->generate(this->noise.data() + f_start * this->N, this->N, this->n->get_noise());
+
+	for (auto f = f_start; f < f_stop; f++)
+	{
+		this->generate_gains(this->time + (unsigned long long)f * n_gains);
+
+		const auto off = f * this->N;
+		if (this->complex)
+		{
+			for (auto n = 0; n < n_gains; n++)
+			{
+				const auto h_re = H_N[off + 2*n   ] = this->h_re[n];
+				const auto h_im = H_N[off + 2*n +1] = this->h_im[n];
+
+				const auto x_re = X_N[off + 2*n   ];
+				const auto x_im = X_N[off + 2*n +1];
+
+				Y_N[off + 2*n   ] = (x_re * h_re - x_im * h_im) + this->noise[off + 2*n   ];
+				Y_N[off + 2*n +1] = (x_im * h_re + x_re * h_im) + this->noise[off + 2*n +1];
+			}
+		}
+		else
+		{
+			const auto L = mipp::nElReg<R>();
+			const auto vec_loop_size = (n_gains / L) * L;
+			for (auto n = 0; n < vec_loop_size; n += L)
+			{
+				const mipp::Reg<R> r_re = &this->h_re[n];
+				const mipp::Reg<R> r_im = &this->h_im[n];
+				const auto r_h = mipp::sqrt(r_re * r_re + r_im * r_im);
+				r_h.storeu(H_N + off + n);
+
+				const auto r_y = mipp::loadu(X_N + off + n) * r_h + mipp::loadu(this->noise.data() + off + n);
+				r_y.storeu(Y_N + off + n);
+			}
+			for (auto n = vec_loop_size; n < n_gains; n++)
+			{
+				H_N[off + n] = std::sqrt(this->h_re[n] * this->h_re[n] + this->h_im[n] * this->h_im[n]);
+				Y_N[off + n] = X_N[off + n] * H_N[off + n] + this->noise[off + n];
+			}
+		}
+	}
+
+	// the time moves forward once all the frames of the wave have been processed
+	if (f_stop == this->n_frames)
+		this->time += (unsigned long long)this->n_frames * n_gains;
+}
+
+template<typename R>
+void Channel_Rayleigh_LLR_Jakes<R>::check_noise()
+{
+	Channel<R>::check_noise();
+
+	this->n->is_of_type_throw(tools::Noise_type::SIGMA);
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Channel_Rayleigh_LLR_Jakes<R_32>;
+template class aff3ct::module::Channel_Rayleigh_LLR_Jakes<R_64>;
+#else
+template class aff3ct::module::Channel_Rayleigh_LLR_Jakes<R>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,83 @@
+#ifndef CHANNEL_RAYLEIGH_LLR_JAKES_HPP_
+#define CHANNEL_RAYLEIGH_LLR_JAKES_HPP_
+
+#include <vector>
+#include <memory>
+#include <mipp.h>
+
+#include "Tools/Algo/Draw_generator/Gaussian_noise_generator/Gaussian_noise_generator.hpp"
+
+#include "../Channel.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Channel_Rayleigh_LLR_Jakes
+ *
+ * \brief Time-correlated flat Rayleigh/Rician fading channel (Clarke/Jakes model).
+ *
+ * The gains are generated on the fly with the sum-of-sinusoids model of Zheng & Xiao:
+ *   h(t) = sqrt(1/(K+1)) * sqrt(1/M) * sum_m [cos(w_d t cos(a_m) + phi_m) + j cos(w_d t sin(a_m) + psi_m)]
+ *        + sqrt(K/(K+1)) * exp(j (w_d t cos(theta_0) + phi_0))
+ * with a_m = (2 pi m - pi + theta) / (4 M), w_d = 2 pi f_d T_s and K the Rician factor (K = 0 gives Rayleigh).
+ * The time index continues from one frame to the next one so consecutive frames are correlated.
+ *
+ * The sinusoids are evaluated with MIPP registers: the exact phases are computed once per frame and the next samples
+ * are obtained by complex rotations, so no trigonometric function is evaluated in the inner loop.
+ *
+ * \tparam R: type of the reals (floating-point representation) in the Channel.
+ */
+template <typename R = float>
+class Channel_Rayleigh_LLR_Jakes : public Channel<R>
+{
+protected:
+	const bool complex;
+	const R    doppler;   // normalized maximum Doppler frequency (f_d * T_s)
+	const int  n_sin;     // number of sinusoids per quadrature component
+	const R    rice_k;    // Rician K-factor (0 for Rayleigh fading)
+	const int  n_gains;   // number of complex gains per frame
+
+	std::unique_ptr<tools::Gaussian_noise_generator<R>> noise_generator;
+
+	std::vector<R> w_re, w_im;        // angular frequencies of the sinusoids (rad/symbol)
+	std::vector<R> phi_re, phi_im;    // initial phases of the sinusoids
+	R w_los, phi_los;                 // line-of-sight component (Rician)
+	mipp::vector<R> h_re, h_im;       // gains of the current frame, padded to a multiple of the register size
+	unsigned long long time;          // index of the first symbol of the next frame
+
+public:
+	Channel_Rayleigh_LLR_Jakes(const int N, const bool complex, const R doppler,
+	                           std::unique_ptr<tools::Gaussian_gen<R>>&& noise_generator,
+	                           const int n_sin = 16, const R rice_k = (R)0, const int seed = 0,
+	                           const tools::Noise<R>& noise = tools::Noise<R>(),
+	                           const int n_frames = 1);
+
+	Channel_Rayleigh_LLR_Jakes(const int N, const bool complex, const R doppler,
+	                           const int n_sin = 16, const R rice_k = (R)0, const int seed = 0,
+	                           const tools::Noise<R>& noise = tools::Noise<R>(),
+	                           const int n_frames = 1);
+
+	virtual ~Channel_Rayleigh_LLR_Jakes() = default;
+
+	virtual void add_noise_wg(const R *X_N, R *H_N, R *Y_N, const int frame_id = -1); using Channel<R>::add_noise_wg;
+
+	/*!
+	 * \brief Reseeds the noise generator and draws new sinusoids (the time index is reset).
+	 */
+	void set_seed(const int seed);
+
+protected:
+	virtual void check_noise();
+
+	void generate_gains(const unsigned long long t0);
+
+private:
+	void init          (const int seed);
+	void draw_sinusoids(const int seed);
+};
+}
+}
+
+#endif /* CHANNEL_RAYLEIGH_LLR_JAKES_HPP_ */
@@ -19,6 +19,9 @@ Channel_Rayleigh_LLR_user<R>
   add_users(add_users),
   gains(N * n_frames),
   noise_generator(std::move(_ng)),
+  gains_trace(nullptr),
+  gains_data(nullptr),
+  n_gains(0),
   gain_occur(gain_occurrences),
   current_gain_occur(0),
   gain_index(0)
@@ -47,6 +50,9 @@ Channel_Rayleigh_LLR_user<R>
   add_users(add_users),
   gains(N * n_frames),
   noise_generator(new tools::Gaussian_noise_generator_std<R>(seed)),
+  gains_trace(nullptr),
+  gains_data(nullptr),
+  n_gains(0),
   gain_occur(gain_occurrences),
   current_gain_occur(0),
   gain_index(0)
@@ -70,6 +76,16 @@ void Channel_Rayleigh_LLR_user<R>
 	if (gains_filename.empty())
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Argument 'gains_filename' should not be empty.");
 
+	if (tools::Mapped_trace::is_trace(gains_filename))
+	{
+		gains_trace = tools::Mapped_trace::open(gains_filename);
+
+		// zero-copy when the stored type matches, else the gains are converted once and shared by all the channels
+		gains_data = gains_trace->get_converted_data<R>();
+		n_gains = (unsigned)gains_trace->get_size();
+		return;
+	}
+
 	std::ifstream file(gains_filename);
 
 	if (file.is_open())
@@ -90,6 +106,9 @@ void Channel_Rayleigh_LLR_user<R>
 
 	if(gains_stock.empty())
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "The file '" + gains_filename + "' is empty.");
+
+	gains_data = gains_stock.data();
+	n_gains    = (unsigned)gains_stock.size();
 }
 
 template <typename R>
@@ -108,7 +127,7 @@ void Channel_Rayleigh_LLR_user<R>
 	// get all the needed gains from the stock
 	for (unsigned i = 0; i < gains.size(); ++i)
 	{
-		gains[i] = gains_stock[gain_index];
+		gains[i] = gains_data[gain_index];
 
 		current_gain_occur++;
 		if(current_gain_occur >= gain_occur)
@@ -116,7 +135,7 @@ void Channel_Rayleigh_LLR_user<R>
 			current_gain_occur = 0;
 			gain_index++;
 
-			if(gain_index >= gains_stock.size())
+			if(gain_index >= n_gains)
 				gain_index = 0;
 		}
 	}
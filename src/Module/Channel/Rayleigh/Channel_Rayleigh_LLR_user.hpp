@@ -3,7 +3,9 @@
 
 #include <vector>
 #include <string>
+#include <memory>
 
+#include "Tools/Algo/Mapped_trace/Mapped_trace.hpp"
 #include "Tools/Algo/Draw_generator/Gaussian_noise_generator/Gaussian_noise_generator.hpp"
 
 #include "../Channel.hpp"
@@ -22,6 +24,9 @@ protected:
 	std::unique_ptr<tools::Gaussian_noise_generator<R>> noise_generator;
 
 	std::vector<R> gains_stock;
+	std::shared_ptr<const tools::Mapped_trace> gains_trace; // shared between all the threads when the file is a binary trace
+	const R* gains_data; // points either on 'gains_stock' or on the (converted) values of the trace
+	unsigned n_gains;
 	const unsigned gain_occur;
 	unsigned current_gain_occur;
 	unsigned gain_index;
@@ -11,7 +11,7 @@ using namespace aff3ct::module;
 template <typename R>
 Channel_user<R>
 ::Channel_user(const int N, const std::string &filename, const bool add_users, const int n_frames)
-: Channel<R>(N, n_frames), add_users(add_users), noise_counter(0)
+: Channel<R>(N, n_frames), add_users(add_users), trace(nullptr), noise_counter(0), n_noise_frames(0)
 {
 	const std::string name = "Channel_user";
 	this->set_name(name);
@@ -19,7 +19,25 @@ Channel_user<R>
 	if (filename.empty())
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "'filename' should not be empty.");
 
-	read_noise_file(filename, this->N, this->noise_buff);
+	if (tools::Mapped_trace::is_trace(filename))
+	{
+		this->trace = tools::Mapped_trace::open(filename);
+
+		if (this->trace->get_frame_size() != (size_t)this->N)
+		{
+			std::stringstream message;
+			message << "The frame size is wrong (read: " << this->trace->get_frame_size() << ", expected: "
+			        << this->N << ").";
+			throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		this->n_noise_frames = (int)this->trace->get_n_frames();
+	}
+	else
+	{
+		read_noise_file(filename, this->N, this->noise_buff);
+		this->n_noise_frames = (int)this->noise_buff.size();
+	}
 }
 
 template <typename R>
@@ -59,11 +77,14 @@ template <typename R>
 void Channel_user<R>
 ::set_noise(const int frame_id)
 {
-	std::copy(this->noise_buff[this->noise_counter].begin(),
-	          this->noise_buff[this->noise_counter].end(),
-	          this->noise.data() + frame_id * this->N);
+	if (this->trace != nullptr)
+		this->trace->read_frame(this->noise_counter, this->noise.data() + frame_id * this->N);
+	else
+		std::copy(this->noise_buff[this->noise_counter].begin(),
+		          this->noise_buff[this->noise_counter].end(),
+		          this->noise.data() + frame_id * this->N);
 
-	this->noise_counter = (this->noise_counter +1) % (int)this->noise_buff.size();
+	this->noise_counter = (this->noise_counter +1) % this->n_noise_frames;
 }
 
 
@@ -2,6 +2,9 @@
 #define CHANNEL_USER_HPP_
 
 #include <vector>
+#include <memory>
+
+#include "Tools/Algo/Mapped_trace/Mapped_trace.hpp"
 
 #include "../Channel.hpp"
 
@@ -37,7 +40,9 @@ protected:
 
 private:
 	std::vector<std::vector<R>> noise_buff;
+	std::shared_ptr<const tools::Mapped_trace> trace; // shared between all the threads when the file is a binary trace
 	int noise_counter;
+	int n_noise_frames;
 };
 }
 }
@@ -6,11 +6,14 @@
 
 #include "Tools/Exception/exception.hpp"
 #include "Tools/general_utils.h"
+#include "Tools/Algo/Construction_cache/Construction_cache.hpp"
+#include "Tools/Algo/Construction_cache/Disk_cache.hpp"
 
 #include "Factory/Module/Puncturer/Puncturer.hpp"
 
 #include "Module/Decoder/Decoder_SISO_SIHO.hpp"
 #include "Module/Encoder/LDPC/Encoder_LDPC.hpp"
+#include "Module/Encoder/LDPC/From_H/Encoder_LDPC_from_H.hpp"
 #include "Module/Puncturer/LDPC/Puncturer_LDPC.hpp"
 
 #include "Codec_LDPC.hpp"
@@ -22,9 +25,13 @@ template <typename B, typename Q>
 Codec_LDPC<B,Q>
 ::Codec_LDPC(const factory::Encoder_LDPC  ::parameters &enc_params,
              const factory::Decoder_LDPC  ::parameters &dec_params,
-                   factory::Puncturer_LDPC::parameters *pct_params)
+             const factory::Puncturer_LDPC::parameters *pct_params)
 : Codec          <B,Q>(enc_params.K, enc_params.N_cw, pct_params ? pct_params->N : enc_params.N_cw, enc_params.tail_length, enc_params.n_frames),
-  Codec_SISO_SIHO<B,Q>(enc_params.K, enc_params.N_cw, pct_params ? pct_params->N : enc_params.N_cw, enc_params.tail_length, enc_params.n_frames)
+  Codec_SISO_SIHO<B,Q>(enc_params.K, enc_params.N_cw, pct_params ? pct_params->N : enc_params.N_cw, enc_params.tail_length, enc_params.n_frames),
+  cstr(Codec_LDPC<B,Q>::get_construction(enc_params, dec_params, pct_params)),
+  H(cstr->H),
+  G(cstr->G),
+  info_bits_pos(cstr->info_bits_pos)
 {
 	const std::string name = "Codec_LDPC";
 	this->set_name(name);
@@ -55,46 +62,13 @@ Codec_LDPC<B,Q>
 	}
 
 	// ---------------------------------------------------------------------------------------------------------- tools
-	if (enc_params.type == "LDPC")
-	{
-		G = tools::LDPC_matrix_handler::read(enc_params.G_path, &info_bits_pos);
-	}
-	else if (enc_params.type == "LDPC_DVBS2")
-	{
-		dvbs2 = tools::build_dvbs2(this->K, this->N);
-		H     = tools::build_H(*dvbs2);
-	}
-
-	if (H.get_n_connections() == 0)
-	{
-		tools::LDPC_matrix_handler::Positions_vector* ibp = nullptr;
-		std::vector<bool>* pct = nullptr;
-
-		if (info_bits_pos.empty())
-			ibp = &info_bits_pos;
-
-		if (pct_params != nullptr && pct_params->pattern.empty())
-			pct = &pct_params->pattern;
+	// G has been computed once in the shared construction, the encoder only shares it
+	if (enc_params.type == "LDPC_H")
+		this->set_encoder(new Encoder_LDPC_from_H<B>(enc_params.K, enc_params.N_cw, H, G, cstr->G_info_bits_pos,
+		                                             enc_params.n_frames));
 
-		H = tools::LDPC_matrix_handler::read(dec_params.H_path, ibp, pct);
-	}
-
-	if (dec_params.H_reorder != "NONE")
-	{	// reorder the H matrix following the check node degrees
-		H.sort_cols_per_density(dec_params.H_reorder == "ASC" ? tools::Matrix::Sort::ASCENDING : tools::Matrix::Sort::DESCENDING);
-	}
-
-
-
-	if (info_bits_pos.empty())
-	{
-		if (enc_params.type == "LDPC_H")
-			this->set_encoder(factory::Encoder_LDPC::build<B>(enc_params, G, H));
-	}
-	else
-	{
+	if (!info_bits_pos.empty())
 		tools::LDPC_matrix_handler::check_info_pos(info_bits_pos, enc_params.K, enc_params.N_cw);
-	}
 
 	// ---------------------------------------------------------------------------------------------------- allocations
 	if (pct_params == nullptr)
@@ -110,13 +84,18 @@ Codec_LDPC<B,Q>
 	}
 	else
 	{
+		// the parameters are shared by the threads: the pattern read with H is set in a local copy
+		factory::Puncturer_LDPC::parameters pct_local(*pct_params);
+		if (pct_local.pattern.empty())
+			pct_local.pattern = cstr->pct_pattern;
+
 		try
 		{
-			this->set_puncturer(factory::Puncturer_LDPC::build<B,Q>(*pct_params));
+			this->set_puncturer(factory::Puncturer_LDPC::build<B,Q>(pct_local));
 		}
 		catch (tools::cannot_allocate const&)
 		{
-			this->set_puncturer(factory::Puncturer::build<B,Q>(*pct_params));
+			this->set_puncturer(factory::Puncturer::build<B,Q>(pct_local));
 		}
 	}
 
@@ -129,7 +108,7 @@ Codec_LDPC<B,Q>
 	{ // encoder not set when building encoder LDPC_H
 		try
 		{
-			this->set_encoder(factory::Encoder_LDPC::build<B>(enc_params, G, H, *dvbs2));
+			this->set_encoder(factory::Encoder_LDPC::build<B>(enc_params, G, H, *cstr->dvbs2));
 		}
 		catch(tools::cannot_allocate const&)
 		{
@@ -161,6 +140,121 @@ Codec_LDPC<B,Q>
 	}
 }
 
+template <typename B, typename Q>
+std::shared_ptr<const typename Codec_LDPC<B,Q>::Construction> Codec_LDPC<B,Q>
+::get_construction(const factory::Encoder_LDPC  ::parameters &enc_params,
+                   const factory::Decoder_LDPC  ::parameters &dec_params,
+                   const factory::Puncturer_LDPC::parameters *pct_params)
+{
+	const auto N        = pct_params ? pct_params->N : enc_params.N_cw;
+	const auto read_pct = pct_params != nullptr && pct_params->pattern.empty();
+
+	// the key contains all the parameters used to build the construction
+	std::stringstream key;
+	key << enc_params.type     << ";" << enc_params.K        << ";" << enc_params.N_cw     << ";" << N           << ";"
+	    << enc_params.G_path   << ";" << enc_params.G_method << ";" << enc_params.G_save_path << ";"
+	    << dec_params.H_path   << ";" << dec_params.H_reorder << ";" << read_pct;
+
+	auto built = false;
+	auto build = [&]()
+	{
+		built = true;
+		std::unique_ptr<Construction> c(new Construction());
+		tools::Sparse_matrix H, G;
+
+		if (enc_params.type == "LDPC")
+		{
+			G = tools::LDPC_matrix_handler::read(enc_params.G_path, &c->info_bits_pos);
+		}
+		else if (enc_params.type == "LDPC_DVBS2")
+		{
+			c->dvbs2 = tools::build_dvbs2(enc_params.K, N);
+			H        = tools::build_H(*c->dvbs2);
+		}
+
+		if (H.get_n_connections() == 0)
+		{
+			tools::LDPC_matrix_handler::Positions_vector* ibp = nullptr;
+			std::vector<bool>* pct = nullptr;
+
+			if (c->info_bits_pos.empty())
+				ibp = &c->info_bits_pos;
+
+			if (read_pct)
+				pct = &c->pct_pattern;
+
+			H = tools::LDPC_matrix_handler::read(dec_params.H_path, ibp, pct);
+		}
+
+		if (dec_params.H_reorder != "NONE")
+		{	// reorder the H matrix following the check node degrees
+			H.sort_cols_per_density(dec_params.H_reorder == "ASC" ? tools::Matrix::Sort::ASCENDING : tools::Matrix::Sort::DESCENDING);
+		}
+
+		if (enc_params.type == "LDPC_H")
+		{
+			G = Encoder_LDPC_from_H<B>::build_G(H, enc_params.G_method, enc_params.G_save_path, c->G_info_bits_pos);
+			if (c->info_bits_pos.empty())
+				c->info_bits_pos = c->G_info_bits_pos;
+		}
+
+		// the modules use the matrices in vertical way: they are turned here once for all
+		c->H = Codec_LDPC<B,Q>::share_vertical(std::move(H));
+		c->G = Codec_LDPC<B,Q>::share_vertical(std::move(G));
+
+		return c.release();
+	};
+
+	auto save = [](tools::Disk_cache::Writer &w, const Construction &c)
+	{
+		w.write(*c.H);
+		w.write(*c.G);
+		w.write(c.info_bits_pos);
+		w.write(c.G_info_bits_pos);
+		w.write(c.pct_pattern);
+	};
+
+	auto load = [](tools::Disk_cache::Reader &r, Construction &c)
+	{
+		tools::Sparse_matrix H, G;
+		r.read(H);
+		r.read(G);
+		r.read(c.info_bits_pos);
+		r.read(c.G_info_bits_pos);
+		r.read(c.pct_pattern);
+		c.H = Codec_LDPC<B,Q>::share_vertical(std::move(H));
+		c.G = Codec_LDPC<B,Q>::share_vertical(std::move(G));
+	};
+
+	return tools::Construction_cache<Construction>::get(key.str(), [&]()
+	{
+		// between the runs, the constructions are identified by the content of the matrix files
+		std::stringstream disk_key;
+		disk_key << key.str() << ";" << tools::Disk_cache::hash_file(enc_params.G_path)
+		                      << ";" << tools::Disk_cache::hash_file(dec_params.H_path);
+
+		std::unique_ptr<Construction> c(tools::Disk_cache::get<Construction>("ldpc", disk_key.str(), build, save, load));
+
+		// the DVB-S2 tables are not stored, they are only a few values
+		if (enc_params.type == "LDPC_DVBS2" && c->dvbs2 == nullptr)
+			c->dvbs2 = tools::build_dvbs2(enc_params.K, N);
+
+		// G has not been built (so not saved) if it comes from the disk cache
+		if (!built && enc_params.type == "LDPC_H" && !enc_params.G_save_path.empty())
+			Encoder_LDPC_from_H<B>::save_G(*c->G, c->G_info_bits_pos, enc_params.G_save_path);
+
+		return c.release();
+	});
+}
+
+template <typename B, typename Q>
+std::shared_ptr<const tools::Sparse_matrix> Codec_LDPC<B,Q>
+::share_vertical(tools::Sparse_matrix &&matrix)
+{
+	matrix.self_turn(tools::Matrix::Way::VERTICAL);
+	return std::make_shared<const tools::Sparse_matrix>(std::move(matrix));
+}
+
 template <typename B, typename Q>
 void Codec_LDPC<B,Q>
 ::_extract_sys_par(const Q *Y_N, Q *sys, Q *par, const int frame_id)
@@ -1,6 +1,8 @@
 #ifndef CODEC_LDPC_HPP_
 #define CODEC_LDPC_HPP_
 
+#include <memory>
+#include <string>
 #include <cstdint>
 
 #include "Factory/Module/Encoder/LDPC/Encoder_LDPC.hpp"
@@ -21,19 +23,34 @@ template <typename B = int, typename Q = float>
 class Codec_LDPC : public Codec_SISO_SIHO<B,Q>
 {
 protected:
-	tools::Sparse_matrix H;
-	tools::Sparse_matrix G;
+	// the structures of the code, built once and shared (read-only) by all the codecs with the same parameters
+	struct Construction
+	{
+		std::shared_ptr<const tools::Sparse_matrix> H; // in vertical way, shared by all the encoders and the decoders
+		std::shared_ptr<const tools::Sparse_matrix> G; // in vertical way, empty if the encoder does not need it
+		tools::LDPC_matrix_handler::Positions_vector info_bits_pos;
+		tools::LDPC_matrix_handler::Positions_vector G_info_bits_pos; // computed with G (only for the LDPC_H encoder)
+		std::vector<bool> pct_pattern;
+		std::unique_ptr<tools::dvbs2_values> dvbs2;
+	};
+
+	std::shared_ptr<const Construction> cstr;
+	const std::shared_ptr<const tools::Sparse_matrix> &H;
+	const std::shared_ptr<const tools::Sparse_matrix> &G;
 	tools::LDPC_matrix_handler::Positions_vector info_bits_pos;
-	std::vector<bool> pctPattern;
-	std::unique_ptr<tools::dvbs2_values> dvbs2;
 
 public:
-	Codec_LDPC(const factory::Encoder_LDPC::parameters   &enc_params,
-	           const factory::Decoder_LDPC::parameters   &dec_params,
-	                 factory::Puncturer_LDPC::parameters *pct_params);
+	Codec_LDPC(const factory::Encoder_LDPC  ::parameters &enc_params,
+	           const factory::Decoder_LDPC  ::parameters &dec_params,
+	           const factory::Puncturer_LDPC::parameters *pct_params);
 	virtual ~Codec_LDPC() = default;
 
 protected:
+	static std::shared_ptr<const Construction> get_construction(const factory::Encoder_LDPC  ::parameters &enc_params,
+	                                                            const factory::Decoder_LDPC  ::parameters &dec_params,
+	                                                            const factory::Puncturer_LDPC::parameters *pct_params);
+	static std::shared_ptr<const tools::Sparse_matrix> share_vertical(tools::Sparse_matrix &&matrix);
+
 	void _extract_sys_par(const Q *Y_N, Q *sys, Q *par, const int frame_id);
 	void _extract_sys_llr(const Q *Y_N, Q *Y_K,         const int frame_id);
 	void _extract_sys_bit(const Q *Y_N, B *V_K,         const int frame_id);
@@ -1,6 +1,10 @@
 #include <sstream>
+#include <iomanip>
+#include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Algo/Construction_cache/Construction_cache.hpp"
+#include "Tools/Algo/Construction_cache/Disk_cache.hpp"
 
 #include "Codec_polar.hpp"
 
@@ -19,6 +23,9 @@ Codec_polar<B,Q>
   adaptive_fb(fb_params.noise == -1.f),
   frozen_bits(fb_params.N_cw, true),
   generated_decoder((dec_params.implem.find("_SNR") != std::string::npos)),
+  fb_key(fb_params.type + ";" + std::to_string(fb_params.K) + ";" + std::to_string(fb_params.N_cw) + ";" +
+         fb_params.path_fb),
+  fb_persist(fb_params.type == "GA" || fb_params.type == "BEC"),
   puncturer_shortlast(nullptr),
   fb_decoder(nullptr),
   fb_encoder(nullptr)
@@ -125,15 +132,14 @@ Codec_polar<B,Q>
 			if(fb_params.type == "BEC")
 			{
 				auto ep = tools::Event_probability<float>(fb_params.noise);
-				fb_generator->set_noise(ep);
+				this->generate_frozen_bits(ep);
 			}
 			else /* type = GA, TV or FILE */
 			{
 				auto sigma = tools::Sigma<float>(fb_params.noise);
-				fb_generator->set_noise(sigma);
+				this->generate_frozen_bits(sigma);
 			}
 
-			fb_generator->generate(frozen_bits);
 			this->notify_frozenbits_update();
 		}
 	}
@@ -173,13 +179,54 @@ void Codec_polar<B,Q>
 	// adaptive frozen bits generation
 	if (adaptive_fb && !generated_decoder)
 	{
-		fb_generator->set_noise(noise);
-		fb_generator->generate(frozen_bits);
-
+		this->generate_frozen_bits(noise);
 		this->notify_frozenbits_update();
 	}
 }
 
+template <typename B, typename Q>
+void Codec_polar<B,Q>
+::generate_frozen_bits(const tools::Noise<float>& noise)
+{
+	fb_generator->set_noise(noise);
+
+	// the short-last puncturer reads the best channels in the generator: it has to be evaluated by each codec
+	if (puncturer_shortlast)
+	{
+		fb_generator->generate(frozen_bits);
+		return;
+	}
+
+	// the frozen bits are computed by the first codec and then shared with the other ones (the other threads)
+	std::stringstream key;
+	key << fb_key << ";" << tools::type_to_str(noise.get_type()) << ";" << std::setprecision(9) << noise.get_noise();
+
+	fb_shared = tools::Construction_cache<std::vector<bool>>::get(key.str(), [&]()
+	{
+		auto build = [&]()
+		{
+			std::unique_ptr<std::vector<bool>> fb(new std::vector<bool>(frozen_bits.size()));
+			fb_generator->generate(*fb);
+			return fb.release();
+		};
+
+		// the files based generators (TV and FILE) already have their own persistent storage
+		if (!fb_persist)
+			return build();
+
+		return tools::Disk_cache::get<std::vector<bool>>("polar_fb", key.str(), build,
+			[](tools::Disk_cache::Writer &w, const std::vector<bool> &fb) { w.write(fb); },
+			[&](tools::Disk_cache::Reader &r, std::vector<bool> &fb)
+			{
+				r.read(fb);
+				if (fb.size() != frozen_bits.size())
+					throw tools::runtime_error(__FILE__, __LINE__, __func__, "Wrong number of frozen bits.");
+			});
+	});
+
+	std::copy(fb_shared->begin(), fb_shared->end(), frozen_bits.begin());
+}
+
 template <typename B, typename Q>
 std::vector<bool>& Codec_polar<B,Q>
 ::get_frozen_bits()
@@ -1,6 +1,10 @@
 #ifndef CODEC_POLAR_HPP_
 #define CODEC_POLAR_HPP_
 
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator.hpp"
 #include "Tools/Code/Polar/Frozenbits_notifier.hpp"
 
@@ -26,6 +30,9 @@ protected:
 	const bool generated_decoder;
 
 	std::unique_ptr<tools::Frozenbits_generator>    fb_generator;
+	const std::string                               fb_key;       // identifies the frozen bits in the shared cache
+	std::shared_ptr<const std::vector<bool>>        fb_shared;    // keeps the current frozen bits in the shared cache
+	const bool                                      fb_persist;   // the frozen bits can be stored in the disk cache
 
 	Puncturer_polar_shortlast<B,Q>*  puncturer_shortlast;
 	tools::Frozenbits_notifier*      fb_decoder;
@@ -46,6 +53,8 @@ public:
 	virtual void notify_frozenbits_update();
 
 protected:
+	void generate_frozen_bits(const tools::Noise<float>& noise);
+
 	void _extract_sys_par(const Q *Y_N, Q *sys, Q *par, const int frame_id);
 	void _extract_sys_llr(const Q *Y_N, Q *sys,         const int frame_id);
 	void _add_sys_ext    (const Q *ext, Q *Y_N,         const int frame_id);
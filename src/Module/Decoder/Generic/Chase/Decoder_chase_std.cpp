@@ -18,7 +18,8 @@ Decoder_chase_std<B,R>
   Decoder_SIHO<B,R>(K, N, n_frames, 1),
   encoder(encoder),
   best_X_N(N),
-  less_reliable_llrs(N),
+  less_reliable_llrs(max_flips),
+  sorter(N),
   max_flips(max_flips),
   hamming(hamming),
   min_euclidean_dist(std::numeric_limits<float>::max()),
@@ -140,14 +141,7 @@ void Decoder_chase_std<B,R>
 
 	if (this->max_flips && !this->encoder.is_codeword(V_N))
 	{
-		std::iota(less_reliable_llrs.begin(), less_reliable_llrs.end(), 0);
-
-		std::partial_sort(less_reliable_llrs.begin(),
-		                  less_reliable_llrs.begin() + this->max_flips,
-		                  less_reliable_llrs.end(),
-		                  [&Y_N](const uint32_t i1, const uint32_t i2) {
-			return std::abs(Y_N[i1]) < std::abs(Y_N[i2]);
-		});
+		this->sorter.partial_sort_abs(Y_N, this->less_reliable_llrs, this->N, this->max_flips);
 
 		V_N[less_reliable_llrs[0]] = !V_N[less_reliable_llrs[0]];
 		if (!this->encoder.is_codeword(V_N))
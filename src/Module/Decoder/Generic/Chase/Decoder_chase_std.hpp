@@ -1,6 +1,7 @@
 #ifndef DECODER_CHASE_STD_HPP_
 #define DECODER_CHASE_STD_HPP_
 
+#include "Tools/Algo/Sort/Bitonic_sorter.hpp"
 #include "Module/Encoder/Encoder.hpp"
 
 #include "../../Decoder_SIHO_HIHO.hpp"
@@ -15,7 +16,8 @@ class Decoder_chase_std : public Decoder_SIHO<B,R>
 protected:
 	Encoder<B> &encoder;
 	std::vector<B> best_X_N;
-	std::vector<uint32_t> less_reliable_llrs;
+	std::vector<int> less_reliable_llrs;
+	tools::Bitonic_sorter<R> sorter;
 	const uint32_t max_flips;
 	const bool hamming;
 	float min_euclidean_dist;
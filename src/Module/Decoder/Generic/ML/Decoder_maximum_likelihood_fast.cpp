@@ -0,0 +1,273 @@
+#include <limits>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Perf/common/hard_decide.h"
+
+#include "Decoder_maximum_likelihood_fast.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B, typename R>
+Decoder_maximum_likelihood_fast<B,R>
+::Decoder_maximum_likelihood_fast(const int K, const int N, Encoder<B> &encoder, const bool hamming,
+                                  const int n_threads, const int n_frames)
+: Decoder                        (K, N,          n_frames, 1),
+  Decoder_maximum_likelihood<B,R>(K, N, encoder, n_frames   ),
+  hamming  (hamming),
+  n_threads(n_threads),
+  n_workers(K < 64 && n_threads > 0 ? (int)std::min((uint64_t)n_threads, (uint64_t)1 << K) : 1),
+  K_sub    (K - tools::Bit_matrix::ctz((uint64_t)n_workers)),
+  n_reg    ((N + mipp::nElReg<float>() -1) / mipp::nElReg<float>()),
+  n_words  ((N + tools::Bit_matrix::word_size -1) / tools::Bit_matrix::word_size),
+  row_signs((size_t)K * n_reg * mipp::nElReg<float>(), 0.f),
+  row_bits (K, N),
+  Y_f      ((size_t)n_reg * mipp::nElReg<float>(), 0.f),
+  Y_bits   (n_words, 0),
+  best_u   (0),
+  best_eucl(n_workers, 0.f),
+  best_hamm(n_workers, 0  ),
+  best_msg (n_workers, 0  ),
+  team     (nullptr)
+{
+	const std::string name = "Decoder_maximum_likelihood_fast";
+	this->set_name(name);
+
+	if (K > 63)
+	{
+		std::stringstream message;
+		message << "'K' has to be smaller than 64 ('K' = " << K << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (n_threads <= 0 || (n_threads & (n_threads -1)))
+	{
+		std::stringstream message;
+		message << "'n_threads' has to be a power of 2 ('n_threads' = " << n_threads << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->build_generator_rows();
+
+	if (n_workers > 1)
+		this->team.reset(new tools::Thread_team(n_workers));
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::build_generator_rows()
+{
+	// the null message has to give the null codeword, else the encoder is not linear
+	std::fill(this->U_K.begin(), this->U_K.end(), (B)0);
+	this->encoder.encode(this->U_K.data(), this->X_N.data(), 0);
+	if (std::any_of(this->X_N.begin(), this->X_N.begin() + this->N, [](const B b) { return b != (B)0; }))
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "The encoder has to be linear.");
+
+	const auto stride = n_reg * mipp::nElReg<float>();
+	for (auto k = 0; k < this->K; k++)
+	{
+		std::fill(this->U_K.begin(), this->U_K.end(), (B)0);
+		this->U_K[k] = (B)1;
+		this->encoder.encode(this->U_K.data(), this->X_N.data(), 0);
+
+		for (auto n = 0; n < this->N; n++)
+			if (this->X_N[n])
+			{
+				this->row_signs[(size_t)k * stride + n] = -0.f;
+				this->row_bits.set(k, n);
+			}
+	}
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::explore_euclidean(const uint64_t prefix, const int K_sub, float &best_metric, uint64_t &best_msg) const
+{
+	const auto L      = mipp::nElReg<float>();
+	const auto stride = n_reg * L;
+
+	// 't' contains the LLRs multiplied by the BPSK symbols of the current codeword, so the correlation is sum(t)
+	mipp::vector<float> t(this->Y_f);
+	for (auto k = K_sub; k < this->K; k++)
+		if ((prefix >> k) & 1)
+			for (auto i = 0; i < stride; i += L)
+			{
+				const mipp::Reg<float> r_t = &t[i];
+				const mipp::Reg<float> r_s = &this->row_signs[(size_t)k * stride + i];
+				(r_t ^ r_s).store(&t[i]);
+			}
+
+	mipp::Reg<float> r_sum = 0.f;
+	for (auto i = 0; i < stride; i += L)
+		r_sum += mipp::Reg<float>(&t[i]);
+
+	// maximize the correlation <=> minimize the Euclidean distance
+	best_metric = mipp::hadd(r_sum);
+	best_msg    = prefix;
+
+	const uint64_t n_msg = (uint64_t)1 << K_sub;
+	for (uint64_t i = 1; i < n_msg; i++)
+	{
+		// in Gray-code order, the message 'i' differs from the message 'i -1' by the bit 'ctz(i)'
+		const auto  k    = tools::Bit_matrix::ctz(i);
+		const auto *row  = &this->row_signs[(size_t)k * stride];
+
+		r_sum = 0.f;
+		for (auto j = 0; j < stride; j += L)
+		{
+			const auto r_t = mipp::Reg<float>(&t[j]) ^ mipp::Reg<float>(row + j);
+			r_t.store(&t[j]);
+			r_sum += r_t;
+		}
+
+		const auto metric = mipp::hadd(r_sum);
+		if (metric > best_metric)
+		{
+			best_metric = metric;
+			best_msg    = prefix | (i ^ (i >> 1));
+		}
+	}
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::explore_hamming(const uint64_t prefix, const int K_sub, uint32_t &best_metric, uint64_t &best_msg) const
+{
+	// 'x' contains the XOR between the current codeword and the hard decisions, so the distance is popcount(x)
+	std::vector<tools::Bit_matrix::word_t> x(this->Y_bits);
+	for (auto k = K_sub; k < this->K; k++)
+		if ((prefix >> k) & 1)
+			for (auto w = 0; w < n_words; w++)
+				x[w] ^= this->row_bits[k][w];
+
+	best_metric = 0;
+	for (auto w = 0; w < n_words; w++)
+		best_metric += tools::Bit_matrix::popcount(x[w]);
+	best_msg = prefix;
+
+	const uint64_t n_msg = (uint64_t)1 << K_sub;
+	for (uint64_t i = 1; i < n_msg; i++)
+	{
+		const auto  k   = tools::Bit_matrix::ctz(i);
+		const auto *row = this->row_bits[k];
+
+		uint32_t metric = 0;
+		for (auto w = 0; w < n_words; w++)
+		{
+			x[w] ^= row[w];
+			metric += tools::Bit_matrix::popcount(x[w]);
+		}
+
+		if (metric < best_metric)
+		{
+			best_metric = metric;
+			best_msg    = prefix | (i ^ (i >> 1));
+		}
+	}
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::explore(const bool euclidean)
+{
+	// the 'p' MSBs of the messages select the sub-space explored by each worker
+	auto worker = [&](const int w)
+	{
+		const auto prefix = (uint64_t)w << K_sub;
+		if (euclidean)
+			this->explore_euclidean(prefix, K_sub, this->best_eucl[w], this->best_msg[w]);
+		else
+			this->explore_hamming(prefix, K_sub, this->best_hamm[w], this->best_msg[w]);
+	};
+
+	if (this->team != nullptr)
+		this->team->run(worker);
+	else
+		worker(0);
+
+	auto best_w = 0;
+	for (auto w = 1; w < n_workers; w++)
+		if (( euclidean && this->best_eucl[w] > this->best_eucl[best_w]) ||
+		    (!euclidean && this->best_hamm[w] < this->best_hamm[best_w]))
+			best_w = w;
+
+	this->best_u = this->best_msg[best_w];
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::message_to_codeword(const uint64_t u, B *V_N)
+{
+	for (auto k = 0; k < this->K; k++)
+		this->best_U_K[k] = (B)((u >> k) & 1);
+
+	// only one encoding per frame to rebuild the best codeword
+	this->encoder.encode(this->best_U_K.data(), this->X_N.data(), 0);
+	std::copy(this->X_N.begin(), this->X_N.begin() + this->N, V_N);
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	this->_decode_siho_cw(Y_N, this->best_X_N.data(), frame_id);
+	std::copy(this->best_U_K.begin(), this->best_U_K.end(), V_K);
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+	// compute Hamming distance instead of Euclidean distance
+	if (hamming)
+	{
+		tools::hard_decide(Y_N, this->hard_Y_N.data(), this->N);
+		this->_decode_hiho_cw(this->hard_Y_N.data(), V_N, frame_id);
+	}
+	else
+	{
+		for (auto n = 0; n < this->N; n++)
+			this->Y_f[n] = (float)Y_N[n];
+
+		this->explore(true);
+		this->message_to_codeword(this->best_u, V_N);
+	}
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::_decode_hiho(const B *Y_N, B *V_K, const int frame_id)
+{
+	this->_decode_hiho_cw(Y_N, this->best_X_N.data(), frame_id);
+	std::copy(this->best_U_K.begin(), this->best_U_K.end(), V_K);
+}
+
+template <typename B, typename R>
+void Decoder_maximum_likelihood_fast<B,R>
+::_decode_hiho_cw(const B *Y_N, B *V_N, const int frame_id)
+{
+	// the hard decisions are packed as a row of the 'row_bits' matrix
+	using word_t = tools::Bit_matrix::word_t;
+	const auto W = (int)tools::Bit_matrix::word_size;
+	std::fill(this->Y_bits.begin(), this->Y_bits.end(), (word_t)0);
+	for (auto n = 0; n < this->N; n++)
+		if (Y_N[n])
+			this->Y_bits[n / W] |= (word_t)1 << (n % W);
+
+	this->explore(false);
+	this->message_to_codeword(this->best_u, V_N);
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_maximum_likelihood_fast<B_8,Q_8>;
+template class aff3ct::module::Decoder_maximum_likelihood_fast<B_16,Q_16>;
+template class aff3ct::module::Decoder_maximum_likelihood_fast<B_32,Q_32>;
+template class aff3ct::module::Decoder_maximum_likelihood_fast<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_maximum_likelihood_fast<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
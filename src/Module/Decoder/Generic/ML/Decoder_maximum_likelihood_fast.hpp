@@ -0,0 +1,77 @@
+#ifndef DECODER_MAXIMUM_LIKELIHOOD_FAST_HPP_
+#define DECODER_MAXIMUM_LIKELIHOOD_FAST_HPP_
+
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <mipp.h>
+
+#include "Tools/Algo/Matrix/Bit_matrix/Bit_matrix.hpp"
+#include "Tools/Algo/Thread_team/Thread_team.hpp"
+
+#include "Decoder_maximum_likelihood.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_maximum_likelihood_fast
+ *
+ * \brief Exhaustive ML decoder walking the message space in Gray-code order.
+ *
+ * The generator rows (codewords of the unit messages) are precomputed once. Two consecutive messages in Gray-code
+ * order differ by only one bit so the next candidate is obtained by applying one generator row:
+ *   - Euclidean distance: the correlation between the LLRs and the BPSK codeword is updated with one SIMD XOR of the
+ *     sign bits (the row) and one horizontal sum,
+ *   - Hamming distance: the bit-packed codeword is updated with one XOR per 64-bit word and the distance is a popcount.
+ * The message space can be split in 2^p sub-spaces decoded by the 2^p members of a persistent team of threads.
+ * The encoder has to be linear and 'K' has to be smaller than 64.
+ */
+template <typename B = int, typename R = float>
+class Decoder_maximum_likelihood_fast : public Decoder_maximum_likelihood<B,R>
+{
+protected:
+	const bool hamming;
+	const int  n_threads;          // number of threads (power of 2)
+	const int  n_workers;          // number of explored sub-spaces: 'n_threads' limited to 2^K
+	const int  K_sub;              // number of bits of the messages of a sub-space
+	const int  n_reg;              // number of SIMD registers to store a frame of 'N' floats
+	const int  n_words;            // number of 64-bit words to store a frame of 'N' bits
+	mipp::vector<float> row_signs; // the K generator rows as floating-point sign masks (-0.f when the bit is set)
+	tools::Bit_matrix row_bits;    // the K generator rows packed in 64-bit words
+	mipp::vector<float> Y_f;       // the input LLRs converted in float and padded
+	std::vector<tools::Bit_matrix::word_t> Y_bits; // the input hard decisions packed in 64-bit words
+	uint64_t best_u;
+	std::vector<float   > best_eucl;          // the best metric of each worker (Euclidean distance)
+	std::vector<uint32_t> best_hamm;          // the best metric of each worker (Hamming distance)
+	std::vector<uint64_t> best_msg;           // the best message of each worker
+	std::unique_ptr<tools::Thread_team> team; // created once, the frames are decoded without thread creation
+
+public:
+	Decoder_maximum_likelihood_fast(const int K, const int N, Encoder<B> &encoder, const bool hamming = false,
+	                                const int n_threads = 1, const int n_frames = 1);
+	virtual ~Decoder_maximum_likelihood_fast() = default;
+
+protected:
+	void _decode_siho   (const R *Y_N,  B *V_K, const int frame_id);
+	void _decode_siho_cw(const R *Y_N,  B *V_N, const int frame_id);
+	void _decode_hiho   (const B *Y_N,  B *V_K, const int frame_id);
+	void _decode_hiho_cw(const B *Y_N,  B *V_N, const int frame_id);
+
+	void build_generator_rows();
+
+	// explore the messages whose 'p' MSBs are equal to 'prefix', return the best metric and the best message
+	void explore_euclidean(const uint64_t prefix, const int K_sub, float    &best_metric, uint64_t &best_msg) const;
+	void explore_hamming  (const uint64_t prefix, const int K_sub, uint32_t &best_metric, uint64_t &best_msg) const;
+
+	void explore(const bool euclidean);
+	void message_to_codeword(const uint64_t u, B *V_N);
+};
+
+template <typename B = int, typename R = float>
+using Decoder_ML_fast = Decoder_maximum_likelihood_fast<B,R>;
+}
+}
+
+#endif /* DECODER_MAXIMUM_LIKELIHOOD_FAST_HPP_ */
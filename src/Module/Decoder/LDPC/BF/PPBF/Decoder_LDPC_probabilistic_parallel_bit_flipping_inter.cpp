@@ -0,0 +1,248 @@
+#include <cmath>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Perf/common/hard_decide.h"
+#include "Tools/Exception/exception.hpp"
+
+#include "Decoder_LDPC_probabilistic_parallel_bit_flipping_inter.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B, typename R>
+Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B,R>
+::Decoder_LDPC_probabilistic_parallel_bit_flipping_inter(const int &K, const int &N, const int& n_ite,
+                                                         const tools::Sparse_matrix &_H,
+                                                         const std::vector<unsigned> &info_bits_pos,
+                                                         const std::vector<float> &bernouilli_probas,
+                                                         const bool enable_syndrome,
+                                                         const int syndrome_depth,
+                                                         const int seed,
+                                                         const int n_frames)
+: Decoder               (K, N, n_frames, BS::n_lanes                                     ),
+  Decoder_SIHO_HIHO<B,R>(K, N, n_frames, BS::n_lanes                                     ),
+  n_ite                 (n_ite                                                           ),
+  enable_syndrome       (enable_syndrome                                                 ),
+  syndrome_depth        (syndrome_depth                                                  ),
+  H                     (_H.turn(tools::Sparse_matrix::Way::VERTICAL)                    ),
+  info_bits_pos         (info_bits_pos                                                   ),
+  thresholds            (bernouilli_probas.size()                                        ),
+  rd_engine             (seed                                                            ),
+  n_planes              (BS::n_planes((unsigned)this->H.get_rows_max_degree() +1)       ),
+  YH_N                  (N * BS::n_lanes                                                 ),
+  Y_bs                  (N                                                               ),
+  var_nodes             (N                                                               ),
+  check_nodes           (this->H.get_n_cols()                                            ),
+  energy                (n_planes                                                        ),
+  syndrome_depths       (BS::n_lanes, 0                                                  )
+{
+	const std::string name = "Decoder_LDPC_probabilistic_parallel_bit_flipping_inter";
+	this->set_name(name);
+
+	if (n_ite <= 0)
+	{
+		std::stringstream message;
+		message << "'n_ite' has to be greater than 0 ('n_ite' = " << n_ite << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (syndrome_depth <= 0)
+	{
+		std::stringstream message;
+		message << "'syndrome_depth' has to be greater than 0 ('syndrome_depth' = " << syndrome_depth << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (N != (int)this->H.get_n_rows())
+	{
+		std::stringstream message;
+		message << "'N' is not compatible with the H matrix ('N' = " << N << ", 'H.get_n_rows()' = "
+		        << this->H.get_n_rows() << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (bernouilli_probas.size() != (this->H.get_rows_max_degree() + 2))
+	{
+		std::stringstream message;
+		message << "'bernouilli_probas.size()' must be equal to the biggest variable node degree plus 2"
+		        << "('bernouilli_probas.size() = '" << bernouilli_probas.size() << ", 'variable node max degree' = "
+		        << this->H.get_rows_max_degree() << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the probabilities are converted in 0.32 fixed-point to be compared with 32 random bits
+	const auto one = (uint64_t)1 << 32;
+	for (unsigned i = 0; i < bernouilli_probas.size(); i++)
+	{
+		const auto p = std::min(std::max((double)bernouilli_probas[i], 0.0), 1.0);
+		this->thresholds[i] = std::min((uint64_t)std::llround(p * (double)one), one);
+	}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B,R>
+::_decode_hiho(const B *Y_N, B *V_K, const int frame_id)
+{
+	this->decode(Y_N, frame_id);
+	BS::unpack(this->var_nodes.data(), V_K, this->info_bits_pos);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B,R>
+::_decode_hiho_cw(const B *Y_N, B *V_N, const int frame_id)
+{
+	this->decode(Y_N, frame_id);
+	BS::unpack(this->var_nodes.data(), V_N, this->N);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B,R>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	tools::hard_decide(Y_N, this->YH_N.data(), this->N * BS::n_lanes);
+	this->decode(this->YH_N.data(), frame_id);
+	BS::unpack(this->var_nodes.data(), V_K, this->info_bits_pos);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B,R>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+	tools::hard_decide(Y_N, this->YH_N.data(), this->N * BS::n_lanes);
+	this->decode(this->YH_N.data(), frame_id);
+	BS::unpack(this->var_nodes.data(), V_N, this->N);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B,R>
+::decode(const B *Y_N, const int frame_id)
+{
+	BS::pack(Y_N, this->Y_bs.data(), this->N);
+	std::copy(this->Y_bs.begin(), this->Y_bs.end(), this->var_nodes.begin());
+	std::fill(this->syndrome_depths.begin(), this->syndrome_depths.end(), 0);
+
+	// a frame stops to be updated when its syndrome has been verified 'syndrome_depth' times in a row
+	auto active = BS::lanes(std::min(BS::n_lanes, this->n_frames - frame_id));
+
+	for (auto ite = 0; ite < this->n_ite && active; ite++)
+	{
+		const auto verified = this->cn_process();
+
+		if (this->enable_syndrome)
+		{
+			for (auto f = 0; f < BS::n_lanes; f++)
+			{
+				if (!((active >> f) & (W)1))
+					continue;
+
+				if ((verified >> f) & (W)1)
+				{
+					this->syndrome_depths[f]++;
+					if (this->syndrome_depths[f] >= this->syndrome_depth)
+						active &= ~((W)1 << f);
+				}
+				else
+					this->syndrome_depths[f] = 0;
+			}
+
+			if (!active)
+				break;
+		}
+
+		this->vn_process(active);
+	}
+}
+
+template <typename B, typename R>
+typename Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B,R>::W
+Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B,R>
+::cn_process()
+{
+	W unsat = (W)0;
+
+	// for each check nodes
+	const auto n_chk_nodes = (int)this->H.get_n_cols();
+	for (auto c = 0; c < n_chk_nodes; c++)
+	{
+		const auto& chk_node = this->H.get_col_to_rows()[c];
+
+		W parity = (W)0;
+		for (auto v : chk_node)
+			parity ^= this->var_nodes[v];
+
+		this->check_nodes[c] = parity;
+		unsat |= parity;
+	}
+
+	return ~unsat;
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B,R>
+::vn_process(const W frames_active)
+{
+	const auto cnt = this->energy.data();
+
+	// for each variable nodes
+	const auto n_var_nodes = (int)this->H.get_n_rows();
+	for (auto v = 0; v < n_var_nodes; v++)
+	{
+		const auto& var_node = this->H.get_row_to_cols()[v];
+		const auto var_degree = (int)var_node.size();
+
+		std::fill(this->energy.begin(), this->energy.end(), (W)0);
+		BS::inc(cnt, this->n_planes, this->var_nodes[v] ^ this->Y_bs[v]);
+		for (auto c : var_node)
+			BS::inc(cnt, this->n_planes, this->check_nodes[c]);
+
+		W flip = (W)0;
+		for (auto e = 0; e <= var_degree +1; e++)
+		{
+			const auto mask = BS::eq(cnt, this->n_planes, (unsigned)e) & frames_active;
+			if (mask)
+				flip |= this->draw_bernoulli(this->thresholds[e], mask);
+		}
+
+		this->var_nodes[v] ^= flip;
+	}
+}
+
+template <typename B, typename R>
+typename Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B,R>::W
+Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B,R>
+::draw_bernoulli(const uint64_t threshold, const W mask)
+{
+	if (threshold == 0)
+		return (W)0;
+	if (threshold >> 32)
+		return mask;
+
+	// U < threshold where U is a 32-bit uniform integer per lane, the bits of U are drawn from the MSB
+	W lower = (W)0, equal = mask;
+	for (auto k = 31; k >= 0 && equal; k--)
+	{
+		const auto u = (W)this->rd_engine();
+		if ((threshold >> k) & 1)
+		{
+			lower |= equal & ~u;
+			equal &= u;
+		}
+		else
+			equal &= ~u;
+	}
+
+	return lower;
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B_8,Q_8>;
+template class aff3ct::module::Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B_16,Q_16>;
+template class aff3ct::module::Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B_32,Q_32>;
+template class aff3ct::module::Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
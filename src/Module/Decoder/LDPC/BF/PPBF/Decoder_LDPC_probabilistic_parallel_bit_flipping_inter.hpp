@@ -0,0 +1,87 @@
+#ifndef DECODER_LDPC_PROBABILISTIC_PARALLEL_BIT_FLIPPING_INTER_HPP_
+#define DECODER_LDPC_PROBABILISTIC_PARALLEL_BIT_FLIPPING_INTER_HPP_
+
+#include <random>
+#include <cstdint>
+
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Perf/Bit_slice/Bit_slice.hpp"
+
+#include "../../../Decoder_SIHO_HIHO.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_LDPC_probabilistic_parallel_bit_flipping_inter
+ *
+ * \brief Bit-sliced version of the Decoder_LDPC_probabilistic_parallel_bit_flipping: 64 frames are decoded at once.
+ *
+ * The energies of the variable nodes are bit-sliced counters. The Bernoulli draws of the 64 frames are made at once
+ * by comparing uniform random words with the binary expansion of the flipping probability (from the MSB, the
+ * comparison stops as soon as all the lanes are decided).
+ */
+template <typename B = int, typename R = float>
+class Decoder_LDPC_probabilistic_parallel_bit_flipping_inter : public Decoder_SIHO_HIHO<B,R>
+{
+protected:
+	typedef uint64_t            W;
+	typedef tools::Bit_slice<W> BS;
+
+	const int  n_ite;      // number of iterations to perform
+	const bool enable_syndrome;
+	const int  syndrome_depth;
+
+	const tools::Sparse_matrix  H; // In vertical way
+	                               // CN are along the columns -> H.get_n_cols() == M (often M=N-K)
+	                               // VN are along the rows    -> H.get_n_rows() == N
+	                               // automatically transpose in the constructor if needed
+
+	const std::vector<unsigned> &info_bits_pos;
+
+	std::vector<uint64_t> thresholds; // Bernoulli probabilities in 0.32 fixed-point (2^32 means always)
+	std::mt19937_64 rd_engine;        // Mersenne Twister 19937 (64-bit)
+
+	const int n_planes;               // number of bit planes of the energies
+	std::vector<B> YH_N;              // hard decisions of the frames of the wave
+	std::vector<W> Y_bs;              // input bits      (bit-sliced)
+	std::vector<W> var_nodes;         // variable nodes  (bit-sliced)
+	std::vector<W> check_nodes;       // check nodes     (bit-sliced)
+	std::vector<W> energy;            // bit-sliced energy of a variable node
+	std::vector<int> syndrome_depths; // current syndrome depth of each frame
+
+public:
+	Decoder_LDPC_probabilistic_parallel_bit_flipping_inter(const int &K, const int &N, const int& n_ite,
+	                                                       const tools::Sparse_matrix &H,
+	                                                       const std::vector<unsigned> &info_bits_pos,
+	                                                       const std::vector<float> &bernouilli_probas,
+	                                                       const bool enable_syndrome = true,
+	                                                       const int syndrome_depth = 1,
+	                                                       const int seed = 0,
+	                                                       const int n_frames = 1);
+	virtual ~Decoder_LDPC_probabilistic_parallel_bit_flipping_inter() = default;
+
+protected:
+	void _decode_siho   (const R *Y_N, B *V_K, const int frame_id);
+	void _decode_siho_cw(const R *Y_N, B *V_N, const int frame_id);
+
+	void _decode_hiho   (const B *Y_N, B *V_K, const int frame_id);
+	void _decode_hiho_cw(const B *Y_N, B *V_N, const int frame_id);
+
+	void decode(const B *Y_N, const int frame_id);
+
+	// return the frames which syndrome is verified
+	W    cn_process(                     );
+	void vn_process(const W frames_active);
+
+	// return a word where the lanes of 'mask' are set with the probability of 'threshold'
+	W draw_bernoulli(const uint64_t threshold, const W mask);
+};
+
+template <typename B = int, typename R = float>
+using Decoder_LDPC_PPBF_inter = Decoder_LDPC_probabilistic_parallel_bit_flipping_inter<B,R>;
+}
+}
+
+#endif /* DECODER_LDPC_PROBABILISTIC_PARALLEL_BIT_FLIPPING_INTER_HPP_ */
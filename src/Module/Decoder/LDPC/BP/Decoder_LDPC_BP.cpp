@@ -9,14 +9,16 @@ using namespace aff3ct::module;
 
 Decoder_LDPC_BP
 ::Decoder_LDPC_BP(const int K, const int N, const int n_ite,
-                  const tools::Sparse_matrix &_H,
+                  const std::shared_ptr<const tools::Sparse_matrix> &_H,
                   const bool enable_syndrome,
                   const int syndrome_depth)
-: n_ite             (n_ite                                       ),
-  H                 (_H.turn(tools::Sparse_matrix::Way::VERTICAL)),
-  enable_syndrome   (enable_syndrome                             ),
-  syndrome_depth    (syndrome_depth                              ),
-  cur_syndrome_depth(0                                           )
+: n_ite             (n_ite                                                                  ),
+  H_ptr             (_H->is_of_way(tools::Sparse_matrix::Way::VERTICAL) ? _H :
+                     std::make_shared<const tools::Sparse_matrix>(_H->turn(tools::Sparse_matrix::Way::VERTICAL))),
+  H                 (*H_ptr                                                                 ),
+  enable_syndrome   (enable_syndrome                                                        ),
+  syndrome_depth    (syndrome_depth                                                         ),
+  cur_syndrome_depth(0                                                                      )
 {
 	if (n_ite <= 0)
 	{
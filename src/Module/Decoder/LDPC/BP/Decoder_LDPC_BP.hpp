@@ -1,6 +1,8 @@
 #ifndef DECODER_LDPC_BP_HPP_
 #define DECODER_LDPC_BP_HPP_
 
+#include <memory>
+
 #include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
 #include "Tools/Code/LDPC/Syndrome/LDPC_syndrome.hpp"
 
@@ -11,19 +13,20 @@ namespace module
 class Decoder_LDPC_BP
 {
 protected:
-	const int                   n_ite;
-	const tools::Sparse_matrix  H; // In vertical way
-	                               // CN are along the columns -> H.get_n_cols() == M (often M=N-K)
-	                               // VN are along the rows    -> H.get_n_rows() == N
-	                               // automatically transpose in the constructor if needed
-	const bool                  enable_syndrome;
-	const int                   syndrome_depth;
+	const int                                          n_ite;
+	const std::shared_ptr<const tools::Sparse_matrix>  H_ptr; // shared with the other modules built on the same code
+	const tools::Sparse_matrix                        &H; // In vertical way
+	                                                      // CN along the columns -> H.get_n_cols() == M (often M=N-K)
+	                                                      // VN along the rows    -> H.get_n_rows() == N
+	                                                      // only copied (transposed) in the constructor if needed
+	const bool                                         enable_syndrome;
+	const int                                          syndrome_depth;
 
 	int cur_syndrome_depth;
 
 public:
 	Decoder_LDPC_BP(const int K, const int N, const int n_ite,
-	                const tools::Sparse_matrix &H,
+	                const std::shared_ptr<const tools::Sparse_matrix> &H,
 	                const bool enable_syndrome = true,
 	                const int syndrome_depth = 1);
 
@@ -27,7 +27,7 @@ protected:
 
 public:
 	Decoder_LDPC_BP_flooding(const int K, const int N, const int n_ite,
-	                         const tools::Sparse_matrix &H,
+	                         const std::shared_ptr<const tools::Sparse_matrix> &H,
 	                         const std::vector<uint32_t> &info_bits_pos,
 	                         const Update_rule &up_rule,
 	                         const bool enable_syndrome = true,
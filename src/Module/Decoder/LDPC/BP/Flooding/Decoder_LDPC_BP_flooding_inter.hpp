@@ -36,7 +36,7 @@ protected:
 
 public:
 	Decoder_LDPC_BP_flooding_inter(const int K, const int N, const int n_ite,
-	                               const tools::Sparse_matrix &H,
+	                               const std::shared_ptr<const tools::Sparse_matrix> &H,
 	                               const std::vector<unsigned> &info_bits_pos,
 	                               const Update_rule &up_rule,
 	                               const bool enable_syndrome = true,
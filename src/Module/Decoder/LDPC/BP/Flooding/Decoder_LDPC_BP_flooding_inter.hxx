@@ -7,6 +7,7 @@
 #include "Tools/Math/utils.h"
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Perf/Reorderer/Reorderer.hpp"
+#include "Tools/Thread_pinning/Thread_pinning.hpp"
 
 #include "../Horizontal_layered/Decoder_LDPC_BP_horizontal_layered_inter.hpp"
 #include "Decoder_LDPC_BP_flooding_inter.hpp"
@@ -18,7 +19,7 @@ namespace module
 template <typename B, typename R, class Update_rule>
 Decoder_LDPC_BP_flooding_inter<B,R,Update_rule>
 ::Decoder_LDPC_BP_flooding_inter(const int K, const int N, const int n_ite,
-                                 const tools::Sparse_matrix &_H,
+                                 const std::shared_ptr<const tools::Sparse_matrix> &_H,
                                  const std::vector<unsigned> &info_bits_pos,
                                  const Update_rule &up_rule,
                                  const bool enable_syndrome,
@@ -32,8 +33,8 @@ Decoder_LDPC_BP_flooding_inter<B,R,Update_rule>
   sat_val               ((R)((1 << ((sizeof(R) * 8 -2) - (int)std::log2(this->H.get_rows_max_degree()))) -1)),
   transpose             (this->H.get_n_connections()                                                        ),
   post                  (N, -1                                                                              ),
-  msg_chk_to_var        (this->n_dec_waves, mipp::vector<mipp::Reg<R>>(this->H.get_n_connections())         ),
-  msg_var_to_chk        (this->n_dec_waves, mipp::vector<mipp::Reg<R>>(this->H.get_n_connections())         ),
+  msg_chk_to_var        (this->n_dec_waves                                                                  ),
+  msg_var_to_chk        (this->n_dec_waves                                                                  ),
   Y_N_reorderered       (N                                                                                  ),
   V_reorderered         (N                                                                                  ),
   init_flag             (true                                                                               )
@@ -48,6 +49,14 @@ Decoder_LDPC_BP_flooding_inter<B,R,Update_rule>
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
 
+	// the messages are the largest state of the decoder (one SIMD register per edge of the Tanner graph), they are
+	// allocated here to be advised before their first touch
+	for (auto w = 0; w < this->n_dec_waves; w++)
+	{
+		tools::Thread_pinning::resize_huge_pages(this->msg_chk_to_var[w], this->H.get_n_connections());
+		tools::Thread_pinning::resize_huge_pages(this->msg_var_to_chk[w], this->H.get_n_connections());
+	}
+
 	mipp::vector<unsigned char> connections(this->H.get_n_rows(), 0);
 
 	const auto &msg_chk_to_var_id = this->H.get_col_to_rows();
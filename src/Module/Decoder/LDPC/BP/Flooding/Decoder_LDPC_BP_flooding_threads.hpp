@@ -0,0 +1,91 @@
+#ifndef DECODER_LDPC_BP_FLOODING_THREADS_HPP_
+#define DECODER_LDPC_BP_FLOODING_THREADS_HPP_
+
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+#include "Tools/Algo/Thread_team/Thread_team.hpp"
+#include "Tools/Code/LDPC/Update_rule/SPA/Update_rule_SPA.hpp"
+
+#include "../../../Decoder_SISO_SIHO.hpp"
+#include "../Decoder_LDPC_BP.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_LDPC_BP_flooding_threads
+ *
+ * \brief Flooding BP decoder splitting the decoding of one frame on a team of threads (intra-frame parallelism), for
+ *        the latency of the long codes.
+ *
+ * The variable nodes and the check nodes are split in contiguous ranges with the same number of edges, each member of
+ * the team updates its ranges and the phases (variable nodes, check nodes, a posteriori information, syndrome) are
+ * separated by barriers. The computations and their order are the same than in the Decoder_LDPC_BP_flooding: the
+ * decoded frames are identical.
+ *
+ * The messages are stored in the variable nodes order: the edges of a variable node range are contiguous. They are
+ * allocated without initialization and first written by the member that owns them, so on a NUMA machine the pages
+ * are placed on the memory node of this member (first-touch policy) and the variable node phase only accesses local
+ * memory.
+ */
+template <typename B = int, typename R = float, class Update_rule = tools::Update_rule_SPA<R>>
+class Decoder_LDPC_BP_flooding_threads : public Decoder_SISO_SIHO<B,R>, public Decoder_LDPC_BP
+{
+protected:
+	const std::vector<uint32_t> &info_bits_pos;
+
+	tools::Thread_team       team;
+	std::vector<Update_rule> up_rules;    // one update rule per member of the team
+
+	std::vector<uint32_t> var_offsets;    // first edge of each variable node (and the number of edges)
+	std::vector<uint32_t> chk_offsets;    // first edge of each check node in 'transpose'
+	std::vector<uint32_t> transpose;      // edges in the check nodes order -> edges in the variable nodes order
+	std::vector<uint32_t> var_bounds;     // variable nodes range of each member
+	std::vector<uint32_t> chk_bounds;     // check nodes range of each member
+
+	std::unique_ptr<R[]>              post;           // a posteriori information
+	std::vector<std::unique_ptr<R[]>> msg_chk_to_var; // check    nodes to variable nodes messages
+	std::vector<std::unique_ptr<R[]>> msg_var_to_chk; // variable nodes to check    nodes messages
+
+	std::vector<uint8_t> syndromes;       // syndrome of the check nodes range of each member (one per cache line)
+
+	bool init_flag; // reset the msg_chk_to_var vector at the begining of the iterative decoding
+
+public:
+	/*!
+	 * \param n_threads: number of threads used to decode a frame (the calling thread included).
+	 */
+	Decoder_LDPC_BP_flooding_threads(const int K, const int N, const int n_ite,
+	                                 const std::shared_ptr<const tools::Sparse_matrix> &H,
+	                                 const std::vector<uint32_t> &info_bits_pos,
+	                                 const Update_rule &up_rule,
+	                                 const int n_threads,
+	                                 const bool enable_syndrome = true,
+	                                 const int syndrome_depth = 1,
+	                                 const int n_frames = 1);
+	virtual ~Decoder_LDPC_BP_flooding_threads() = default;
+	void reset();
+
+protected:
+	void _decode_siso   (const R *Y_N1, R *Y_N2, const int frame_id);
+	void _decode_siho   (const R *Y_N,  B *V_K,  const int frame_id);
+	void _decode_siho_cw(const R *Y_N,  B *V_N,  const int frame_id);
+
+	void _decode(const R *Y_N, const int frame_id);
+
+	// work of one member of the team
+	void _decode_member          (const int tid, const R *Y_N, const int frame_id, const bool init);
+	void _initialize_var_to_chk  (const int tid, const R *Y_N, const R *msg_chk_to_var, R *msg_var_to_chk);
+	void _decode_single_ite      (const int tid,               const R *msg_var_to_chk, R *msg_chk_to_var);
+	void _compute_post           (const int tid, const R *Y_N, const R *msg_chk_to_var, R *post);
+	bool _check_syndrome_soft    (const int tid, const R *post) const;
+};
+}
+}
+
+#include "Decoder_LDPC_BP_flooding_threads.hxx"
+
+#endif /* DECODER_LDPC_BP_FLOODING_THREADS_HPP_ */
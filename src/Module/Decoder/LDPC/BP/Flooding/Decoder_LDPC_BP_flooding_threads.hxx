@@ -0,0 +1,286 @@
+#include <limits>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Perf/common/hard_decide.h"
+
+#include "Decoder_LDPC_BP_flooding_threads.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, class Update_rule>
+Decoder_LDPC_BP_flooding_threads<B,R,Update_rule>
+::Decoder_LDPC_BP_flooding_threads(const int K, const int N, const int n_ite,
+                                   const std::shared_ptr<const tools::Sparse_matrix> &_H,
+                                   const std::vector<uint32_t> &info_bits_pos,
+                                   const Update_rule &up_rule,
+                                   const int n_threads,
+                                   const bool enable_syndrome,
+                                   const int syndrome_depth,
+                                   const int n_frames)
+: Decoder               (K, N, n_frames, 1                               ),
+  Decoder_SISO_SIHO<B,R>(K, N, n_frames, 1                               ),
+  Decoder_LDPC_BP       (K, N, n_ite, _H, enable_syndrome, syndrome_depth),
+  info_bits_pos         (info_bits_pos                                   ),
+  team                  (n_threads                                       ),
+  up_rules              (n_threads, up_rule                              ),
+  var_offsets           (this->H.get_n_rows() +1, 0                      ),
+  chk_offsets           (this->H.get_n_cols() +1, 0                      ),
+  transpose             (this->H.get_n_connections()                     ),
+  syndromes             (n_threads * 64, 0                               ),
+  init_flag             (true                                            )
+{
+	const std::string name = "Decoder_LDPC_BP_flooding_threads<" + up_rule.get_name() + ">";
+	this->set_name(name);
+
+	const auto &chk_to_var = this->H.get_col_to_rows();
+	const auto &var_to_chk = this->H.get_row_to_cols();
+
+	if (this->H.get_n_connections() > (size_t)std::numeric_limits<uint32_t>::max())
+	{
+		std::stringstream message;
+		message << "'H.get_n_connections()' has to be smaller or equal to 'std::numeric_limits<uint32_t>::max()' "
+		        << "('H.get_n_connections()' = " << this->H.get_n_connections()
+		        << ", 'std::numeric_limits<uint32_t>::max()' = " << std::numeric_limits<uint32_t>::max() << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (size_t v = 0; v < var_to_chk.size(); v++)
+		this->var_offsets[v +1] = this->var_offsets[v] + (uint32_t)var_to_chk[v].size();
+	for (size_t c = 0; c < chk_to_var.size(); c++)
+		this->chk_offsets[c +1] = this->chk_offsets[c] + (uint32_t)chk_to_var[c].size();
+
+	// same edge numbering than in the Decoder_LDPC_BP_flooding
+	std::vector<uint32_t> connections(var_to_chk.size(), 0);
+	auto k = 0;
+	for (size_t c = 0; c < chk_to_var.size(); c++)
+		for (auto var_id : chk_to_var[c])
+		{
+			if (connections[var_id] >= var_to_chk[var_id].size())
+			{
+				std::stringstream message;
+				message << "'connections[var_id]' has to be smaller than 'var_to_chk[var_id].size()' "
+				        << "('var_id' = " << var_id << ", 'connections[var_id]' = " << connections[var_id]
+				        << ", 'var_to_chk[var_id].size()' = " << var_to_chk[var_id].size() << ").";
+				throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+			}
+
+			this->transpose[k++] = this->var_offsets[var_id] + connections[var_id]++;
+		}
+
+	this->var_bounds = tools::Thread_team::split(this->var_offsets, n_threads);
+	this->chk_bounds = tools::Thread_team::split(this->chk_offsets, n_threads);
+
+	// the messages are not initialized here: the pages are first written by the members that own them
+	const auto n_edges = this->H.get_n_connections();
+	this->post.reset(new R[N]);
+	for (auto f = 0; f < n_frames; f++)
+	{
+		this->msg_chk_to_var.push_back(std::unique_ptr<R[]>(new R[n_edges]));
+		this->msg_var_to_chk.push_back(std::unique_ptr<R[]>(new R[n_edges]));
+	}
+
+	this->team.run([this, n_frames](const int tid)
+	{
+		const auto v_first = this->var_bounds[tid], v_last = this->var_bounds[tid +1];
+		const auto e_first = this->var_offsets[v_first], e_last = this->var_offsets[v_last];
+
+		std::fill(this->post.get() + v_first, this->post.get() + v_last, (R)-1);
+		for (auto f = 0; f < n_frames; f++)
+		{
+			std::fill(this->msg_chk_to_var[f].get() + e_first, this->msg_chk_to_var[f].get() + e_last, (R)0);
+			std::fill(this->msg_var_to_chk[f].get() + e_first, this->msg_var_to_chk[f].get() + e_last, (R)0);
+		}
+	});
+}
+
+template <typename B, typename R, class Update_rule>
+void Decoder_LDPC_BP_flooding_threads<B,R,Update_rule>
+::reset()
+{
+	this->init_flag = true;
+}
+
+template <typename B, typename R, class Update_rule>
+void Decoder_LDPC_BP_flooding_threads<B,R,Update_rule>
+::_decode_siso(const R *Y_N1, R *Y_N2, const int frame_id)
+{
+	this->_decode(Y_N1, frame_id);
+
+	// prepare for next round by processing extrinsic information
+	for (auto v = 0; v < this->N; v++)
+		Y_N2[v] = this->post[v] - Y_N1[v];
+}
+
+template <typename B, typename R, class Update_rule>
+void Decoder_LDPC_BP_flooding_threads<B,R,Update_rule>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	this->_decode(Y_N, frame_id);
+
+	// take the hard decision
+	for (auto v = 0; v < this->K; v++)
+	{
+		const auto k = this->info_bits_pos[v];
+		V_K[v] = !(this->post[k] >= 0);
+	}
+}
+
+template <typename B, typename R, class Update_rule>
+void Decoder_LDPC_BP_flooding_threads<B,R,Update_rule>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+	this->_decode(Y_N, frame_id);
+
+	tools::hard_decide(this->post.get(), V_N, this->N);
+}
+
+template <typename B, typename R, class Update_rule>
+void Decoder_LDPC_BP_flooding_threads<B,R,Update_rule>
+::_decode(const R *Y_N, const int frame_id)
+{
+	// memory zones initialization (done by the members)
+	const auto init = this->init_flag;
+	if (this->init_flag && frame_id == Decoder_SIHO<B,R>::n_frames -1)
+		this->init_flag = false;
+
+	this->team.run([this, Y_N, frame_id, init](const int tid)
+	{
+		this->_decode_member(tid, Y_N, frame_id, init);
+	});
+}
+
+template <typename B, typename R, class Update_rule>
+void Decoder_LDPC_BP_flooding_threads<B,R,Update_rule>
+::_decode_member(const int tid, const R *Y_N, const int frame_id, const bool init)
+{
+	auto &up_rule = this->up_rules[tid];
+	auto *msg_chk_to_var = this->msg_chk_to_var[frame_id].get();
+	auto *msg_var_to_chk = this->msg_var_to_chk[frame_id].get();
+
+	if (init)
+		std::fill(msg_chk_to_var + this->var_offsets[this->var_bounds[tid   ]],
+		          msg_chk_to_var + this->var_offsets[this->var_bounds[tid +1]], (R)0);
+
+	// all the members take the same decisions: the syndrome depth is updated on a local copy
+	auto cur_syndrome_depth = this->cur_syndrome_depth;
+
+	up_rule.begin_decoding(this->n_ite);
+
+	auto ite = 0;
+	for (; ite < this->n_ite; ite++)
+	{
+		up_rule.begin_ite(ite);
+		this->_initialize_var_to_chk(tid, Y_N, msg_chk_to_var, msg_var_to_chk);
+		this->team.barrier();
+		this->_decode_single_ite(tid, msg_var_to_chk, msg_chk_to_var);
+		up_rule.end_ite();
+		this->team.barrier();
+
+		if (this->enable_syndrome && ite != this->n_ite -1)
+		{
+			this->_compute_post(tid, Y_N, msg_chk_to_var, this->post.get());
+			this->team.barrier();
+			this->syndromes[tid * 64] = this->_check_syndrome_soft(tid, this->post.get());
+			this->team.barrier();
+
+			// the flags are written again after at least two other barriers: no race with the slow members
+			auto syndrome = true;
+			for (auto t = 0; t < this->team.get_n_threads(); t++)
+				syndrome = syndrome && this->syndromes[t * 64];
+
+			cur_syndrome_depth = syndrome ? (cur_syndrome_depth +1) % this->syndrome_depth : 0;
+			if (syndrome && cur_syndrome_depth == 0)
+				break;
+		}
+	}
+	if (ite == this->n_ite)
+		this->_compute_post(tid, Y_N, msg_chk_to_var, this->post.get());
+
+	up_rule.end_decoding();
+
+	if (tid == 0)
+		this->cur_syndrome_depth = cur_syndrome_depth;
+}
+
+template <typename B, typename R, class Update_rule>
+void Decoder_LDPC_BP_flooding_threads<B,R,Update_rule>
+::_initialize_var_to_chk(const int tid, const R *Y_N, const R *msg_chk_to_var, R *msg_var_to_chk)
+{
+	const auto v_last = (int)this->var_bounds[tid +1];
+	for (auto v = (int)this->var_bounds[tid]; v < v_last; v++)
+	{
+		const auto first = this->var_offsets[v   ];
+		const auto last  = this->var_offsets[v +1];
+
+		auto sum_msg_chk_to_var = (R)0;
+		for (auto e = first; e < last; e++)
+			sum_msg_chk_to_var += msg_chk_to_var[e];
+
+		const auto tmp = Y_N[v] + sum_msg_chk_to_var;
+		for (auto e = first; e < last; e++)
+			msg_var_to_chk[e] = tmp - msg_chk_to_var[e];
+	}
+}
+
+template <typename B, typename R, class Update_rule>
+void Decoder_LDPC_BP_flooding_threads<B,R,Update_rule>
+::_decode_single_ite(const int tid, const R *msg_var_to_chk, R *msg_chk_to_var)
+{
+	auto &up_rule = this->up_rules[tid];
+
+	const auto c_last = (int)this->chk_bounds[tid +1];
+	for (auto c = (int)this->chk_bounds[tid]; c < c_last; c++)
+	{
+		const auto transpose_ptr = this->transpose.data() + this->chk_offsets[c];
+		const auto chk_degree    = (int)(this->chk_offsets[c +1] - this->chk_offsets[c]);
+
+		up_rule.begin_chk_node_in(c, chk_degree);
+		for (auto v = 0; v < chk_degree; v++)
+			up_rule.compute_chk_node_in(v, msg_var_to_chk[transpose_ptr[v]]);
+		up_rule.end_chk_node_in();
+
+		up_rule.begin_chk_node_out(c, chk_degree);
+		for (auto v = 0; v < chk_degree; v++)
+			msg_chk_to_var[transpose_ptr[v]] = up_rule.compute_chk_node_out(v, msg_var_to_chk[transpose_ptr[v]]);
+		up_rule.end_chk_node_out();
+	}
+}
+
+template <typename B, typename R, class Update_rule>
+void Decoder_LDPC_BP_flooding_threads<B,R,Update_rule>
+::_compute_post(const int tid, const R *Y_N, const R *msg_chk_to_var, R *post)
+{
+	const auto v_last = (int)this->var_bounds[tid +1];
+	for (auto v = (int)this->var_bounds[tid]; v < v_last; v++)
+	{
+		auto sum_msg_chk_to_var = (R)0;
+		for (auto e = this->var_offsets[v]; e < this->var_offsets[v +1]; e++)
+			sum_msg_chk_to_var += msg_chk_to_var[e];
+
+		post[v] = Y_N[v] + sum_msg_chk_to_var;
+	}
+}
+
+template <typename B, typename R, class Update_rule>
+bool Decoder_LDPC_BP_flooding_threads<B,R,Update_rule>
+::_check_syndrome_soft(const int tid, const R *post) const
+{
+	const auto c_last = (int)this->chk_bounds[tid +1];
+	for (auto c = (int)this->chk_bounds[tid]; c < c_last; c++)
+	{
+		auto sign = 0;
+		for (auto var_id : this->H[c])
+			sign ^= (post[var_id] < 0) ? -1 : 0;
+
+		if (sign)
+			return false;
+	}
+
+	return true;
+}
+}
+}
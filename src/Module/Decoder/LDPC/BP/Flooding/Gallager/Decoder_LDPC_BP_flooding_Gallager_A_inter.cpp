@@ -0,0 +1,104 @@
+#include <algorithm>
+
+#include "Decoder_LDPC_BP_flooding_Gallager_A_inter.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B, typename R>
+Decoder_LDPC_BP_flooding_Gallager_A_inter<B,R>
+::Decoder_LDPC_BP_flooding_Gallager_A_inter(const int K, const int N, const int n_ite,
+                                            const std::shared_ptr<const tools::Sparse_matrix> &_H,
+                                            const std::vector<unsigned> &info_bits_pos, const bool enable_syndrome,
+                                            const int syndrome_depth, const int n_frames)
+: Decoder                                     (K, N, n_frames, tools::Bit_slice<uint64_t>::n_lanes                ),
+  Decoder_LDPC_BP_flooding_Gallager_inter<B,R>(K, N, n_ite, _H, info_bits_pos, enable_syndrome, syndrome_depth,
+                                               n_frames                                                           ),
+  n_planes                                    (BS::n_planes((unsigned)this->H.get_rows_max_degree() +1)          ),
+  disagree_pref                               (this->H.get_rows_max_degree() +1                                   ),
+  counter                                     (n_planes                                                           )
+{
+	const std::string name = "Decoder_LDPC_BP_flooding_Gallager_A_inter";
+	this->set_name(name);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_A_inter<B,R>
+::_initialize_var_to_chk(const bool first_ite)
+{
+	auto chk_to_var_ptr = this->chk_to_var.data();
+	auto var_to_chk_ptr = this->var_to_chk.data();
+
+	// for each variable nodes
+	const auto n_var_nodes = (int)this->H.get_n_rows();
+	for (auto v = 0; v < n_var_nodes; v++)
+	{
+		const auto var_degree = (int)this->H.get_row_to_cols()[v].size();
+		const auto cur_state  = this->Y_bs[v];
+
+		if (first_ite)
+		{
+			std::fill(var_to_chk_ptr, var_to_chk_ptr + var_degree, cur_state);
+		}
+		else
+		{
+			// the input bit is flipped if all the other entering messages disagree with it:
+			// the AND of the other disagreements is the product of a prefix and a suffix
+			this->disagree_pref[0] = (W)~(W)0;
+			for (auto c = 0; c < var_degree; c++)
+				this->disagree_pref[c +1] = this->disagree_pref[c] & (chk_to_var_ptr[c] ^ cur_state);
+
+			W disagree_suff = (W)~(W)0;
+			for (auto c = var_degree -1; c >= 0; c--)
+			{
+				var_to_chk_ptr[c] = cur_state ^ (this->disagree_pref[c] & disagree_suff);
+				disagree_suff &= chk_to_var_ptr[c] ^ cur_state;
+			}
+		}
+
+		chk_to_var_ptr += var_degree;
+		var_to_chk_ptr += var_degree;
+	}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_A_inter<B,R>
+::_make_majority_vote()
+{
+	auto chk_to_var_ptr = this->chk_to_var.data();
+
+	// for the K variable nodes (make a majority vote with the entering messages)
+	const auto n_var_nodes = (int)this->H.get_n_rows();
+	for (auto v = 0; v < n_var_nodes; v++)
+	{
+		const auto var_degree = (int)this->H.get_row_to_cols()[v].size();
+
+		std::fill(this->counter.begin(), this->counter.end(), (W)0);
+		for (auto c = 0; c < var_degree; c++)
+			BS::inc(this->counter.data(), this->n_planes, chk_to_var_ptr[c]);
+
+		auto n_votes = var_degree;
+		if (var_degree % 2 == 0)
+		{
+			BS::inc(this->counter.data(), this->n_planes, this->Y_bs[v]);
+			n_votes++;
+		}
+
+		// take the hard decision: more ones than zeros
+		this->D_bs[v] = BS::ge(this->counter.data(), this->n_planes, (unsigned)(n_votes / 2 +1));
+
+		chk_to_var_ptr += var_degree;
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_A_inter<B_8,Q_8>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_A_inter<B_16,Q_16>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_A_inter<B_32,Q_32>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_A_inter<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_A_inter<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,45 @@
+#ifndef DECODER_LDPC_BP_FLOODING_GALLAGER_A_INTER_HPP_
+#define DECODER_LDPC_BP_FLOODING_GALLAGER_A_INTER_HPP_
+
+#include "Decoder_LDPC_BP_flooding_Gallager_inter.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_LDPC_BP_flooding_Gallager_A_inter
+ *
+ * \brief Bit-sliced version of the Decoder_LDPC_BP_flooding_Gallager_A: 64 frames are decoded at once.
+ */
+template <typename B = int, typename R = float>
+class Decoder_LDPC_BP_flooding_Gallager_A_inter : public Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+{
+protected:
+	typedef typename Decoder_LDPC_BP_flooding_Gallager_inter<B,R>::W  W;
+	typedef typename Decoder_LDPC_BP_flooding_Gallager_inter<B,R>::BS BS;
+
+	const int n_planes;           // number of bit planes of the counters
+	std::vector<W> disagree_pref; // prefix ANDs of the disagreements between the input bit and the entering messages
+	std::vector<W> counter;       // bit-sliced counter of the entering messages equal to 1
+
+public:
+	Decoder_LDPC_BP_flooding_Gallager_A_inter(const int K, const int N, const int n_ite,
+	                                          const std::shared_ptr<const tools::Sparse_matrix> &H,
+	                                          const std::vector<unsigned> &info_bits_pos,
+	                                          const bool enable_syndrome = true,
+	                                          const int syndrome_depth = 1,
+	                                          const int n_frames = 1);
+	virtual ~Decoder_LDPC_BP_flooding_Gallager_A_inter() = default;
+
+protected:
+	void _initialize_var_to_chk(const bool first_ite);
+	void _make_majority_vote   (                    );
+};
+
+template <typename B = int, typename R = float>
+using Decoder_LDPC_BP_flooding_GALA_inter = Decoder_LDPC_BP_flooding_Gallager_A_inter<B,R>;
+}
+}
+
+#endif /* DECODER_LDPC_BP_FLOODING_GALLAGER_A_INTER_HPP_ */
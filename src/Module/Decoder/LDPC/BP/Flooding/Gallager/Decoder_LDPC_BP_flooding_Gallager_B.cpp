@@ -15,7 +15,8 @@ using namespace aff3ct::module;
 
 template <typename B, typename R>
 Decoder_LDPC_BP_flooding_Gallager_B<B,R>
-::Decoder_LDPC_BP_flooding_Gallager_B(const int K, const int N, const int n_ite, const tools::Sparse_matrix &_H,
+::Decoder_LDPC_BP_flooding_Gallager_B(const int K, const int N, const int n_ite,
+                                      const std::shared_ptr<const tools::Sparse_matrix> &_H,
                                       const std::vector<unsigned> &info_bits_pos, const bool enable_syndrome,
                                       const int syndrome_depth, const int n_frames)
 : Decoder               (K, N, n_frames, 1                               ),
@@ -0,0 +1,122 @@
+#include <algorithm>
+
+#include "Decoder_LDPC_BP_flooding_Gallager_B_inter.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B, typename R>
+Decoder_LDPC_BP_flooding_Gallager_B_inter<B,R>
+::Decoder_LDPC_BP_flooding_Gallager_B_inter(const int K, const int N, const int n_ite,
+                                            const std::shared_ptr<const tools::Sparse_matrix> &_H,
+                                            const std::vector<unsigned> &info_bits_pos, const bool enable_syndrome,
+                                            const int syndrome_depth, const int n_frames)
+: Decoder                                     (K, N, n_frames, tools::Bit_slice<uint64_t>::n_lanes                ),
+  Decoder_LDPC_BP_flooding_Gallager_inter<B,R>(K, N, n_ite, _H, info_bits_pos, enable_syndrome, syndrome_depth,
+                                               n_frames                                                           ),
+  n_planes                                    (BS::n_planes((unsigned)this->H.get_rows_max_degree())             ),
+  counter                                     (n_planes                                                           )
+{
+	const std::string name = "Decoder_LDPC_BP_flooding_Gallager_B_inter";
+	this->set_name(name);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_B_inter<B,R>
+::_initialize_var_to_chk(const bool first_ite)
+{
+	auto chk_to_var_ptr = this->chk_to_var.data();
+	auto var_to_chk_ptr = this->var_to_chk.data();
+
+	// for each variable nodes
+	const auto n_var_nodes = (int)this->H.get_n_rows();
+	for (auto v = 0; v < n_var_nodes; v++)
+	{
+		const auto var_degree = (int)this->H.get_row_to_cols()[v].size();
+		const auto cur_state  = this->Y_bs[v];
+
+		if (first_ite)
+		{
+			std::fill(var_to_chk_ptr, var_to_chk_ptr + var_degree, cur_state);
+		}
+		else
+		{
+			// 'sum' is the number of entering messages equal to 1, the scalar decoder computes
+			// 'diff' = 'var_degree' - X with X = 2 * 'sum' + 'cur_state' - 'chk_to_var[c]' and sends 1 if 'diff' < 0,
+			// 'cur_state' if 'diff' == 0 and 0 else: X only takes 3 forms so 'diff' is compared with constants
+			std::fill(this->counter.begin(), this->counter.end(), (W)0);
+			for (auto c = 0; c < var_degree; c++)
+				BS::inc(this->counter.data(), this->n_planes, chk_to_var_ptr[c]);
+
+			const auto cnt = this->counter.data();
+			const auto odd = var_degree % 2;
+
+			// X = 2 * sum       ('cur_state' == 'chk_to_var[c]')
+			const auto gt0 = BS::ge(cnt, this->n_planes, (unsigned)(var_degree / 2 +1));
+			const auto eq0 = odd ? (W)0 : BS::eq(cnt, this->n_planes, (unsigned)(var_degree / 2));
+			// X = 2 * sum +1    ('cur_state' == 1 and 'chk_to_var[c]' == 0)
+			const auto gt1 = BS::ge(cnt, this->n_planes, (unsigned)((var_degree -1) / 2 +1));
+			const auto eq1 = odd ? BS::eq(cnt, this->n_planes, (unsigned)((var_degree -1) / 2)) : (W)0;
+			// X = 2 * sum -1    ('cur_state' == 0 and 'chk_to_var[c]' == 1)
+			const auto gt2 = BS::ge(cnt, this->n_planes, (unsigned)((var_degree +1) / 2 +1));
+
+			const auto same_msg = gt0 | (eq0 & cur_state);
+			const auto one_zero = gt1 | eq1;
+			const auto zero_one = gt2;
+
+			// majority vote on each node
+			for (auto c = 0; c < var_degree; c++)
+			{
+				const auto m = chk_to_var_ptr[c];
+				var_to_chk_ptr[c] = (~(cur_state ^ m) & same_msg) |
+				                    ( cur_state & ~m  & one_zero) |
+				                    (~cur_state &  m  & zero_one);
+			}
+		}
+
+		chk_to_var_ptr += var_degree;
+		var_to_chk_ptr += var_degree;
+	}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_B_inter<B,R>
+::_make_majority_vote()
+{
+	auto chk_to_var_ptr = this->chk_to_var.data();
+
+	// for the K variable nodes (make a majority vote with the entering messages)
+	const auto n_var_nodes = (int)this->H.get_n_rows();
+	for (auto v = 0; v < n_var_nodes; v++)
+	{
+		const auto var_degree = (int)this->H.get_row_to_cols()[v].size();
+		const auto cur_state  = this->Y_bs[v];
+
+		std::fill(this->counter.begin(), this->counter.end(), (W)0);
+		for (auto c = 0; c < var_degree; c++)
+			BS::inc(this->counter.data(), this->n_planes, chk_to_var_ptr[c]);
+
+		// take the hard decision: 1 if 2 * sum + 'cur_state' > 'var_degree', 'cur_state' in case of equality
+		const auto cnt = this->counter.data();
+		const auto odd = var_degree % 2;
+		const auto dec0 = BS::ge(cnt, this->n_planes, (unsigned)(var_degree / 2 +1));
+		const auto dec1 = BS::ge(cnt, this->n_planes, (unsigned)((var_degree -1) / 2 +1)) |
+		                  (odd ? BS::eq(cnt, this->n_planes, (unsigned)((var_degree -1) / 2)) : (W)0);
+
+		this->D_bs[v] = (~cur_state & dec0) | (cur_state & dec1);
+
+		chk_to_var_ptr += var_degree;
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_B_inter<B_8,Q_8>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_B_inter<B_16,Q_16>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_B_inter<B_32,Q_32>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_B_inter<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_B_inter<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
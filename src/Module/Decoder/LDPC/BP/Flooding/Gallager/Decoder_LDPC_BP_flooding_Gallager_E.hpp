@@ -25,7 +25,8 @@ protected:
 	int scaling;
 
 public:
-	Decoder_LDPC_BP_flooding_Gallager_E(const int K, const int N, const int n_ite, const tools::Sparse_matrix &H,
+	Decoder_LDPC_BP_flooding_Gallager_E(const int K, const int N, const int n_ite,
+	                                    const std::shared_ptr<const tools::Sparse_matrix> &H,
 	                                    const std::vector<unsigned> &info_bits_pos,
 	                                    const bool enable_syndrome = true,
 	                                    const int syndrome_depth = 1,
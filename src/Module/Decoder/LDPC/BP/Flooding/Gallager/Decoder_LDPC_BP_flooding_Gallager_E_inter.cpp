@@ -0,0 +1,168 @@
+#include <algorithm>
+
+#include "Decoder_LDPC_BP_flooding_Gallager_E_inter.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B, typename R>
+Decoder_LDPC_BP_flooding_Gallager_E_inter<B,R>
+::Decoder_LDPC_BP_flooding_Gallager_E_inter(const int K, const int N, const int n_ite,
+                                            const std::shared_ptr<const tools::Sparse_matrix> &_H,
+                                            const std::vector<unsigned> &info_bits_pos, const bool enable_syndrome,
+                                            const int syndrome_depth, const int n_frames)
+: Decoder                                     (K, N, n_frames, tools::Bit_slice<uint64_t>::n_lanes                ),
+  Decoder_LDPC_BP_flooding_Gallager_inter<B,R>(K, N, n_ite, _H, info_bits_pos, enable_syndrome, syndrome_depth,
+                                               n_frames                                                           ),
+  chk_to_var_nz                               (this->H.get_n_connections(), 0                                     ),
+  var_to_chk_nz                               (this->H.get_n_connections(), 0                                     ),
+  n_planes                                    (BS::n_planes((unsigned)this->H.get_rows_max_degree() +3) +1       ),
+  sum                                         (n_planes                                                           ),
+  tmp                                         (n_planes                                                           ),
+  scaling                                     (1                                                                  )
+{
+	const std::string name = "Decoder_LDPC_BP_flooding_Gallager_E_inter";
+	this->set_name(name);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_E_inter<B,R>
+::_set_ite(const int ite)
+{
+	this->scaling = ite < 2 ? 2 : 1;
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_E_inter<B,R>
+::_initialize_var_to_chk(const bool first_ite)
+{
+	auto chk_to_var_ptr    = this->chk_to_var   .data();
+	auto chk_to_var_nz_ptr = this->chk_to_var_nz.data();
+	auto var_to_chk_ptr    = this->var_to_chk   .data();
+	auto var_to_chk_nz_ptr = this->var_to_chk_nz.data();
+
+	const auto sign_plane = this->n_planes -1;
+
+	// for each variable nodes
+	const auto n_var_nodes = (int)this->H.get_n_rows();
+	for (auto v = 0; v < n_var_nodes; v++)
+	{
+		const auto var_degree = (int)this->H.get_row_to_cols()[v].size();
+		const auto cur_state  = this->Y_bs[v]; // 1 for -1
+
+		if (first_ite)
+		{
+			std::fill(var_to_chk_ptr,    var_to_chk_ptr    + var_degree, cur_state);
+			std::fill(var_to_chk_nz_ptr, var_to_chk_nz_ptr + var_degree, (W)~(W)0);
+		}
+		else
+		{
+			std::fill(this->sum.begin(), this->sum.end(), (W)0);
+			for (auto c = 0; c < var_degree; c++)
+			{
+				BS::inc(this->sum.data(), this->n_planes, chk_to_var_nz_ptr[c] & ~chk_to_var_ptr[c]);
+				BS::dec(this->sum.data(), this->n_planes, chk_to_var_nz_ptr[c] &  chk_to_var_ptr[c]);
+			}
+			for (auto s = 0; s < this->scaling; s++)
+			{
+				BS::inc(this->sum.data(), this->n_planes, ~cur_state);
+				BS::dec(this->sum.data(), this->n_planes,  cur_state);
+			}
+
+			// the outgoing message is the sign of the sum without the entering message of the same edge
+			for (auto c = 0; c < var_degree; c++)
+			{
+				std::copy(this->sum.begin(), this->sum.end(), this->tmp.begin());
+				BS::dec(this->tmp.data(), this->n_planes, chk_to_var_nz_ptr[c] & ~chk_to_var_ptr[c]);
+				BS::inc(this->tmp.data(), this->n_planes, chk_to_var_nz_ptr[c] &  chk_to_var_ptr[c]);
+
+				var_to_chk_ptr   [c] = this->tmp[sign_plane];
+				var_to_chk_nz_ptr[c] = BS::non_zero(this->tmp.data(), this->n_planes);
+			}
+		}
+
+		chk_to_var_ptr    += var_degree;
+		chk_to_var_nz_ptr += var_degree;
+		var_to_chk_ptr    += var_degree;
+		var_to_chk_nz_ptr += var_degree;
+	}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_E_inter<B,R>
+::_decode_single_ite()
+{
+	auto transpose_ptr = this->transpose.data();
+
+	// for each check nodes
+	const auto n_chk_nodes = (int)this->H.get_n_cols();
+	for (auto c = 0; c < n_chk_nodes; c++)
+	{
+		const auto chk_degree = (int)this->H.get_col_to_rows()[c].size();
+
+		// the product of the other messages is null if there is at least one null message without the current one
+		W acc = (W)0, zero1 = (W)0, zero2 = (W)0;
+		for (auto v = 0; v < chk_degree; v++)
+		{
+			const auto zero = ~this->var_to_chk_nz[transpose_ptr[v]];
+			zero2 |= zero1 & zero;
+			zero1 |= zero;
+			acc   ^= this->var_to_chk[transpose_ptr[v]];
+		}
+
+		for (auto v = 0; v < chk_degree; v++)
+		{
+			const auto nz = this->var_to_chk_nz[transpose_ptr[v]];
+			this->chk_to_var   [transpose_ptr[v]] = acc ^ this->var_to_chk[transpose_ptr[v]];
+			this->chk_to_var_nz[transpose_ptr[v]] = (nz & ~zero1) | (~nz & ~zero2);
+		}
+
+		transpose_ptr += chk_degree;
+	}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_E_inter<B,R>
+::_make_majority_vote()
+{
+	auto chk_to_var_ptr    = this->chk_to_var   .data();
+	auto chk_to_var_nz_ptr = this->chk_to_var_nz.data();
+
+	const auto sign_plane = this->n_planes -1;
+
+	// for the K variable nodes (make a majority vote with the entering messages)
+	const auto n_var_nodes = (int)this->H.get_n_rows();
+	for (auto v = 0; v < n_var_nodes; v++)
+	{
+		const auto var_degree = (int)this->H.get_row_to_cols()[v].size();
+		const auto cur_state  = this->Y_bs[v];
+
+		std::fill(this->sum.begin(), this->sum.end(), (W)0);
+		for (auto c = 0; c < var_degree; c++)
+		{
+			BS::inc(this->sum.data(), this->n_planes, chk_to_var_nz_ptr[c] & ~chk_to_var_ptr[c]);
+			BS::dec(this->sum.data(), this->n_planes, chk_to_var_nz_ptr[c] &  chk_to_var_ptr[c]);
+		}
+		BS::inc(this->sum.data(), this->n_planes, ~cur_state);
+		BS::dec(this->sum.data(), this->n_planes,  cur_state);
+
+		// take the hard decision: 1 if the sum is negative, the input bit if the sum is null
+		const auto zero = ~BS::non_zero(this->sum.data(), this->n_planes);
+		this->D_bs[v] = this->sum[sign_plane] | (zero & cur_state);
+
+		chk_to_var_ptr    += var_degree;
+		chk_to_var_nz_ptr += var_degree;
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_E_inter<B_8,Q_8>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_E_inter<B_16,Q_16>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_E_inter<B_32,Q_32>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_E_inter<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_E_inter<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,57 @@
+#ifndef DECODER_LDPC_BP_FLOODING_GALLAGER_E_INTER_HPP_
+#define DECODER_LDPC_BP_FLOODING_GALLAGER_E_INTER_HPP_
+
+#include "Decoder_LDPC_BP_flooding_Gallager_inter.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_LDPC_BP_flooding_Gallager_E_inter
+ *
+ * \brief Bit-sliced version of the Decoder_LDPC_BP_flooding_Gallager_E: 64 frames are decoded at once.
+ *
+ * The ternary messages are stored in two bit planes (sign and non-zero) and the sums of the variable nodes are
+ * computed with bit-sliced adders.
+ */
+template <typename B = int, typename R = float>
+class Decoder_LDPC_BP_flooding_Gallager_E_inter : public Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+{
+protected:
+	typedef typename Decoder_LDPC_BP_flooding_Gallager_inter<B,R>::W  W;
+	typedef typename Decoder_LDPC_BP_flooding_Gallager_inter<B,R>::BS BS;
+
+	// the messages are in {-1, 0, +1}: 'chk_to_var' and 'var_to_chk' contain the signs (1 for -1) and the following
+	// vectors tell if the messages are not null
+	std::vector<W> chk_to_var_nz;
+	std::vector<W> var_to_chk_nz;
+
+	const int n_planes; // number of bit planes of the signed sums
+	std::vector<W> sum; // bit-sliced sum of the entering messages (two's complement)
+	std::vector<W> tmp; // bit-sliced sum without one message
+
+	int scaling;
+
+public:
+	Decoder_LDPC_BP_flooding_Gallager_E_inter(const int K, const int N, const int n_ite,
+	                                          const std::shared_ptr<const tools::Sparse_matrix> &H,
+	                                          const std::vector<unsigned> &info_bits_pos,
+	                                          const bool enable_syndrome = true,
+	                                          const int syndrome_depth = 1,
+	                                          const int n_frames = 1);
+	virtual ~Decoder_LDPC_BP_flooding_Gallager_E_inter() = default;
+
+protected:
+	void _initialize_var_to_chk(const bool first_ite);
+	void _decode_single_ite    (                    );
+	void _make_majority_vote   (                    );
+	void _set_ite              (const int ite       );
+};
+
+template <typename B = int, typename R = float>
+using Decoder_LDPC_BP_flooding_GALE_inter = Decoder_LDPC_BP_flooding_Gallager_E_inter<B,R>;
+}
+}
+
+#endif /* DECODER_LDPC_BP_FLOODING_GALLAGER_E_INTER_HPP_ */
@@ -0,0 +1,233 @@
+#include <limits>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Perf/common/hard_decide.h"
+#include "Tools/Exception/exception.hpp"
+
+#include "Decoder_LDPC_BP_flooding_Gallager_inter.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template <typename B, typename R>
+Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::Decoder_LDPC_BP_flooding_Gallager_inter(const int K, const int N, const int n_ite,
+                                          const std::shared_ptr<const tools::Sparse_matrix> &_H,
+                                          const std::vector<unsigned> &info_bits_pos, const bool enable_syndrome,
+                                          const int syndrome_depth, const int n_frames)
+: Decoder               (K, N, n_frames, BS::n_lanes                     ),
+  Decoder_SIHO_HIHO<B,R>(K, N, n_frames, BS::n_lanes                     ),
+  Decoder_LDPC_BP       (K, N, n_ite, _H, enable_syndrome, syndrome_depth),
+  info_bits_pos         (info_bits_pos                                   ),
+  HY_N                  (N * BS::n_lanes                                 ),
+  Y_bs                  (N                                               ),
+  D_bs                  (N                                               ),
+  V_bs                  (N                                               ),
+  chk_to_var            (this->H.get_n_connections(), 0                  ),
+  var_to_chk            (this->H.get_n_connections(), 0                  ),
+  transpose             (this->H.get_n_connections()                     ),
+  syndrome_depths       (BS::n_lanes, 0                                  ),
+  active                ((W)0                                            ),
+  done                  ((W)0                                            )
+{
+	const std::string name = "Decoder_LDPC_BP_flooding_Gallager_inter";
+	this->set_name(name);
+
+	std::vector<unsigned char> connections(this->H.get_n_rows(), 0);
+
+	const auto &chk_to_var_id = this->H.get_col_to_rows();
+	const auto &var_to_chk_id = this->H.get_row_to_cols();
+
+	auto k = 0;
+	for (auto i = 0; i < (int)chk_to_var_id.size(); i++)
+	{
+		for (auto j = 0; j < (int)chk_to_var_id[i].size(); j++)
+		{
+			auto var_id = chk_to_var_id[i][j];
+
+			auto branch_id = 0;
+			for (auto ii = 0; ii < (int)var_id; ii++)
+				branch_id += (int)var_to_chk_id[ii].size();
+			branch_id += connections[var_id];
+			connections[var_id]++;
+
+			if (connections[var_id] > (int)var_to_chk_id[var_id].size())
+			{
+				std::stringstream message;
+				message << "'connections[var_id]' has to be equal or smaller than 'var_to_chk_id[var_id].size()' "
+				        << "('var_id' = " << var_id << ", 'connections[var_id]' = " << connections[var_id]
+				        << ", 'var_to_chk_id[var_id].size()' = " << var_to_chk_id[var_id].size() << ").";
+				throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+			}
+
+			transpose[k] = branch_id;
+			k++;
+		}
+	}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::_decode_hiho(const B *Y_N, B *V_K, const int frame_id)
+{
+	this->_load(Y_N, frame_id);
+	this->_decode();
+	BS::unpack(this->V_bs.data(), V_K, this->info_bits_pos);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::_decode_hiho_cw(const B *Y_N, B *V_N, const int frame_id)
+{
+	this->_load(Y_N, frame_id);
+	this->_decode();
+	BS::unpack(this->V_bs.data(), V_N, this->N);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+	tools::hard_decide(Y_N, this->HY_N.data(), this->N * BS::n_lanes);
+	this->_load(this->HY_N.data(), frame_id);
+	this->_decode();
+	BS::unpack(this->V_bs.data(), V_K, this->info_bits_pos);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+	tools::hard_decide(Y_N, this->HY_N.data(), this->N * BS::n_lanes);
+	this->_load(this->HY_N.data(), frame_id);
+	this->_decode();
+	BS::unpack(this->V_bs.data(), V_N, this->N);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::_load(const B *Y_N, const int frame_id)
+{
+	// the lanes after the last frame of the last wave are not waited by the syndrome detection
+	const auto n_frames_wave = std::min(BS::n_lanes, this->n_frames - frame_id);
+	this->active = BS::lanes(n_frames_wave);
+
+	BS::pack(Y_N, this->Y_bs.data(), this->N);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::_decode()
+{
+	this->done = (W)0;
+	std::fill(this->syndrome_depths.begin(), this->syndrome_depths.end(), 0);
+
+	auto ite = 0;
+	for (; ite < this->n_ite; ite++)
+	{
+		this->_set_ite(ite);
+		this->_initialize_var_to_chk(ite == 0);
+		this->_decode_single_ite();
+
+		if (this->enable_syndrome && ite != this->n_ite -1)
+		{
+			// for the K variable nodes (make a majority vote with the entering messages)
+			this->_make_majority_vote();
+			this->_latch_decisions();
+			this->_update_done();
+
+			if ((this->done & this->active) == this->active)
+				break;
+		}
+	}
+	if (ite == this->n_ite)
+	{
+		this->_make_majority_vote();
+		this->_latch_decisions();
+	}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::_latch_decisions()
+{
+	// the frames which syndrome has already been verified keep their decisions
+	const auto keep = this->done;
+	for (auto v = 0; v < this->N; v++)
+		this->V_bs[v] = (this->V_bs[v] & keep) | (this->D_bs[v] & ~keep);
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::_update_done()
+{
+	// syndrome of the 64 frames at once: a lane of 'unsat' is set if at least one check node is not satisfied
+	W unsat = (W)0;
+	const auto n_chk_nodes = (int)this->H.get_n_cols();
+	for (auto c = 0; c < n_chk_nodes; c++)
+	{
+		const auto &chk_node = this->H.get_col_to_rows()[c];
+		W parity = (W)0;
+		for (auto v : chk_node)
+			parity ^= this->D_bs[v];
+		unsat |= parity;
+	}
+
+	const auto pending = this->active & ~this->done;
+	for (auto f = 0; f < BS::n_lanes; f++)
+	{
+		if (!((pending >> f) & (W)1))
+			continue;
+
+		if ((unsat >> f) & (W)1)
+			this->syndrome_depths[f] = 0;
+		else
+		{
+			this->syndrome_depths[f] = (this->syndrome_depths[f] +1) % this->syndrome_depth;
+			if (this->syndrome_depths[f] == 0)
+				this->done |= (W)1 << f;
+		}
+	}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::_decode_single_ite()
+{
+	auto transpose_ptr = this->transpose.data();
+
+	// for each check nodes
+	const auto n_chk_nodes = (int)this->H.get_n_cols();
+	for (auto c = 0; c < n_chk_nodes; c++)
+	{
+		const auto chk_degree = (int)this->H.get_col_to_rows()[c].size();
+
+		W acc = (W)0;
+		for (auto v = 0; v < chk_degree; v++)
+			acc ^= this->var_to_chk[transpose_ptr[v]];
+
+		for (auto v = 0; v < chk_degree; v++)
+			this->chk_to_var[transpose_ptr[v]] = acc ^ this->var_to_chk[transpose_ptr[v]];
+
+		transpose_ptr += chk_degree;
+	}
+}
+
+template <typename B, typename R>
+void Decoder_LDPC_BP_flooding_Gallager_inter<B,R>
+::_set_ite(const int ite)
+{
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_inter<B_8,Q_8>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_inter<B_16,Q_16>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_inter<B_32,Q_32>;
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_inter<B_64,Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_BP_flooding_Gallager_inter<B,Q>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,73 @@
+#ifndef DECODER_LDPC_BP_FLOODING_GALLAGER_INTER_HPP_
+#define DECODER_LDPC_BP_FLOODING_GALLAGER_INTER_HPP_
+
+#include <cstdint>
+
+#include "Tools/Perf/Bit_slice/Bit_slice.hpp"
+
+#include "../../../../Decoder_SIHO_HIHO.hpp"
+#include "../../Decoder_LDPC_BP.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_LDPC_BP_flooding_Gallager_inter
+ *
+ * \brief Common part of the bit-sliced Gallager decoders.
+ *
+ * The messages are stored in 64-bit words where the bit 'f' belongs to the frame 'f': one wave decodes 64 independent
+ * frames and the check and variable node updates are boolean expressions on the words. The syndrome is checked for
+ * the 64 frames at once, a frame which syndrome is verified keeps its decision while the others go on.
+ */
+template <typename B = int, typename R = float>
+class Decoder_LDPC_BP_flooding_Gallager_inter : public Decoder_SIHO_HIHO<B,R>, public Decoder_LDPC_BP
+{
+protected:
+	typedef uint64_t                W;
+	typedef tools::Bit_slice<W>     BS;
+
+	const std::vector<uint32_t> &info_bits_pos;
+
+	std::vector<B       > HY_N;       // hard decisions of the frames of the wave
+	std::vector<W       > Y_bs;       // input bits        (bit-sliced)
+	std::vector<W       > D_bs;       // current decisions (bit-sliced)
+	std::vector<W       > V_bs;       // decoded bits      (bit-sliced)
+	std::vector<W       > chk_to_var; // check    nodes to variable nodes messages (bit-sliced)
+	std::vector<W       > var_to_chk; // variable nodes to check    nodes messages (bit-sliced)
+	std::vector<unsigned> transpose;
+	std::vector<int     > syndrome_depths; // current syndrome depth of each frame
+
+	W active; // frames of the current wave
+	W done;   // frames which syndrome has been verified
+
+public:
+	Decoder_LDPC_BP_flooding_Gallager_inter(const int K, const int N, const int n_ite,
+	                                        const std::shared_ptr<const tools::Sparse_matrix> &H,
+	                                        const std::vector<unsigned> &info_bits_pos,
+	                                        const bool enable_syndrome = true,
+	                                        const int syndrome_depth = 1,
+	                                        const int n_frames = 1);
+	virtual ~Decoder_LDPC_BP_flooding_Gallager_inter() = default;
+
+protected:
+	void _decode_hiho   (const B *Y_N, B *V_K, const int frame_id);
+	void _decode_hiho_cw(const B *Y_N, B *V_K, const int frame_id);
+	void _decode_siho   (const R *Y_N, B *V_K, const int frame_id);
+	void _decode_siho_cw(const R *Y_N, B *V_K, const int frame_id);
+
+	void _load  (const B *Y_N, const int frame_id);
+	void _decode();
+	void _latch_decisions();
+	void _update_done    ();
+
+	virtual void _initialize_var_to_chk(const bool first_ite) = 0;
+	virtual void _decode_single_ite    (                    );
+	virtual void _make_majority_vote   (                    ) = 0;
+	virtual void _set_ite              (const int ite       );
+};
+}
+}
+
+#endif /* DECODER_LDPC_BP_FLOODING_GALLAGER_INTER_HPP_ */
@@ -16,16 +16,16 @@ namespace module
 template <typename B, typename R>
 Decoder_LDPC_BP_flooding_SPA<B,R>
 ::Decoder_LDPC_BP_flooding_SPA(const int K, const int N, const int n_ite,
-                               const tools::Sparse_matrix &_H,
+                               const std::shared_ptr<const tools::Sparse_matrix> &_H,
                                const std::vector<uint32_t> &info_bits_pos,
                                const bool enable_syndrome,
                                const int syndrome_depth,
                                const int n_frames)
 : Decoder(K, N, n_frames, 1),
   Decoder_LDPC_BP_flooding<B,R,tools::Update_rule_SPA<R>>(K, N, n_ite, _H, info_bits_pos,
-                                                          tools::Update_rule_SPA<R>(_H.get_cols_max_degree()),
+                                                          tools::Update_rule_SPA<R>(_H->get_cols_max_degree()),
                                                           enable_syndrome, syndrome_depth, n_frames),
-  values(_H.get_cols_max_degree())
+  values(_H->get_cols_max_degree())
 {
 	const std::string name = "Decoder_LDPC_BP_flooding_SPA";
 	this->set_name(name);
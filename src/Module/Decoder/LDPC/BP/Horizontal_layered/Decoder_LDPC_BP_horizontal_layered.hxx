@@ -15,7 +15,7 @@ namespace module
 template <typename B, typename R, class Update_rule>
 Decoder_LDPC_BP_horizontal_layered<B,R,Update_rule>
 ::Decoder_LDPC_BP_horizontal_layered(const int K, const int N, const int n_ite,
-                                     const tools::Sparse_matrix &_H,
+                                     const std::shared_ptr<const tools::Sparse_matrix> &_H,
                                      const std::vector<unsigned> &info_bits_pos,
                                      const Update_rule &up_rule,
                                      const bool enable_syndrome,
@@ -82,49 +82,66 @@ template <typename B, typename R, class Update_rule>
 void Decoder_LDPC_BP_horizontal_layered<B,R,Update_rule>
 ::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
 {
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	// the sub-timers are only measured with the statistics and the spans only recorded when the tracer is started
+	auto &task = (*this)[dec::tsk::decode_siho];
+	const auto stats = task.is_stats();
+	const auto trace = tools::is_trace_enabled();
+	std::chrono::steady_clock::time_point t_load, t_decod, t_store;
+	uint64_t s_load = 0, s_decod = 0, s_store = 0;
+
+	if (stats) t_load = std::chrono::steady_clock::now(); // ------------------------------------------------------ LOAD
+	if (trace) s_load = tools::trace_now();
 	this->_load(Y_N, frame_id);
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	if (stats) task.update_timer((int)dec::tm::decode_siho::load, std::chrono::steady_clock::now() - t_load);
+	if (trace) task.trace_timer ((int)dec::tm::decode_siho::load, s_load);
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	if (stats) t_decod = std::chrono::steady_clock::now(); // --------------------------------------------------- DECODE
+	if (trace) s_decod = tools::trace_now();
 	// actual decoding
 	this->_decode(frame_id);
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	if (stats) task.update_timer((int)dec::tm::decode_siho::decode, std::chrono::steady_clock::now() - t_decod);
+	if (trace) task.trace_timer ((int)dec::tm::decode_siho::decode, s_decod);
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	if (stats) t_store = std::chrono::steady_clock::now(); // ---------------------------------------------------- STORE
+	if (trace) s_store = tools::trace_now();
 	// take the hard decision
 	for (auto i = 0; i < this->K; i++)
 	{
 		const auto k = this->info_bits_pos[i];
 		V_K[i] = !(this->var_nodes[frame_id][k] >= 0);
 	}
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::load,   d_load);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store,  d_store);
+	if (stats) task.update_timer((int)dec::tm::decode_siho::store, std::chrono::steady_clock::now() - t_store);
+	if (trace) task.trace_timer ((int)dec::tm::decode_siho::store, s_store);
 }
 
 template <typename B, typename R, class Update_rule>
 void Decoder_LDPC_BP_horizontal_layered<B,R,Update_rule>
 ::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
 {
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	auto &task = (*this)[dec::tsk::decode_siho_cw];
+	const auto stats = task.is_stats();
+	const auto trace = tools::is_trace_enabled();
+	std::chrono::steady_clock::time_point t_load, t_decod, t_store;
+	uint64_t s_load = 0, s_decod = 0, s_store = 0;
+
+	if (stats) t_load = std::chrono::steady_clock::now(); // ------------------------------------------------------ LOAD
+	if (trace) s_load = tools::trace_now();
 	this->_load(Y_N, frame_id);
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	if (stats) task.update_timer((int)dec::tm::decode_siho_cw::load, std::chrono::steady_clock::now() - t_load);
+	if (trace) task.trace_timer ((int)dec::tm::decode_siho_cw::load, s_load);
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	if (stats) t_decod = std::chrono::steady_clock::now(); // --------------------------------------------------- DECODE
+	if (trace) s_decod = tools::trace_now();
 	// actual decoding
 	this->_decode(frame_id);
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	if (stats) task.update_timer((int)dec::tm::decode_siho_cw::decode, std::chrono::steady_clock::now() - t_decod);
+	if (trace) task.trace_timer ((int)dec::tm::decode_siho_cw::decode, s_decod);
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	if (stats) t_store = std::chrono::steady_clock::now(); // ---------------------------------------------------- STORE
+	if (trace) s_store = tools::trace_now();
 	tools::hard_decide(this->var_nodes[frame_id].data(), V_N, this->N);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::load,   d_load);
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::store,  d_store);
+	if (stats) task.update_timer((int)dec::tm::decode_siho_cw::store, std::chrono::steady_clock::now() - t_store);
+	if (trace) task.trace_timer ((int)dec::tm::decode_siho_cw::store, s_store);
 }
 
 template <typename B, typename R, class Update_rule>
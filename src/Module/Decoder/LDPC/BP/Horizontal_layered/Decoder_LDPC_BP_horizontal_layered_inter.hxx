@@ -7,6 +7,7 @@
 #include "Tools/Math/utils.h"
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Perf/Reorderer/Reorderer.hpp"
+#include "Tools/Thread_pinning/Thread_pinning.hpp"
 
 #include "Decoder_LDPC_BP_horizontal_layered_inter.hpp"
 
@@ -34,7 +35,7 @@ inline mipp::Reg<int8_t> saturate(const mipp::Reg<int8_t> v, const int8_t s)
 template <typename B, typename R, class Update_rule>
 Decoder_LDPC_BP_horizontal_layered_inter<B,R,Update_rule>
 ::Decoder_LDPC_BP_horizontal_layered_inter(const int K, const int N, const int n_ite,
-                                           const tools::Sparse_matrix &_H,
+                                           const std::shared_ptr<const tools::Sparse_matrix> &_H,
                                            const std::vector<unsigned> &info_bits_pos,
                                            const Update_rule &up_rule,
                                            const bool enable_syndrome,
@@ -47,7 +48,7 @@ Decoder_LDPC_BP_horizontal_layered_inter<B,R,Update_rule>
   up_rule               (up_rule                                                                            ),
   sat_val               ((R)((1 << ((sizeof(R) * 8 -2) - (int)std::log2(this->H.get_rows_max_degree()))) -1)),
   var_nodes             (this->n_dec_waves, mipp::vector<mipp::Reg<R>>(N)                                   ),
-  messages              (this->n_dec_waves, mipp::vector<mipp::Reg<R>>(this->H.get_n_connections())         ),
+  messages              (this->n_dec_waves                                                                  ),
   contributions         (this->H.get_cols_max_degree()                                                      ),
   Y_N_reorderered       (N                                                                                  ),
   V_reorderered         (N                                                                                  ),
@@ -62,6 +63,11 @@ Decoder_LDPC_BP_horizontal_layered_inter<B,R,Update_rule>
 		message << "'sat_val' has to be greater than 0 ('sat_val' = " << this->sat_val << ").";
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
+
+	// the messages are the largest state of the decoder (one SIMD register per edge of the Tanner graph), they are
+	// allocated here to be advised before their first touch
+	for (auto &m : this->messages)
+		tools::Thread_pinning::resize_huge_pages(m, this->H.get_n_connections());
 }
 
 template <typename B, typename R, class Update_rule>
@@ -16,13 +16,14 @@ using namespace aff3ct::module;
 template <typename B, typename R>
 Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B,R>
 ::Decoder_LDPC_BP_horizontal_layered_ONMS_inter(const int K, const int N, const int n_ite,
-                                                const tools::Sparse_matrix &_H,
+                                                const std::shared_ptr<const tools::Sparse_matrix> &_H,
                                                 const std::vector<unsigned> &info_bits_pos,
                                                 const float normalize_factor,
                                                 const R offset,
                                                 const bool enable_syndrome,
                                                 const int syndrome_depth,
-                                                const int n_frames)
+                                                const int n_frames,
+                                                const bool compact_messages)
 : Decoder               (K, N, n_frames, mipp::N<R>()                                                       ),
   Decoder_SISO_SIHO<B,R>(K, N, n_frames, mipp::N<R>()                                                       ),
   Decoder_LDPC_BP       (K, N, n_ite, _H, enable_syndrome, syndrome_depth                                   ),
@@ -32,8 +33,15 @@ Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B,R>
   saturation            ((R)((1 << ((sizeof(R) * 8 -2) - (int)std::log2(this->H.get_rows_max_degree()))) -1)),
   init_flag             (true                                                                               ),
   info_bits_pos         (info_bits_pos                                                                      ),
+  compact_messages      (compact_messages                                                                   ),
   var_nodes             (this->n_dec_waves, mipp::vector<mipp::Reg<R>>(N)                                   ),
-  branches              (this->n_dec_waves, mipp::vector<mipp::Reg<R>>(this->H.get_n_connections())         ),
+  branches              (this->n_dec_waves, mipp::vector<mipp::Reg<R>>(compact_messages ? 0 :
+                                                                       this->H.get_n_connections())         ),
+  signs_offsets         (compact_messages ? this->H.get_n_cols() +1 : 0                                     ),
+  chk_csts              (this->n_dec_waves, mipp::vector<mipp::Reg<R>>(compact_messages ?
+                                                                       2 * this->H.get_n_cols() : 0)        ),
+  chk_argmins           (this->n_dec_waves, mipp::vector<mipp::Reg<B>>(compact_messages ?
+                                                                       this->H.get_n_cols() : 0)            ),
   Y_N_reorderered       (N                                                                                  ),
   V_reorderered         (N                                                                                  )
 {
@@ -49,6 +57,26 @@ Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B,R>
 		message << "'saturation' has to be greater than 0 ('saturation' = " << saturation << ").";
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
+
+	if (compact_messages)
+	{
+		const auto n_bits = (unsigned)(sizeof(B) * 8);
+		// the position of the smallest magnitude in a CN is stored in a 'B' (H is vertical: the CNs are the columns)
+		if (this->H.get_cols_max_degree() > (size_t)std::numeric_limits<B>::max())
+		{
+			std::stringstream message;
+			message << "'H.get_cols_max_degree()' has to be smaller or equal to 'std::numeric_limits<B>::max()' "
+			        << "('H.get_cols_max_degree()' = " << this->H.get_cols_max_degree()
+			        << ", 'std::numeric_limits<B>::max()' = " << +std::numeric_limits<B>::max() << ").";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		signs_offsets[0] = 0;
+		for (size_t c = 0; c < this->H.get_n_cols(); c++)
+			signs_offsets[c +1] = signs_offsets[c] + ((unsigned)this->H[c].size() + n_bits -1) / n_bits;
+
+		this->signs.resize(this->n_dec_waves, mipp::vector<mipp::Reg<B>>(signs_offsets.back()));
+	}
 }
 
 template <typename B, typename R>
@@ -67,9 +95,14 @@ void Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B,R>
 	// memory zones initialization
 	if (this->init_flag)
 	{
-		const auto zero = mipp::Reg<R>((R)0);
-		std::fill(this->branches [cur_wave].begin(), this->branches [cur_wave].end(), zero);
-		std::fill(this->var_nodes[cur_wave].begin(), this->var_nodes[cur_wave].end(), zero);
+		const auto zero   = mipp::Reg<R>((R)0);
+		const auto zero_b = mipp::Reg<B>((B)0);
+		std::fill(this->branches   [cur_wave].begin(), this->branches   [cur_wave].end(), zero  );
+		std::fill(this->var_nodes  [cur_wave].begin(), this->var_nodes  [cur_wave].end(), zero  );
+		std::fill(this->chk_csts   [cur_wave].begin(), this->chk_csts   [cur_wave].end(), zero  );
+		std::fill(this->chk_argmins[cur_wave].begin(), this->chk_argmins[cur_wave].end(), zero_b);
+		if (this->compact_messages)
+			std::fill(this->signs[cur_wave].begin(), this->signs[cur_wave].end(), zero_b);
 
 		if (cur_wave == this->n_dec_waves -1) this->init_flag = false;
 	}
@@ -242,7 +275,10 @@ void Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B,R>
 
 	for (auto ite = 0; ite < this->n_ite; ite++)
 	{
-		this->_decode_single_ite<F>(this->var_nodes[cur_wave], this->branches[cur_wave]);
+		if (this->compact_messages)
+			this->_decode_single_ite_compact<F>(cur_wave);
+		else
+			this->_decode_single_ite<F>(this->var_nodes[cur_wave], this->branches[cur_wave]);
 
 		// stop criterion
 		if (this->enable_syndrome && this->_check_syndrome(frame_id))
@@ -341,6 +377,84 @@ void Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B,R>
 	}
 }
 
+// BP algorithm, the messages are rebuilt from the compact representation of the check nodes
+template <typename B, typename R>
+template <int F>
+void Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B,R>
+::_decode_single_ite_compact(const int cur_wave)
+{
+	auto &var_nodes = this->var_nodes  [cur_wave];
+	auto &csts      = this->chk_csts   [cur_wave];
+	auto &argmins   = this->chk_argmins[cur_wave];
+	auto &sgns      = this->signs      [cur_wave];
+
+	constexpr int n_bits = (int)(sizeof(B) * 8);
+
+	const auto zero_msk    = mipp::Msk<mipp::N<B>()>(false);
+	const auto zero        = mipp::Reg<R>((R)0);
+	const auto zero_b      = mipp::Reg<B>((B)0);
+	const auto n_chk_nodes = (int)H.get_n_cols();
+	for (auto c = 0; c < n_chk_nodes; c++)
+	{
+		auto sign   = zero_msk;
+		auto min1   = mipp::Reg<R>(std::numeric_limits<R>::max());
+		auto min2   = mipp::Reg<R>(std::numeric_limits<R>::max());
+		auto argmin = zero_b;
+
+		const auto old_cste1  = csts[2 * c +0];
+		const auto old_cste2  = csts[2 * c +1];
+		const auto old_argmin = argmins[c];
+		const auto sgns_c     = sgns.data() + this->signs_offsets[c];
+
+		const auto chk_degree = (int)this->H[c].size();
+		for (auto v = 0; v < chk_degree; v++)
+		{
+			// rebuild the message of the previous iteration
+			const auto bit     = mipp::Reg<B>((B)((uint64_t)1 << (v % n_bits)));
+			const auto old_sng = (sgns_c[v / n_bits] & bit) != zero_b;
+			const auto old_abs = mipp::blend(old_cste1, old_cste2, mipp::Reg<B>((B)v) == old_argmin);
+
+			contributions[v]    = var_nodes[this->H[c][v]] - mipp::copysign(old_abs, old_sng);
+			const auto var_abs  = mipp::abs (contributions[v]);
+			const auto var_sign = mipp::sign(contributions[v]);
+			const auto tmp      = min1;
+
+			sign  ^= var_sign;
+			argmin = mipp::blend(mipp::Reg<B>((B)v), argmin, var_abs < min1);
+			min1   = mipp::min(min1,           var_abs      );
+			min2   = mipp::min(min2, mipp::max(var_abs, tmp));
+		}
+
+		auto cste1 = simd_sat<R>(simd_normalize<R,F>(min2 - offset, normalize_factor), saturation);
+		auto cste2 = simd_sat<R>(simd_normalize<R,F>(min1 - offset, normalize_factor), saturation);
+
+		cste1 = mipp::blend(zero, cste1, zero > cste1);
+		cste2 = mipp::blend(zero, cste2, zero > cste2);
+
+		auto sgn_word = zero_b;
+		for (auto v = 0; v < chk_degree; v++)
+		{
+			const auto var_val = contributions[v];
+			const auto res_abs = mipp::blend(cste1, cste2, mipp::Reg<B>((B)v) == argmin);
+			const auto res_sng = sign ^ mipp::sign(var_val);
+
+			var_nodes[this->H[c][v]] = var_val + mipp::copysign(res_abs, res_sng);
+
+			const auto bit = mipp::Reg<B>((B)((uint64_t)1 << (v % n_bits)));
+			sgn_word |= mipp::blend(bit, zero_b, res_sng);
+			if (v % n_bits == n_bits -1 || v == chk_degree -1)
+			{
+				sgns_c[v / n_bits] = sgn_word;
+				sgn_word = zero_b;
+			}
+		}
+
+		csts[2 * c +0] = cste1;
+		csts[2 * c +1] = cste2;
+		argmins[c]     = argmin;
+	}
+}
+
 template <typename B, typename R>
 bool Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B,R>
 ::_check_syndrome(const int frame_id)
@@ -10,6 +10,17 @@ namespace aff3ct
 {
 namespace module
 {
+/*!
+ * \class Decoder_LDPC_BP_horizontal_layered_ONMS_inter
+ *
+ * \brief Horizontal layered BP decoder with the Offset Normalized Min-Sum update rule (MS, NMS and OMS), SIMD inter-frame.
+ *
+ * In the compact mode ('compact_messages' = true), the check to variable messages are not stored per edge: the
+ * messages of a check node are fully described by its two magnitudes (from the two minimums), the position of the
+ * minimum and the sign of each message (packed in the bits of a SIMD register). The messages are rebuilt on the fly
+ * from this tuple. The decoder state is reduced from 'd' registers to '3 + ceil(d / (8 * sizeof(B)))' registers per
+ * check node of degree 'd', the decoded frames are exactly the same.
+ */
 template <typename B = int, typename R = float>
 class Decoder_LDPC_BP_horizontal_layered_ONMS_inter : public Decoder_SISO_SIHO<B,R>, public Decoder_LDPC_BP
 {
@@ -26,22 +37,31 @@ protected:
 
 	const std::vector<unsigned> &info_bits_pos;
 
+	const bool compact_messages;
+
 	// data structures for iterative decoding
 	std::vector<mipp::vector<mipp::Reg<R>>> var_nodes;
 	std::vector<mipp::vector<mipp::Reg<R>>> branches;
 
+	// data structures for the compact mode (instead of 'branches')
+	std::vector<unsigned>                   signs_offsets; // position of the first sign register of each check node
+	std::vector<mipp::vector<mipp::Reg<R>>> chk_csts;      // the two magnitudes of the messages of each check node
+	std::vector<mipp::vector<mipp::Reg<B>>> chk_argmins;   // position of the minimum in each check node
+	std::vector<mipp::vector<mipp::Reg<B>>> signs;         // signs of the messages, one bit per edge
+
 	mipp::vector<mipp::Reg<R>> Y_N_reorderered;
 	mipp::vector<mipp::Reg<B>> V_reorderered;
 
 public:
 	Decoder_LDPC_BP_horizontal_layered_ONMS_inter(const int K, const int N, const int n_ite,
-	                                              const tools::Sparse_matrix &H,
+	                                              const std::shared_ptr<const tools::Sparse_matrix> &H,
 	                                              const std::vector<unsigned> &info_bits_pos,
 	                                              const float normalize_factor = 1.f,
 	                                              const R offset = (R)0,
 	                                              const bool enable_syndrome = true,
 	                                              const int syndrome_depth = 1,
-	                                              const int n_frames = 1);
+	                                              const int n_frames = 1,
+	                                              const bool compact_messages = false);
 	virtual ~Decoder_LDPC_BP_horizontal_layered_ONMS_inter() = default;
 
 	void reset();
@@ -56,6 +76,8 @@ protected:
 	void _decode(const int frame_id);
 	template <int F = 1>
 	void _decode_single_ite(mipp::vector<mipp::Reg<R>> &var_nodes, mipp::vector<mipp::Reg<R>> &branches);
+	template <int F = 1>
+	void _decode_single_ite_compact(const int cur_wave);
 	bool _check_syndrome(const int frame_id);
 };
 }
@@ -21,7 +21,7 @@ protected:
 
 public:
 	Decoder_LDPC_BP_peeling(const int K, const int N, const int n_ite,
-	                        const tools::Sparse_matrix &H,
+	                        const std::shared_ptr<const tools::Sparse_matrix> &H,
 	                        const std::vector<unsigned> &info_bits_pos,
 	                        const bool enable_syndrome = true,
 	                        const int syndrome_depth = 1,
@@ -15,7 +15,7 @@ namespace module
 template <typename B, typename R, class Update_rule>
 Decoder_LDPC_BP_vertical_layered<B,R,Update_rule>
 ::Decoder_LDPC_BP_vertical_layered(const int K, const int N, const int n_ite,
-                                   const tools::Sparse_matrix &_H,
+                                   const std::shared_ptr<const tools::Sparse_matrix> &_H,
                                    const std::vector<unsigned> &info_bits_pos,
                                    const Update_rule &up_rule,
                                    const bool enable_syndrome,
@@ -0,0 +1,92 @@
+#ifndef DECODER_POLAR_SCAN_FAST_SYS_
+#define DECODER_POLAR_SCAN_FAST_SYS_
+
+#include <vector>
+#include <memory>
+#include <mipp.h>
+
+#include "Tools/Code/Polar/Pattern_polar_parser.hpp"
+#include "Tools/Code/Polar/API/API_polar_dynamic_seq.hpp"
+#include "Tools/Code/Polar/API/functions_polar_seq.h"
+#include "Tools/Code/Polar/decoder_polar_functions.h"
+#include "Tools/Code/Polar/Frozenbits_notifier.hpp"
+
+#include "../../Decoder_SISO_SIHO.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_polar_SCAN_fast_sys
+ *
+ * \brief Fast systematic Soft CANcellation (SCAN) decoder: the SCAN schedule is applied on the pruned tree of the
+ *        polar code and the node updates are made with the API_polar kernels (sequential, intra-frame SIMD or
+ *        inter-frame SIMD depending on the API_polar template parameter).
+ *
+ * The soft feedbacks of the rate 0 and rate 1 nodes are constant and the ones of the repetition and single parity
+ * check nodes are computed directly (the exact extrinsic of a repetition code and the min-sum extrinsic of a single
+ * parity check code). Without the REP and SPC nodes, the decoder gives the same results than the
+ * Decoder_polar_SCAN_naive_sys. The SIMD kernels are not used on the nodes smaller than a register: the LLRs and the
+ * soft feedbacks are kept from an iteration to the other and a full register store would overwrite the next nodes.
+ *
+ * When the early termination is enabled, the iterations stop as soon as the hard decisions on the codeword are the
+ * same for two consecutive iterations (for all the frames of the SIMD inter-frame level).
+ */
+template <typename B = int, typename R = float, class API_polar = tools::API_polar_dynamic_seq<B,R>>
+class Decoder_polar_SCAN_fast_sys : public Decoder_SISO_SIHO<B,R>, public tools::Frozenbits_notifier
+{
+protected:
+	const int                 m;                 // graph depth
+	const int                 max_iter;          // maximum number of iterations
+	const bool                early_termination; // stop when the hard decisions are stable
+	      mipp::vector<R>     l;                 // LLRs from the channel side (alpha), one array of size N per level
+	      mipp::vector<R>     b;                 // soft feedbacks from the frozen bits side (beta), same layout
+	      mipp::vector<R>     tmp;               // intermediate values of the node updates
+	      mipp::vector<B>     s;                 // hard decisions on the codeword
+	      mipp::vector<B>     s_prev;            // hard decisions on the codeword at the previous iteration
+	const std::vector<bool>  &frozen_bits;       // frozen bits
+
+	tools::Pattern_polar_parser polar_patterns;
+
+public:
+	Decoder_polar_SCAN_fast_sys(const int& K, const int& N, const int& max_iter, const std::vector<bool>& frozen_bits,
+	                            const bool early_termination = false, const int n_frames = 1);
+
+	Decoder_polar_SCAN_fast_sys(const int& K, const int& N, const int& max_iter, const std::vector<bool>& frozen_bits,
+	                            std::vector<std::unique_ptr<tools::Pattern_polar_i>>&& polar_patterns,
+	                            const int idx_r0, const int idx_r1, const bool early_termination = false,
+	                            const int n_frames = 1);
+
+	virtual ~Decoder_polar_SCAN_fast_sys() = default;
+
+	virtual void notify_frozenbits_update();
+
+protected:
+	        void _load          (const R *Y_N                                       );
+	        void _load          (const R *sys, const R *par                         );
+	virtual void _decode        (                                                   );
+	        void _decode_siho   (const R *Y_N,  B *V_K,  const int frame_id         );
+	        void _decode_siho_cw(const R *Y_N,  B *V_N,  const int frame_id         );
+	        void _decode_siso   (const R *sys, const R *par, R *ext, const int frame_id);
+	        void _decode_siso   (const R *Y_N1, R *Y_N2, const int frame_id         );
+	        void _store         (               B *V_K                              );
+	        void _store_cw      (               B *V_N                              );
+
+	virtual void recursive_decode(const int off, const int depth, int &node_id);
+
+	void hard_decide();
+	void f_node  (const R *l_a, const R *l_b, R *l_c, const int n_elmts);
+	void g0_node (const R *l_a, const R *l_b, R *l_c, const int n_elmts);
+	void rep_node(const R *l_a, R *b_a, const int n_elmts);
+	void spc_node(const R *l_a, R *b_a, const int n_elmts);
+
+private:
+	void check_parameters();
+};
+}
+}
+
+#include "Decoder_polar_SCAN_fast_sys.hxx"
+
+#endif /* DECODER_POLAR_SCAN_FAST_SYS_ */
@@ -0,0 +1,482 @@
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Math/utils.h"
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Perf/Reorderer/Reorderer.hpp"
+
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r0.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r0_left.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r1.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_rep.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_rep_left.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_spc.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_std.hpp"
+
+#include "Tools/Code/Polar/fb_extract.h"
+
+#include "Decoder_polar_SCAN_fast_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::Decoder_polar_SCAN_fast_sys(const int& K, const int& N, const int& max_iter, const std::vector<bool>& frozen_bits,
+                              const bool early_termination, const int n_frames)
+: Decoder              (K, N, n_frames, API_polar::get_n_frames()),
+  Decoder_SISO_SIHO<B,R>(K, N, n_frames, API_polar::get_n_frames()),
+  m                    ((int)std::log2(N)),
+  max_iter             (max_iter),
+  early_termination    (early_termination),
+  l                    (((int)std::log2(N) +1) * N * API_polar::get_n_frames() + mipp::nElReg<R>()),
+  b                    (((int)std::log2(N) +1) * N * API_polar::get_n_frames() + mipp::nElReg<R>()),
+  tmp                  (                         N * API_polar::get_n_frames() + mipp::nElReg<R>()),
+  s                    (                         N * API_polar::get_n_frames() + mipp::nElReg<B>()),
+  s_prev               (                         N * API_polar::get_n_frames() + mipp::nElReg<B>()),
+  frozen_bits          (frozen_bits),
+  polar_patterns       (N,
+                        frozen_bits,
+                        {new tools::Pattern_polar_std,
+                         new tools::Pattern_polar_r0_left,
+                         new tools::Pattern_polar_r0,
+                         new tools::Pattern_polar_r1,
+                         new tools::Pattern_polar_rep_left,
+                         new tools::Pattern_polar_rep,
+                         new tools::Pattern_polar_spc},
+                        2,
+                        3)
+{
+	const std::string name = "Decoder_polar_SCAN_fast_sys";
+	this->set_name(name);
+
+	this->check_parameters();
+}
+
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::Decoder_polar_SCAN_fast_sys(const int& K, const int& N, const int& max_iter, const std::vector<bool>& frozen_bits,
+                              std::vector<std::unique_ptr<tools::Pattern_polar_i>> &&polar_patterns,
+                              const int idx_r0, const int idx_r1, const bool early_termination, const int n_frames)
+: Decoder              (K, N, n_frames, API_polar::get_n_frames()),
+  Decoder_SISO_SIHO<B,R>(K, N, n_frames, API_polar::get_n_frames()),
+  m                    ((int)std::log2(N)),
+  max_iter             (max_iter),
+  early_termination    (early_termination),
+  l                    (((int)std::log2(N) +1) * N * API_polar::get_n_frames() + mipp::nElReg<R>()),
+  b                    (((int)std::log2(N) +1) * N * API_polar::get_n_frames() + mipp::nElReg<R>()),
+  tmp                  (                         N * API_polar::get_n_frames() + mipp::nElReg<R>()),
+  s                    (                         N * API_polar::get_n_frames() + mipp::nElReg<B>()),
+  s_prev               (                         N * API_polar::get_n_frames() + mipp::nElReg<B>()),
+  frozen_bits          (frozen_bits),
+  polar_patterns       (N, frozen_bits, std::move(polar_patterns), idx_r0, idx_r1)
+{
+	const std::string name = "Decoder_polar_SCAN_fast_sys";
+	this->set_name(name);
+
+	this->check_parameters();
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::check_parameters()
+{
+	static_assert(sizeof(B) == sizeof(R), "");
+
+	if (!tools::is_power_of_2(this->N))
+	{
+		std::stringstream message;
+		message << "'N' has to be a power of 2 ('N' = " << this->N << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (this->N != (int)frozen_bits.size())
+	{
+		std::stringstream message;
+		message << "'frozen_bits.size()' has to be equal to 'N' ('frozen_bits.size()' = " << frozen_bits.size()
+		        << ", 'N' = " << this->N << ").";
+		throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	auto k = 0; for (auto i = 0; i < this->N; i++) if (frozen_bits[i] == 0) k++;
+	if (this->K != k)
+	{
+		std::stringstream message;
+		message << "The number of information bits in the frozen_bits is invalid ('K' = " << this->K << ", 'k' = "
+		        << k << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (max_iter <= 0)
+	{
+		std::stringstream message;
+		message << "'max_iter' has to be greater than 0 ('max_iter' = " << max_iter << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::notify_frozenbits_update()
+{
+	polar_patterns.notify_frozenbits_update();
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_load(const R *Y_N)
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	if (n_frames == 1)
+		std::copy(Y_N, Y_N + this->N, l.begin());
+	else
+	{
+		std::vector<const R*> frames(n_frames);
+		for (auto f = 0; f < n_frames; f++)
+			frames[f] = Y_N + f * this->N;
+		tools::Reorderer_static<R,n_frames>::apply(frames, l.data(), this->N);
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_load(const R *sys, const R *par)
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	// the systematic LLRs are on the information bits and the parity LLRs on the frozen bits
+	const auto n_par = this->N - this->K;
+	for (auto f = 0; f < n_frames; f++)
+	{
+		auto sys_idx = 0, par_idx = 0;
+		for (auto i = 0; i < this->N; i++)
+			l[i * n_frames + f] = frozen_bits[i] ? par[f * n_par + par_idx++] : sys[f * this->K + sys_idx++];
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_decode()
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	// the soft feedbacks of the frozen bits are set when their nodes are reached for the first time
+	std::fill(b.begin(), b.begin() + (m +1) * this->N * n_frames, tools::init_LLR<R>());
+
+	for (auto ite = 0; ite < max_iter; ite++)
+	{
+		int node_id = 0;
+		this->recursive_decode(0, 0, node_id);
+
+		if (early_termination && ite < max_iter -1)
+		{
+			std::swap(this->s, this->s_prev);
+			this->hard_decide();
+
+			if (ite && std::equal(s.begin(), s.begin() + this->N * n_frames, s_prev.begin()))
+				break;
+		}
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::recursive_decode(const int off, const int depth, int &node_id)
+{
+	// 'off' is the offset of the node in its level, the levels are stored one after the other (the root first)
+	constexpr int n_frames = API_polar::get_n_frames();
+	const auto n_elmts = this->N >> depth;
+	const auto n_elm_2 = n_elmts >> 1;
+	const auto off_p   = (depth +0) * this->N + off; // parent node
+	const auto off_c   = (depth +1) * this->N + off; // left child node (the right one is at 'off_c + n_elm_2')
+
+	const auto node_type = polar_patterns.get_node_type(node_id);
+
+	const bool is_terminal_pattern = (node_type == tools::polar_node_t::RATE_0) ||
+	                                 (node_type == tools::polar_node_t::RATE_1) ||
+	                                 (node_type == tools::polar_node_t::REP)    ||
+	                                 (node_type == tools::polar_node_t::SPC);
+
+	if (!is_terminal_pattern && depth < m)
+	{
+		const R *l_up = l.data() + (off_p          ) * n_frames;
+		const R *l_dw = l.data() + (off_p + n_elm_2) * n_frames;
+		      R *b_up = b.data() + (off_p          ) * n_frames;
+		      R *b_dw = b.data() + (off_p + n_elm_2) * n_frames;
+		      R *l_le = l.data() + (off_c          ) * n_frames;
+		      R *l_ri = l.data() + (off_c + n_elm_2) * n_frames;
+		const R *b_le = b.data() + (off_c          ) * n_frames;
+		const R *b_ri = b.data() + (off_c + n_elm_2) * n_frames;
+
+		// the left half of the temporary space of the node is kept until the soft feedback update, the right half is
+		// used by the right child
+		R *t_le = tmp.data() + (off          ) * n_frames;
+		R *t_ri = tmp.data() + (off + n_elm_2) * n_frames;
+
+		// LLRs of the left child (with the feedback of the right child from the previous iteration), useless when
+		// the left child is a rate 0 node
+		if (node_type != tools::polar_node_t::RATE_0_LEFT)
+		{
+			this->g0_node(l_dw, b_ri, t_ri, n_elm_2);
+			this->f_node (l_up, t_ri, l_le, n_elm_2);
+		}
+
+		this->recursive_decode(off, depth +1, ++node_id); // recursive call left
+
+		// LLRs of the right child
+		this->f_node (b_le, l_up, t_le, n_elm_2);
+		this->g0_node(l_dw, t_le, l_ri, n_elm_2);
+
+		this->recursive_decode(off + n_elm_2, depth +1, ++node_id); // recursive call right
+
+		// soft feedback of the node
+		this->g0_node(b_ri, l_dw, t_ri, n_elm_2);
+		this->f_node (b_le, t_ri, b_up, n_elm_2);
+		this->g0_node(b_ri, t_le, b_dw, n_elm_2);
+	}
+	else
+	{
+		const R *l_a = l.data() + off_p * n_frames;
+		      R *b_a = b.data() + off_p * n_frames;
+
+		switch (node_type)
+		{
+			case tools::polar_node_t::RATE_0: std::fill(b_a, b_a + n_elmts * n_frames, tools::sat_val<R>()); break;
+			case tools::polar_node_t::RATE_1: break; // the soft feedback is always null
+			case tools::polar_node_t::REP:    this->rep_node(l_a, b_a, n_elmts); break;
+			case tools::polar_node_t::SPC:    this->spc_node(l_a, b_a, n_elmts); break;
+			default:
+				break;
+		}
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::f_node(const R *l_a, const R *l_b, R *l_c, const int n_elmts)
+{
+	// the LLRs and the soft feedbacks are kept between the iterations: the SIMD kernels write a full register and
+	// would overwrite the values of the next nodes when the node is smaller than a register
+	if (n_elmts * API_polar::get_n_frames() < mipp::nElReg<R>())
+		tools::f_seq<R, tools::f_LLR<R>>::apply(l_a, l_b, l_c, n_elmts);
+	else
+		API_polar::f(l_a, l_b, l_c, n_elmts);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::g0_node(const R *l_a, const R *l_b, R *l_c, const int n_elmts)
+{
+	if (n_elmts * API_polar::get_n_frames() < mipp::nElReg<R>())
+		tools::g0_seq<R, tools::g0_LLR<R>>::apply(l_a, l_b, l_c, n_elmts);
+	else
+		API_polar::g0(l_a, l_b, l_c, n_elmts);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::rep_node(const R *l_a, R *b_a, const int n_elmts)
+{
+	// extrinsic of a repetition code: b_a[i] = sum_{j != i} l_a[j], computed with the prefix and the suffix sums (no
+	// subtraction of the saturated fixed-point values)
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	R acc[n_frames];
+	std::fill(acc, acc + n_frames, tools::init_LLR<R>());
+	for (auto i = 0; i < n_elmts; i++)
+		for (auto f = 0; f < n_frames; f++)
+		{
+			b_a[i * n_frames + f] = acc[f];
+			acc[f] = tools::v_LLR<R>(acc[f], l_a[i * n_frames + f]);
+		}
+
+	std::fill(acc, acc + n_frames, tools::init_LLR<R>());
+	for (auto i = n_elmts -1; i >= 0; i--)
+		for (auto f = 0; f < n_frames; f++)
+		{
+			b_a[i * n_frames + f] = tools::v_LLR<R>(b_a[i * n_frames + f], acc[f]);
+			acc[f] = tools::v_LLR<R>(acc[f], l_a[i * n_frames + f]);
+		}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::spc_node(const R *l_a, R *b_a, const int n_elmts)
+{
+	// min-sum extrinsic of a single parity check code: the sign of the other values and the minimum of their
+	// magnitudes (the second minimum for the position of the first one)
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	for (auto f = 0; f < n_frames; f++)
+	{
+		auto min1 = std::numeric_limits<R>::max();
+		auto min2 = std::numeric_limits<R>::max();
+		auto pos1 = 0;
+		auto sign = false;
+		for (auto i = 0; i < n_elmts; i++)
+		{
+			const auto v = l_a[i * n_frames + f];
+			const auto a = (R)std::abs(v);
+			sign ^= v < 0;
+			if (a < min1)
+			{
+				min2 = min1;
+				min1 = a;
+				pos1 = i;
+			}
+			else if (a < min2)
+				min2 = a;
+		}
+
+		for (auto i = 0; i < n_elmts; i++)
+		{
+			const auto v   = l_a[i * n_frames + f];
+			const auto abs = (i == pos1) ? min2 : min1;
+			b_a[i * n_frames + f] = (sign ^ (v < 0)) ? (R)-abs : abs;
+		}
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::hard_decide()
+{
+	// the root of the tree gives the codeword (the decoder is systematic)
+	API_polar::g0(l.data(), b.data(), tmp.data(), this->N);
+	API_polar::h (tmp.data(), s.data(), this->N);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
+{
+//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	this->_load(Y_N);
+//	auto d_load = std::chrono::steady_clock::now() - t_load;
+
+//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	this->_decode();
+//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+
+//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	this->_store(V_K);
+//	auto d_store = std::chrono::steady_clock::now() - t_store;
+
+//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::load,   d_load);
+//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::decode, d_decod);
+//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store,  d_store);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_decode_siho_cw(const R *Y_N, B *V_N, const int frame_id)
+{
+//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	this->_load(Y_N);
+//	auto d_load = std::chrono::steady_clock::now() - t_load;
+
+//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	this->_decode();
+//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+
+//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	this->_store_cw(V_N);
+//	auto d_store = std::chrono::steady_clock::now() - t_store;
+
+//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::load,   d_load);
+//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::decode, d_decod);
+//	(*this)[dec::tsk::decode_siho_cw].update_timer(dec::tm::decode_siho_cw::store,  d_store);
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_decode_siso(const R *sys, const R *par, R *ext, const int frame_id)
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	// ----------------------------------------------------------------------------------------------------------- LOAD
+	this->_load(sys, par);
+
+	// --------------------------------------------------------------------------------------------------------- DECODE
+	this->_decode();
+
+	// ---------------------------------------------------------------------------------------------------------- STORE
+	for (auto f = 0; f < n_frames; f++)
+	{
+		auto sys_idx = 0;
+		for (auto i = 0; i < this->N; i++)
+			if (!frozen_bits[i]) // if "i" is NOT a frozen bit (information bit = sytematic bit)
+				ext[f * this->K + sys_idx++] = b[i * n_frames + f];
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_decode_siso(const R *Y_N1, R *Y_N2, const int frame_id)
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	// ----------------------------------------------------------------------------------------------------------- LOAD
+	this->_load(Y_N1);
+
+	// --------------------------------------------------------------------------------------------------------- DECODE
+	this->_decode();
+
+	// ---------------------------------------------------------------------------------------------------------- STORE
+	if (n_frames == 1)
+		std::copy(b.begin(), b.begin() + this->N, Y_N2);
+	else
+	{
+		std::vector<R*> frames(n_frames);
+		for (auto f = 0; f < n_frames; f++)
+			frames[f] = Y_N2 + f * this->N;
+		tools::Reorderer_static<R,n_frames>::apply_rev(b.data(), frames, this->N);
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_store(B *V_K)
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	this->hard_decide();
+
+	if (n_frames == 1)
+		tools::fb_extract(this->polar_patterns.get_leaves_pattern_types(), this->s.data(), V_K);
+	else
+	{
+		tools::fb_extract<B,n_frames>(this->polar_patterns.get_leaves_pattern_types(),
+		                              this->s.data(), this->s_prev.data());
+
+		std::vector<B*> frames(n_frames);
+		for (auto f = 0; f < n_frames; f++)
+			frames[f] = V_K + f * this->K;
+		tools::Reorderer_static<B,n_frames>::apply_rev(this->s_prev.data(), frames, this->K);
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCAN_fast_sys<B,R,API_polar>
+::_store_cw(B *V_N)
+{
+	constexpr int n_frames = API_polar::get_n_frames();
+
+	this->hard_decide();
+
+	if (n_frames == 1)
+		std::copy(this->s.begin(), this->s.begin() + this->N, V_N);
+	else
+	{
+		std::vector<B*> frames(n_frames);
+		for (auto f = 0; f < n_frames; f++)
+			frames[f] = V_N + f * this->N;
+		tools::Reorderer_static<B,n_frames>::apply_rev(this->s.data(), frames, this->N);
+	}
+}
+}
+}
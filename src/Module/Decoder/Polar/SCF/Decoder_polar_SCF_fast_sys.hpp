@@ -0,0 +1,96 @@
+#ifndef DECODER_POLAR_SCF_FAST_SYS_
+#define DECODER_POLAR_SCF_FAST_SYS_
+
+#include <vector>
+#include <memory>
+#include <mipp.h>
+
+#include "Module/CRC/CRC.hpp"
+
+#include "../SC/Decoder_polar_SC_fast_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_polar_SCF_fast_sys
+ *
+ * \brief Fast systematic Successive Cancellation Flip (SCF) decoder built on the pruned tree of the
+ *        Decoder_polar_SC_fast_sys decoder.
+ *
+ * The flip candidates are the decisions of the rate 1, repetition and single parity check nodes (flipping a bit of a
+ * SPC node also flips its least reliable bit to keep the parity). The 'n_flips' least reliable candidates are kept in
+ * a bounded heap during the first decoding. When the CRC is not verified, the state of the decoder (LLRs and partial
+ * sums) is checkpointed at each candidate node and each flip attempt resumes the decoding from its checkpoint instead
+ * of from the root of the tree.
+ */
+template <typename B = int, typename R = float,
+          class API_polar = tools::API_polar_dynamic_seq<B, R, tools::f_LLR <  R>,
+                                                               tools::g_LLR <B,R>,
+                                                               tools::g0_LLR<  R>,
+                                                               tools::h_LLR <B,R>,
+                                                               tools::xo_STD<B  >>>
+class Decoder_polar_SCF_fast_sys : public Decoder_polar_SC_fast_sys<B,R,API_polar>
+{
+protected:
+	struct Flip_candidate
+	{
+		float metric;  // reliability of the decision
+		int   node_id; // id of the terminal node in the pruned tree
+		int   bit;     // position of the bit in the node
+
+		bool operator<(const Flip_candidate &c) const { return metric < c.metric; }
+	};
+
+	CRC<B>& crc;
+
+	const int                         n_flips;
+	      std::vector<B>              U_test;
+	      std::vector<int>            nodes_end;  // id of the node following the sub-tree of each node
+	      std::vector<int>            snap_ids;   // checkpoint index of each node (-1 if none)
+	      std::vector<Flip_candidate> candidates; // bounded heap of the least reliable decisions
+	      mipp::vector<R>             l_snap;     // checkpointed LLRs (the channel LLRs are never overwritten)
+	      mipp::vector<B>             s_snap;     // checkpointed partial sums
+	      std::vector<int>            s_snap_len; // number of checkpointed partial sums
+	      bool                        collect;    // collect the flip candidates
+	      int                         resume_id;  // node where the decoding resumes (-1 if none)
+	      int                         flip_id;    // node where a decision is flipped (-1 if none)
+	      int                         flip_bit;   // position of the flipped decision in the node
+
+public:
+	Decoder_polar_SCF_fast_sys(const int& K, const int& N, const std::vector<bool>& frozen_bits, CRC<B>& crc,
+	                           const int n_flips, const int n_frames = 1);
+
+	Decoder_polar_SCF_fast_sys(const int& K, const int& N, const std::vector<bool>& frozen_bits,
+	                           std::vector<std::unique_ptr<tools::Pattern_polar_i>>&& polar_patterns,
+	                           const int idx_r0, const int idx_r1, CRC<B>& crc, const int n_flips,
+	                           const int n_frames = 1);
+
+	virtual ~Decoder_polar_SCF_fast_sys() = default;
+
+	virtual void notify_frozenbits_update();
+
+protected:
+	virtual void _decode          (                                                                          );
+	virtual bool check_crc        (                                                                          );
+	virtual void recursive_decode (const int off_l, const int off_s, const int reverse_depth, int &node_id   );
+	        void collect_candidates(const tools::polar_node_t node_type, const int off_l, const int n_elmts,
+	                                const int node_id                                                        );
+	        void flip              (const tools::polar_node_t node_type, const int off_l, const int off_s,
+	                                const int n_elmts                                                        );
+	        void checkpoint        (const int snap_id, const int off_s                                       );
+	        void restore           (const int snap_id                                                        );
+	        int  min_abs_pos       (const R *l_a, const int n_elmts                                          ) const;
+
+private:
+	int  recursive_nodes_end(const int reverse_depth, int node_id);
+	void init_nodes_end     (                                    );
+	void check_parameters   (                                    );
+};
+}
+}
+
+#include "Decoder_polar_SCF_fast_sys.hxx"
+
+#endif /* DECODER_POLAR_SCF_FAST_SYS_ */
@@ -0,0 +1,373 @@
+#include <cmath>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Code/Polar/fb_extract.h"
+
+#include "Decoder_polar_SCF_fast_sys.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::Decoder_polar_SCF_fast_sys(const int& K, const int& N, const std::vector<bool>& frozen_bits, CRC<B>& crc,
+                             const int n_flips, const int n_frames)
+: Decoder                                (K, N, n_frames, API_polar::get_n_frames()),
+  Decoder_polar_SC_fast_sys<B,R,API_polar>(K, N, frozen_bits, n_frames),
+  crc       (crc),
+  n_flips   (n_flips),
+  U_test    (K),
+  l_snap    (n_flips * N),
+  s_snap    (n_flips * N),
+  s_snap_len(n_flips, 0),
+  collect   (false),
+  resume_id (-1),
+  flip_id   (-1),
+  flip_bit  (-1)
+{
+	const std::string name = "Decoder_polar_SCF_fast_sys";
+	this->set_name(name);
+
+	this->check_parameters();
+	this->init_nodes_end();
+}
+
+template <typename B, typename R, class API_polar>
+Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::Decoder_polar_SCF_fast_sys(const int& K, const int& N, const std::vector<bool>& frozen_bits,
+                             std::vector<std::unique_ptr<tools::Pattern_polar_i>> &&polar_patterns,
+                             const int idx_r0, const int idx_r1, CRC<B>& crc, const int n_flips, const int n_frames)
+: Decoder                                (K, N, n_frames, API_polar::get_n_frames()),
+  Decoder_polar_SC_fast_sys<B,R,API_polar>(K, N, frozen_bits, std::move(polar_patterns), idx_r0, idx_r1, n_frames),
+  crc       (crc),
+  n_flips   (n_flips),
+  U_test    (K),
+  l_snap    (n_flips * N),
+  s_snap    (n_flips * N),
+  s_snap_len(n_flips, 0),
+  collect   (false),
+  resume_id (-1),
+  flip_id   (-1),
+  flip_bit  (-1)
+{
+	const std::string name = "Decoder_polar_SCF_fast_sys";
+	this->set_name(name);
+
+	this->check_parameters();
+	this->init_nodes_end();
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::check_parameters()
+{
+	static_assert(API_polar::get_n_frames() == 1, "The SCF decoder does not support the inter-frame SIMD strategy.");
+
+	if (crc.get_size() > this->K)
+	{
+		std::stringstream message;
+		message << "'crc.get_size()' has to be equal or smaller than 'K' ('crc.get_size()' = " << crc.get_size()
+		        << ", 'K' = " << this->K << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (n_flips < 0)
+	{
+		std::stringstream message;
+		message << "'n_flips' has to be positive ('n_flips' = " << n_flips << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::notify_frozenbits_update()
+{
+	Decoder_polar_SC_fast_sys<B,R,API_polar>::notify_frozenbits_update();
+	this->init_nodes_end();
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::init_nodes_end()
+{
+	nodes_end.clear();
+	this->recursive_nodes_end(this->m, 0);
+	snap_ids.assign(nodes_end.size(), -1);
+}
+
+template <typename B, typename R, class API_polar>
+int Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::recursive_nodes_end(const int reverse_depth, int node_id)
+{
+	const auto node_type = this->polar_patterns.get_node_type(node_id);
+
+	const bool is_terminal_pattern = (node_type == tools::polar_node_t::RATE_0) ||
+	                                 (node_type == tools::polar_node_t::RATE_1) ||
+	                                 (node_type == tools::polar_node_t::REP)    ||
+	                                 (node_type == tools::polar_node_t::SPC);
+
+	auto next_id = node_id +1;
+	if (!is_terminal_pattern && reverse_depth)
+	{
+		next_id = this->recursive_nodes_end(reverse_depth -1, next_id); // left sub-tree
+		next_id = this->recursive_nodes_end(reverse_depth -1, next_id); // right sub-tree
+	}
+
+	if ((int)nodes_end.size() <= node_id)
+		nodes_end.resize(node_id +1);
+	nodes_end[node_id] = next_id;
+
+	return next_id;
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::_decode()
+{
+	int first_id = 0;
+
+	// first decoding, the flip candidates are collected on the way
+	candidates.clear();
+	collect = n_flips > 0;
+	this->recursive_decode(0, 0, this->m, first_id);
+	collect = false;
+
+	if (candidates.empty() || this->check_crc())
+		return;
+
+	// the least reliable candidates first
+	std::sort_heap(candidates.begin(), candidates.end());
+
+	// second decoding (same as the first one), the state of the decoder is checkpointed at the candidate nodes
+	auto n_snaps = 0;
+	for (auto &c : candidates)
+		if (snap_ids[c.node_id] < 0)
+			snap_ids[c.node_id] = n_snaps++;
+
+	first_id = 0;
+	this->recursive_decode(0, 0, this->m, first_id);
+
+	// flip attempts, each one resumes the decoding from the checkpoint of its node
+	for (auto &c : candidates)
+	{
+		this->restore(snap_ids[c.node_id]);
+
+		resume_id = c.node_id;
+		flip_id   = c.node_id;
+		flip_bit  = c.bit;
+
+		first_id = 0;
+		this->recursive_decode(0, 0, this->m, first_id);
+
+		if (this->check_crc())
+			break;
+	}
+
+	flip_id = -1;
+	for (auto &c : candidates)
+		snap_ids[c.node_id] = -1;
+}
+
+template <typename B, typename R, class API_polar>
+bool Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::check_crc()
+{
+	tools::fb_extract(this->polar_patterns.get_leaves_pattern_types(), this->s.data(), U_test.data());
+	return crc.check(U_test, this->get_simd_inter_frame_level());
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::recursive_decode(const int off_l, const int off_s, const int reverse_depth, int &node_id)
+{
+	const int n_elmts = 1 << reverse_depth;
+	const int n_elm_2 = n_elmts >> 1;
+	const auto node_type = this->polar_patterns.get_node_type(node_id);
+
+	const bool is_terminal_pattern = (node_type == tools::polar_node_t::RATE_0) ||
+	                                 (node_type == tools::polar_node_t::RATE_1) ||
+	                                 (node_type == tools::polar_node_t::REP)    ||
+	                                 (node_type == tools::polar_node_t::SPC);
+
+	if (!is_terminal_pattern && reverse_depth)
+	{
+		// when the decoding resumes in this sub-tree, the LLRs of the child on the path to the checkpoint are restored
+		const auto resume_here  = resume_id > node_id;
+		const auto resume_right = resume_here && resume_id >= nodes_end[node_id +1];
+
+		// f
+		if (!resume_here)
+			switch (node_type)
+			{
+				case tools::polar_node_t::STANDARD: API_polar::f(this->l, off_l, off_l + n_elm_2, off_l + n_elmts, n_elm_2); break;
+				case tools::polar_node_t::REP_LEFT: API_polar::f(this->l, off_l, off_l + n_elm_2, off_l + n_elmts, n_elm_2); break;
+				default:
+					break;
+			}
+
+		if (!resume_right)
+			this->recursive_decode(off_l + n_elmts, off_s, reverse_depth -1, ++node_id); // recursive call left
+		else
+			node_id = nodes_end[node_id +1] -1; // skip the left sub-tree
+
+		// g
+		if (!resume_right)
+			switch (node_type)
+			{
+				case tools::polar_node_t::STANDARD:    API_polar::g (this->s, this->l, off_l, off_l + n_elm_2, off_s, off_l + n_elmts, n_elm_2); break;
+				case tools::polar_node_t::RATE_0_LEFT: API_polar::g0(         this->l, off_l, off_l + n_elm_2,        off_l + n_elmts, n_elm_2); break;
+				case tools::polar_node_t::REP_LEFT:    API_polar::gr(this->s, this->l, off_l, off_l + n_elm_2, off_s, off_l + n_elmts, n_elm_2); break;
+				default:
+					break;
+			}
+
+		this->recursive_decode(off_l + n_elmts, off_s + n_elm_2, reverse_depth -1, ++node_id); // recursive call right
+
+		// xor
+		switch (node_type)
+		{
+			case tools::polar_node_t::STANDARD:    API_polar::xo (this->s, off_s, off_s + n_elm_2, off_s, n_elm_2); break;
+			case tools::polar_node_t::RATE_0_LEFT: API_polar::xo0(this->s,        off_s + n_elm_2, off_s, n_elm_2); break;
+			case tools::polar_node_t::REP_LEFT:    API_polar::xo (this->s, off_s, off_s + n_elm_2, off_s, n_elm_2); break;
+			default:
+				break;
+		}
+	}
+	else
+	{
+		if (node_id == resume_id)
+			resume_id = -1; // the state of the decoder has been restored up to this node
+		else if (flip_id < 0 && snap_ids[node_id] >= 0) // only during the checkpointing decoding
+			this->checkpoint(snap_ids[node_id], off_s);
+
+		// h
+		switch (node_type)
+		{
+			case tools::polar_node_t::RATE_0: API_polar::h0 (this->s,                 off_s, n_elmts); break;
+			case tools::polar_node_t::RATE_1: API_polar::h  (this->s, this->l, off_l, off_s, n_elmts); break;
+			case tools::polar_node_t::REP:    API_polar::rep(this->s, this->l, off_l, off_s, n_elmts); break;
+			case tools::polar_node_t::SPC:    API_polar::spc(this->s, this->l, off_l, off_s, n_elmts); break;
+			default:
+				break;
+		}
+
+		if (collect)
+			this->collect_candidates(node_type, off_l, n_elmts, node_id);
+
+		if (node_id == flip_id)
+			this->flip(node_type, off_l, off_s, n_elmts);
+	}
+}
+
+template <typename B, typename R, class API_polar>
+int Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::min_abs_pos(const R *l_a, const int n_elmts) const
+{
+	// position of the least reliable LLR (the first one in case of equality, as in the SPC nodes of the API)
+	auto min_pos = 0;
+	for (auto i = 1; i < n_elmts; i++)
+		if (std::abs(l_a[i]) < std::abs(l_a[min_pos]))
+			min_pos = i;
+	return min_pos;
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::collect_candidates(const tools::polar_node_t node_type, const int off_l, const int n_elmts, const int node_id)
+{
+	// bounded max-heap: its top is the most reliable of the 'n_flips' least reliable candidates
+	auto push = [this](const float metric, const int node_id, const int bit)
+	{
+		if ((int)candidates.size() < n_flips)
+		{
+			candidates.push_back({metric, node_id, bit});
+			std::push_heap(candidates.begin(), candidates.end());
+		}
+		else if (metric < candidates.front().metric)
+		{
+			std::pop_heap(candidates.begin(), candidates.end());
+			candidates.back() = {metric, node_id, bit};
+			std::push_heap(candidates.begin(), candidates.end());
+		}
+	};
+
+	const R *l_a = this->l.data() + off_l;
+	switch (node_type)
+	{
+		case tools::polar_node_t::RATE_1:
+			for (auto i = 0; i < n_elmts; i++)
+				push((float)std::abs(l_a[i]), node_id, i);
+			break;
+		case tools::polar_node_t::REP:
+		{
+			auto sum_l = 0.f;
+			for (auto i = 0; i < n_elmts; i++)
+				sum_l += (float)l_a[i];
+			push(std::abs(sum_l), node_id, 0);
+			break;
+		}
+		case tools::polar_node_t::SPC:
+		{
+			const auto min_pos = this->min_abs_pos(l_a, n_elmts);
+			for (auto i = 0; i < n_elmts; i++)
+				if (i != min_pos)
+					push((float)std::abs(l_a[i]), node_id, i);
+			break;
+		}
+		default:
+			break;
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::flip(const tools::polar_node_t node_type, const int off_l, const int off_s, const int n_elmts)
+{
+	B *s_a = this->s.data() + off_s;
+	auto flip_s = [](B &s) { s = (s == 0) ? tools::bit_init<B>() : 0; };
+
+	switch (node_type)
+	{
+		case tools::polar_node_t::RATE_1:
+			flip_s(s_a[this->flip_bit]);
+			break;
+		case tools::polar_node_t::REP:
+			for (auto i = 0; i < n_elmts; i++)
+				flip_s(s_a[i]);
+			break;
+		case tools::polar_node_t::SPC: // the least reliable bit is also flipped to keep the parity
+			flip_s(s_a[this->flip_bit]);
+			flip_s(s_a[this->min_abs_pos(this->l.data() + off_l, n_elmts)]);
+			break;
+		default:
+			break;
+	}
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::checkpoint(const int snap_id, const int off_s)
+{
+	// the LLRs of the root (channel) are never modified, only the ones of the lower levels are saved
+	std::copy(this->l.begin() + this->N, this->l.begin() + 2 * this->N, l_snap.begin() + snap_id * this->N);
+	std::copy(this->s.begin(),           this->s.begin() + off_s,       s_snap.begin() + snap_id * this->N);
+	s_snap_len[snap_id] = off_s;
+}
+
+template <typename B, typename R, class API_polar>
+void Decoder_polar_SCF_fast_sys<B,R,API_polar>
+::restore(const int snap_id)
+{
+	std::copy(l_snap.begin() +  snap_id    * this->N,
+	          l_snap.begin() + (snap_id +1) * this->N,
+	          this->l.begin() + this->N);
+	std::copy(s_snap.begin() + snap_id * this->N,
+	          s_snap.begin() + snap_id * this->N + s_snap_len[snap_id],
+	          this->s.begin());
+}
+}
+}
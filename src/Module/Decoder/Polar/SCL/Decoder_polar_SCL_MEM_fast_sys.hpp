@@ -6,7 +6,7 @@
 #include <mipp.h>
 
 #include "Tools/Code/Polar/API/API_polar_dynamic_seq.hpp"
-#include "Tools/Algo/Sort/LC_sorter.hpp"
+#include "Tools/Algo/Sort/Bitonic_sorter.hpp"
 #include "Tools/Code/Polar/decoder_polar_functions.h"
 #include "Tools/Code/Polar/Frozenbits_notifier.hpp"
 #include "Tools/Code/Polar/Pattern_polar_parser.hpp"
@@ -52,10 +52,8 @@ protected:
 	std::vector<std::vector<int>>     n_array_ref_s;   // give array used by a path
 	std::vector<std::vector<int>>     path_2_array_s;   // give array used by a path
 
-	tools::LC_sorter<R>               sorter;
-//	tools::LC_sorter_simd<R>          sorter_simd;
+	tools::Bitonic_sorter<R>          sorter;
 	std::vector<int>                  best_idx;
-	mipp::vector<R>                   l_tmp;
 
 public:
 	Decoder_polar_SCL_MEM_fast_sys(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits,
@@ -65,9 +65,7 @@ Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>
   n_array_ref_s    (L, std::vector<int>(m)),
   path_2_array_s   (L, std::vector<int>(m)),
   sorter           (N),
-//sorter_simd      (N),
-  best_idx         (L),
-  l_tmp            (N)
+  best_idx         (std::max(L, 4))
 {
 	const std::string name = "Decoder_polar_SCL_MEM_fast_sys";
 	this->set_name(name);
@@ -150,9 +148,7 @@ Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>
   n_array_ref_s      (L, std::vector<int>(m)),
   path_2_array_s     (L, std::vector<int>(m)),
   sorter           (N),
-//sorter_simd      (N),
-  best_idx         (L),
-  l_tmp            (N)
+  best_idx         (std::max(L, 4))
 {
 	const std::string name = "Decoder_polar_SCL_MEM_fast_sys";
 	this->set_name(name);
@@ -674,9 +670,7 @@ void Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>
 				const auto path  = paths[i];
 				const auto array = path_2_array_l[path][r_d];
 
-				for (auto i = 0; i < n_elmts; i++) l_tmp[i] = std::abs(l[array][off_l +i]);
-				sorter.partial_sort_destructive(l_tmp.data(), best_idx, n_elmts, 2);
-//				sorter_simd.partial_sort_abs(l[array].data() + off_l, best_idx, n_elmts, 2);
+				sorter.partial_sort_abs(l[array].data() + off_l, best_idx, n_elmts, 2);
 
 				bit_flips[2 * path +0] = best_idx[0];
 				bit_flips[2 * path +1] = best_idx[1];
@@ -758,9 +752,7 @@ void Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>
 				const auto path  = paths[i];
 				const auto array = path_2_array_l[path][REV_D];
 
-				for (auto i = 0; i < N_ELMTS; i++) l_tmp[i] = std::abs(l[array][off_l +i]);
-				sorter.partial_sort_destructive(l_tmp.data(), best_idx, N_ELMTS, 2);
-//				sorter_simd.partial_sort_abs(l[array].data() + off_l, best_idx, N_ELMTS, 2);
+				sorter.partial_sort_abs(l[array].data() + off_l, best_idx, N_ELMTS, 2);
 
 				bit_flips[2 * path +0] = best_idx[0];
 				bit_flips[2 * path +1] = best_idx[1];
@@ -1033,9 +1025,7 @@ void Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>
 			const auto path  = paths[i];
 			const auto array = path_2_array_l[paths[i]][r_d];
 
-			for (auto i = 0; i < n_elmts; i++) l_tmp[i] = std::abs(l[array][off_l +i]);
-			sorter.partial_sort_destructive(l_tmp.data(), best_idx, n_elmts, 4);
-//			sorter_simd.partial_sort_abs(l[array].data() + off_l, best_idx, n_elmts, 4);
+			sorter.partial_sort_abs(l[array].data() + off_l, best_idx, n_elmts, 4);
 
 			for (auto j = 0; j < 4; j++)
 				bit_flips[4 * path +j] = best_idx[j];
@@ -1145,9 +1135,7 @@ void Decoder_polar_SCL_MEM_fast_sys<B,R,API_polar>
 			const auto path  = paths[i];
 			const auto array = path_2_array_l[paths[i]][REV_D];
 
-			for (auto i = 0; i < N_ELMTS; i++) l_tmp[i] = std::abs(l[array][off_l +i]);
-			sorter.partial_sort_destructive(l_tmp.data(), best_idx, N_ELMTS, 4);
-//			sorter_simd.partial_sort_abs(l[array].data() + off_l, best_idx, N_ELMTS, 4);
+			sorter.partial_sort_abs(l[array].data() + off_l, best_idx, N_ELMTS, 4);
 
 			for (auto j = 0; j < 4; j++)
 				bit_flips[4 * path +j] = best_idx[j];
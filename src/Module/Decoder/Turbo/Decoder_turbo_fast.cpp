@@ -94,11 +94,21 @@ template <typename B, typename R>
 void Decoder_turbo_fast<B,R>
 ::_decode_siho(const R *Y_N, B *V_K, const int frame_id)
 {
-//	auto t_load = std::chrono::steady_clock::now(); // ----------------------------------------------------------- LOAD
+	// the sub-timers are only measured with the statistics and the spans only recorded when the tracer is started
+	auto &task = (*this)[dec::tsk::decode_siho];
+	const auto stats = task.is_stats();
+	const auto trace = tools::is_trace_enabled();
+	std::chrono::steady_clock::time_point t_load, t_decod, t_store;
+	uint64_t s_load = 0, s_decod = 0, s_store = 0;
+
+	if (stats) t_load = std::chrono::steady_clock::now(); // ------------------------------------------------------ LOAD
+	if (trace) s_load = tools::trace_now();
 	this->_load(Y_N, frame_id);
-//	auto d_load = std::chrono::steady_clock::now() - t_load;
+	if (stats) task.update_timer((int)dec::tm::decode_siho::load, std::chrono::steady_clock::now() - t_load);
+	if (trace) task.trace_timer ((int)dec::tm::decode_siho::load, s_load);
 
-//	auto t_decod = std::chrono::steady_clock::now(); // -------------------------------------------------------- DECODE
+	if (stats) t_decod = std::chrono::steady_clock::now(); // --------------------------------------------------- DECODE
+	if (trace) s_decod = tools::trace_now();
 	const auto n_frames = this->get_simd_inter_frame_level();
 	const auto tail_n_2 = this->siso_n.tail_length() / 2;
 	const auto tail_i_2 = this->siso_i.tail_length() / 2;
@@ -173,16 +183,23 @@ void Decoder_turbo_fast<B,R>
 
 	for (auto cb : this->callbacks_end)
 		cb(ite -1);
-//	auto d_decod = std::chrono::steady_clock::now() - t_decod;
+	if (stats) task.update_timer((int)dec::tm::decode_siho::decode, std::chrono::steady_clock::now() - t_decod);
+	if (trace) task.trace_timer ((int)dec::tm::decode_siho::decode, s_decod);
 
-//	auto t_store = std::chrono::steady_clock::now(); // --------------------------------------------------------- STORE
+	if (stats) t_store = std::chrono::steady_clock::now(); // ---------------------------------------------------- STORE
+	if (trace) s_store = tools::trace_now();
 	this->_store(V_K);
-//	auto d_store = std::chrono::steady_clock::now() - t_store;
-
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::load,   d_load);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::decode, d_decod);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::store,  d_store);
-//	(*this)[dec::tsk::decode_siho].update_timer(dec::tm::decode_siho::total,  d_load + d_decod + d_store);
+	if (stats)
+	{
+		const auto t_end = std::chrono::steady_clock::now();
+		task.update_timer((int)dec::tm::decode_siho::store, t_end - t_store);
+		task.update_timer((int)dec::tm::decode_siho::total, t_end - t_load );
+	}
+	if (trace)
+	{
+		task.trace_timer((int)dec::tm::decode_siho::store, s_store);
+		task.trace_timer((int)dec::tm::decode_siho::total, s_load );
+	}
 }
 
 template <typename B, typename R>
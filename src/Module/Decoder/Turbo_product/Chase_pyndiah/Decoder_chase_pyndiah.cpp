@@ -41,6 +41,8 @@ Decoder_chase_pyndiah<B,R>
   parity_extended           (this->N == (N_np +1)                                                    ),
   cp_coef                   (cp_coef                                                                 ),
   least_reliable_pos        (n_least_reliable_positions                                              ),
+  sorted_pos                (n_least_reliable_positions                                              ),
+  sorter                    (N_np                                                                    ),
   competitors               (n_test_vectors                                                          ),
   hard_Y_N                  (this->N                                                                 ),
   test_vect                 (n_test_vectors * hard_Y_N.size()                                        ),
@@ -252,26 +254,13 @@ template <typename B, typename R>
 void Decoder_chase_pyndiah<B,R>
 ::find_least_reliable_pos(const R* Y_N)
 {
-	for (auto it = least_reliable_pos.begin(); it != least_reliable_pos.end(); it++)
-	{
-		it->metric = std::numeric_limits<R>::max();
-		it->pos    = this->N;
-	}
+	// the positions are sorted by increasing reliability, the ties are broken in favor of the first position
+	sorter.partial_sort_abs(Y_N, sorted_pos, N_np, n_least_reliable_positions);
 
-	for (int i = 0; i < N_np; i++)
+	for (int i = 0; i < n_least_reliable_positions; i++)
 	{
-		// check if R[i] is a least reliable value compared to the already saved positions
-		for (auto it = least_reliable_pos.begin(); it != least_reliable_pos.end(); it++)
-		{
-			R val = std::abs(Y_N[i]);
-
-			if (val < it->metric)
-			{ // Y_N[i] is weak, then save its position
-				least_reliable_pos.pop_back(); // remove the last position that is not weak enough
-				it = least_reliable_pos.insert(it, {val, i});
-				break;
-			}
-		}
+		least_reliable_pos[i].metric = std::abs(Y_N[sorted_pos[i]]);
+		least_reliable_pos[i].pos    = sorted_pos[i];
 	}
 }
 
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "../../Decoder_SISO_SIHO.hpp"
+#include "Tools/Algo/Sort/Bitonic_sorter.hpp"
 #include "Module/Decoder/BCH/Decoder_BCH.hpp"
 #include "Module/Encoder/Encoder.hpp"
 
@@ -62,6 +63,8 @@ protected:
 	const std::vector<float> cp_coef; // the a, b, c, d and e coefficient described above in the class description
 
 	std::vector<info> least_reliable_pos; // the list of least reliable positions
+	std::vector<int>  sorted_pos;         // the least reliable positions given by the sorter
+	tools::Bitonic_sorter<R> sorter;      // selects the least reliable positions
 	std::vector<info> competitors;        // the competitors' metric and their related test vector position
 	std::vector<B>    hard_Y_N;           // the taken hard decision at the input of the chase
 	std::vector<B>    test_vect;          // the test vectors after being corrected by the decoder 'dec'
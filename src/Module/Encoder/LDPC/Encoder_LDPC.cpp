@@ -22,7 +22,7 @@ Encoder_LDPC<B>
 
 template <typename B>
 Encoder_LDPC<B>
-::Encoder_LDPC(const int K, const int N, const tools::Sparse_matrix &G, const int n_frames)
+::Encoder_LDPC(const int K, const int N, const std::shared_ptr<const tools::Sparse_matrix> &G, const int n_frames)
 : Encoder<B>(K, N, n_frames), G(G)
 {
 	const std::string name = "Encoder_LDPC";
@@ -33,7 +33,8 @@ Encoder_LDPC<B>
 
 template <typename B>
 Encoder_LDPC<B>
-::Encoder_LDPC(const int K, const int N, const tools::Sparse_matrix &G, const tools::Sparse_matrix &H, const int n_frames)
+::Encoder_LDPC(const int K, const int N, const std::shared_ptr<const tools::Sparse_matrix> &G,
+               const std::shared_ptr<const tools::Sparse_matrix> &H, const int n_frames)
 : Encoder<B>(K, N, n_frames), G(G), H(H)
 {
 	const std::string name = "Encoder_LDPC";
@@ -47,7 +48,8 @@ template <typename B>
 void Encoder_LDPC<B>
 ::check_G_dimensions()
 {
-	G.self_turn(tools::Sparse_matrix::Way::VERTICAL);
+	if (!G->is_of_way(tools::Sparse_matrix::Way::VERTICAL))
+		G = std::make_shared<const tools::Sparse_matrix>(G->turn(tools::Sparse_matrix::Way::VERTICAL));
 	this->_check_G_dimensions();
 }
 
@@ -55,7 +57,8 @@ template <typename B>
 void Encoder_LDPC<B>
 ::check_H_dimensions()
 {
-	H.self_turn(tools::Sparse_matrix::Way::VERTICAL);
+	if (!H->is_of_way(tools::Sparse_matrix::Way::VERTICAL))
+		H = std::make_shared<const tools::Sparse_matrix>(H->turn(tools::Sparse_matrix::Way::VERTICAL));
 	this->_check_H_dimensions();
 }
 
@@ -63,19 +66,19 @@ template <typename B>
 void Encoder_LDPC<B>
 ::_check_G_dimensions()
 {
-	if (this->K != (int)this->G.get_n_cols())
+	if (this->K != (int)this->G->get_n_cols())
 	{
 		std::stringstream message;
 		message << "The built G matrix has a dimension 'K' different than the given one ('K' = " << this->K
-		        << ", 'G.get_n_cols()' = " << this->G.get_n_cols() << ").";
+		        << ", 'G.get_n_cols()' = " << this->G->get_n_cols() << ").";
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
 
-	if (this->N != (int)this->G.get_n_rows())
+	if (this->N != (int)this->G->get_n_rows())
 	{
 		std::stringstream message;
 		message << "The built G matrix has a dimension 'N' different than the given one ('N' = " << this->N
-		        << ", 'G.get_n_rows()' = " << this->G.get_n_rows() << ").";
+		        << ", 'G.get_n_rows()' = " << this->G->get_n_rows() << ").";
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
 }
@@ -84,11 +87,11 @@ template <typename B>
 void Encoder_LDPC<B>
 ::_check_H_dimensions()
 {
-	if (this->N != (int)this->H.get_n_rows())
+	if (this->N != (int)this->H->get_n_rows())
 	{
 		std::stringstream message;
 		message << "The built H matrix has a dimension 'N' different than the given one ('N' = " << this->N
-		        << ", 'H.get_n_rows()' = " << this->H.get_n_rows() << ").";
+		        << ", 'H.get_n_rows()' = " << this->H->get_n_rows() << ").";
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
 }
@@ -100,7 +103,7 @@ void Encoder_LDPC<B>
 	for (auto i = 0; i < this->N; i++)
 	{
 		X_N[i] = 0;
-		auto& links = this->G.get_cols_from_row(i);
+		auto& links = this->G->get_cols_from_row(i);
 		for (unsigned j = 0; j < links.size(); j++)
 			X_N[i] += U_K[ links[j] ];
 		X_N[i] &= (B)1; // modulo 2
@@ -111,10 +114,10 @@ template <typename B>
 bool Encoder_LDPC<B>
 ::is_codeword(const B *X_N)
 {
-	if (this->H.get_n_connections() == 0)
+	if (this->H == nullptr || this->H->get_n_connections() == 0)
 		throw tools::unimplemented_error(__FILE__, __LINE__, __func__);
 
-	return tools::LDPC_syndrome::check_hard(X_N, this->H);
+	return tools::LDPC_syndrome::check_hard(X_N, *this->H);
 }
 
 // ==================================================================================== explicit template instantiation
@@ -1,6 +1,7 @@
 #ifndef ENCODER_LDPC_HPP_
 #define ENCODER_LDPC_HPP_
 
+#include <memory>
 #include <vector>
 
 #include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
@@ -16,21 +17,23 @@ template <typename B = int>
 class Encoder_LDPC : public Encoder<B>
 {
 protected:
-	tools::Sparse_matrix G; // In vertical way
-	                        // the generator matrix (automatically transposed if needed in constructor)
-	                        // G cols are the K dimension
-	                        // G rows are the N dimension
-	tools::Sparse_matrix H; // In vertical way
-	                        // the decodeur matrix (automatically transposed if needed in constructor)
-	                        // H cols are the M dimension (often M = N - K)
-	                        // H rows are the N dimension
+	// the matrices are shared with the other modules built on the same code, they are in vertical way (only copied in
+	// the constructor if they have to be transposed)
+	std::shared_ptr<const tools::Sparse_matrix> G; // the generator matrix
+	                                               // G cols are the K dimension
+	                                               // G rows are the N dimension
+	std::shared_ptr<const tools::Sparse_matrix> H; // the decodeur matrix
+	                                               // H cols are the M dimension (often M = N - K)
+	                                               // H rows are the N dimension
 
 protected:
 	Encoder_LDPC(const int K, const int N, const int n_frames = 1);
 
 public:
-	Encoder_LDPC(const int K, const int N, const tools::Sparse_matrix &G, const int n_frames = 1);
-	Encoder_LDPC(const int K, const int N, const tools::Sparse_matrix &G, const tools::Sparse_matrix &H, const int n_frames = 1);
+	Encoder_LDPC(const int K, const int N, const std::shared_ptr<const tools::Sparse_matrix> &G,
+	             const int n_frames = 1);
+	Encoder_LDPC(const int K, const int N, const std::shared_ptr<const tools::Sparse_matrix> &G,
+	             const std::shared_ptr<const tools::Sparse_matrix> &H, const int n_frames = 1);
 	virtual ~Encoder_LDPC() = default;
 
 	virtual bool is_codeword(const B *X_N);
@@ -4,6 +4,8 @@
 #include <functional>
 #include <sstream>
 #include <fstream>
+#include <thread>
+#include <algorithm>
 
 #include "Tools/Exception/exception.hpp"
 #include "Tools/Code/LDPC/AList/AList.hpp"
@@ -15,19 +17,54 @@ using namespace aff3ct::module;
 
 template <typename B>
 Encoder_LDPC_from_H<B>
-::Encoder_LDPC_from_H(const int K, const int N, const tools::Sparse_matrix &_H, const std::string& G_method,
-                      const std::string& G_save_path, const int n_frames)
+::Encoder_LDPC_from_H(const int K, const int N, const std::shared_ptr<const tools::Sparse_matrix> &_H,
+                      const std::string& G_method, const std::string& G_save_path, const int n_frames)
 : Encoder_LDPC<B>(K, N, n_frames)
 {
 	const std::string name = "Encoder_LDPC_from_H";
 	this->set_name(name);
 
-	this->H = _H.turn(tools::Matrix::Way::HORIZONTAL);
+	this->H = _H;
+	this->G = std::make_shared<const tools::Sparse_matrix>(
+		Encoder_LDPC_from_H<B>::build_G(*_H, G_method, G_save_path, this->info_bits_pos));
 
+	this->check_G_dimensions();
+	this->check_H_dimensions();
+}
+
+template <typename B>
+Encoder_LDPC_from_H<B>
+::Encoder_LDPC_from_H(const int K, const int N, const std::shared_ptr<const tools::Sparse_matrix> &_H,
+                      const std::shared_ptr<const tools::Sparse_matrix> &_G, const std::vector<uint32_t> &info_bits_pos,
+                      const int n_frames)
+: Encoder_LDPC<B>(K, N, n_frames)
+{
+	const std::string name = "Encoder_LDPC_from_H";
+	this->set_name(name);
+
+	this->H = _H;
+	this->G = _G;
+	this->info_bits_pos = info_bits_pos;
+
+	this->check_G_dimensions();
+	this->check_H_dimensions();
+}
+
+template <typename B>
+tools::Sparse_matrix Encoder_LDPC_from_H<B>
+::build_G(const tools::Sparse_matrix &_H, const std::string& G_method, const std::string& G_save_path,
+          std::vector<uint32_t> &info_bits_pos)
+{
+	const auto H = _H.turn(tools::Matrix::Way::HORIZONTAL);
+
+	// G is built once for all the threads (see Codec_LDPC): all the cores are used for the elimination
+	const auto n_threads = std::max(1, (int)std::thread::hardware_concurrency());
+
+	tools::Sparse_matrix G;
 	if (G_method == "IDENTITY")
-		this->G = tools::LDPC_matrix_handler::transform_H_to_G_identity(this->H, this->info_bits_pos);
+		G = tools::LDPC_matrix_handler::transform_H_to_G_identity(H, info_bits_pos, n_threads);
 	else if (G_method == "LU_DEC")
-		this->G = tools::LDPC_matrix_handler::transform_H_to_G_decomp_LU(this->H, this->info_bits_pos);
+		G = tools::LDPC_matrix_handler::transform_H_to_G_decomp_LU(H, info_bits_pos, n_threads);
 	else
 	{
 		std::stringstream message;
@@ -36,21 +73,25 @@ Encoder_LDPC_from_H<B>
 	}
 
 	if (G_save_path != "")
+		Encoder_LDPC_from_H<B>::save_G(G, info_bits_pos, G_save_path);
+
+	return G;
+}
+
+template <typename B>
+void Encoder_LDPC_from_H<B>
+::save_G(const tools::Sparse_matrix &G, const std::vector<uint32_t> &info_bits_pos, const std::string& G_save_path)
+{
+	std::ofstream file(G_save_path);
+	if (!file.is_open())
 	{
-		std::ofstream file(G_save_path);
-		if (!file.is_open())
-		{
-			std::stringstream message;
-			message << "'G_save_path' could not be opened ('G_save_path' = \"" << G_save_path << "\").";
-			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
-		}
-
-		tools::AList::write(this->G, file);
-		tools::AList::write_info_bits_pos(this->info_bits_pos, file);
+		std::stringstream message;
+		message << "'G_save_path' could not be opened ('G_save_path' = \"" << G_save_path << "\").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
 	}
 
-	this->check_G_dimensions();
-	this->check_H_dimensions();
+	tools::AList::write(G, file);
+	tools::AList::write_info_bits_pos(info_bits_pos, file);
 }
 
 // ==================================================================================== explicit template instantiation
@@ -16,9 +16,31 @@ template <typename B = int>
 class Encoder_LDPC_from_H : public Encoder_LDPC<B>
 {
 public:
-	Encoder_LDPC_from_H(const int K, const int N, const tools::Sparse_matrix &H, const std::string& G_method = "FAST",
-	                    const std::string& G_save_path = "", const int n_frames = 1);
+	Encoder_LDPC_from_H(const int K, const int N, const std::shared_ptr<const tools::Sparse_matrix> &H,
+	                    const std::string& G_method = "FAST", const std::string& G_save_path = "",
+	                    const int n_frames = 1);
+	Encoder_LDPC_from_H(const int K, const int N, const std::shared_ptr<const tools::Sparse_matrix> &H,
+	                    const std::shared_ptr<const tools::Sparse_matrix> &G,
+	                    const std::vector<uint32_t> &info_bits_pos, const int n_frames = 1);
 	virtual ~Encoder_LDPC_from_H() = default;
+
+	/*!
+	 * \brief Computes the generator matrix G from the parity matrix H (and the positions of the information bits), so
+	 *        it can be computed once and shared between several encoders.
+	 *
+	 * \param H:             the parity matrix.
+	 * \param G_method:      the method used to generate G ("IDENTITY" or "LU_DEC").
+	 * \param G_save_path:   if not empty, G and the positions of the information bits are saved in this file.
+	 * \param info_bits_pos: the computed positions of the information bits.
+	 */
+	static tools::Sparse_matrix build_G(const tools::Sparse_matrix &H, const std::string& G_method,
+	                                    const std::string& G_save_path, std::vector<uint32_t> &info_bits_pos);
+
+	/*!
+	 * \brief Saves G and the positions of the information bits in the AList format (as done by 'build_G').
+	 */
+	static void save_G(const tools::Sparse_matrix &G, const std::vector<uint32_t> &info_bits_pos,
+	                   const std::string& G_save_path);
 };
 
 }
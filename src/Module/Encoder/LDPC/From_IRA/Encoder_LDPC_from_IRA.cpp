@@ -14,7 +14,8 @@ using namespace aff3ct::module;
 
 template <typename B>
 Encoder_LDPC_from_IRA<B>
-::Encoder_LDPC_from_IRA(const int K, const int N, const tools::Sparse_matrix &_H, const int n_frames)
+::Encoder_LDPC_from_IRA(const int K, const int N, const std::shared_ptr<const tools::Sparse_matrix> &_H,
+                        const int n_frames)
 : Encoder_LDPC<B>(K, N, n_frames)
 {
 	const std::string name = "Encoder_LDPC_from_IRA";
@@ -40,7 +41,7 @@ void Encoder_LDPC_from_IRA<B>
 
 
 	//Calculate parity part
-	for (auto& l : this->H.get_rows_from_col(0))
+	for (auto& l : this->H->get_rows_from_col(0))
 		if (l < (unsigned)this->K)
 			parity[0] ^= U_K[l];
 
@@ -48,7 +49,7 @@ void Encoder_LDPC_from_IRA<B>
 	{
 		parity[i] = parity[i -1];
 
-		for (auto& l : this->H.get_rows_from_col(i))
+		for (auto& l : this->H->get_rows_from_col(i))
 			if (l < (unsigned)this->K)
 				parity[i] ^= U_K[l];
 	}
@@ -60,11 +61,11 @@ void Encoder_LDPC_from_IRA<B>
 {
 	Encoder_LDPC<B>::_check_H_dimensions();
 
-	if ((this->N-this->K) != (int)this->H.get_n_cols())
+	if ((this->N-this->K) != (int)this->H->get_n_cols())
 	{
 		std::stringstream message;
 		message << "The built H matrix has a dimension '(N-K)' different than the given one ('(N-K)' = " << (this->N-this->K)
-		        << ", 'H.get_n_cols()' = " << this->H.get_n_cols() << ").";
+		        << ", 'H.get_n_cols()' = " << this->H->get_n_cols() << ").";
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
 }
@@ -16,7 +16,8 @@ template <typename B = int>
 class Encoder_LDPC_from_IRA : public Encoder_LDPC<B>
 {
 public:
-	Encoder_LDPC_from_IRA(const int K, const int N, const tools::Sparse_matrix &H, const int n_frames = 1);
+	Encoder_LDPC_from_IRA(const int K, const int N, const std::shared_ptr<const tools::Sparse_matrix> &H,
+	                      const int n_frames = 1);
 	virtual ~Encoder_LDPC_from_IRA() = default;
 
 protected:
@@ -14,9 +14,10 @@ using namespace aff3ct::module;
 
 template <typename B>
 Encoder_LDPC_from_QC<B>
-::Encoder_LDPC_from_QC(const int K, const int N, const tools::Sparse_matrix &_H, const int n_frames)
+::Encoder_LDPC_from_QC(const int K, const int N, const std::shared_ptr<const tools::Sparse_matrix> &_H,
+                       const int n_frames)
 : Encoder_LDPC<B>(K, N, n_frames),
-  invH2(tools::LDPC_matrix_handler::LU_decomposition(_H))
+  invH2(tools::LDPC_matrix_handler::LU_decomposition(*_H))
 {
 	const std::string name = "Encoder_LDPC_from_QC";
 	this->set_name(name);
@@ -39,7 +40,7 @@ void Encoder_LDPC_from_QC<B>
 	mipp::vector<int8_t> parity(M, 0);
 
 	for (auto i = 0; i < M; i++)
-		for (auto& l : this->H.get_rows_from_col(i))
+		for (auto& l : this->H->get_rows_from_col(i))
 			if (l < (unsigned)this->K)
 				parity[i] ^= U_K[l];
 
@@ -58,11 +59,11 @@ void Encoder_LDPC_from_QC<B>
 {
 	Encoder_LDPC<B>::_check_H_dimensions();
 
-	if ((this->N-this->K) != (int)this->H.get_n_cols())
+	if ((this->N-this->K) != (int)this->H->get_n_cols())
 	{
 		std::stringstream message;
 		message << "The built H matrix has a dimension '(N-K)' different than the given one ('(N-K)' = " << (this->N-this->K)
-		        << ", 'H.get_n_cols()' = " << this->H.get_n_cols() << ").";
+		        << ", 'H.get_n_cols()' = " << this->H->get_n_cols() << ").";
 		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
 	}
 }
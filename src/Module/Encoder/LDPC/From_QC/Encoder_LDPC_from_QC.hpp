@@ -19,7 +19,8 @@ protected:
 	tools::LDPC_matrix_handler::LDPC_matrix invH2;
 
 public:
-	Encoder_LDPC_from_QC(const int K, const int N, const tools::Sparse_matrix &H, const int n_frames = 1);
+	Encoder_LDPC_from_QC(const int K, const int N, const std::shared_ptr<const tools::Sparse_matrix> &H,
+	                     const int n_frames = 1);
 	virtual ~Encoder_LDPC_from_QC() = default;
 
 protected:
@@ -1,5 +1,7 @@
+#include <cmath>
 #include <string>
 #include <vector>
+#include <algorithm>
 #include <stdexcept>
 
 #include "Monitor_BFER.hpp"
@@ -16,7 +18,9 @@ Monitor_BFER<B>
 ::Monitor_BFER(const int K, const unsigned max_fe, const unsigned max_n_frames,
                const bool count_unknown_values, const int n_frames)
 : Monitor(n_frames), K(K), max_fe(max_fe), max_n_frames(max_n_frames),
-  count_unknown_values(count_unknown_values), err_hist(0), err_hist_activated(false)
+  count_unknown_values(count_unknown_values), err_hist(0), err_hist_activated(false), weighted(false),
+  weights(n_frames, 1.0), ci_width(0.f), ci_level(0.95f), ci_method(tools::CI_method::WILSON), ci_min_fe(10),
+  ci_reached(false)
 {
 	const std::string name = "Monitor_BFER";
 	this->set_name(name);
@@ -46,6 +50,8 @@ Monitor_BFER<B>
 : Monitor_BFER<B>(mon.get_K(), mon.get_max_fe(), mon.get_max_n_frames(), mon.get_count_unknown_values(),
                   n_frames == -1 ? mon.get_n_frames() : n_frames)
 {
+	this->activate_weighting(mon.is_weighted());
+	this->set_ci_criterion(mon.get_ci_width(), mon.get_ci_level(), mon.get_ci_method(), mon.get_ci_min_fe());
 }
 
 template <typename B>
@@ -140,8 +146,14 @@ int Monitor_BFER<B>
 
 	if (bit_errors_count)
 	{
-		vals.n_be += bit_errors_count;
-		vals.n_fe ++;
+		const auto w = weights[frame_id];
+
+		vals.n_be  += bit_errors_count;
+		vals.n_fe  ++;
+		vals.w_be  += w * bit_errors_count;
+		vals.w2_be += w * bit_errors_count * w * bit_errors_count;
+		vals.w_fe  += w;
+		vals.w2_fe += w * w;
 
 		if (err_hist_activated)
 			err_hist.add_value(bit_errors_count);
@@ -169,10 +181,20 @@ bool Monitor_BFER<B>
 	return get_max_n_frames() != 0 && get_n_analyzed_fra() >= get_max_n_frames();
 }
 
+template <typename B>
+bool Monitor_BFER<B>
+::ci_limit_achieved() const
+{
+	return ci_reached;
+}
+
 template <typename B>
 bool Monitor_BFER<B>
 ::is_done() const
 {
+	if (get_ci_width() != 0.f)
+		return ci_limit_achieved() || frame_limit_achieved();
+
 	return fe_limit_achieved() || frame_limit_achieved();
 }
 
@@ -227,12 +249,28 @@ unsigned long long Monitor_BFER<B>
 	return vals.n_be;
 }
 
+template <typename B>
+double Monitor_BFER<B>
+::get_w_fe() const
+{
+	return vals.w_fe;
+}
+
+template <typename B>
+double Monitor_BFER<B>
+::get_w_be() const
+{
+	return vals.w_be;
+}
+
 template <typename B>
 float Monitor_BFER<B>
 ::get_fer() const
 {
 	auto t_fer = 0.f;
-	if (this->get_n_fe() != 0)
+	if (this->is_weighted() && this->get_n_fe() != 0)
+		t_fer = (float)(this->get_w_fe() / (double)this->get_n_analyzed_fra());
+	else if (this->get_n_fe() != 0)
 		t_fer = (float)this->get_n_fe() / (float)this->get_n_analyzed_fra();
 	else
 		t_fer = (1.f) / ((float)this->get_n_analyzed_fra());
@@ -245,7 +283,9 @@ float Monitor_BFER<B>
 ::get_ber() const
 {
 	auto t_ber = 0.f;
-	if (this->get_n_be() != 0)
+	if (this->is_weighted() && this->get_n_be() != 0)
+		t_ber = (float)(this->get_w_be() / (double)this->get_n_analyzed_fra() / (double)this->get_K());
+	else if (this->get_n_be() != 0)
 		t_ber = (float)this->get_n_be() / (float)this->get_n_analyzed_fra() / (float)this->get_K();
 	else
 		t_ber = (1.f) / ((float)this->get_n_analyzed_fra()) / this->get_K();
@@ -253,6 +293,68 @@ float Monitor_BFER<B>
 	return t_ber;
 }
 
+template <typename B>
+float Monitor_BFER<B>
+::get_ci_width() const
+{
+	return ci_width;
+}
+
+template <typename B>
+float Monitor_BFER<B>
+::get_ci_level() const
+{
+	return ci_level;
+}
+
+template <typename B>
+tools::CI_method Monitor_BFER<B>
+::get_ci_method() const
+{
+	return ci_method;
+}
+
+template <typename B>
+std::pair<double,double> Monitor_BFER<B>
+::get_fer_interval() const
+{
+	return this->get_interval((double)vals.n_fe, vals.w_fe, vals.w2_fe, 1.);
+}
+
+template <typename B>
+unsigned Monitor_BFER<B>
+::get_ci_min_fe() const
+{
+	return ci_min_fe;
+}
+
+template <typename B>
+std::pair<double,double> Monitor_BFER<B>
+::get_ber_interval() const
+{
+	return this->get_interval((double)vals.n_be, vals.w_be, vals.w2_be, (double)this->get_K());
+}
+
+template <typename B>
+std::pair<double,double> Monitor_BFER<B>
+::get_interval(const double n_err, const double w_err, const double w2_err, const double n_elmts) const
+{
+	const auto n_fra = (double)this->get_n_analyzed_fra();
+	if (n_fra == 0.)
+		return std::make_pair(0., 1.);
+
+	if (!this->is_weighted())
+		return tools::binomial_interval(n_err, n_fra * n_elmts, (double)this->get_ci_level(), this->get_ci_method());
+
+	// the samples are the weighted rates of errors of the frames: 'w * n_err / n_elmts'
+	const auto z    = tools::normal_quantile(1. - (1. - (double)this->get_ci_level()) * 0.5);
+	const auto mean = w_err / (n_fra * n_elmts);
+	const auto var  = std::max(0., w2_err / (n_fra * n_elmts * n_elmts) - mean * mean) / n_fra;
+	const auto half = z * std::sqrt(var);
+
+	return std::make_pair(std::max(0., mean - half), mean + half);
+}
+
 template<typename B>
 bool Monitor_BFER<B>
 ::get_count_unknown_values() const
@@ -275,6 +377,86 @@ void Monitor_BFER<B>
 
 
 
+template<typename B>
+void Monitor_BFER<B>
+::set_ci_criterion(const float width, const float level, const tools::CI_method method, const unsigned min_fe)
+{
+	if (width < 0.f)
+	{
+		std::stringstream message;
+		message << "'width' has to be positive ('width' = " << width << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (level <= 0.f || level >= 1.f)
+	{
+		std::stringstream message;
+		message << "'level' has to be in ]0;1[ ('level' = " << level << ").";
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->ci_width  = width;
+	this->ci_level  = level;
+	this->ci_method = method;
+	this->ci_min_fe = min_fe;
+
+	this->update_ci_limit();
+}
+
+template<typename B>
+void Monitor_BFER<B>
+::update_ci_limit()
+{
+	// too few wrong frames: the intervals (and the rates) are not reliable yet
+	if (this->get_ci_width() == 0.f || this->get_n_fe() == 0 || this->get_n_fe() < this->get_ci_min_fe())
+	{
+		this->ci_reached = false;
+		return;
+	}
+
+	const auto fer = this->get_interval((double)vals.n_fe, vals.w_fe, vals.w2_fe, 1.);
+	const auto ber = this->get_interval((double)vals.n_be, vals.w_be, vals.w2_be, (double)this->get_K());
+
+	const auto n_fra   = (double)this->get_n_analyzed_fra();
+	const auto fer_est = this->is_weighted() ? vals.w_fe / n_fra : (double)vals.n_fe / n_fra;
+	const auto ber_est = (this->is_weighted() ? vals.w_be : (double)vals.n_be) / (n_fra * (double)this->get_K());
+
+	const auto fer_width = (fer.second - fer.first) * 0.5 / fer_est;
+	const auto ber_width = (ber.second - ber.first) * 0.5 / ber_est;
+
+	this->ci_reached = fer_width <= (double)this->get_ci_width() && ber_width <= (double)this->get_ci_width();
+}
+
+template<typename B>
+void Monitor_BFER<B>
+::activate_weighting(bool val)
+{
+	weighted = val;
+
+	if (!weighted)
+		std::fill(this->weights.begin(), this->weights.end(), 1.0);
+}
+
+template<typename B>
+bool Monitor_BFER<B>
+::is_weighted() const
+{
+	return weighted;
+}
+
+template<typename B>
+void Monitor_BFER<B>
+::set_weights(const double *weights)
+{
+	if (!this->is_weighted())
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "The weighting has to be activated before setting "
+		                                                        "the weights.");
+
+	std::copy(weights, weights + this->get_n_frames(), this->weights.begin());
+}
+
+
+
 template <typename B>
 void Monitor_BFER<B>
 ::add_handler_fe(std::function<void(unsigned, int)> callback)
@@ -304,6 +486,7 @@ void Monitor_BFER<B>
 {
 	Monitor::reset();
 	vals.reset();
+	ci_reached = false;
 
 	this->err_hist.reset();
 }
@@ -379,6 +562,9 @@ void Monitor_BFER<B>
 ::copy(const Attributes& v)
 {
 	vals = v;
+
+	// the reductions end with a copy: evaluate here the (costly) confidence intervals stop criterion
+	this->update_ci_limit();
 }
 
 template <typename B>
@@ -397,6 +583,10 @@ typename Monitor_BFER<B>::Attributes& Monitor_BFER<B>::Attributes
 	n_be  += a.n_be;
 	n_fe  += a.n_fe;
 	n_fra += a.n_fra;
+	w_be  += a.w_be;
+	w2_be += a.w2_be;
+	w_fe  += a.w_fe;
+	w2_fe += a.w2_fe;
 
 	return *this;
 }
@@ -408,6 +598,10 @@ void Monitor_BFER<B>::Attributes
 	n_be  = 0;
 	n_fe  = 0;
 	n_fra = 0;
+	w_be  = 0.;
+	w2_be = 0.;
+	w_fe  = 0.;
+	w2_fe = 0.;
 }
 
 template <typename B>
@@ -3,6 +3,7 @@
 
 #include "../Monitor.hpp"
 #include "Tools/Algo/Histogram.hpp"
+#include "Tools/Math/confidence_interval.h"
 
 namespace aff3ct
 {
@@ -22,6 +23,10 @@ protected:
 		unsigned long long n_fra;           // the number of checked frames
 		unsigned long long n_be;            // the number of wrong bits
 		unsigned long long n_fe;            // the number of wrong frames
+		double             w_be;            // the sum of the weights of the wrong bits (importance sampling)
+		double             w2_be;           // the sum of the squared weighted bit errors of the frames (importance sampling)
+		double             w_fe;            // the sum of the weights of the wrong frames (importance sampling)
+		double             w2_fe;           // the sum of the squared weights of the wrong frames (importance sampling)
 
 		Attributes();
 		void reset();
@@ -37,6 +42,14 @@ private:
 	Attributes vals;
 	tools::Histogram<int> err_hist; // the error histogram record
 	bool err_hist_activated;
+	bool weighted;                  // the errors are weighted by the likelihood ratios of the frames
+	std::vector<double> weights;    // the likelihood ratio of each frame (importance sampling)
+
+	float             ci_width;         // target relative half width of the confidence intervals (0 = disabled)
+	float             ci_level;         // confidence level of the intervals
+	tools::CI_method  ci_method;        // method to compute the intervals (without weighting)
+	unsigned          ci_min_fe;        // min number of wrong frames before the intervals are trusted
+	bool              ci_reached;       // the target width is reached for the BER and the FER (updated on 'copy')
 
 	std::vector<std::function<void(unsigned, int )>> callbacks_fe;
 	std::vector<std::function<void(          void)>> callbacks_check;
@@ -96,6 +109,7 @@ public:
 
 	bool    fe_limit_achieved() const;
 	bool frame_limit_achieved() const;
+	bool    ci_limit_achieved() const;
 	virtual bool is_done() const;
 
 	const Attributes&     get_attributes          () const;
@@ -106,12 +120,72 @@ public:
 	unsigned long long    get_n_analyzed_fra      () const;
 	unsigned long long    get_n_fe                () const;
 	unsigned long long    get_n_be                () const;
+	double                get_w_fe                () const;
+	double                get_w_be                () const;
 	float                 get_fer                 () const;
 	float                 get_ber                 () const;
 
+	float                 get_ci_width            () const;
+	float                 get_ci_level            () const;
+	tools::CI_method      get_ci_method           () const;
+	unsigned              get_ci_min_fe           () const;
+
+	/*!
+	 * \brief Gets the confidence intervals (lower and upper bounds) on the FER and the BER.
+	 *
+	 * Without weighting the intervals are binomial ones (Wilson or Clopper-Pearson, on the frames for the FER and on
+	 * the bits for the BER). With weighting (importance sampling) they are based on the normal approximation of the
+	 * weighted means.
+	 */
+	std::pair<double,double> get_fer_interval     () const;
+	std::pair<double,double> get_ber_interval     () const;
+
 	tools::Histogram<int> get_err_hist            () const;
 	void activate_err_histogram(bool val);
 
+	/*!
+	 * \brief Replaces the frame errors stop criterion by a precision one: 'is_done()' returns true when the relative
+	 *        half widths of the confidence intervals on the BER and on the FER are both smaller than 'width' (or when
+	 *        the frame limit is achieved). The criterion is evaluated when the attributes are copied, i.e. during the
+	 *        reductions of the monitors. The intervals are not trusted before 'min_fe' wrong frames: with very few
+	 *        errors (and a lucky draw) they can be narrow while the rates are far from the true ones.
+	 *
+	 * \param width:  target relative half width (0.1 for +/- 10%), 0 disables the criterion.
+	 * \param level:  confidence level (0.95 for 95%).
+	 * \param method: method to compute the intervals.
+	 * \param min_fe: min number of wrong frames before the criterion can stop the simulation.
+	 */
+	void set_ci_criterion(const float width, const float level = 0.95f,
+	                      const tools::CI_method method = tools::CI_method::WILSON, const unsigned min_fe = 10);
+
+	/*!
+	 * \brief Enables the importance sampling mode: each checked frame is weighted by its likelihood ratio (see
+	 *        'set_weights()') and the FER and the BER are the weighted means of the errors.
+	 */
+	void activate_weighting(bool val);
+	bool is_weighted       (        ) const;
+
+	/*!
+	 * \brief Sets the likelihood ratios of the next checked frames.
+	 *
+	 * \param weights: one weight per frame ('n_frames' values).
+	 */
+	template <class A = std::allocator<double>>
+	void set_weights(const std::vector<double,A>& weights)
+	{
+		if ((int)weights.size() != this->n_frames)
+		{
+			std::stringstream message;
+			message << "'weights.size()' has to be equal to 'n_frames' ('weights.size()' = " << weights.size()
+			        << ", 'n_frames' = " << this->n_frames << ").";
+			throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		this->set_weights(weights.data());
+	}
+
+	void set_weights(const double *weights);
+
 	virtual void add_handler_fe               (std::function<void(unsigned, int )> callback);
 	virtual void add_handler_check            (std::function<void(          void)> callback);
 	virtual void add_handler_fe_limit_achieved(std::function<void(          void)> callback);
@@ -137,6 +211,11 @@ public:
 protected:
 	virtual int _check_errors(const B *U, const B *Y, const int frame_id);
 
+private:
+	std::pair<double,double> get_interval(const double n_err, const double w_err, const double w2_err,
+	                                      const double n_elmts) const;
+	void update_ci_limit();
+
 };
 }
 }
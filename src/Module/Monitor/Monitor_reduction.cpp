@@ -6,6 +6,7 @@
 #endif
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Perf/Trace/Tracer.hpp"
 
 #include "Monitor_reduction.hpp"
 
@@ -17,6 +18,13 @@ std::vector<aff3ct::module::Monitor_reduction*>                              aff
 std::thread::id                                                              aff3ct::module::Monitor_reduction::master_thread_id = std::this_thread::get_id();
 std::chrono::nanoseconds                                                     aff3ct::module::Monitor_reduction::d_reduce_frequency = std::chrono::milliseconds(1000);
 std::chrono::time_point<std::chrono::steady_clock, std::chrono::nanoseconds> aff3ct::module::Monitor_reduction::t_last_reduction;
+#ifdef AFF3CT_MPI
+bool                                                                         aff3ct::module::Monitor_reduction::async = false;
+bool                                                                         aff3ct::module::Monitor_reduction::pending = false;
+std::vector<MPI_Request>                                                     aff3ct::module::Monitor_reduction::requests;
+int                                                                          aff3ct::module::Monitor_reduction::stop_send = 0;
+int                                                                          aff3ct::module::Monitor_reduction::n_stop_recv = 0;
+#endif
 
 Monitor_reduction
 ::Monitor_reduction()
@@ -33,6 +41,15 @@ void Monitor_reduction
 void Monitor_reduction
 ::reset_all()
 {
+#ifdef AFF3CT_MPI
+	// a reduction in flight can't be canceled, its result is dropped
+	if (Monitor_reduction::pending)
+	{
+		MPI_Waitall((int)Monitor_reduction::requests.size(), Monitor_reduction::requests.data(), MPI_STATUSES_IGNORE);
+		Monitor_reduction::pending = false;
+	}
+#endif
+
 	Monitor_reduction::t_last_reduction = std::chrono::steady_clock::now();
 	Monitor_reduction::stop_loop        = false;
 
@@ -120,6 +137,11 @@ bool Monitor_reduction
 bool Monitor_reduction
 ::__reduce__(bool fully, bool force)
 {
+#ifdef AFF3CT_MPI
+	if (Monitor_reduction::async)
+		return Monitor_reduction::__ireduce__(fully, force);
+#endif
+
 	bool all_process_on_last = false;
 
 	// only the master thread can do this
@@ -127,10 +149,14 @@ bool Monitor_reduction
 	              (std::chrono::steady_clock::now() - Monitor_reduction::t_last_reduction) >=
 	               Monitor_reduction::d_reduce_frequency))
 	{
+		static const auto trace_id = tools::Tracer::register_name("Monitor_reduction::reduce");
+		const auto t_trace = tools::Tracer::now();
+
 		for (auto& m : Monitor_reduction::monitors)
 			m->_reduce(fully);
 
 		all_process_on_last = reduce_stop_loop();
+		tools::Tracer::span(trace_id, t_trace);
 
 		Monitor_reduction::t_last_reduction = std::chrono::steady_clock::now();
 	}
@@ -138,12 +164,120 @@ bool Monitor_reduction
 	return all_process_on_last;
 }
 
+#ifdef AFF3CT_MPI
+bool Monitor_reduction
+::__ireduce__(bool fully, bool force)
+{
+	// only the master thread can do this
+	if (!force && std::this_thread::get_id() != Monitor_reduction::master_thread_id)
+		return false;
+
+	const auto t_trace = tools::Tracer::now();
+	const auto is_pending = Monitor_reduction::pending;
+
+	// progress the reduction in flight, its result is applied as soon as it is completed
+	if (is_pending)
+		Monitor_reduction::ireduce_complete(force);
+
+	bool all_process_on_last = false;
+	if (force)
+	{
+		// the snapshot of the reduction in flight can be outdated: the final values are reduced in a new one
+		Monitor_reduction::ireduce_post(fully);
+		all_process_on_last = Monitor_reduction::ireduce_complete(true);
+	}
+	else if (!Monitor_reduction::pending && !Monitor_reduction::get_stop_loop() &&
+	         (std::chrono::steady_clock::now() - Monitor_reduction::t_last_reduction) >=
+	          Monitor_reduction::d_reduce_frequency)
+	{
+		// a process which stops posts no more reduction here, its final values are posted by 'last_reduce_all'
+		Monitor_reduction::ireduce_post(fully);
+	}
+	else if (!is_pending)
+		return false;
+
+	static const auto trace_id = tools::Tracer::register_name("Monitor_reduction::ireduce");
+	tools::Tracer::span(trace_id, t_trace);
+
+	return all_process_on_last;
+}
+
+void Monitor_reduction
+::ireduce_post(bool fully)
+{
+	auto &reqs = Monitor_reduction::requests;
+	reqs.resize(Monitor_reduction::monitors.size() +1);
+
+	for (size_t m = 0; m < Monitor_reduction::monitors.size(); m++)
+		Monitor_reduction::monitors[m]->_ireduce(fully, reqs[m]);
+
+	Monitor_reduction::stop_send = Monitor_reduction::get_stop_loop() ? 1 : 0;
+	MPI_Iallreduce(&Monitor_reduction::stop_send, &Monitor_reduction::n_stop_recv, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD,
+	               &reqs.back());
+
+	Monitor_reduction::pending          = true;
+	Monitor_reduction::t_last_reduction = std::chrono::steady_clock::now();
+}
+
+bool Monitor_reduction
+::ireduce_complete(bool block)
+{
+	auto &reqs = Monitor_reduction::requests;
+
+	int completed = 1;
+	if (block)
+		MPI_Waitall((int)reqs.size(), reqs.data(), MPI_STATUSES_IGNORE);
+	else
+		MPI_Testall((int)reqs.size(), reqs.data(), &completed, MPI_STATUSES_IGNORE);
+
+	if (!completed)
+		return false;
+
+	Monitor_reduction::pending = false;
+
+	for (auto& m : Monitor_reduction::monitors)
+		m->_ireduce_complete();
+
+	if (Monitor_reduction::n_stop_recv > 0)
+		Monitor_reduction::set_stop_loop();
+
+	int np;
+	MPI_Comm_size(MPI_COMM_WORLD, &np);
+
+	return Monitor_reduction::n_stop_recv == np;
+}
+
+void Monitor_reduction
+::_ireduce(bool fully, MPI_Request &request)
+{
+	this->_reduce(fully);
+	request = MPI_REQUEST_NULL;
+}
+
+void Monitor_reduction
+::_ireduce_complete()
+{
+}
+
+void Monitor_reduction
+::set_async(bool async)
+{
+	Monitor_reduction::async = async;
+}
+#endif
+
 void Monitor_reduction
 ::set_master_thread_id(std::thread::id t)
 {
 	Monitor_reduction::master_thread_id = t;
 }
 
+std::thread::id Monitor_reduction
+::get_master_thread_id()
+{
+	return Monitor_reduction::master_thread_id;
+}
+
 void Monitor_reduction
 ::set_reduce_frequency(std::chrono::nanoseconds d)
 {
@@ -6,6 +6,10 @@
 #include <vector>
 #include <cassert>
 
+#ifdef AFF3CT_MPI
+#include <mpi.h>
+#endif
+
 #include "Monitor.hpp"
 
 namespace aff3ct
@@ -23,6 +27,14 @@ private:
 
 	static std::chrono::time_point<std::chrono::steady_clock, std::chrono::nanoseconds> t_last_reduction;
 
+#ifdef AFF3CT_MPI
+	static bool                     async;       // the reductions are non-blocking
+	static bool                     pending;     // a non-blocking reduction is in flight
+	static std::vector<MPI_Request> requests;    // the requests of the reduction in flight (monitors + stop flag)
+	static int                      stop_send;   // snapshot of the stop flag sent by the reduction in flight
+	static int                      n_stop_recv; // number of process that have sent a stop flag
+#endif
+
 public:
 	/*
 	 * \brief check if any recorded monitor reduction has done after having done a reduction
@@ -50,8 +62,19 @@ public:
 
 	static void set_master_thread_id(std::thread::id          t);
 
+	static std::thread::id get_master_thread_id();
+
 	static void set_reduce_frequency(std::chrono::nanoseconds d);
 
+#ifdef AFF3CT_MPI
+	/*
+	 * \brief enable the non-blocking reductions ('MPI_Iallreduce'): the master thread posts a snapshot of the monitors
+	 *        and keeps simulating, the reduction is progressed and its result applied in the next 'is_done_all' calls
+	 *        (the reduced monitors are late by one reduction). The final reduction of 'last_reduce_all' is complete.
+	 */
+	static void set_async(bool async);
+#endif
+
 	/*
 	 * \brief get if the current simulation loop must be stopped or not
 	 * \return true if loop must be stopped
@@ -89,6 +112,19 @@ protected:
 	 */
 	virtual bool is_done_mr() = 0;
 
+#ifdef AFF3CT_MPI
+	/*
+	 * \brief post the non-blocking reduction of this monitor (by default the reduction is local and blocking)
+	 * \param request is the request of the posted reduction ('MPI_REQUEST_NULL' if there is nothing to wait)
+	 */
+	virtual void _ireduce(bool fully, MPI_Request &request);
+
+	/*
+	 * \brief apply the result of the non-blocking reduction of this monitor once its request is completed
+	 */
+	virtual void _ireduce_complete();
+#endif
+
 private:
 	/*
 	 * \brief add the monitor in the 'monitors' list
@@ -109,6 +145,27 @@ private:
 	 * \return the result of the 'reduce_stop_loop()' call after the reductions. If there were not, then return false.
 	 */
 	static bool __reduce__(bool fully, bool force);
+
+#ifdef AFF3CT_MPI
+	/*
+	 * \brief non-blocking version of '__reduce__': progress the reduction in flight and post a new one if the
+	 *        'd_reduce_frequency' criteria is reached. If 'force' is set, wait the reduction in flight and then do a
+	 *        complete reduction.
+	 * \return true if all process are at the final reduce step in a complete reduction, else false
+	 */
+	static bool __ireduce__(bool fully, bool force);
+
+	/*
+	 * \brief snapshot the stop flag and post the non-blocking reductions of all 'monitors'
+	 */
+	static void ireduce_post(bool fully);
+
+	/*
+	 * \brief test (or wait if 'block' is set) the reduction in flight and apply its result if it is completed
+	 * \return true if the reduction is completed and if all process are at the final reduce step
+	 */
+	static bool ireduce_complete(bool block);
+#endif
 };
 
 
@@ -132,9 +189,26 @@ public:
 	virtual void reset();
 	virtual void clear_callbacks();
 
+	/*
+	 * \brief get the reduced attributes as raw bytes (to save them in a checkpoint)
+	 */
+	std::vector<char> get_raw_attributes() const;
+
+	/*
+	 * \brief add raw attributes (from a checkpoint) to the first monitor of the list: they are counted in the next
+	 *        reductions
+	 */
+	void collect_raw_attributes(const std::vector<char> &raw);
+
 protected:
 	virtual void _reduce(bool fully = false);
 
+	/*
+	 * \brief collect the data of the monitors list in the 'collecter' without modifying this monitor
+	 * \return the 'collecter'
+	 */
+	const M& _collect(bool fully = false);
+
 	/*
 	 * \brief call reset()
 	 */
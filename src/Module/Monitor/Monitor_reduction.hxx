@@ -3,6 +3,7 @@
 
 #include <sstream>
 #include <numeric>
+#include <cstring>
 #include "Tools/Exception/exception.hpp"
 
 #include "Monitor_reduction.hpp"
@@ -95,6 +96,36 @@ void Monitor_reduction_M<M>
 		m->clear_callbacks();
 }
 
+template <class M>
+std::vector<char> Monitor_reduction_M<M>
+::get_raw_attributes() const
+{
+	const auto &vals = M::get_attributes();
+	const auto ptr = reinterpret_cast<const char*>(&vals);
+
+	return std::vector<char>(ptr, ptr + sizeof(vals));
+}
+
+template <class M>
+void Monitor_reduction_M<M>
+::collect_raw_attributes(const std::vector<char> &raw)
+{
+	using Attributes = typename M::Attributes;
+
+	if (raw.size() != sizeof(Attributes))
+	{
+		std::stringstream message;
+		message << "'raw.size()' has to be equal to 'sizeof(Attributes)' ('raw.size()' = " << raw.size()
+		        << ", 'sizeof(Attributes)' = " << sizeof(Attributes) << ").";
+		throw tools::length_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	Attributes vals;
+	std::memcpy((void*)&vals, raw.data(), sizeof(Attributes));
+
+	this->monitors[0]->collect(vals);
+}
+
 template <class M>
 void Monitor_reduction_M<M>
 ::_reduce(bool fully)
@@ -108,12 +139,19 @@ void Monitor_reduction_M<M>
 	// M::copy(collecter, fully);
 
 	// New way to collect data (without object allocation)
+	M::copy(this->_collect(fully), fully);
+}
+
+template <class M>
+const M& Monitor_reduction_M<M>
+::_collect(bool fully)
+{
 	collecter.reset();
 
 	for (auto& m : this->monitors)
 		collecter.collect(*m, fully);
 
-	M::copy(collecter, fully);
+	return collecter;
 }
 
 }
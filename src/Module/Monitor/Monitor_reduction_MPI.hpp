@@ -21,6 +21,10 @@ private:
 	MPI_Datatype MPI_monitor_vals;
 	MPI_Op       MPI_Op_reduce_monitors;
 
+	// buffers of the non-blocking reduction in flight: the monitors keep on being updated during the communication
+	Attributes   mvals_isend;
+	Attributes   mvals_irecv;
+
 public:
 	explicit Monitor_reduction_MPI(const std::vector<std::unique_ptr<M>> &monitors);
 	virtual ~Monitor_reduction_MPI() = default;
@@ -30,6 +34,9 @@ public:
 protected:
 	virtual void _reduce(bool fully = false);
 
+	virtual void _ireduce(bool fully, MPI_Request &request);
+	virtual void _ireduce_complete();
+
 private:
 	static void MPI_reduce_monitors(void *in, void *inout, int *len, MPI_Datatype *datatype);
 };
@@ -64,6 +64,25 @@ void Monitor_reduction_MPI<M>
 	M::copy(mvals_recv);
 }
 
+template <class M>
+void Monitor_reduction_MPI<M>
+::_ireduce(bool fully, MPI_Request &request)
+{
+	fully = false;
+
+	// the send buffer is a snapshot: it is not modified until the request is completed
+	mvals_isend = Monitor_reduction_M<M>::_collect(fully).get_attributes();
+	MPI_Iallreduce(&mvals_isend, &mvals_irecv, 1, MPI_monitor_vals, MPI_Op_reduce_monitors, MPI_COMM_WORLD,
+	               &request);
+}
+
+template <class M>
+void Monitor_reduction_MPI<M>
+::_ireduce_complete()
+{
+	M::copy(mvals_irecv);
+}
+
 template <class M>
 void Monitor_reduction_MPI<M>
 ::reset()
@@ -11,7 +11,7 @@ using namespace aff3ct::module;
 template <typename B>
 Source_user<B>
 ::Source_user(const int K, const std::string filename, const int n_frames, const int start_idx)
-: Source<B>(K, n_frames), source(), src_counter(start_idx)
+: Source<B>(K, n_frames), source(), trace(nullptr), src_counter(start_idx), n_src(0)
 {
 	const std::string name = "Source_user";
 	this->set_name(name);
@@ -19,6 +19,33 @@ Source_user<B>
 	if (filename.empty())
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "'filename' should not be empty.");
 
+	if (tools::Mapped_trace::is_trace(filename))
+	{
+		this->trace = tools::Mapped_trace::open(filename);
+
+		if (this->trace->get_frame_size() != (size_t)this->K)
+		{
+			std::stringstream message;
+			message << "The size is wrong (read: " << this->trace->get_frame_size() << ", expected: " << this->K
+			        << ").";
+			throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		this->n_src = (int)this->trace->get_n_frames();
+	}
+	else
+	{
+		this->read_as_text(filename);
+		this->n_src = (int)this->source.size();
+	}
+
+	src_counter %= n_src;
+}
+
+template <typename B>
+void Source_user<B>
+::read_as_text(const std::string &filename)
+{
 	std::ifstream file(filename.c_str(), std::ios::in);
 
 	if (file.is_open())
@@ -64,19 +91,20 @@ Source_user<B>
 	}
 	else
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "Can't open '" + filename + "' file.");
-
-	src_counter %= (int)source.size();
 }
 
 template <typename B>
 void Source_user<B>
 ::_generate(B *U_K, const int frame_id)
 {
-	std::copy(this->source[this->src_counter].begin(),
-	          this->source[this->src_counter].end  (),
-	          U_K);
+	if (this->trace != nullptr)
+		this->trace->read_frame(this->src_counter, U_K);
+	else
+		std::copy(this->source[this->src_counter].begin(),
+		          this->source[this->src_counter].end  (),
+		          U_K);
 
-	this->src_counter = (this->src_counter +1) % (int)this->source.size();
+	this->src_counter = (this->src_counter +1) % this->n_src;
 }
 
 // ==================================================================================== explicit template instantiation
@@ -4,6 +4,9 @@
 #include <string>
 #include <random>
 #include <vector>
+#include <memory>
+
+#include "Tools/Algo/Mapped_trace/Mapped_trace.hpp"
 
 #include "../Source.hpp"
 
@@ -16,7 +19,9 @@ class Source_user : public Source<B>
 {
 private:
 	std::vector<std::vector<B>> source;
+	std::shared_ptr<const tools::Mapped_trace> trace; // shared between all the threads when the file is a binary trace
 	int src_counter;
+	int n_src;
 
 public:
 	Source_user(const int K, std::string filename, const int n_frames = 1, const int start_idx = 0);
@@ -24,6 +29,9 @@ public:
 
 protected:
 	void _generate(B *U_K, const int frame_id);
+
+private:
+	void read_as_text(const std::string &filename);
 };
 }
 }
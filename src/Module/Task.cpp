@@ -4,6 +4,9 @@
 
 #include <rang.hpp>
 
+#include "Tools/Perf/Counters/Perf_counters.hpp"
+#include "Tools/Perf/Trace/Tracer.hpp"
+
 #include "Module.hpp"
 #include "Socket.hpp"
 #include "Task.hpp"
@@ -19,6 +22,7 @@ Task::Task(const Module &module, const std::string &name, const bool autoalloc,
   autoexec(autoexec),
   stats(stats),
   fast(fast),
+  perf(false),
   debug(debug),
   debug_hex(false),
   debug_limit(-1),
@@ -29,6 +33,10 @@ Task::Task(const Module &module, const std::string &name, const bool autoalloc,
   duration_total(std::chrono::nanoseconds(0)),
   duration_min(std::chrono::nanoseconds(0)),
   duration_max(std::chrono::nanoseconds(0)),
+  perf_n_calls(0),
+  perf_total((size_t)tools::perf_evt::SIZE, 0),
+  perf_available((size_t)tools::perf_evt::SIZE, false),
+  trace_id(-1),
   last_input_socket(nullptr)
 {
 }
@@ -69,6 +77,8 @@ void Task::set_stats(const bool stats)
 
 	if (this->stats)
 		this->set_fast(false);
+	else
+		this->perf = false;
 }
 
 void Task::set_fast(const bool fast)
@@ -84,6 +94,15 @@ void Task::set_fast(const bool fast)
 		sockets[i]->set_fast(this->fast);
 }
 
+void Task::set_perf(const bool perf)
+{
+	this->perf = perf;
+
+	// the counters are read around the codelet in the statistics mode
+	if (this->perf)
+		this->set_stats(true);
+}
+
 void Task::set_debug(const bool debug)
 {
 	this->debug = debug;
@@ -205,7 +224,9 @@ int Task::exec()
 {
 	if (fast)
 	{
+		const auto t_trace = tools::Tracer::now();
 		auto exec_status = this->codelet();
+		this->trace(t_trace);
 		this->n_calls++;
 		return exec_status;
 	}
@@ -263,12 +284,27 @@ int Task::exec()
 		}
 
 		int exec_status;
+		const auto t_trace = tools::Tracer::now();
 		if (stats)
 		{
+			uint64_t perf_start[(int)tools::perf_evt::SIZE], perf_stop[(int)tools::perf_evt::SIZE];
+			auto perf_ok = perf && tools::Perf_counters::local().read(perf_start);
+
 			auto t_start = std::chrono::steady_clock::now();
 			exec_status = this->codelet();
 			auto duration = std::chrono::steady_clock::now() - t_start;
 
+			if (perf_ok && tools::Perf_counters::local().read(perf_stop))
+			{
+				auto &counters = tools::Perf_counters::local();
+				for (auto e = 0; e < (int)tools::perf_evt::SIZE; e++)
+				{
+					this->perf_available[e] = counters.is_available((tools::perf_evt)e);
+					this->perf_total    [e] += perf_stop[e] - perf_start[e];
+				}
+				this->perf_n_calls++;
+			}
+
 			this->duration_total += duration;
 			if (n_calls)
 			{
@@ -283,6 +319,7 @@ int Task::exec()
 		}
 		else
 			exec_status = this->codelet();
+		this->trace(t_trace);
 		this->n_calls++;
 
 		if (debug)
@@ -451,6 +488,21 @@ const std::vector<std::chrono::nanoseconds>& Task::get_timers_max() const
 	return this->timers_max;
 }
 
+uint32_t Task::get_perf_n_calls() const
+{
+	return this->perf_n_calls;
+}
+
+const std::vector<uint64_t>& Task::get_perf_total() const
+{
+	return this->perf_total;
+}
+
+const std::vector<bool>& Task::get_perf_available() const
+{
+	return this->perf_available;
+}
+
 socket_t Task::get_socket_type(const Socket &s) const
 {
 	for (size_t i = 0; i < sockets.size(); i++)
@@ -465,11 +517,17 @@ socket_t Task::get_socket_type(const Socket &s) const
 
 void Task::register_timer(const std::string &name)
 {
-	this->timers_name   .push_back(name                       );
-	this->timers_n_calls.push_back(0                          );
-	this->timers_total  .push_back(std::chrono::nanoseconds(0));
-	this->timers_max    .push_back(std::chrono::nanoseconds(0));
-	this->timers_min    .push_back(std::chrono::nanoseconds(0));
+	this->timers_name    .push_back(name                       );
+	this->timers_n_calls .push_back(0                          );
+	this->timers_total   .push_back(std::chrono::nanoseconds(0));
+	this->timers_max     .push_back(std::chrono::nanoseconds(0));
+	this->timers_min     .push_back(std::chrono::nanoseconds(0));
+	this->timers_trace_id.push_back(-1                         );
+}
+
+std::string Task::get_trace_name() const
+{
+	return this->module.get_name() + "::" + this->get_name();
 }
 
 void Task::reset_stats()
@@ -483,6 +541,9 @@ void Task::reset_stats()
 	for (auto &x : this->timers_total  ) x = std::chrono::nanoseconds(0);
 	for (auto &x : this->timers_min    ) x = std::chrono::nanoseconds(0);
 	for (auto &x : this->timers_max    ) x = std::chrono::nanoseconds(0);
+
+	this->perf_n_calls = 0;
+	std::fill(this->perf_total.begin(), this->perf_total.end(), 0);
 }
 
 // ==================================================================================== explicit template instantiation
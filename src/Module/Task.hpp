@@ -6,8 +6,10 @@
 #include <memory>
 
 #include <map>
+#include <atomic>
 #include <chrono>
 #include <vector>
+#include <cstdint>
 #include <typeinfo>
 #include <algorithm>
 #include <typeindex>
@@ -20,6 +22,22 @@
 
 namespace aff3ct
 {
+namespace tools
+{
+// hooks of the timeline tracer (defined in 'Tools/Perf/Trace/Tracer.cpp')
+uint64_t trace_now          ();
+uint32_t trace_register_name(const std::string &name);
+void     trace_span         (const uint32_t name_id, const uint64_t t_begin);
+
+// state of the timeline tracer, checked before calling the hooks
+extern std::atomic<bool> trace_enabled;
+
+inline bool is_trace_enabled()
+{
+	return trace_enabled.load(std::memory_order_relaxed);
+}
+}
+
 namespace module
 {
 class Module;
@@ -39,6 +57,7 @@ protected:
 	bool autoexec;
 	bool stats;
 	bool fast;
+	bool perf;
 	bool debug;
 	bool debug_hex;
 	int32_t debug_limit;
@@ -59,6 +78,15 @@ protected:
 	std::vector<std::chrono::nanoseconds> timers_min;
 	std::vector<std::chrono::nanoseconds> timers_max;
 
+	// hardware performance counters (see 'tools::Perf_counters')
+	uint32_t              perf_n_calls;
+	std::vector<uint64_t> perf_total;
+	std::vector<bool>     perf_available;
+
+	// timeline tracing (see 'tools::Tracer'), the names are registered at the first traced call
+	int64_t              trace_id;
+	std::vector<int64_t> timers_trace_id;
+
 	Socket* last_input_socket;
 	std::vector<socket_t> socket_type;
 
@@ -81,6 +109,7 @@ public:
 	void set_autoexec       (const bool     autoexec );
 	void set_stats          (const bool     stats    );
 	void set_fast           (const bool     fast     );
+	void set_perf           (const bool     perf     );
 	void set_debug          (const bool     debug    );
 	void set_debug_hex      (const bool     debug_hex);
 	void set_debug_limit    (const uint32_t limit    );
@@ -91,6 +120,7 @@ public:
 	inline bool is_autoexec         (                  ) const { return this->autoexec;             }
 	inline bool is_stats            (                  ) const { return this->stats;                }
 	inline bool is_fast             (                  ) const { return this->fast;                 }
+	inline bool is_perf             (                  ) const { return this->perf;                 }
 	inline bool is_debug            (                  ) const { return this->debug;                }
 	inline bool is_debug_hex        (                  ) const { return this->debug_hex;            }
 	inline bool is_last_input_socket(const Socket &s_in) const { return last_input_socket == &s_in; }
@@ -111,6 +141,9 @@ public:
 	const std::vector<std::chrono::nanoseconds>& get_timers_total  () const;
 	const std::vector<std::chrono::nanoseconds>& get_timers_min    () const;
 	const std::vector<std::chrono::nanoseconds>& get_timers_max    () const;
+	      uint32_t                               get_perf_n_calls  () const;
+	const std::vector<uint64_t>                & get_perf_total    () const;
+	const std::vector<bool>                    & get_perf_available() const;
 
 	int exec();
 
@@ -138,9 +171,35 @@ public:
 		}
 	}
 
+	/*!
+	 * \brief Records the span of the sub-timer 'id' in the timeline from 't_start' (given by 'tools::trace_now()').
+	 */
+	inline void trace_timer(const int id, const uint64_t t_start)
+	{
+		if (t_start)
+		{
+			if (this->timers_trace_id[id] < 0)
+				this->timers_trace_id[id] = (int64_t)tools::trace_register_name(this->get_trace_name() + "::" +
+				                                                                this->timers_name[id]);
+			tools::trace_span((uint32_t)this->timers_trace_id[id], t_start);
+		}
+	}
+
 protected:
 	void register_timer(const std::string &key);
 
+	std::string get_trace_name() const;
+
+	inline void trace(const uint64_t t_start)
+	{
+		if (t_start)
+		{
+			if (this->trace_id < 0)
+				this->trace_id = (int64_t)tools::trace_register_name(this->get_trace_name());
+			tools::trace_span((uint32_t)this->trace_id, t_start);
+		}
+	}
+
 	template <typename T>
 	Socket& create_socket_in(const std::string &name, const size_t n_elmts);
 
@@ -1,7 +1,9 @@
 #include <cmath>
 #include <thread>
+#include <random>
 #include <string>
 #include <sstream>
+#include <exception>
 #include <algorithm>
 #include <functional>
 
@@ -10,6 +12,7 @@
 #include "Tools/Display/rang_format/rang_format.h"
 #include "Tools/Display/Statistics/Statistics.hpp"
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Thread_pinning/Thread_pinning.hpp"
 
 #include "Factory/Module/Monitor/Monitor.hpp"
 #include "Factory/Tools/Display/Terminal/Terminal.hpp"
@@ -29,7 +32,8 @@ BFER<B,R,Q>
 
   monitor_mi(params_BFER.n_threads),
   monitor_er(params_BFER.n_threads),
-  dumper    (params_BFER.n_threads)
+  dumper    (params_BFER.n_threads),
+  reporter_thr(nullptr)
 {
 	if (params_BFER.n_threads < 1)
 	{
@@ -41,9 +45,10 @@ BFER<B,R,Q>
 	if (params_BFER.err_track_enable)
 	{
 		for (auto tid = 0; tid < params_BFER.n_threads; tid++)
-			dumper[tid].reset(new tools::Dumper());
+			dumper[tid].reset(new tools::Dumper_stream());
 
-		dumper_red.reset(new tools::Dumper_reduction(dumper));
+		// the frames are written during the simulation by the writer thread of the reduction
+		dumper_red.reset(new tools::Dumper_reduction_stream(dumper, params_BFER.err_track_path + ".tmp"));
 	}
 
 	if (!params_BFER.noise->pdf_path.empty())
@@ -51,7 +56,8 @@ BFER<B,R,Q>
 		                                                tools::Distribution_mode::SUMMATION,
 		                                                params_BFER.mdm->rop_est_bits > 0));
 
-	this->build_monitors ();
+	this->build_checkpoint();
+	this->build_monitors  ();
 	this->build_reporters();
 
 	this->terminal = this->build_terminal();
@@ -160,11 +166,35 @@ void BFER<B,R,Q>
 		    !params_BFER.debug)
 			terminal->start_temp_report(params_BFER.ter->frequency);
 
-		this->t_start_noise_point = std::chrono::steady_clock::now();
+		// resume the noise point from the checkpoint: the counted frames are not simulated again
+		bool point_done = false;
+		auto elapsed    = std::chrono::nanoseconds(0);
+		if (this->checkpoint != nullptr)
+			if (auto point = this->checkpoint->find(this->noise->get_noise()))
+			{
+				point_done = point->done;
+				elapsed    = std::chrono::duration_cast<std::chrono::nanoseconds>(
+				                 std::chrono::duration<double>(point->elapsed));
+
+#ifdef AFF3CT_MPI
+				if (params_BFER.mpi_rank == 0) // the counts are added only once by the MPI reduction
+#endif
+				{
+					this->monitor_er_red->collect_raw_attributes(point->monitors[0]);
+					if (this->monitor_mi_red != nullptr)
+						this->monitor_mi_red->collect_raw_attributes(point->monitors[1]);
+				}
+
+				this->reporter_thr->set_elapsed_time(elapsed);
+			}
+
+		this->t_start_noise_point = std::chrono::steady_clock::now() - elapsed;
+		this->t_last_checkpoint   = std::chrono::steady_clock::now();
 
 		try
 		{
-			this->_launch();
+			if (!point_done)
+				this->_launch();
 			module::Monitor_reduction::is_done_all(true, true); // final reduction
 		}
 		catch (std::exception const& e)
@@ -179,6 +209,10 @@ void BFER<B,R,Q>
 			tools::Terminal::stop();
 		}
 
+		// an interrupted noise point will be continued by the next resume
+		if (this->checkpoint != nullptr && !point_done)
+			this->save_checkpoint(!tools::Terminal::is_interrupt() && !this->simu_error);
+
 #ifdef AFF3CT_MPI
 		if (params_BFER.mpi_rank == 0)
 #endif
@@ -206,8 +240,13 @@ void BFER<B,R,Q>
 			}
 		}
 
+		// with the confidence intervals stop criterion, the target precision replaces the frame errors limit
+		const bool target_achieved = this->monitor_er_red->get_ci_width() != 0.f ?
+		                             this->monitor_er_red->ci_limit_achieved() :
+		                             this->monitor_er_red->fe_limit_achieved();
+
 		if (!params_BFER.crit_nostop && !params_BFER.err_track_revert && !tools::Terminal::is_interrupt() &&
-		    !this->monitor_er_red->fe_limit_achieved() &&
+		    !target_achieved &&
 		    (this->monitor_er_red->frame_limit_achieved() || this->stop_time_reached()))
 			tools::Terminal::stop();
 
@@ -247,7 +286,7 @@ void BFER<B,R,Q>
 			}
 		}
 
-		if (this->dumper_red != nullptr && !this->simu_error)
+		if (this->dumper_red != nullptr && !this->simu_error && !point_done)
 		{
 			std::stringstream s_noise;
 			s_noise << std::setprecision(2) << std::fixed << this->noise->get_noise();
@@ -286,6 +325,8 @@ std::unique_ptr<typename BFER<B,R,Q>::Monitor_BFER_type> BFER<B,R,Q>
 	auto mnt_tmp = params_BFER.mnt_er->build<B>(count_unknown_values);
 	auto mnt = std::unique_ptr<typename BFER<B,R,Q>::Monitor_BFER_type>(mnt_tmp);
 	mnt->activate_err_histogram(params_BFER.mnt_er->err_hist != -1);
+	mnt->activate_weighting(params_BFER.chn->type == "AWGN" &&
+	                        (params_BFER.chn->is_scale != 1.f || params_BFER.chn->is_shift != 0.f));
 
 	return mnt;
 }
@@ -316,6 +357,7 @@ void BFER<B,R,Q>
 	this->reporters.push_back(std::unique_ptr<tools::Reporter_BFER<B>>(reporter_BFER));
 	auto reporter_thr = new tools::Reporter_throughput<uint64_t>(*this->monitor_er_red);
 	this->reporters.push_back(std::unique_ptr<tools::Reporter_throughput<uint64_t>>(reporter_thr));
+	this->reporter_thr = reporter_thr;
 }
 
 template <typename B, typename R, typename Q>
@@ -350,6 +392,7 @@ void BFER<B,R,Q>
 	module::Monitor_reduction::set_master_thread_id(std::this_thread::get_id());
 #ifdef AFF3CT_MPI
 	module::Monitor_reduction::set_reduce_frequency(params_BFER.mnt_mpi_comm_freq);
+	module::Monitor_reduction::set_async(params_BFER.mnt_mpi_async);
 #else
 	auto freq = std::chrono::milliseconds(0);
 	if (params_BFER.mnt_red_lazy)
@@ -372,6 +415,9 @@ void BFER<B,R,Q>
 {
 	try
 	{
+		// the memory of the modules is allocated (and first touched) on the NUMA node of the pinned thread
+		tools::Thread_pinning::pin(tid);
+
 		simu->__build_communication_chain(tid);
 
 		if (simu->params_BFER.err_track_enable)
@@ -402,12 +448,22 @@ void BFER<B,R,Q>
 		}
 		simu->mutex_exception.unlock();
 	}
+
+	// the main thread builds the chain 0: the threads it creates later (terminal, ...) don't inherit its CPU
+	if (tid == 0)
+		tools::Thread_pinning::unpin();
 }
 
 template <typename B, typename R, typename Q>
 bool BFER<B,R,Q>
 ::keep_looping_noise_point()
 {
+	// periodic checkpoint by the master thread (just after its reductions)
+	if (this->checkpoint != nullptr &&
+	    std::this_thread::get_id() == module::Monitor_reduction::get_master_thread_id() &&
+	    std::chrono::steady_clock::now() - this->t_last_checkpoint >= params_BFER.chk_freq)
+		this->save_checkpoint(false);
+
 	// communication chain execution
 	return !(tools::Terminal::is_interrupt() // if user stopped the simulation
 	         || module::Monitor_reduction::is_done_all() // while any monitor criteria is not reached -> do reduction
@@ -423,6 +479,106 @@ bool BFER<B,R,Q>
 	                                                                     params_BFER.stop_time;
 }
 
+template <typename B, typename R, typename Q>
+int BFER<B,R,Q>
+::get_seed(const int tid) const
+{
+	const auto seed       = params_BFER.local_seed + tid;
+	const auto generation = this->checkpoint != nullptr ? this->checkpoint->get_generation() : 0;
+
+	if (generation == 0)
+		return seed;
+
+	// mix the seed and the generation: the frames of a resumed simulation are independent of the previous ones
+	std::seed_seq seq = {(uint32_t)seed, generation};
+	uint32_t mixed_seed;
+	seq.generate(&mixed_seed, &mixed_seed +1);
+
+	return (int)mixed_seed;
+}
+
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::build_checkpoint()
+{
+	if (params_BFER.chk_path.empty())
+		return;
+
+	// the parameters which modify the meaning or the layout of the saved monitors
+	std::stringstream signature;
+	signature << "K="      << params_BFER.src->K                << ";N="   << params_BFER.cdc->N
+	          << ";noise=" << params_BFER.noise->type
+	          << ";mdm="   << params_BFER.mdm->type      << "/" << params_BFER.mdm->bps
+	          << ";chn="   << params_BFER.chn->type
+	          << ";dec="   << params_BFER.cdc->dec->type << "/" << params_BFER.cdc->dec->implem
+	          << ";coded=" << params_BFER.coded_monitoring      << ";mi="  << params_BFER.mnt_mutinfo;
+
+	this->checkpoint.reset(new tools::Checkpoint(signature.str()));
+
+	if (!params_BFER.resume)
+		return;
+
+#ifdef AFF3CT_MPI
+	// the first process reads the checkpoint and sends it to the others
+	std::string data;
+	std::exception_ptr error;
+	if (params_BFER.mpi_rank == 0)
+	{
+		try
+		{
+			this->checkpoint->load(params_BFER.chk_path);
+			data = this->checkpoint->serialize();
+		}
+		catch (std::exception const&)
+		{
+			error = std::current_exception();
+		}
+	}
+
+	unsigned long long data_size = data.size();
+	MPI_Bcast(&data_size, 1, MPI_UNSIGNED_LONG_LONG, 0, MPI_COMM_WORLD);
+
+	if (error)
+		std::rethrow_exception(error);
+
+	if (data_size == 0)
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "The first process can't read the checkpoint.");
+
+	data.resize(data_size);
+	MPI_Bcast(&data[0], (int)data_size, MPI_CHAR, 0, MPI_COMM_WORLD);
+
+	if (params_BFER.mpi_rank != 0)
+		this->checkpoint->deserialize(data);
+#else
+	this->checkpoint->load(params_BFER.chk_path);
+#endif
+}
+
+template <typename B, typename R, typename Q>
+void BFER<B,R,Q>
+::save_checkpoint(const bool done)
+{
+	this->t_last_checkpoint = std::chrono::steady_clock::now();
+
+#ifdef AFF3CT_MPI
+	// the reduced monitors are the same on all the processes
+	if (params_BFER.mpi_rank != 0)
+		return;
+#endif
+
+	tools::Checkpoint::Point point;
+	point.noise   = this->noise->get_noise();
+	point.done    = done;
+	point.elapsed = std::chrono::duration<double>(this->t_last_checkpoint - this->t_start_noise_point).count();
+
+	point.monitors.push_back(this->monitor_er_red->get_raw_attributes());
+	if (this->monitor_mi_red != nullptr)
+		point.monitors.push_back(this->monitor_mi_red->get_raw_attributes());
+
+	this->checkpoint->update(point);
+	this->checkpoint->save(params_BFER.chk_path);
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef AFF3CT_MULTI_PREC
@@ -14,7 +14,10 @@
 #include "Tools/Display/Terminal/Terminal.hpp"
 #include "Tools/Display/Dumper/Dumper.hpp"
 #include "Tools/Display/Dumper/Dumper_reduction.hpp"
+#include "Tools/Display/Dumper/Dumper_stream.hpp"
+#include "Tools/Display/Dumper/Dumper_reduction_stream.hpp"
 #include "Tools/Math/Distribution/Distributions.hpp"
+#include "Tools/Checkpoint/Checkpoint.hpp"
 #include "Tools/Noise/Noise.hpp"
 
 #include "Module/Module.hpp"
@@ -78,6 +81,11 @@ protected:
 	// terminal and reporters (for the output of the simu)
 	std::vector<std::unique_ptr<tools::Reporter>> reporters;
 	std::unique_ptr<tools::Terminal>              terminal;
+	tools::Reporter_throughput<uint64_t>*         reporter_thr;
+
+	// save the progress of the simulation (nullptr if disabled)
+	std::unique_ptr<tools::Checkpoint>    checkpoint;
+	std::chrono::steady_clock::time_point t_last_checkpoint;
 
 	// noise distribution
 	std::unique_ptr<tools::Distributions<R>> distributions;
@@ -103,6 +111,20 @@ protected:
 	virtual bool keep_looping_noise_point();
 	bool stop_time_reached();
 
+	/*
+	 * \brief get the seed of the generator of the seeds of the thread 'tid': the seeds are different after each resume
+	 *        of a checkpoint to simulate new frames
+	 */
+	int get_seed(const int tid) const;
+
+	void build_checkpoint();
+
+	/*
+	 * \brief save the reduced monitors of the current noise point in the checkpoint file
+	 * \param done is true if the noise point is over
+	 */
+	void save_checkpoint(const bool done);
+
 private:
 	static void start_thread_build_comm_chain(BFER<B,R,Q> *simu, const int tid);
 };
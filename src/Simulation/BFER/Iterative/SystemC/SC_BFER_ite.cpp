@@ -24,6 +24,10 @@ SC_BFER_ite<B,R,Q>
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "SystemC simulation does not support the coded "
 		                                                            "monitoring.");
 
+	if (this->monitor_er_red->is_weighted())
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "SystemC simulation does not support the "
+		                                                            "importance sampling.");
+
 	this->add_module("coset_real_i", params_BFER_ite.n_threads);
 }
 
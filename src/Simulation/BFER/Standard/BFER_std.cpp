@@ -25,7 +25,7 @@ BFER_std<B,R,Q>
   rd_engine_seed(params_BFER_std.n_threads)
 {
 	for (auto tid = 0; tid < params_BFER_std.n_threads; tid++)
-		rd_engine_seed[tid].seed(params_BFER_std.local_seed + tid);
+		rd_engine_seed[tid].seed(this->get_seed(tid));
 
 	this->add_module("source"    , params_BFER_std.n_threads);
 	this->add_module("crc"       , params_BFER_std.n_threads);
@@ -23,6 +23,10 @@ SC_BFER_std<B,R,Q>
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "BFER SystemC simulation does not support the "
 		                                                            "coded monitoring.");
 
+	if (this->monitor_er_red->is_weighted())
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "BFER SystemC simulation does not support the "
+		                                                            "importance sampling.");
+
 	if (params_BFER_std.mnt_mutinfo)
 		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "BFER SystemC simulation does not support the "
 		                                                            "mututal information computation.");
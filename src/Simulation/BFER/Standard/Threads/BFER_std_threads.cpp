@@ -5,6 +5,9 @@
 #include <thread>
 
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Perf/Trace/Tracer.hpp"
+#include "Tools/Thread_pinning/Thread_pinning.hpp"
+#include "Module/Channel/AWGN/Channel_AWGN_LLR.hpp"
 #include "Tools/Display/rang_format/rang_format.h"
 
 #include "BFER_std_threads.hpp"
@@ -52,8 +55,13 @@ template <typename B, typename R, typename Q>
 void BFER_std_threads<B,R,Q>
 ::start_thread(BFER_std_threads<B,R,Q> *simu, const int tid)
 {
+	tools::Tracer::set_thread_name("simulation thread " + std::to_string(tid));
+
 	try
 	{
+		// same CPU as the thread which built the modules of 'tid': their memory is on the local NUMA node
+		tools::Thread_pinning::pin(tid);
+
 		simu->sockets_binding(tid);
 		simu->simulation_loop(tid);
 	}
@@ -77,6 +85,10 @@ void BFER_std_threads<B,R,Q>
 
 		simu->mutex_exception.unlock();
 	}
+
+	// the main thread runs the chain 0: the threads it creates later (terminal, ...) don't inherit its CPU
+	if (tid == 0)
+		tools::Thread_pinning::unpin();
 }
 
 template <typename B, typename R, typename Q>
@@ -276,6 +288,9 @@ void BFER_std_threads<B,R,Q>
 
 	using namespace module;
 
+	// the likelihood ratios of the frames are given by the channel in importance sampling mode
+	auto channel_is = monitor.is_weighted() ? dynamic_cast<Channel_AWGN_LLR<R>*>(&channel) : nullptr;
+
 	// communication chain execution
 	while (this->keep_looping_noise_point())
 	{
@@ -367,6 +382,9 @@ void BFER_std_threads<B,R,Q>
 			}
 		}
 
+		if (channel_is != nullptr)
+			monitor.set_weights(channel_is->get_is_weights());
+
 		monitor[mnt::tsk::check_errors].exec();
 
 		if (this->params_BFER_std.mnt_mutinfo)
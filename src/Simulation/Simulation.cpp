@@ -1,5 +1,13 @@
 #include <sstream>
+
+#ifdef AFF3CT_MPI
+#include <mpi.h>
+#endif
+
 #include "Tools/Exception/exception.hpp"
+#include "Tools/Algo/Construction_cache/Disk_cache.hpp"
+#include "Tools/Perf/Trace/Tracer.hpp"
+#include "Tools/Thread_pinning/Thread_pinning.hpp"
 
 #include "Simulation.hpp"
 
@@ -10,6 +18,37 @@ Simulation
 ::Simulation(const factory::Simulation::parameters& simu_params)
 : params(simu_params), simu_error(false)
 {
+	// the codes constructions are persistent between the runs only if a cache directory is given
+	tools::Disk_cache::set_directory(params.cache_dir);
+
+	if (!params.trace_path.empty())
+	{
+#ifdef AFF3CT_MPI
+		// one trace file per process, the processes are distinguished by their rank in the timeline
+		tools::Tracer::start(params.trace_path + "_" + std::to_string(params.mpi_rank), params.mpi_rank);
+#else
+		tools::Tracer::start(params.trace_path);
+#endif
+	}
+
+	size_t pin_offset = 0;
+#ifdef AFF3CT_MPI
+	// the processes of a same node are placed one after the other on the CPUs of the node
+	MPI_Comm node_comm;
+	int node_rank;
+	MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, params.mpi_rank, MPI_INFO_NULL, &node_comm);
+	MPI_Comm_rank(node_comm, &node_rank);
+	MPI_Comm_free(&node_comm);
+	pin_offset = (size_t)node_rank * (size_t)params.n_threads;
+#endif
+	tools::Thread_pinning::init(tools::Thread_pinning::str_to_policy(params.pin_policy), params.pin_cpus, pin_offset);
+	tools::Thread_pinning::set_huge_pages(params.huge_pages);
+}
+
+Simulation
+::~Simulation()
+{
+	tools::Tracer::stop();
 }
 
 bool Simulation
@@ -33,6 +72,9 @@ void Simulation
 					if (params.statistics)
 						t->set_stats(true);
 
+					if (params.hw_counters)
+						t->set_perf(true);
+
 					// enable the debug mode in the modules
 					if (params.debug)
 					{
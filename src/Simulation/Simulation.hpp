@@ -42,7 +42,7 @@ public:
 	/*!
 	 *  \brief Destructor.
 	 */
-	virtual ~Simulation() = default;
+	virtual ~Simulation();
 
 	bool is_error() const;
 
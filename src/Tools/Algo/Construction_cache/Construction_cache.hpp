@@ -0,0 +1,115 @@
+#ifndef CONSTRUCTION_CACHE_HPP_
+#define CONSTRUCTION_CACHE_HPP_
+
+#include <map>
+#include <mutex>
+#include <future>
+#include <string>
+#include <memory>
+#include <exception>
+
+namespace aff3ct
+{
+namespace tools
+{
+
+/*!
+ * \class Construction_cache
+ *
+ * \brief Process-wide cache of the immutable objects required to build a code (parity matrices, generator matrices,
+ *        frozen bits...).
+ *
+ * In the simulations, each thread builds its own codec. Without cache, the same matrix file is parsed and the same
+ * construction algorithm is run once per thread. With the cache, the first thread builds the object and the others get
+ * a shared read-only pointer on it: only the mutable state (the decoder buffers) is allocated per thread.
+ *
+ * An object stays in the cache as long as at least one codec uses it, the threads that request an object which is
+ * being built wait for it (the object is built only once). The lock of the cache is not held during the builds: the
+ * objects of different keys are built concurrently and a build can request an object of another key.
+ *
+ * \tparam T: the type of the cached objects (one cache per type).
+ */
+template <class T>
+class Construction_cache
+{
+public:
+	/*!
+	 * \brief Return the object associated to the key, build it if it is not in the cache.
+	 *
+	 * \param key:   identifies the object, it has to contain all the parameters used by 'build'.
+	 * \param build: callable returning a pointer on a new object (the cache takes the ownership), called at most once
+	 *               for the key while the object is in use.
+	 * \return a shared read-only object.
+	 */
+	template <class F>
+	static std::shared_ptr<const T> get(const std::string &key, F &&build)
+	{
+		std::promise<std::shared_ptr<const T>> promise;
+		std::shared_future<std::shared_ptr<const T>> future;
+		Entry *entry = nullptr;
+
+		{
+			std::lock_guard<std::mutex> lock(mutex());
+
+			entry = &entries()[key]; // the elements of a map are not moved by the insertions
+			auto shared = entry->object.lock();
+			if (shared != nullptr)
+				return shared;
+
+			// the object is being built by another thread
+			if (entry->pending.valid())
+				future = entry->pending;
+			else
+				entry->pending = promise.get_future().share();
+		}
+
+		if (future.valid())
+			return future.get();
+
+		try
+		{
+			std::shared_ptr<const T> shared(build());
+			{
+				std::lock_guard<std::mutex> lock(mutex());
+				entry->object  = shared;
+				entry->pending = std::shared_future<std::shared_ptr<const T>>();
+			}
+			promise.set_value(shared);
+			return shared;
+		}
+		catch (...)
+		{
+			// the waiting threads get the exception, the next request will try to build the object again
+			{
+				std::lock_guard<std::mutex> lock(mutex());
+				entry->pending = std::shared_future<std::shared_ptr<const T>>();
+			}
+			promise.set_exception(std::current_exception());
+			throw;
+		}
+	}
+
+private:
+	struct Entry
+	{
+		std::weak_ptr<const T>                       object;  // the object, if it is in use
+		std::shared_future<std::shared_ptr<const T>> pending; // valid while the object is being built
+	};
+
+	static std::mutex& mutex()
+	{
+		static std::mutex mtx;
+		return mtx;
+	}
+
+	static std::map<std::string, Entry>& entries()
+	{
+		static std::map<std::string, Entry> ent;
+		return ent;
+	}
+};
+
+}
+}
+
+#endif /* CONSTRUCTION_CACHE_HPP_ */
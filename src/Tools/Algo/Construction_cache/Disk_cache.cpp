@@ -0,0 +1,385 @@
+#if defined(__linux__) || defined(__linux) || defined(linux) || defined(__FreeBSD__) || defined(__APPLE__) || defined(__MACH__)
+#define AFF3CT_MMAP_SUPPORT
+#include <sys/mman.h>
+#include <fcntl.h>
+#endif
+
+#ifdef _MSC_VER
+#include <direct.h>
+#include <process.h>
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Display/rang_format/rang_format.h"
+#include "Tools/version.h"
+
+#include "Disk_cache.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+constexpr uint32_t Disk_cache::version;
+
+namespace
+{
+// read-only view of an entry file: memory-mapped when the system supports it
+class Entry_file
+{
+private:
+	size_t            size;
+	void*             mapping;
+	std::vector<char> buffer;
+	const char*       data;
+
+public:
+	explicit Entry_file(const std::string &path)
+	: size(0), mapping(nullptr), buffer(), data(nullptr)
+	{
+#ifdef AFF3CT_MMAP_SUPPORT
+		const int fd = ::open(path.c_str(), O_RDONLY);
+		if (fd < 0)
+			return;
+
+		struct stat st;
+		if (fstat(fd, &st) == 0 && st.st_size > 0)
+		{
+			this->mapping = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (this->mapping == MAP_FAILED)
+				this->mapping = nullptr;
+			else
+			{
+				this->size = (size_t)st.st_size;
+				this->data = static_cast<const char*>(this->mapping);
+			}
+		}
+		::close(fd);
+#else
+		std::ifstream file(path.c_str(), std::ios::in | std::ios::binary | std::ios::ate);
+		if (!file.is_open())
+			return;
+
+		this->buffer.resize((size_t)file.tellg());
+		file.seekg(0, std::ios::beg);
+		file.read(this->buffer.data(), this->buffer.size());
+		if (!file.good())
+			return;
+
+		this->size = this->buffer.size();
+		this->data = this->buffer.data();
+#endif
+	}
+
+	~Entry_file()
+	{
+#ifdef AFF3CT_MMAP_SUPPORT
+		if (this->mapping != nullptr)
+			munmap(this->mapping, this->size);
+#endif
+	}
+
+	inline bool        is_open () const { return this->data != nullptr; }
+	inline size_t      get_size() const { return this->size;            }
+	inline const char* get_data() const { return this->data;            }
+};
+
+bool make_directory(const std::string &path)
+{
+#ifdef _MSC_VER // Windows with MSVC
+	return _mkdir(path.c_str()) == 0 || errno == EEXIST;
+#elif defined(_WIN32) // MinGW on Windows
+	return mkdir(path.c_str()) == 0 || errno == EEXIST;
+#else // UNIX like
+	return mkdir(path.c_str(), S_IRWXU | S_IRGRP | S_IXGRP | S_IROTH | S_IXOTH) == 0 || errno == EEXIST;
+#endif
+}
+
+int process_id()
+{
+#ifdef _MSC_VER
+	return _getpid();
+#else
+	return (int)getpid();
+#endif
+}
+}
+
+// ============================================================================================================ Writer
+
+void Disk_cache::Writer
+::write_raw(const void *data, const size_t size)
+{
+	this->buffer.append(static_cast<const char*>(data), size);
+}
+
+void Disk_cache::Writer
+::write(const std::vector<bool> &values)
+{
+	std::vector<uint8_t> bytes((values.size() + 7) / 8, 0);
+	for (size_t i = 0; i < values.size(); i++)
+		if (values[i])
+			bytes[i / 8] |= (uint8_t)(1 << (i % 8));
+
+	this->write((uint64_t)values.size());
+	this->write_raw(bytes.data(), bytes.size());
+}
+
+void Disk_cache::Writer
+::write(const tools::Sparse_matrix &matrix)
+{
+	// both adjacency lists are stored: the order of the connections matters for the decoders
+	this->write((uint64_t)matrix.get_n_rows());
+	this->write((uint64_t)matrix.get_n_cols());
+	for (auto &cols : matrix.get_row_to_cols())
+		this->write(cols);
+	for (auto &rows : matrix.get_col_to_rows())
+		this->write(rows);
+}
+
+// ============================================================================================================ Reader
+
+Disk_cache::Reader
+::Reader(const char *data, const size_t size)
+: cur(data), end(data + size)
+{
+}
+
+void Disk_cache::Reader
+::read_raw(void *data, const size_t size)
+{
+	if ((size_t)(this->end - this->cur) < size)
+		throw runtime_error(__FILE__, __LINE__, __func__, "The payload is truncated.");
+
+	if (size)
+		std::memcpy(data, this->cur, size);
+	this->cur += size;
+}
+
+size_t Disk_cache::Reader
+::read_size(const size_t elmt_size)
+{
+	uint64_t n = 0;
+	this->read(n);
+
+	// a corrupted size can not be bigger than the remaining payload
+	if (elmt_size && n > (uint64_t)(this->end - this->cur) / elmt_size)
+		throw runtime_error(__FILE__, __LINE__, __func__, "The payload is truncated.");
+
+	return (size_t)n;
+}
+
+void Disk_cache::Reader
+::read(std::vector<bool> &values)
+{
+	uint64_t n = 0;
+	this->read(n);
+
+	if ((n + 7) / 8 > (uint64_t)(this->end - this->cur))
+		throw runtime_error(__FILE__, __LINE__, __func__, "The payload is truncated.");
+
+	values.resize((size_t)n);
+	for (size_t i = 0; i < values.size(); i++)
+		values[i] = ((uint8_t)this->cur[i / 8] >> (i % 8)) & 1;
+	this->cur += (n + 7) / 8;
+}
+
+void Disk_cache::Reader
+::read(tools::Sparse_matrix &matrix)
+{
+	uint64_t n_rows = 0, n_cols = 0;
+	this->read(n_rows);
+	this->read(n_cols);
+
+	if (n_rows == 0 || n_cols == 0) // an unused matrix
+	{
+		matrix = tools::Sparse_matrix((size_t)n_rows, (size_t)n_cols);
+		return;
+	}
+
+	// each list takes at least 8 bytes (its size)
+	if (n_rows + n_cols > (uint64_t)(this->end - this->cur) / sizeof(uint64_t))
+		throw runtime_error(__FILE__, __LINE__, __func__, "The payload is truncated.");
+
+	std::vector<std::vector<tools::Sparse_matrix::Idx_t>> row_to_cols((size_t)n_rows), col_to_rows((size_t)n_cols);
+	for (auto &cols : row_to_cols)
+		this->read(cols);
+	for (auto &rows : col_to_rows)
+		this->read(rows);
+
+	matrix = tools::Sparse_matrix::from_adjacency(std::move(row_to_cols), std::move(col_to_rows));
+}
+
+// ======================================================================================================== Disk_cache
+
+std::string& Disk_cache
+::directory()
+{
+	static std::string dir;
+	return dir;
+}
+
+void Disk_cache
+::set_directory(const std::string &path)
+{
+	auto dir = path;
+	while (dir.size() > 1 && (dir.back() == '/' || dir.back() == '\\'))
+		dir.pop_back();
+
+	if (!dir.empty())
+	{
+		// create the parent directories too
+		for (size_t pos = dir.find_first_of("/\\", 1); pos != std::string::npos; pos = dir.find_first_of("/\\", pos +1))
+			make_directory(dir.substr(0, pos));
+
+		if (!make_directory(dir))
+		{
+			std::stringstream message;
+			message << "The cache directory can't be created ('path' = \"" << path << "\").";
+			throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	Disk_cache::directory() = dir;
+}
+
+std::string Disk_cache
+::get_directory()
+{
+	return Disk_cache::directory();
+}
+
+bool Disk_cache
+::is_enabled()
+{
+	return !Disk_cache::directory().empty();
+}
+
+uint64_t Disk_cache
+::hash(const void *data, const size_t size, uint64_t h)
+{
+	const auto bytes = static_cast<const uint8_t*>(data);
+	for (size_t i = 0; i < size; i++)
+	{
+		h ^= (uint64_t)bytes[i];
+		h *= 0x100000001b3ULL;
+	}
+
+	return h;
+}
+
+uint64_t Disk_cache
+::hash_file(const std::string &path)
+{
+	if (path.empty())
+		return 0;
+
+	Entry_file file(path);
+	if (!file.is_open())
+		return 0;
+
+	const uint64_t size = (uint64_t)file.get_size();
+	return Disk_cache::hash(file.get_data(), file.get_size(), Disk_cache::hash(&size, sizeof(size)));
+}
+
+std::string Disk_cache
+::full_key(const std::string &key)
+{
+	std::stringstream fkey;
+	fkey << key << ";aff3ct=" << aff3ct::version() << ";cache=" << Disk_cache::version;
+	return fkey.str();
+}
+
+std::string Disk_cache
+::entry_path(const std::string &kind, const std::string &full_key)
+{
+	std::stringstream path;
+	path << Disk_cache::directory() << "/" << kind << "_" << std::hex << std::setw(16) << std::setfill('0')
+	     << Disk_cache::hash(full_key.data(), full_key.size()) << ".bin";
+	return path.str();
+}
+
+bool Disk_cache
+::load_entry(const std::string &kind, const std::string &key, const std::function<void(Reader&)> &load)
+{
+	const auto path = Disk_cache::entry_path(kind, key);
+
+	Entry_file file(path);
+	if (!file.is_open())
+		return false; // not in the cache
+
+	Header h;
+	const auto valid_header = file.get_size() >= sizeof(Header) &&
+	                          (std::memcpy(&h, file.get_data(), sizeof(Header)),
+	                           std::memcmp(h.magic, "AFF3CTCA", sizeof(h.magic)) == 0) &&
+	                          h.version == Disk_cache::version &&
+	                          (uint64_t)file.get_size() == sizeof(Header) + (uint64_t)h.key_size + h.payload_size;
+
+	if (valid_header)
+	{
+		const auto stored_key = file.get_data() + sizeof(Header);
+		if (h.key_size != key.size() || std::memcmp(stored_key, key.data(), key.size()) != 0)
+			return false; // an other object with the same key hash, it will be replaced
+
+		const auto payload = stored_key + h.key_size;
+		if (Disk_cache::hash(payload, (size_t)h.payload_size) == h.payload_hash)
+		{
+			try
+			{
+				Reader reader(payload, (size_t)h.payload_size);
+				load(reader);
+				return true;
+			}
+			catch (std::exception const&)
+			{
+			}
+		}
+	}
+
+	std::clog << rang::tag::warning << "The '" << path << "' cache entry is corrupted, it is rebuilt." << std::endl;
+	return false;
+}
+
+void Disk_cache
+::store_entry(const std::string &kind, const std::string &key, const Writer &writer)
+{
+	const auto path    = Disk_cache::entry_path(kind, key);
+	const auto tmp     = path + ".tmp" + std::to_string(process_id());
+	const auto &payload = writer.get_buffer();
+
+	Header h;
+	std::memcpy(h.magic, "AFF3CTCA", sizeof(h.magic));
+	h.version      = Disk_cache::version;
+	h.key_size     = (uint32_t)key.size();
+	h.payload_size = (uint64_t)payload.size();
+	h.payload_hash = Disk_cache::hash(payload.data(), payload.size());
+
+	bool success;
+	{
+		std::ofstream file(tmp.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+		file.write(reinterpret_cast<const char*>(&h), sizeof(Header));
+		file.write(key.data(), key.size());
+		file.write(payload.data(), payload.size());
+		success = file.good();
+	}
+
+	// the complete entry replaces the previous one in one step: the concurrent runs read the old one or the new one
+#ifdef _WIN32
+	if (success)
+		std::remove(path.c_str());
+#endif
+	if (!success || std::rename(tmp.c_str(), path.c_str()) != 0)
+	{
+		std::remove(tmp.c_str());
+		std::clog << rang::tag::warning << "The '" << path << "' cache entry can't be written." << std::endl;
+	}
+}
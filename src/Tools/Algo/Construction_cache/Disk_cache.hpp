@@ -0,0 +1,162 @@
+#ifndef DISK_CACHE_HPP_
+#define DISK_CACHE_HPP_
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <type_traits>
+
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+
+/*!
+ * \class Disk_cache
+ *
+ * \brief Opt-in persistent cache of the derived code constructions (generator matrices, parity matrices, frozen
+ *        bits...) shared between the runs.
+ *
+ * The Construction_cache shares an object between the threads of a process, the Disk_cache shares it between the
+ * processes: when a directory is set, the object built by the first run is serialized in a compact binary file and
+ * the next runs only have to map this file in memory and read it back.
+ *
+ * An entry is identified by a kind (the type of object) and a key. The key has to contain all the parameters used to
+ * build the object and the hash of the content of the input files (see 'hash_file'), the AFF3CT version and the cache
+ * format version are added to it: a modified input file or a new version gives a new entry. The key is also stored
+ * in the entry and compared at load time (no false hit on a hash collision).
+ *
+ * Entry layout (little-endian, in '<directory>/<kind>_<hash of the key>.bin'):
+ *   - a 32-byte header (see Disk_cache::Header),
+ *   - the key ('key_size' bytes),
+ *   - the payload ('payload_size' bytes) written by a Disk_cache::Writer.
+ *
+ * A truncated, corrupted (wrong payload hash) or unreadable entry is ignored: the object is built again and the entry
+ * is overwritten. The entries are written in a temporary file and then renamed so the concurrent runs (or MPI ranks)
+ * never read a partial entry.
+ */
+class Disk_cache
+{
+public:
+	static constexpr uint32_t version = 1;
+
+	struct Header
+	{
+		char     magic[8];     // "AFF3CTCA"
+		uint32_t version;
+		uint32_t key_size;
+		uint64_t payload_size;
+		uint64_t payload_hash;
+	};
+
+	/*!
+	 * \class Writer
+	 *
+	 * \brief Serializes the objects in a binary buffer.
+	 */
+	class Writer
+	{
+	private:
+		std::string buffer;
+
+	public:
+		template <typename T>
+		void write(const T &value);
+
+		template <typename T>
+		void write(const std::vector<T> &values);
+
+		void write(const std::vector<bool>   &values);
+		void write(const tools::Sparse_matrix &matrix);
+
+		inline const std::string& get_buffer() const { return buffer; }
+
+	private:
+		void write_raw(const void *data, const size_t size);
+	};
+
+	/*!
+	 * \class Reader
+	 *
+	 * \brief Deserializes the objects written by a Disk_cache::Writer, throws a tools::runtime_error if the buffer is
+	 *        too short or if the read data are not consistent.
+	 */
+	class Reader
+	{
+	private:
+		const char* cur;
+		const char* end;
+
+	public:
+		Reader(const char *data, const size_t size);
+
+		template <typename T>
+		void read(T &value);
+
+		template <typename T>
+		void read(std::vector<T> &values);
+
+		void read(std::vector<bool>   &values);
+		void read(tools::Sparse_matrix &matrix);
+
+		inline bool is_end() const { return cur == end; }
+
+	private:
+		void read_raw(void *data, const size_t size);
+		size_t read_size(const size_t elmt_size);
+	};
+
+	/*!
+	 * \brief Set the cache directory (created if needed), an empty path disables the cache (the default).
+	 */
+	static void set_directory(const std::string &path);
+
+	static std::string get_directory();
+
+	static bool is_enabled();
+
+	/*!
+	 * \brief 64-bit FNV-1a hash of a buffer, 'h' allows to chain the calls.
+	 */
+	static uint64_t hash(const void *data, const size_t size, uint64_t h = 0xcbf29ce484222325ULL);
+
+	/*!
+	 * \brief Hash of the content of a file (and of its size), 0 if the path is empty or if the file can't be read.
+	 */
+	static uint64_t hash_file(const std::string &path);
+
+	/*!
+	 * \brief Return the object of the given kind and key: load it from the cache directory if there is a valid entry,
+	 *        else build it (and store it if the cache is enabled).
+	 *
+	 * \param kind:  type of the object (prefix of the entry file name).
+	 * \param key:   identifies the object (see the class description).
+	 * \param build: callable returning a pointer on a new object.
+	 * \param save:  callable 'void(Writer&, const T&)' serializing the object.
+	 * \param load:  callable 'void(Reader&, T&)' deserializing the object.
+	 * \return a new object (the caller takes the ownership).
+	 */
+	template <class T, class F, class S, class L>
+	static T* get(const std::string &kind, const std::string &key, F &&build, S &&save, L &&load);
+
+private:
+	static std::string& directory();
+
+	static std::string full_key  (const std::string &key);
+	static std::string entry_path(const std::string &kind, const std::string &full_key);
+
+	static bool load_entry (const std::string &kind, const std::string &key,
+	                        const std::function<void(Reader&)> &load);
+	static void store_entry(const std::string &kind, const std::string &key, const Writer &writer);
+};
+}
+}
+
+#include "Disk_cache.hxx"
+
+#endif /* DISK_CACHE_HPP_ */
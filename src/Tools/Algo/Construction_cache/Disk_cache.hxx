@@ -0,0 +1,83 @@
+#include <memory>
+#include <type_traits>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Disk_cache.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+template <typename T>
+void Disk_cache::Writer
+::write(const T &value)
+{
+	static_assert(std::is_trivially_copyable<T>::value, "'T' has to be trivially copyable.");
+
+	this->write_raw(&value, sizeof(T));
+}
+
+template <typename T>
+void Disk_cache::Writer
+::write(const std::vector<T> &values)
+{
+	static_assert(std::is_trivially_copyable<T>::value, "'T' has to be trivially copyable.");
+
+	this->write((uint64_t)values.size());
+	this->write_raw(values.data(), values.size() * sizeof(T));
+}
+
+template <typename T>
+void Disk_cache::Reader
+::read(T &value)
+{
+	static_assert(std::is_trivially_copyable<T>::value, "'T' has to be trivially copyable.");
+
+	this->read_raw(&value, sizeof(T));
+}
+
+template <typename T>
+void Disk_cache::Reader
+::read(std::vector<T> &values)
+{
+	static_assert(std::is_trivially_copyable<T>::value, "'T' has to be trivially copyable.");
+
+	values.resize(this->read_size(sizeof(T)));
+	this->read_raw(values.data(), values.size() * sizeof(T));
+}
+
+template <class T, class F, class S, class L>
+T* Disk_cache
+::get(const std::string &kind, const std::string &key, F &&build, S &&save, L &&load)
+{
+	if (!Disk_cache::is_enabled())
+		return build();
+
+	const auto fkey = Disk_cache::full_key(key);
+
+	std::unique_ptr<T> obj;
+	const auto loaded = Disk_cache::load_entry(kind, fkey, [&](Reader &reader)
+	{
+		std::unique_ptr<T> o(new T());
+		load(reader, *o);
+
+		if (!reader.is_end())
+			throw runtime_error(__FILE__, __LINE__, __func__, "The payload has not been entirely read.");
+
+		obj = std::move(o);
+	});
+
+	if (loaded)
+		return obj.release();
+
+	obj.reset(build());
+
+	Writer writer;
+	save(writer, *obj);
+	Disk_cache::store_entry(kind, fkey, writer);
+
+	return obj.release();
+}
+}
+}
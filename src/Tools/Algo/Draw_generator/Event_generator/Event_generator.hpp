@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "Tools/types.h"
+#include "Tools/Exception/exception.hpp"
 #include "../Draw_generator.hpp"
 
 namespace aff3ct
@@ -27,6 +28,23 @@ public:
 	}
 
 	virtual void generate(E *draw, const unsigned length, const R event_probability) = 0;
+
+	/*!
+	 * \brief Return true if the generator can directly give the positions of the events (see 'generate_positions').
+	 */
+	virtual bool is_sparse() const
+	{
+		return false;
+	}
+
+	/*!
+	 * \brief Generate the positions (in ascending order) of the events in a sequence of 'length' elements.
+	 */
+	virtual void generate_positions(std::vector<unsigned> &positions, const unsigned length,
+	                                const R event_probability)
+	{
+		throw runtime_error(__FILE__, __LINE__, __func__, "This event generator does not support the sparse mode.");
+	}
 };
 
 }
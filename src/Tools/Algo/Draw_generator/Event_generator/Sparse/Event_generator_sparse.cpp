@@ -0,0 +1,81 @@
+#include <cmath>
+#include <algorithm>
+
+#include "Event_generator_sparse.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+template <typename R, typename E>
+Event_generator_sparse<R,E>
+::Event_generator_sparse(const int seed)
+: Event_generator<R,E>()
+{
+	this->set_seed(seed);
+}
+
+template <typename R, typename E>
+void Event_generator_sparse<R,E>
+::set_seed(const int seed)
+{
+	mt19937.seed(seed);
+}
+
+template <typename R, typename E>
+bool Event_generator_sparse<R,E>
+::is_sparse() const
+{
+	return true;
+}
+
+template <typename R, typename E>
+void Event_generator_sparse<R,E>
+::generate(E *draw, const unsigned length, const R event_probability)
+{
+	std::vector<unsigned> positions;
+	this->generate_positions(positions, length, event_probability);
+
+	std::fill(draw, draw + length, (E)false);
+	for (auto p : positions)
+		draw[p] = (E)true;
+}
+
+template <typename R, typename E>
+void Event_generator_sparse<R,E>
+::generate_positions(std::vector<unsigned> &positions, const unsigned length, const R event_probability)
+{
+	positions.clear();
+
+	if (event_probability <= (R)0.)
+		return;
+
+	if (event_probability >= (R)1.)
+	{
+		positions.resize(length);
+		for (unsigned i = 0; i < length; i++)
+			positions[i] = i;
+		return;
+	}
+
+	// the number of non-events before an event follows a geometric distribution: floor(log(U) / log(1 - p))
+	const auto inv_log_q = 1. / std::log1p(-(double)event_probability);
+
+	auto pos = -1.;
+	while (true)
+	{
+		pos += 1. + std::floor(std::log(mt19937.randd_oo()) * inv_log_q);
+		if (pos >= (double)length)
+			break;
+		positions.push_back((unsigned)pos);
+	}
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::tools::Event_generator_sparse<R_32>;
+template class aff3ct::tools::Event_generator_sparse<R_64>;
+#else
+template class aff3ct::tools::Event_generator_sparse<R>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,43 @@
+#ifndef EVENT_GENERATOR_SPARSE_HPP
+#define EVENT_GENERATOR_SPARSE_HPP
+
+#include "Tools/Algo/PRNG/PRNG_MT19937.hpp"
+
+#include "../Event_generator.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+
+/*!
+ * \class Event_generator_sparse
+ *
+ * \brief Draws the gaps between two consecutive events from a geometric distribution instead of drawing one value
+ *        per element: the cost is proportional to the number of events (efficient for low event probabilities).
+ */
+template <typename R = float, typename E = typename tools::matching_types<R>::B>
+class Event_generator_sparse : public Event_generator<R,E>
+{
+private:
+	tools::PRNG_MT19937 mt19937; // Mersenne Twister 19937 (scalar)
+
+public:
+	explicit Event_generator_sparse(const int seed = 0);
+
+	virtual ~Event_generator_sparse() = default;
+
+	virtual void set_seed(const int seed);
+
+	virtual bool is_sparse() const;
+
+	virtual void generate(E *draw, const unsigned length, const R event_probability);
+
+	virtual void generate_positions(std::vector<unsigned> &positions, const unsigned length,
+	                                const R event_probability);
+};
+
+}
+}
+
+#endif //EVENT_GENERATOR_SPARSE_HPP
@@ -0,0 +1,197 @@
+#if defined(__linux__) || defined(__linux) || defined(linux) || defined(__FreeBSD__) || defined(__APPLE__) || defined(__MACH__)
+#define AFF3CT_MMAP_SUPPORT
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <fstream>
+#include <cstring>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Mapped_trace.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+constexpr uint32_t Mapped_trace::version;
+constexpr size_t   Mapped_trace::header_size;
+
+Mapped_trace
+::Mapped_trace(const std::string &filename)
+: filename(filename), header(), file_size(0), mapping(nullptr), buffer(), data(nullptr)
+{
+	if (filename.empty())
+		throw invalid_argument(__FILE__, __LINE__, __func__, "'filename' should not be empty.");
+
+#ifdef AFF3CT_MMAP_SUPPORT
+	const int fd = ::open(filename.c_str(), O_RDONLY);
+	if (fd < 0)
+		throw invalid_argument(__FILE__, __LINE__, __func__, "Can't open '" + filename + "' file.");
+
+	struct stat st;
+	if (fstat(fd, &st) != 0)
+	{
+		::close(fd);
+		throw runtime_error(__FILE__, __LINE__, __func__, "Can't stat the '" + filename + "' file.");
+	}
+	this->file_size = (size_t)st.st_size;
+
+	if (this->file_size < header_size)
+	{
+		::close(fd);
+		throw runtime_error(__FILE__, __LINE__, __func__, "The '" + filename + "' file is too small to be a trace.");
+	}
+
+	// a shared read-only mapping: the physical pages come from the page cache and are shared between threads and
+	// between processes of the same node
+	this->mapping = mmap(nullptr, this->file_size, PROT_READ, MAP_SHARED, fd, 0);
+	::close(fd);
+
+	if (this->mapping == MAP_FAILED)
+	{
+		this->mapping = nullptr;
+		throw runtime_error(__FILE__, __LINE__, __func__, "Can't map the '" + filename + "' file in memory.");
+	}
+
+	const char* raw = static_cast<const char*>(this->mapping);
+#else
+	std::ifstream file(filename.c_str(), std::ios::in | std::ios::binary | std::ios::ate);
+	if (!file.is_open())
+		throw invalid_argument(__FILE__, __LINE__, __func__, "Can't open '" + filename + "' file.");
+
+	this->file_size = (size_t)file.tellg();
+	if (this->file_size < header_size)
+		throw runtime_error(__FILE__, __LINE__, __func__, "The '" + filename + "' file is too small to be a trace.");
+
+	this->buffer.resize(this->file_size);
+	file.seekg(0, std::ios::beg);
+	file.read(this->buffer.data(), this->file_size);
+
+	const char* raw = this->buffer.data();
+#endif
+
+	std::memcpy(&this->header, raw, sizeof(Header));
+
+	try
+	{
+		Mapped_trace::check_header(this->header, this->file_size, filename);
+	}
+	catch (...)
+	{
+#ifdef AFF3CT_MMAP_SUPPORT
+		munmap(this->mapping, this->file_size);
+		this->mapping = nullptr;
+#endif
+		throw;
+	}
+
+	this->data = raw + this->header.data_offset;
+
+#if defined(AFF3CT_MMAP_SUPPORT) && defined(MADV_WILLNEED)
+	madvise(this->mapping, this->file_size, MADV_WILLNEED);
+#endif
+}
+
+Mapped_trace
+::~Mapped_trace()
+{
+#ifdef AFF3CT_MMAP_SUPPORT
+	if (this->mapping != nullptr)
+		munmap(this->mapping, this->file_size);
+#endif
+}
+
+std::shared_ptr<const Mapped_trace> Mapped_trace
+::open(const std::string &filename)
+{
+	// the traces are shared as long as at least one module uses them
+	static std::mutex mtx;
+	static std::map<std::string, std::weak_ptr<const Mapped_trace>> opened;
+
+	std::lock_guard<std::mutex> lock(mtx);
+
+	auto shared = opened[filename].lock();
+	if (shared == nullptr)
+	{
+		shared = std::shared_ptr<const Mapped_trace>(new Mapped_trace(filename));
+		opened[filename] = shared;
+	}
+
+	return shared;
+}
+
+bool Mapped_trace
+::is_trace(const std::string &filename)
+{
+	std::ifstream file(filename.c_str(), std::ios::in | std::ios::binary);
+	if (!file.is_open())
+		return false;
+
+	Header h;
+	file.read(reinterpret_cast<char*>(&h), sizeof(Header));
+	if (file.gcount() != (std::streamsize)sizeof(Header))
+		return false;
+
+	return std::memcmp(h.magic, "AFF3CTTR", sizeof(h.magic)) == 0;
+}
+
+size_t Mapped_trace
+::sizeof_data_type(const Data_type t)
+{
+	switch (t)
+	{
+		case Data_type::INT8:    return sizeof(int8_t);
+		case Data_type::FLOAT32: return sizeof(float);
+		case Data_type::FLOAT64: return sizeof(double);
+	}
+
+	return 0;
+}
+
+void Mapped_trace
+::check_header(const Header &h, const size_t file_size, const std::string &filename)
+{
+	if (std::memcmp(h.magic, "AFF3CTTR", sizeof(h.magic)) != 0)
+		throw runtime_error(__FILE__, __LINE__, __func__, "The '" + filename + "' file is not an AFF3CT trace "
+		                                                  "(use 'scripts/convert_trace.py' to convert it).");
+
+	if (h.version != Mapped_trace::version)
+	{
+		std::stringstream message;
+		message << "Unsupported trace version in '" << filename << "' ('h.version' = " << h.version
+		        << ", supported version = " << Mapped_trace::version << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (h.data_type > (uint32_t)Data_type::FLOAT64)
+	{
+		std::stringstream message;
+		message << "Unknown data type in '" << filename << "' ('h.data_type' = " << h.data_type << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (h.n_frames == 0 || h.frame_size == 0)
+	{
+		std::stringstream message;
+		message << "'n_frames' and 'frame_size' have to be bigger than 0 ('n_frames' = " << h.n_frames
+		        << ", 'frame_size' = " << h.frame_size << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const auto elmt_size = sizeof_data_type((Data_type)h.data_type);
+	if (h.data_offset < header_size || h.data_offset % elmt_size ||
+	    h.data_offset + h.n_frames * h.frame_size * elmt_size > file_size)
+	{
+		std::stringstream message;
+		message << "The '" << filename << "' file is truncated or corrupted ('data_offset' = " << h.data_offset
+		        << ", 'n_frames' = " << h.n_frames << ", 'frame_size' = " << h.frame_size
+		        << ", 'file_size' = " << file_size << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+}
@@ -0,0 +1,129 @@
+#ifndef MAPPED_TRACE_HPP_
+#define MAPPED_TRACE_HPP_
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+
+namespace aff3ct
+{
+namespace tools
+{
+
+/*!
+ * \class Mapped_trace
+ *
+ * \brief Read-only binary trace file (source bits, noise frames, fading gains...) mapped in memory.
+ *
+ * A trace file is opened (and memory-mapped) only once per process and the same immutable object is shared by all the
+ * modules (and so all the threads) that use it. As the mapping is read-only and backed by the file, the physical
+ * pages are also shared between the processes (MPI ranks) running on the same node. Each user of the trace keeps its
+ * own cursor (frame index), the trace object itself has no mutable state (apart from the converted copies of the
+ * values, built once on demand by 'get_converted_data').
+ *
+ * File layout (little-endian):
+ *   - a 64-byte header (see Mapped_trace::Header),
+ *   - 'n_frames * frame_size' values of type 'data_type' starting at 'data_offset'.
+ *
+ * The 'scripts/convert_trace.py' script converts the legacy text/binary files into this format.
+ */
+class Mapped_trace
+{
+public:
+	enum class Data_type : uint32_t { INT8 = 0, FLOAT32 = 1, FLOAT64 = 2 };
+
+	static constexpr uint32_t version     = 1;
+	static constexpr size_t   header_size = 64;
+
+	struct Header
+	{
+		char     magic[8];    // "AFF3CTTR"
+		uint32_t version;
+		uint32_t data_type;   // a Data_type value
+		uint64_t n_frames;
+		uint64_t frame_size;
+		uint64_t data_offset; // in bytes from the beginning of the file, 'header_size' aligned
+	};
+
+private:
+	const std::string filename;
+	Header            header;
+	size_t            file_size;
+	void*             mapping;
+	std::vector<char> buffer;   // used only when memory-mapping is not supported by the system
+	const char*       data;
+
+	mutable std::vector<char> converted     [3]; // the values converted in each Data_type (if requested)
+	mutable std::once_flag    converted_once[3];
+
+public:
+	virtual ~Mapped_trace();
+
+	/*!
+	 * \brief Open a trace file, the trace is mapped only once per process and then shared.
+	 *
+	 * \param filename: path to the trace file.
+	 * \return a shared read-only trace.
+	 */
+	static std::shared_ptr<const Mapped_trace> open(const std::string &filename);
+
+	/*!
+	 * \brief Return true if the given file starts with a valid trace header (magic number and version).
+	 */
+	static bool is_trace(const std::string &filename);
+
+	/*!
+	 * \brief Write a trace file (mainly for the tests and the conversion tools).
+	 */
+	template <typename T>
+	static void write(const std::string &filename, const std::vector<std::vector<T>> &frames);
+
+	inline size_t    get_n_frames  () const { return (size_t)header.n_frames;     }
+	inline size_t    get_frame_size() const { return (size_t)header.frame_size;   }
+	inline size_t    get_size      () const { return get_n_frames() * get_frame_size(); }
+	inline Data_type get_data_type () const { return (Data_type)header.data_type; }
+	inline const std::string& get_filename() const { return filename; }
+
+	/*!
+	 * \brief Return a direct pointer on the mapped data if 'T' matches the stored data type, nullptr else.
+	 */
+	template <typename T>
+	inline const T* get_data() const;
+
+	/*!
+	 * \brief Same as 'get_data' but if 'T' does not match the stored data type, all the values are converted once (at
+	 *        the first call) and the converted copy is shared by all the users of the trace.
+	 */
+	template <typename T>
+	inline const T* get_converted_data() const;
+
+	/*!
+	 * \brief Copy (and convert) 'n_elmts' values starting at the flat index 'offset' into 'out'.
+	 */
+	template <typename T>
+	inline void read(const size_t offset, const size_t n_elmts, T *out) const;
+
+	/*!
+	 * \brief Copy (and convert) the frame number 'frame_idx' into 'out' ('out' has to be 'frame_size' long).
+	 */
+	template <typename T>
+	inline void read_frame(const size_t frame_idx, T *out) const;
+
+private:
+	explicit Mapped_trace(const std::string &filename);
+
+	static void check_header(const Header &header, const size_t file_size, const std::string &filename);
+	static size_t sizeof_data_type(const Data_type t);
+
+	template <typename T>
+	static Data_type get_data_type_of();
+};
+}
+}
+
+#include "Mapped_trace.hxx"
+
+#endif /* MAPPED_TRACE_HPP_ */
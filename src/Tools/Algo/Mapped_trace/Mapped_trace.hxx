@@ -0,0 +1,128 @@
+#include <sstream>
+#include <fstream>
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Mapped_trace.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+template <> inline Mapped_trace::Data_type Mapped_trace::get_data_type_of<int8_t>() { return Data_type::INT8;    }
+template <> inline Mapped_trace::Data_type Mapped_trace::get_data_type_of<float >() { return Data_type::FLOAT32; }
+template <> inline Mapped_trace::Data_type Mapped_trace::get_data_type_of<double>() { return Data_type::FLOAT64; }
+
+template <typename T>
+void Mapped_trace
+::write(const std::string &filename, const std::vector<std::vector<T>> &frames)
+{
+	const auto frame_size = frames.empty() ? (size_t)0 : frames[0].size();
+	for (auto &f : frames)
+		if (f.size() != frame_size)
+		{
+			std::stringstream message;
+			message << "All the frames should have the same size ('f.size()' = " << f.size()
+			        << ", 'frame_size' = " << frame_size << ").";
+			throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+	std::ofstream file(filename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+	if (!file.is_open())
+		throw invalid_argument(__FILE__, __LINE__, __func__, "Can't open '" + filename + "' file.");
+
+	Header h;
+	std::memcpy(h.magic, "AFF3CTTR", sizeof(h.magic));
+	h.version     = Mapped_trace::version;
+	h.data_type   = (uint32_t)get_data_type_of<T>();
+	h.n_frames    = (uint64_t)frames.size();
+	h.frame_size  = (uint64_t)frame_size;
+	h.data_offset = (uint64_t)header_size;
+
+	std::vector<char> raw_header(header_size, 0);
+	std::memcpy(raw_header.data(), &h, sizeof(Header));
+	file.write(raw_header.data(), raw_header.size());
+
+	for (auto &f : frames)
+		file.write(reinterpret_cast<const char*>(f.data()), f.size() * sizeof(T));
+
+	if (!file.good())
+		throw runtime_error(__FILE__, __LINE__, __func__, "Failed to write the '" + filename + "' file.");
+}
+
+template <typename T>
+const T* Mapped_trace
+::get_data() const
+{
+	const bool match = (std::is_same<T,int8_t>::value && this->get_data_type() == Data_type::INT8   ) ||
+	                   (std::is_same<T,float >::value && this->get_data_type() == Data_type::FLOAT32) ||
+	                   (std::is_same<T,double>::value && this->get_data_type() == Data_type::FLOAT64);
+
+	return match ? reinterpret_cast<const T*>(this->data) : nullptr;
+}
+
+template <typename T>
+const T* Mapped_trace
+::get_converted_data() const
+{
+	const auto direct = this->get_data<T>();
+	if (direct != nullptr)
+		return direct;
+
+	// the first caller converts the values for all the threads, the other ones wait for the conversion
+	const auto t = (size_t)get_data_type_of<T>();
+	std::call_once(this->converted_once[t], [this, t]()
+	{
+		this->converted[t].resize(this->get_size() * sizeof(T));
+		this->read(0, this->get_size(), reinterpret_cast<T*>(this->converted[t].data()));
+	});
+
+	return reinterpret_cast<const T*>(this->converted[t].data());
+}
+
+template <typename T>
+void Mapped_trace
+::read(const size_t offset, const size_t n_elmts, T *out) const
+{
+	if (offset + n_elmts > this->get_size())
+	{
+		std::stringstream message;
+		message << "'offset' + 'n_elmts' has to be smaller or equal to 'get_size()' ('offset' = " << offset
+		        << ", 'n_elmts' = " << n_elmts << ", 'get_size()' = " << this->get_size() << ").";
+		throw out_of_range(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	switch (this->get_data_type())
+	{
+		case Data_type::INT8:
+		{
+			auto in = reinterpret_cast<const int8_t*>(this->data) + offset;
+			std::transform(in, in + n_elmts, out, [](const int8_t v) { return (T)v; });
+			break;
+		}
+		case Data_type::FLOAT32:
+		{
+			auto in = reinterpret_cast<const float*>(this->data) + offset;
+			std::transform(in, in + n_elmts, out, [](const float v) { return (T)v; });
+			break;
+		}
+		case Data_type::FLOAT64:
+		{
+			auto in = reinterpret_cast<const double*>(this->data) + offset;
+			std::transform(in, in + n_elmts, out, [](const double v) { return (T)v; });
+			break;
+		}
+	}
+}
+
+template <typename T>
+void Mapped_trace
+::read_frame(const size_t frame_idx, T *out) const
+{
+	this->read(frame_idx * this->get_frame_size(), this->get_frame_size(), out);
+}
+}
+}
@@ -0,0 +1,558 @@
+#include <thread>
+#include <numeric>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Thread_pinning/Thread_pinning.hpp"
+
+#include "Bit_matrix.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+constexpr size_t Bit_matrix::word_size;
+
+Bit_matrix
+::Bit_matrix(const size_t n_rows, const size_t n_cols)
+: Matrix(n_rows, n_cols),
+  n_words((n_cols + word_size -1) / word_size),
+  data(n_rows * n_words, 0),
+  rows_degrees(n_rows, 0),
+  cols_degrees(n_cols, 0)
+{
+}
+
+Bit_matrix::word_t Bit_matrix
+::get_bits(const size_t row_index, const size_t col_index, const size_t n_bits) const
+{
+	if (col_index >= get_n_cols() || n_bits == 0)
+		return 0;
+
+	const auto row = (*this)[row_index];
+	const auto w   = col_index / word_size;
+	const auto o   = col_index % word_size;
+
+	auto bits = row[w] >> o;
+	if (o && w +1 < n_words)
+		bits |= row[w +1] << (word_size - o);
+
+	return (n_bits >= word_size) ? bits : bits & (((word_t)1 << n_bits) -1);
+}
+
+bool Bit_matrix
+::at(const size_t row_index, const size_t col_index) const
+{
+	check_indexes(row_index, col_index);
+
+	return this->get(row_index, col_index);
+}
+
+void Bit_matrix
+::add_connection(const size_t row_index, const size_t col_index)
+{
+	if (at(row_index, col_index))
+	{
+		std::stringstream message;
+		message << "('row_index';'col_index') connection already exists ('row_index' = " << row_index
+		        << ", 'col_index' = " << col_index << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	this->set(row_index, col_index);
+	rows_degrees[row_index]++;
+	cols_degrees[col_index]++;
+
+	this->rows_max_degree = std::max(get_rows_max_degree(), rows_degrees[row_index]);
+	this->cols_max_degree = std::max(get_cols_max_degree(), cols_degrees[col_index]);
+
+	this->n_connections++;
+}
+
+void Bit_matrix
+::rm_connection(const size_t row_index, const size_t col_index)
+{
+	if (!at(row_index, col_index))
+		return;
+
+	this->flip(row_index, col_index);
+
+	rows_degrees[row_index]--;
+	cols_degrees[col_index]--;
+	this->n_connections--;
+
+	if ((rows_degrees[row_index] + 1) == get_rows_max_degree())
+		rows_max_degree = *std::max_element(rows_degrees.begin(), rows_degrees.end());
+
+	if ((cols_degrees[col_index] + 1) == get_cols_max_degree())
+		cols_max_degree = *std::max_element(cols_degrees.begin(), cols_degrees.end());
+}
+
+void Bit_matrix
+::self_resize(const size_t n_rows, const size_t n_cols, Origin o)
+{
+	// offsets of the new matrix in the old one
+	const auto top   = (o == Origin::TOP_LEFT  || o == Origin::TOP_RIGHT   );
+	const auto left  = (o == Origin::TOP_LEFT  || o == Origin::BOTTOM_LEFT );
+	const auto d_row = top  ? (long long)0 : (long long)get_n_rows() - (long long)n_rows;
+	const auto d_col = left ? (long long)0 : (long long)get_n_cols() - (long long)n_cols;
+
+	Bit_matrix resized(n_rows, n_cols);
+	for (size_t r = 0; r < n_rows; r++)
+	{
+		const auto src = (long long)r + d_row;
+		if (src < 0 || src >= (long long)get_n_rows())
+			continue;
+
+		auto row = resized[r];
+		for (size_t w = 0; w < resized.n_words; w++)
+		{
+			const auto c = (long long)(w * word_size) + d_col;
+			if (c >= 0)
+				row[w] = this->get_bits((size_t)src, (size_t)c);
+			else if (c > -(long long)word_size)
+				row[w] = this->get_bits((size_t)src, 0, (size_t)((long long)word_size + c)) << (size_t)(-c);
+		}
+	}
+	resized.clear_padding();
+
+	this->n_words = resized.n_words;
+	this->data    = std::move(resized.data);
+
+	Matrix::self_resize(n_rows, n_cols);
+
+	rows_degrees.resize(n_rows);
+	cols_degrees.resize(n_cols);
+}
+
+Bit_matrix Bit_matrix
+::resize(const size_t n_rows, const size_t n_cols, Origin o) const
+{
+	Bit_matrix resized(*this);
+
+	resized.self_resize(n_rows, n_cols, o);
+
+	return resized;
+}
+
+void Bit_matrix
+::xor_rows(const size_t dst, const size_t src, const size_t col_index)
+{
+	auto       d = (*this)[dst];
+	const auto s = (*this)[src];
+
+	for (auto w = col_index / word_size; w < n_words; w++)
+		d[w] ^= s[w];
+}
+
+void Bit_matrix
+::swap_rows(const size_t row_index1, const size_t row_index2)
+{
+	if (row_index1 != row_index2)
+		std::swap_ranges((*this)[row_index1], (*this)[row_index1] + n_words, (*this)[row_index2]);
+}
+
+void Bit_matrix
+::swap_cols(const size_t col_index1, const size_t col_index2)
+{
+	if (col_index1 == col_index2)
+		return;
+
+	for (size_t r = 0; r < get_n_rows(); r++)
+		if (this->get(r, col_index1) != this->get(r, col_index2))
+		{
+			this->flip(r, col_index1);
+			this->flip(r, col_index2);
+		}
+}
+
+void Bit_matrix
+::erase_row(const size_t row_index, const size_t n_rows)
+{
+	data.erase(data.begin() + row_index * n_words, data.begin() + (row_index + n_rows) * n_words);
+	rows_degrees.erase(rows_degrees.begin() + row_index, rows_degrees.begin() + row_index + n_rows);
+
+	Matrix::self_resize(get_n_rows() - n_rows, get_n_cols());
+}
+
+size_t Bit_matrix
+::find_next(const size_t row_index, const size_t col_index) const
+{
+	if (col_index >= get_n_cols())
+		return get_n_cols();
+
+	const auto row = (*this)[row_index];
+
+	auto w = col_index / word_size;
+	auto x = row[w] & (~(word_t)0 << (col_index % word_size));
+	while (!x && ++w < n_words)
+		x = row[w];
+
+	return x ? w * word_size + ctz(x) : get_n_cols();
+}
+
+bool Bit_matrix
+::is_null_row(const size_t row_index) const
+{
+	const auto row = (*this)[row_index];
+	return std::all_of(row, row + n_words, [](const word_t x) { return x == 0; });
+}
+
+void Bit_matrix
+::parse_connections()
+{
+	std::fill(rows_degrees.begin(), rows_degrees.end(), 0);
+	std::fill(cols_degrees.begin(), cols_degrees.end(), 0);
+	this->n_connections = 0;
+
+	for (size_t r = 0; r < get_n_rows(); r++)
+	{
+		const auto row = (*this)[r];
+		for (size_t w = 0; w < n_words; w++)
+		{
+			rows_degrees[r] += popcount(row[w]);
+			for (auto x = row[w]; x; x &= x -1)
+				cols_degrees[w * word_size + ctz(x)]++;
+		}
+		this->n_connections += rows_degrees[r];
+	}
+
+	rows_max_degree = rows_degrees.empty() ? 0 : *std::max_element(rows_degrees.begin(), rows_degrees.end());
+	cols_max_degree = cols_degrees.empty() ? 0 : *std::max_element(cols_degrees.begin(), cols_degrees.end());
+}
+
+Bit_matrix Bit_matrix
+::transpose() const
+{
+	Bit_matrix trans(*this);
+
+	trans.self_transpose();
+
+	return trans;
+}
+
+void Bit_matrix
+::self_transpose()
+{
+	const auto n_rows = get_n_rows();
+	const auto n_cols = get_n_cols();
+
+	Bit_matrix trans(n_cols, n_rows);
+
+	// transpose the blocks of 64x64 bits
+	word_t block[word_size];
+	for (size_t r0 = 0; r0 < n_rows; r0 += word_size)
+	{
+		const auto n_r = std::min(word_size, n_rows - r0);
+		for (size_t w = 0; w < n_words; w++)
+		{
+			for (size_t i = 0; i < word_size; i++)
+				block[i] = (i < n_r) ? (*this)[r0 + i][w] : 0;
+
+			transpose64(block);
+
+			const auto n_c = std::min(word_size, n_cols - w * word_size);
+			for (size_t i = 0; i < n_c; i++)
+				trans[w * word_size + i][r0 / word_size] = block[i];
+		}
+	}
+
+	this->n_words = trans.n_words;
+	this->data    = std::move(trans.data);
+
+	Matrix::self_transpose(); // transpose the matrix size and degrees
+
+	std::swap(cols_degrees, rows_degrees);
+}
+
+Bit_matrix Bit_matrix
+::turn(Way w) const
+{
+	Bit_matrix turned(*this);
+
+	turned.self_turn(w);
+
+	return turned;
+}
+
+void Bit_matrix
+::sort_cols_per_density(Sort order)
+{
+	std::vector<size_t> cols(get_n_cols());
+	std::iota(cols.begin(), cols.end(), 0);
+
+	switch(order)
+	{
+		case Sort::ASCENDING:
+			std::stable_sort(cols.begin(), cols.end(),
+			                 [&](size_t c1, size_t c2) { return cols_degrees[c1] < cols_degrees[c2]; });
+		break;
+		case Sort::DESCENDING:
+			std::stable_sort(cols.begin(), cols.end(),
+			                 [&](size_t c1, size_t c2) { return cols_degrees[c1] > cols_degrees[c2]; });
+		break;
+	}
+
+	Bit_matrix sorted(get_n_rows(), get_n_cols());
+	for (size_t r = 0; r < get_n_rows(); r++)
+		for (size_t c = 0; c < get_n_cols(); c++)
+			if (this->get(r, cols[c]))
+				sorted.set(r, c);
+
+	std::vector<size_t> degrees(get_n_cols());
+	for (size_t c = 0; c < get_n_cols(); c++)
+		degrees[c] = cols_degrees[cols[c]];
+
+	this->data   = std::move(sorted.data);
+	cols_degrees = std::move(degrees);
+}
+
+void Bit_matrix
+::print(bool transpose, std::ostream& os) const
+{
+	if (transpose)
+	{
+		for (size_t c = 0; c < get_n_cols(); c++)
+		{
+			for (size_t r = 0; r < get_n_rows(); r++)
+				os << +this->get(r, c) << " ";
+			os << std::endl;
+		}
+	}
+	else
+	{
+		for (size_t r = 0; r < get_n_rows(); r++)
+		{
+			for (size_t c = 0; c < get_n_cols(); c++)
+				os << +this->get(r, c) << " ";
+			os << std::endl;
+		}
+	}
+}
+
+size_t Bit_matrix
+::gauss_jordan(const size_t max_col, std::vector<std::pair<size_t,size_t>>* swapped_cols, const int n_threads)
+{
+	constexpr size_t k = 8; // number of pivots per block
+
+	std::vector<word_t> table(((size_t)1 << k) * n_words);
+
+	size_t i = 0;
+	auto stop = false;
+	while (!stop && i < get_n_rows() && i < max_col)
+	{
+		// the pivots of the block are on the rows and the columns [c0, c0 + n_piv), they are kept reduced between
+		// them, the other rows are updated only at the end of the block
+		const auto c0 = i;
+		size_t n_piv = 0;
+
+		// the row 'r' is not yet updated with the block pivots: as they are reduced, its bits in the block give the
+		// coefficients of the pivots, 'col_mask' contains the bits of the pivots in the column 'i'
+		word_t col_mask = 0;
+		auto lazy_bit = [&](const size_t r)
+		{
+			return this->get(r, i) ^ (popcount(this->get_bits(r, c0, n_piv) & col_mask) & 1);
+		};
+
+		// eliminate the block pivots from the row 'r'
+		auto eliminate = [&](const size_t r)
+		{
+			const auto coefs = this->get_bits(r, c0, n_piv);
+			for (size_t p = 0; p < n_piv; p++)
+				if ((coefs >> p) & 1)
+					this->xor_rows(r, c0 + p, c0);
+		};
+
+		while (n_piv < k && i < get_n_rows() && i < max_col)
+		{
+			col_mask = 0;
+			for (size_t p = 0; p < n_piv; p++)
+				col_mask |= (word_t)this->get(c0 + p, i) << p;
+
+			auto piv = get_n_rows();
+			for (auto r = i; r < get_n_rows(); r++)
+				if (lazy_bit(r))
+				{
+					piv = r;
+					break;
+				}
+
+			if (piv != get_n_rows())
+			{
+				this->swap_rows(i, piv);
+				eliminate(i);
+			}
+			else if (swapped_cols != nullptr)
+			{
+				eliminate(i);
+
+				// find an other column which is good on the row i
+				const auto c = this->find_next(i, i +1);
+				if (c != get_n_cols())
+				{
+					swapped_cols->push_back(std::make_pair(i, c));
+					this->swap_cols(i, c);
+				}
+				else
+				{
+					// the row is the null vector then delete it
+					this->erase_row(i);
+					continue;
+				}
+			}
+			else
+			{
+				stop = true;
+				break;
+			}
+
+			// keep the block pivots reduced
+			for (size_t p = 0; p < n_piv; p++)
+				if (this->get(c0 + p, i))
+					this->xor_rows(c0 + p, i, c0);
+
+			n_piv++;
+			i++;
+		}
+
+		if (n_piv)
+			this->m4ri_update(c0, n_piv, table, n_threads);
+	}
+
+	return i;
+}
+
+void Bit_matrix
+::m4ri_update(const size_t c0, const size_t n_piv, std::vector<word_t>& table, const int n_threads)
+{
+	const auto w0     = c0 / word_size;
+	const auto stride = n_words - w0;
+
+	// all the combinations of the pivot rows in Gray-code order: only one XOR per combination
+	std::fill(table.begin(), table.begin() + stride, (word_t)0);
+	const size_t n_comb = (size_t)1 << n_piv;
+	for (size_t g = 1; g < n_comb; g++)
+	{
+		const auto prev = (g -1) ^ ((g -1) >> 1);
+		const auto curr =  g     ^ ( g     >> 1);
+		const auto p    = ctz((word_t)(prev ^ curr));
+
+		const auto src = table.data() + prev * stride;
+		const auto dst = table.data() + curr * stride;
+		const auto piv = (*this)[c0 + p] + w0;
+		for (size_t w = 0; w < stride; w++)
+			dst[w] = src[w] ^ piv[w];
+	}
+
+	auto update = [&](const size_t r_start, const size_t r_stop)
+	{
+		for (auto r = r_start; r < r_stop; r++)
+		{
+			if (r >= c0 && r < c0 + n_piv)
+				continue;
+
+			const auto idx = this->get_bits(r, c0, n_piv);
+			if (idx)
+			{
+				auto       row = (*this)[r] + w0;
+				const auto cmb = table.data() + idx * stride;
+				for (size_t w = 0; w < stride; w++)
+					row[w] ^= cmb[w];
+			}
+		}
+	};
+
+	// the threads are worth only if there are enough words to update
+	const auto n_rows = get_n_rows();
+	const auto n_thr  = (size_t)std::max(1, std::min(n_threads, (int)((n_rows * stride) >> 14)));
+	if (n_thr <= 1)
+		update(0, n_rows);
+	else
+	{
+		std::vector<std::thread> threads;
+		const auto chunk = (n_rows + n_thr -1) / n_thr;
+		for (size_t t = 1; t < n_thr; t++)
+			threads.push_back(std::thread([&update, n_rows, chunk, t]()
+			{
+				// the helper threads don't keep the CPU of a pinned creator
+				Thread_pinning::unpin();
+				update(std::min(n_rows, t * chunk), std::min(n_rows, (t +1) * chunk));
+			}));
+		update(0, std::min(n_rows, chunk));
+		for (auto &t : threads)
+			t.join();
+	}
+}
+
+void Bit_matrix
+::clear_padding()
+{
+	if (get_n_cols() % word_size == 0 || n_words == 0)
+		return;
+
+	const auto mask = ((word_t)1 << (get_n_cols() % word_size)) -1;
+	for (size_t r = 0; r < get_n_rows(); r++)
+		(*this)[r][n_words -1] &= mask;
+}
+
+void Bit_matrix
+::transpose64(word_t a[64])
+{
+	// recursive swap of the off-diagonal blocks (32x32, then 16x16, ..., then 1x1)
+	word_t m = 0x00000000FFFFFFFFULL;
+	for (size_t j = 32; j != 0; j >>= 1, m ^= (m << j))
+		for (size_t k = 0; k < 64; k = ((k | j) +1) & ~j)
+		{
+			const auto t = ((a[k] >> j) ^ a[k | j]) & m;
+			a[k    ] ^= t << j;
+			a[k | j] ^= t;
+		}
+}
+
+Bit_matrix Bit_matrix
+::identity(const size_t n_rows, const size_t n_cols)
+{
+	Bit_matrix mat(n_rows, n_cols);
+	auto shortest_side = std::min(n_rows, n_cols);
+
+	for (size_t i = 0; i < shortest_side; i++)
+		mat.add_connection(i,i);
+
+	return mat;
+}
+
+Bit_matrix Bit_matrix
+::zero(const size_t n_rows, const size_t n_cols)
+{
+	return Bit_matrix(n_rows, n_cols);
+}
+
+Bit_matrix Bit_matrix
+::from_sparse(const Sparse_matrix& sparse)
+{
+	Bit_matrix bits(sparse.get_n_rows(), sparse.get_n_cols());
+
+	for (size_t r = 0; r < sparse.get_n_rows(); r++)
+		for (auto c : sparse.get_cols_from_row(r))
+			bits.set(r, c);
+
+	bits.parse_connections();
+
+	return bits;
+}
+
+Sparse_matrix Bit_matrix
+::to_sparse() const
+{
+	auto sparse = Sparse_matrix::zero(get_n_rows(), get_n_cols());
+
+	for (size_t r = 0; r < get_n_rows(); r++)
+	{
+		const auto row = (*this)[r];
+		for (size_t w = 0; w < n_words; w++)
+			for (auto x = row[w]; x; x &= x -1)
+				sparse.add_connection(r, w * word_size + ctz(x));
+	}
+
+	return sparse;
+}
@@ -0,0 +1,241 @@
+#ifndef BIT_MATRIX_HPP_
+#define BIT_MATRIX_HPP_
+
+#include <vector>
+#include <string>
+#include <utility>
+#include <cstdint>
+#include <iostream>
+
+#include "../Matrix.hpp"
+#include "../Sparse_matrix/Sparse_matrix.hpp"
+#include "../Full_matrix/Full_matrix.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Dense binary matrix over GF(2): each row is packed in 64-bit words (the bit 'c % 64' of the word 'c / 64' is the
+ * column 'c'), the rows are stored contiguously. The row operations (XOR, swap) work on whole words.
+ *
+ * As for the Full_matrix, the degrees are only maintained by 'add_connection' and 'rm_connection': after any other
+ * modification call 'parse_connections()' if you need them.
+ */
+class Bit_matrix : public Matrix
+{
+public:
+	using word_t = uint64_t;
+	static constexpr size_t word_size = 64;
+
+	explicit Bit_matrix(const size_t n_rows = 0, const size_t n_cols = 1);
+
+	virtual ~Bit_matrix() = default;
+
+	inline size_t get_n_words() const
+	{
+		return this->n_words;
+	}
+
+	inline word_t* operator[](const size_t row_index)
+	{
+		return this->data.data() + row_index * this->n_words;
+	}
+
+	inline const word_t* operator[](const size_t row_index) const
+	{
+		return this->data.data() + row_index * this->n_words;
+	}
+
+	/*
+	 * Fast accessors without bound checks and without degree update
+	 */
+	inline bool get(const size_t row_index, const size_t col_index) const
+	{
+		return ((*this)[row_index][col_index / word_size] >> (col_index % word_size)) & (word_t)1;
+	}
+
+	inline void set(const size_t row_index, const size_t col_index)
+	{
+		(*this)[row_index][col_index / word_size] |= (word_t)1 << (col_index % word_size);
+	}
+
+	inline void flip(const size_t row_index, const size_t col_index)
+	{
+		(*this)[row_index][col_index / word_size] ^= (word_t)1 << (col_index % word_size);
+	}
+
+	/*
+	 * Return the 'n_bits' (<= 64) bits of the row starting at the column 'col_index' (the first one is the LSB)
+	 */
+	word_t get_bits(const size_t row_index, const size_t col_index, const size_t n_bits = word_size) const;
+
+	/*
+	 * return true if there is a connection there
+	 */
+	bool at(const size_t row_index, const size_t col_index) const;
+
+	/*
+	 * Add a connection and update the rows and cols degrees values
+	 */
+	void add_connection(const size_t row_index, const size_t col_index);
+
+	/*
+	 * Remove the connection and update the rows and cols degrees values
+	 */
+	void rm_connection(const size_t row_index, const size_t col_index);
+
+	/*
+	 * Resize the matrix to the new dimensions in function of the part of the matrix considered as the origin
+	 * Ex: if o == BOTTOM_RIGHT, and need to extend the matrix then add rows on the top and columns on the left
+	 */
+	void self_resize(const size_t n_rows, const size_t n_cols, Origin o);
+
+	/*
+	 * Resize the matrix by calling self_resize on a copy matrix
+	 */
+	Bit_matrix resize(const size_t n_rows, const size_t n_cols, Origin o) const;
+
+	/*
+	 * row 'dst' ^= row 'src', from the word including the column 'col_index'
+	 */
+	void xor_rows(const size_t dst, const size_t src, const size_t col_index = 0);
+
+	void swap_rows(const size_t row_index1, const size_t row_index2);
+	void swap_cols(const size_t col_index1, const size_t col_index2);
+
+	/*
+	 * Erase the 'n_rows' rows from the given index 'row_index'
+	 */
+	void erase_row(const size_t row_index, const size_t n_rows = 1);
+
+	/*
+	 * return the column of the first connection of the row from the column 'col_index', 'get_n_cols()' if none
+	 */
+	size_t find_next(const size_t row_index, const size_t col_index = 0) const;
+
+	/*
+	 * return true if the row does not contain any connection
+	 */
+	bool is_null_row(const size_t row_index) const;
+
+	/*
+	 * Compute the rows and cols degrees values when the matrix values have been modified
+	 * without the use of 'add_connection' and 'rm_connection' interface
+	 */
+	void parse_connections();
+
+	/*
+	 * Return the transposed matrix of this matrix (transposed by blocks of 64x64 bits)
+	 */
+	Bit_matrix transpose() const;
+
+	/*
+	 * Transpose internally this matrix
+	 */
+	void self_transpose();
+
+	/*
+	 * Return turn the matrix in horizontal or vertical way
+	 */
+	Bit_matrix turn(Way w) const;
+
+	/*
+	 * Sort the matrix columns per density in ascending or descending order
+	 * You need to call 'parse_connections()' before to assure good work.
+	 */
+	void sort_cols_per_density(Sort order);
+
+	/*
+	 * Print the matrix in its full view with 0s and 1s.
+	 * 'transpose' allow the print in its transposed view
+	 */
+	void print(bool transpose = false, std::ostream& os = std::cout) const;
+
+	/*
+	 * \brief Gauss-Jordan elimination with the Method of the Four Russians (M4RI).
+	 *
+	 * For each column 'i' (from 0), the pivot is the first row (from the row 'i') with a one in the column 'i', it is
+	 * moved on the row 'i' and the column 'i' is cleared in all the other rows. The pivots are processed by blocks of
+	 * 8 columns: the 256 combinations of the 8 pivot rows are precomputed (in Gray-code order) and each other row is
+	 * updated with only one XOR of a combination (selected by its 8 bits in the block). The rows updates can be
+	 * split between several threads.
+	 *
+	 * \param max_col:      the pivots are searched in the columns [0, max_col).
+	 * \param swapped_cols: if not null, when there is no pivot in the column 'i', the column 'i' is swapped with the
+	 *                      first column (after 'i') with a one in the row 'i' (the pair is recorded) and if the row
+	 *                      'i' is null, it is erased. If null, the elimination stops on the first column without
+	 *                      pivot.
+	 * \param n_threads:    number of threads used to update the rows.
+	 * \return the number of pivots (the 'n' first columns are then the identity on the 'n' first rows).
+	 */
+	size_t gauss_jordan(const size_t max_col, std::vector<std::pair<size_t,size_t>>* swapped_cols = nullptr,
+	                    const int n_threads = 1);
+
+	/*
+	 * \brief create a matrix of the given size filled with identity diagonal
+	 */
+	static Bit_matrix identity(const size_t n_rows, const size_t n_cols);
+
+	/*
+	 * \brief create a matrix of the given size filled with only zeros
+	 */
+	static Bit_matrix zero(const size_t n_rows, const size_t n_cols);
+
+	/*
+	 * conversions from/to the other matrix types (the degrees are computed)
+	 */
+	static Bit_matrix from_sparse(const Sparse_matrix& sparse);
+	Sparse_matrix to_sparse() const;
+
+	template <typename T>
+	static Bit_matrix from_full(const Full_matrix<T>& full);
+
+	template <typename T>
+	Full_matrix<T> to_full() const;
+
+	static inline unsigned popcount(word_t x)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		return (unsigned)__builtin_popcountll(x);
+#else
+		x = x - ((x >> 1) & 0x5555555555555555ULL);
+		x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+		x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+		return (unsigned)((x * 0x0101010101010101ULL) >> 56);
+#endif
+	}
+
+	// 'x' has not to be null
+	static inline unsigned ctz(word_t x)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		return (unsigned)__builtin_ctzll(x);
+#else
+		unsigned n = 0;
+		while (!(x & 1)) { x >>= 1; n++; }
+		return n;
+#endif
+	}
+
+private:
+	size_t              n_words;
+	std::vector<word_t> data;
+
+	std::vector<size_t> rows_degrees;
+	std::vector<size_t> cols_degrees;
+
+	// clear the bits after the last column in the last word of each row
+	void clear_padding();
+
+	// clear the columns [c0, c0 + n_piv) in all the rows except the pivot ones (rows [c0, c0 + n_piv))
+	void m4ri_update(const size_t c0, const size_t n_piv, std::vector<word_t>& table, const int n_threads);
+
+	static void transpose64(word_t a[64]);
+};
+}
+}
+
+#include "Bit_matrix.hxx"
+
+#endif /* BIT_MATRIX_HPP_ */
@@ -0,0 +1,47 @@
+#ifndef BIT_MATRIX_HXX_
+#define BIT_MATRIX_HXX_
+
+#include "Bit_matrix.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+template <typename T>
+Bit_matrix Bit_matrix
+::from_full(const Full_matrix<T>& full)
+{
+	Bit_matrix bits(full.get_n_rows(), full.get_n_cols());
+
+	for (size_t r = 0; r < full.get_n_rows(); r++)
+		for (size_t c = 0; c < full.get_n_cols(); c++)
+			if (full[r][c])
+				bits.set(r, c);
+
+	bits.parse_connections();
+
+	return bits;
+}
+
+template <typename T>
+Full_matrix<T> Bit_matrix
+::to_full() const
+{
+	auto full = Full_matrix<T>::zero(get_n_rows(), get_n_cols());
+
+	for (size_t r = 0; r < get_n_rows(); r++)
+	{
+		const auto row = (*this)[r];
+		for (size_t w = 0; w < n_words; w++)
+			for (auto x = row[w]; x; x &= x -1)
+				full[r][w * word_size + ctz(x)] = 1;
+	}
+
+	full.parse_connections();
+
+	return full;
+}
+}
+}
+
+#endif /* BIT_MATRIX_HXX_ */
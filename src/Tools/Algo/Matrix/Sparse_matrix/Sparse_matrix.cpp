@@ -326,4 +326,47 @@ Sparse_matrix Sparse_matrix
 ::zero(const size_t n_rows, const size_t n_cols)
 {
 	return Sparse_matrix(n_rows, n_cols);
-}
\ No newline at end of file
+}
+
+Sparse_matrix Sparse_matrix
+::from_adjacency(std::vector<std::vector<Idx_t>> row_to_cols, std::vector<std::vector<Idx_t>> col_to_rows)
+{
+	const auto n_rows = row_to_cols.size();
+	const auto n_cols = col_to_rows.size();
+
+	if (n_rows == 0 || n_cols == 0)
+	{
+		std::stringstream message;
+		message << "'n_rows' and 'n_cols' have to be greater than 0 ('n_rows' = " << n_rows
+		        << ", 'n_cols' = " << n_cols << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the two lists have to contain exactly the same (row, col) pairs, without duplicate
+	std::vector<std::pair<Idx_t,Idx_t>> from_rows, from_cols;
+	for (size_t r = 0; r < n_rows; r++)
+		for (auto c : row_to_cols[r])
+			from_rows.push_back(std::make_pair((Idx_t)r, c));
+	for (size_t c = 0; c < n_cols; c++)
+		for (auto r : col_to_rows[c])
+			from_cols.push_back(std::make_pair(r, (Idx_t)c));
+
+	std::sort(from_rows.begin(), from_rows.end());
+	std::sort(from_cols.begin(), from_cols.end());
+
+	if (from_rows != from_cols ||
+	    std::adjacent_find(from_rows.begin(), from_rows.end()) != from_rows.end() ||
+	    (!from_rows.empty() && from_rows.back().first >= n_rows) ||
+	    std::any_of(from_rows.begin(), from_rows.end(), [n_cols](const std::pair<Idx_t,Idx_t>& p)
+	                                                    { return (size_t)p.second >= n_cols; }))
+	{
+		throw runtime_error(__FILE__, __LINE__, __func__, "'row_to_cols' and 'col_to_rows' are not consistent.");
+	}
+
+	Sparse_matrix mat(n_rows, n_cols);
+	mat.row_to_cols = std::move(row_to_cols);
+	mat.col_to_rows = std::move(col_to_rows);
+	mat.parse_connections();
+
+	return mat;
+}
@@ -111,6 +111,14 @@ public:
 	 */
 	static Sparse_matrix zero(const size_t n_rows, const size_t n_cols);
 
+	/*
+	 * \brief create a matrix from its two adjacency lists, the order of the connections in each list is kept
+	 *        (unlike a sequence of 'add_connection' calls that may not be able to give the same orders)
+	 * \return the matrix, throw a runtime_error if the lists do not describe the same connections
+	 */
+	static Sparse_matrix from_adjacency(std::vector<std::vector<Idx_t>> row_to_cols,
+	                                    std::vector<std::vector<Idx_t>> col_to_rows);
+
 private:
 	std::vector<std::vector<Idx_t>> row_to_cols;
 	std::vector<std::vector<Idx_t>> col_to_rows;
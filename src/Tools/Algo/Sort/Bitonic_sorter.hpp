@@ -0,0 +1,126 @@
+/*!
+ * \file
+ * \brief Top-K selection based on bitonic sorting networks.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef BITONIC_SORTER_HPP
+#define BITONIC_SORTER_HPP
+
+#include <limits>
+#include <vector>
+#include <mipp.h>
+
+#include "LC_sorter.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Bitonic_sorter
+ *
+ * \brief Selects the K smallest values of an array (and their positions) with fixed-size bitonic networks.
+ *
+ * When the input is long enough, each lane of P = 2^ceil(log2(K)) SIMD registers (P <= 32) keeps its own K smallest
+ * values. The input is loaded by blocks of P registers: a block is sorted vertically with a bitonic network, merged with
+ * the selected registers by a half-cleaner (the P smallest elements of two sorted sequences form a bitonic sequence)
+ * and the selected registers are sorted again with a bitonic merge. A block is skipped when none of its elements is
+ * smaller than the largest selected one. The positions are carried in registers of the same type than the values (the
+ * number of the loaded register is stored, not the position itself, so the 8-bit and 16-bit types can be used).
+ * Finally, the 'P * mipp::nElReg<T>()' candidates of the lanes are merged in scalar.
+ *
+ * The short inputs and the candidates are processed in scalar: an element is inserted in the sorted selection only if
+ * it is smaller than the largest selected one, once the selection is filled most of the elements are rejected with a
+ * single comparison.
+ *
+ * The ties are broken in favor of the smallest position: the selection is deterministic and does not depend on the
+ * SIMD width. The selection falls back on the LC_sorter if K > 32 or if K > 16 for the short inputs, when the number
+ * of elements is a power of 2 (the tree is then faster than the insertions). Otherwise, for K > 32, the positions are
+ * selected with 'std::partial_sort'. The buffers grow with 'n_elmts' when it exceeds 'max_elmts'.
+ *
+ * The interface is the same as the LC_sorter one.
+ *
+ * \tparam T: the type of the values to sort (int8_t, int16_t, int32_t, int64_t, float or double).
+ */
+template <typename T>
+class Bitonic_sorter
+{
+public:
+	static constexpr int max_K     = 32; /*!< Largest number of selected elements handled by the networks. */
+	static constexpr int max_n_net = 64; /*!< Largest number of elements that can be sorted by the 'sort' method. */
+
+private:
+	// the vertical networks store the register numbers in the type T: they have to be exactly representable, the
+	// largest one is used for the padding
+	static constexpr int max_regs = std::numeric_limits<T>::digits >= 31 ? std::numeric_limits<int>::max() :
+	                                (int)~(~0u << std::numeric_limits<T>::digits);
+
+	int               max_elmts;
+	LC_sorter<T>      lc_sorter;
+	mipp::vector<T>   vals;
+	std::vector<int>  tmp_idx;
+	std::vector<T>    cand_vals;
+	std::vector<int>  cand_idx;
+
+public:
+	explicit Bitonic_sorter(const int max_elmts);
+
+	/*!
+	 * \brief Computes the positions of the K smallest values (sorted in increasing order).
+	 *
+	 * \param values:  the values, they are not modified.
+	 * \param pos:     the positions of the K smallest values (the size of the vector has to be at least K).
+	 * \param n_elmts: the number of values (if <= 0, 'max_elmts' values), it has to be greater or equal to K.
+	 * \param K:       the number of positions to compute (if <= 0, 'pos.size()').
+	 */
+	void partial_sort(const T* values, std::vector<int> &pos, int n_elmts = -1, int K = -1);
+
+	/*!
+	 * \brief Same as 'partial_sort', the values are not modified (kept for compatibility with the LC_sorter).
+	 */
+	void partial_sort_destructive(T* values, std::vector<int> &pos, int n_elmts = -1, int K = -1);
+
+	/*!
+	 * \brief Computes the positions of the K smallest absolute values (sorted in increasing order), the absolute value
+	 *        of the lowest integer is saturated to the largest one.
+	 */
+	void partial_sort_abs(const T* values, std::vector<int> &pos, int n_elmts = -1, int K = -1);
+
+	/*!
+	 * \brief Sorts in increasing order the values and their positions with a bitonic network.
+	 *
+	 * \param values:  the values to sort.
+	 * \param idx:     the positions carried with the values (used to break the ties).
+	 * \param n_elmts: the number of values (has to be lower or equal to 'max_n_net').
+	 */
+	static void sort(T* values, int* idx, const int n_elmts);
+
+private:
+	void _resize      (const int n_elmts);
+	void _select_large(const T* values, std::vector<int> &pos, const int n_elmts, const int K);
+	void _select(const T* values, std::vector<int> &pos, const int n_elmts, const int K);
+
+	template <int P> void _select(const T* values, std::vector<int> &pos, const int n_elmts, const int K);
+
+	template <int P>
+	static void _select_scalar(const T* values, const int* idx, const int n_elmts, const int K, T* best_vals,
+	                           int* best_idx);
+
+	template <int P>
+	static void _select_simd(const T* values, const int n_regs, T* cand_vals, int* cand_idx);
+
+	template <int P, typename V, typename I> static inline void _sort      (V* v, I* i);
+	template <int P, typename V, typename I> static inline void _merge     (V* v, I* i);
+	template <int P, typename V, typename I> static inline void _half_clean(V* v, I* i, V* w, I* j);
+
+	static inline void _cmp_swap(T& a, int& ia, T& b, int& ib);
+	static inline void _cmp_swap(mipp::Reg<T>& a, mipp::Reg<T>& ia, mipp::Reg<T>& b, mipp::Reg<T>& ib);
+};
+}
+}
+
+#include "Bitonic_sorter.hxx"
+
+#endif /* BITONIC_SORTER_HPP */
@@ -0,0 +1,359 @@
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Bitonic_sorter.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+template <typename T>
+constexpr int Bitonic_sorter<T>::max_K;
+
+template <typename T>
+constexpr int Bitonic_sorter<T>::max_n_net;
+
+template <typename T>
+constexpr int Bitonic_sorter<T>::max_regs;
+
+template <typename T>
+Bitonic_sorter<T>
+::Bitonic_sorter(const int max_elmts)
+: max_elmts(max_elmts),
+  lc_sorter(max_elmts),
+  vals     (max_elmts),
+  tmp_idx  (max_elmts),
+  cand_vals((max_K +1) * mipp::nElReg<T>()),
+  cand_idx ((max_K +1) * mipp::nElReg<T>())
+{
+}
+
+template <typename T>
+void Bitonic_sorter<T>
+::partial_sort(const T* values, std::vector<int> &pos, int n_elmts, int K)
+{
+	K       = (K       <= 0) ? (int)pos.size() : K;
+	n_elmts = (n_elmts <= 0) ? max_elmts       : n_elmts;
+
+	this->_resize(n_elmts);
+
+	if (K > max_K)
+		this->_select_large(values, pos, n_elmts, K);
+	else
+		this->_select(values, pos, n_elmts, K);
+}
+
+template <typename T>
+void Bitonic_sorter<T>
+::partial_sort_destructive(T* values, std::vector<int> &pos, int n_elmts, int K)
+{
+	this->partial_sort(values, pos, n_elmts, K);
+}
+
+template <typename T>
+void Bitonic_sorter<T>
+::partial_sort_abs(const T* values, std::vector<int> &pos, int n_elmts, int K)
+{
+	K       = (K       <= 0) ? (int)pos.size() : K;
+	n_elmts = (n_elmts <= 0) ? max_elmts       : n_elmts;
+
+	this->_resize(n_elmts);
+
+	// the magnitude of the lowest integer (e.g. -128 for int8_t) overflows, it is saturated to the largest value
+	for (auto i = 0; i < n_elmts; i++)
+		vals[i] = (std::numeric_limits<T>::is_integer && values[i] == std::numeric_limits<T>::min()) ?
+		          std::numeric_limits<T>::max() : (T)std::abs(values[i]);
+
+	if (K > max_K)
+		this->_select_large(vals.data(), pos, n_elmts, K);
+	else
+		this->_select(vals.data(), pos, n_elmts, K);
+}
+
+template <typename T>
+void Bitonic_sorter<T>
+::sort(T* values, int* idx, const int n_elmts)
+{
+	if (n_elmts > max_n_net)
+	{
+		std::stringstream message;
+		message << "'n_elmts' has to be equal or smaller than 'max_n_net' ('n_elmts' = " << n_elmts
+		        << ", 'max_n_net' = " << max_n_net << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const auto inf = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() :
+	                                                        std::numeric_limits<T>::max();
+
+	T   v[max_n_net];
+	int i[max_n_net];
+	std::copy(values, values + n_elmts, v);
+	std::copy(idx,    idx    + n_elmts, i);
+	std::fill(v + n_elmts, v + max_n_net, inf);
+	std::fill(i + n_elmts, i + max_n_net, std::numeric_limits<int>::max());
+
+	     if (n_elmts <=  2) Bitonic_sorter<T>::_sort< 2>(v, i);
+	else if (n_elmts <=  4) Bitonic_sorter<T>::_sort< 4>(v, i);
+	else if (n_elmts <=  8) Bitonic_sorter<T>::_sort< 8>(v, i);
+	else if (n_elmts <= 16) Bitonic_sorter<T>::_sort<16>(v, i);
+	else if (n_elmts <= 32) Bitonic_sorter<T>::_sort<32>(v, i);
+	else                    Bitonic_sorter<T>::_sort<64>(v, i);
+
+	std::copy(v, v + n_elmts, values);
+	std::copy(i, i + n_elmts, idx   );
+}
+
+template <typename T>
+void Bitonic_sorter<T>
+::_resize(const int n_elmts)
+{
+	if (n_elmts > max_elmts)
+	{
+		max_elmts = n_elmts;
+		lc_sorter = LC_sorter<T>(max_elmts);
+		vals    .resize(max_elmts);
+		tmp_idx .resize(max_elmts);
+	}
+}
+
+template <typename T>
+void Bitonic_sorter<T>
+::_select_large(const T* values, std::vector<int> &pos, const int n_elmts, const int K)
+{
+	// the tree of the LC_sorter requires a power of 2 number of elements, it also marks the selected values with the
+	// largest one: the values equal to it (e.g. a saturated absolute value) could not be distinguished from the marks
+	const auto max = std::numeric_limits<T>::max();
+	if (!(n_elmts & (n_elmts -1)) && std::count_if(values, values + n_elmts, [max](const T v) { return v < max; }) >= K)
+	{
+		lc_sorter.partial_sort(values, pos, n_elmts, K);
+		return;
+	}
+
+	std::iota(tmp_idx.begin(), tmp_idx.begin() + n_elmts, 0);
+	std::partial_sort(tmp_idx.begin(), tmp_idx.begin() + K, tmp_idx.begin() + n_elmts,
+	                  [values](const int a, const int b) { return values[a] < values[b] ||
+	                                                              (values[a] == values[b] && a < b); });
+	std::copy(tmp_idx.begin(), tmp_idx.begin() + K, pos.begin());
+}
+
+template <typename T>
+void Bitonic_sorter<T>
+::_select(const T* values, std::vector<int> &pos, const int n_elmts, const int K)
+{
+	     if (K <=  2) this->template _select< 2>(values, pos, n_elmts, K);
+	else if (K <=  4) this->template _select< 4>(values, pos, n_elmts, K);
+	else if (K <=  8) this->template _select< 8>(values, pos, n_elmts, K);
+	else if (K <= 16) this->template _select<16>(values, pos, n_elmts, K);
+	else              this->template _select<32>(values, pos, n_elmts, K);
+}
+
+template <typename T>
+template <int P>
+void Bitonic_sorter<T>
+::_select(const T* values, std::vector<int> &pos, const int n_elmts, const int K)
+{
+	T   best_vals[P];
+	int best_idx [P];
+
+	constexpr auto n_lanes = mipp::N<T>();
+	const auto n_regs = n_elmts / n_lanes;
+
+	// the vertical networks are worth only if each lane processes several blocks
+	if (n_lanes > 1 && n_elmts >= 2 * P * n_lanes && n_regs < max_regs)
+	{
+		Bitonic_sorter<T>::_select_simd<P>(values, n_regs, cand_vals.data(), cand_idx.data());
+
+		// the last elements (which do not fill a register) are directly added to the candidates
+		auto n_cands = P * n_lanes;
+		for (auto i = n_regs * n_lanes; i < n_elmts; i++)
+		{
+			cand_vals[n_cands] = values[i];
+			cand_idx [n_cands] = i;
+			n_cands++;
+		}
+
+		Bitonic_sorter<T>::_select_scalar<P>(cand_vals.data(), cand_idx.data(), n_cands, K, best_vals, best_idx);
+	}
+	else if (K > 16 && !(n_elmts & (n_elmts -1)))
+	{
+		// the insertions become too expensive, the tree of the LC_sorter is faster (it requires a power of 2)
+		lc_sorter.partial_sort(values, pos, n_elmts, K);
+		return;
+	}
+	else
+		Bitonic_sorter<T>::_select_scalar<P>(values, nullptr, n_elmts, K, best_vals, best_idx);
+
+	std::copy(best_idx, best_idx + K, pos.begin());
+}
+
+template <typename T>
+template <int P>
+void Bitonic_sorter<T>
+::_select_scalar(const T* values, const int* idx, const int n_elmts, const int K, T* best_vals, int* best_idx)
+{
+	const auto inf = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() :
+	                                                        std::numeric_limits<T>::max();
+
+	std::fill(best_vals, best_vals + P, inf);
+	std::fill(best_idx,  best_idx  + P, std::numeric_limits<int>::max());
+
+	// an element is inserted only if it is smaller than the largest selected one: once the buffer is filled, most of
+	// the elements are rejected with one comparison
+	for (auto i = 0; i < n_elmts; i++)
+	{
+		const auto v = values[i];
+		const auto j = idx ? idx[i] : i;
+
+		if (v < best_vals[K -1] || (v == best_vals[K -1] && j < best_idx[K -1]))
+		{
+			auto k = K -1;
+			while (k > 0 && (v < best_vals[k -1] || (v == best_vals[k -1] && j < best_idx[k -1])))
+			{
+				best_vals[k] = best_vals[k -1];
+				best_idx [k] = best_idx [k -1];
+				k--;
+			}
+			best_vals[k] = v;
+			best_idx [k] = j;
+		}
+	}
+}
+
+template <typename T>
+template <int P>
+void Bitonic_sorter<T>
+::_select_simd(const T* values, const int n_regs, T* cand_vals, int* cand_idx)
+{
+	constexpr auto n_lanes = mipp::N<T>();
+
+	const auto r_inf = mipp::Reg<T>(std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() :
+	                                                                       std::numeric_limits<T>::max());
+	const auto r_max = mipp::Reg<T>((T)max_regs);
+
+	// each lane keeps its own P smallest values, the positions are stored as register numbers
+	mipp::Reg<T> best_vals[P], best_regs[P], blk_vals[P], blk_regs[P];
+	for (auto k = 0; k < P; k++)
+	{
+		best_vals[k] = r_inf;
+		best_regs[k] = r_max;
+	}
+
+	for (auto r = 0; r < n_regs; r += P)
+	{
+		for (auto k = 0; k < P; k++)
+			if (r + k < n_regs)
+			{
+				blk_vals[k].loadu(values + (r + k) * n_lanes);
+				blk_regs[k] = mipp::Reg<T>((T)(r + k));
+			}
+			else
+			{
+				blk_vals[k] = r_inf;
+				blk_regs[k] = r_max;
+			}
+
+		// skip the block if none of its elements is smaller than the largest selected one
+		const auto &worst_vals = best_vals[P -1], &worst_regs = best_regs[P -1];
+		auto smaller = (blk_vals[0] < worst_vals) | ((blk_vals[0] == worst_vals) & (blk_regs[0] < worst_regs));
+		for (auto k = 1; k < P; k++)
+			smaller = smaller | (blk_vals[k] < worst_vals) | ((blk_vals[k] == worst_vals) & (blk_regs[k] < worst_regs));
+		if (mipp::testz(smaller))
+			continue;
+
+		Bitonic_sorter<T>::_sort      <P>(blk_vals, blk_regs);
+		Bitonic_sorter<T>::_half_clean<P>(best_vals, best_regs, blk_vals, blk_regs);
+		Bitonic_sorter<T>::_merge     <P>(best_vals, best_regs);
+	}
+
+	T regs[n_lanes];
+	for (auto k = 0; k < P; k++)
+	{
+		best_vals[k].storeu(cand_vals + k * n_lanes);
+		best_regs[k].storeu(regs);
+
+		for (auto l = 0; l < n_lanes; l++)
+			cand_idx[k * n_lanes + l] = (regs[l] == (T)max_regs) ? std::numeric_limits<int>::max() :
+			                                                        (int)regs[l] * n_lanes + l;
+	}
+}
+
+template <typename T>
+template <int P, typename V, typename I>
+void Bitonic_sorter<T>
+::_sort(V* v, I* i)
+{
+	for (auto k = 2; k <= P; k <<= 1)
+		for (auto j = k >> 1; j > 0; j >>= 1)
+			for (auto x = 0; x < P; x++)
+			{
+				const auto y = x ^ j;
+				if (y > x)
+				{
+					if ((x & k) == 0) Bitonic_sorter<T>::_cmp_swap(v[x], i[x], v[y], i[y]); // increasing order
+					else              Bitonic_sorter<T>::_cmp_swap(v[y], i[y], v[x], i[x]); // decreasing order
+				}
+			}
+}
+
+template <typename T>
+template <int P, typename V, typename I>
+void Bitonic_sorter<T>
+::_merge(V* v, I* i)
+{
+	// sort a bitonic sequence in increasing order
+	for (auto j = P >> 1; j > 0; j >>= 1)
+		for (auto x = 0; x < P; x++)
+		{
+			const auto y = x ^ j;
+			if (y > x)
+				Bitonic_sorter<T>::_cmp_swap(v[x], i[x], v[y], i[y]);
+		}
+}
+
+template <typename T>
+template <int P, typename V, typename I>
+void Bitonic_sorter<T>
+::_half_clean(V* v, I* i, V* w, I* j)
+{
+	// 'v' and 'w' are sorted in increasing order: after this step 'v' contains the P smallest elements of both
+	// sequences and is bitonic
+	for (auto x = 0; x < P; x++)
+		Bitonic_sorter<T>::_cmp_swap(v[x], i[x], w[P -1 -x], j[P -1 -x]);
+}
+
+template <typename T>
+void Bitonic_sorter<T>
+::_cmp_swap(T& a, int& ia, T& b, int& ib)
+{
+	// written without branch to be compiled with conditional moves
+	const auto s   = (b < a) | ((b == a) & (ib < ia));
+	const auto lo  = s ? b  : a;
+	const auto hi  = s ? a  : b;
+	const auto ilo = s ? ib : ia;
+	const auto ihi = s ? ia : ib;
+
+	a = lo; ia = ilo;
+	b = hi; ib = ihi;
+}
+
+template <typename T>
+void Bitonic_sorter<T>
+::_cmp_swap(mipp::Reg<T>& a, mipp::Reg<T>& ia, mipp::Reg<T>& b, mipp::Reg<T>& ib)
+{
+	const auto m = (b < a) | ((b == a) & (ib < ia));
+
+	const auto lo  = mipp::blend(b,  a,  m);
+	const auto hi  = mipp::blend(a,  b,  m);
+	const auto ilo = mipp::blend(ib, ia, m);
+	const auto ihi = mipp::blend(ia, ib, m);
+
+	a = lo; ia = ilo;
+	b = hi; ib = ihi;
+}
+}
+}
@@ -0,0 +1,182 @@
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Thread_pinning/Thread_pinning.hpp"
+
+#include "Thread_team.hpp"
+
+using namespace aff3ct::tools;
+
+Thread_team
+::Thread_team(const int n_threads)
+: n_threads(n_threads),
+  task(nullptr),
+  generation(0),
+  n_running(0),
+  stop(false),
+  error(nullptr),
+  barrier_count(0),
+  barrier_generation(0),
+  barrier_n_sleeping(0)
+{
+	if (n_threads <= 0)
+	{
+		std::stringstream message;
+		message << "'n_threads' has to be greater than 0 ('n_threads' = " << n_threads << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	for (auto t = 1; t < n_threads; t++)
+		this->workers.push_back(std::thread(&Thread_team::worker, this, t));
+}
+
+Thread_team
+::~Thread_team()
+{
+	{
+		std::lock_guard<std::mutex> lock(this->mtx);
+		this->stop = true;
+	}
+	this->cv_start.notify_all();
+
+	for (auto &w : this->workers)
+		w.join();
+}
+
+void Thread_team
+::run(const std::function<void(const int tid)> &task)
+{
+	if (this->n_threads == 1)
+	{
+		task(0);
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(this->mtx);
+		this->task      = &task;
+		this->n_running = this->n_threads -1;
+		this->error     = nullptr;
+		this->generation++;
+	}
+	this->cv_start.notify_all();
+
+	std::exception_ptr error = nullptr;
+	try
+	{
+		task(0);
+	}
+	catch (...)
+	{
+		error = std::current_exception();
+	}
+
+	std::unique_lock<std::mutex> lock(this->mtx);
+	this->cv_done.wait(lock, [this]() { return this->n_running == 0; });
+	this->task = nullptr;
+
+	if (error == nullptr)
+		error = this->error;
+	if (error != nullptr)
+		std::rethrow_exception(error);
+}
+
+void Thread_team
+::worker(const int tid)
+{
+	// else all the members would share the CPU of a pinned creator
+	Thread_pinning::unpin();
+
+	uint64_t last_generation = 0;
+	while (true)
+	{
+		const std::function<void(const int)> *task;
+		{
+			std::unique_lock<std::mutex> lock(this->mtx);
+			this->cv_start.wait(lock, [&]() { return this->stop || this->generation != last_generation; });
+			if (this->stop)
+				return;
+			last_generation = this->generation;
+			task = this->task;
+		}
+
+		std::exception_ptr error = nullptr;
+		try
+		{
+			(*task)(tid);
+		}
+		catch (...)
+		{
+			error = std::current_exception();
+		}
+
+		std::lock_guard<std::mutex> lock(this->mtx);
+		if (error != nullptr && this->error == nullptr)
+			this->error = error;
+		if (--this->n_running == 0)
+			this->cv_done.notify_one();
+	}
+}
+
+void Thread_team
+::barrier()
+{
+	if (this->n_threads == 1)
+		return;
+
+	// the generation can't change before the arrival of this member
+	const auto gen = this->barrier_generation.load(std::memory_order_acquire);
+	if (this->barrier_count.fetch_add(1, std::memory_order_acq_rel) == this->n_threads -1)
+	{
+		this->barrier_count.store(0, std::memory_order_relaxed);
+		this->barrier_generation.fetch_add(1, std::memory_order_seq_cst);
+
+		// the sleeping members registered themselves before checking the generation under the lock: either they see
+		// the new generation or they are counted here (both operations are sequentially consistent)
+		if (this->barrier_n_sleeping.load(std::memory_order_seq_cst) > 0)
+		{
+			std::lock_guard<std::mutex> lock(this->barrier_mtx);
+			this->barrier_cv.notify_all();
+		}
+		return;
+	}
+
+	// spin, then yield the core, then sleep
+	constexpr int n_spins = 1024, n_yields = 128;
+	for (auto i = 0; i < n_spins + n_yields; i++)
+	{
+		if (this->barrier_generation.load(std::memory_order_acquire) != gen)
+			return;
+		if (i >= n_spins)
+			std::this_thread::yield();
+	}
+
+	this->barrier_n_sleeping.fetch_add(1, std::memory_order_seq_cst);
+	{
+		std::unique_lock<std::mutex> lock(this->barrier_mtx);
+		this->barrier_cv.wait(lock, [&]()
+		{
+			return this->barrier_generation.load(std::memory_order_seq_cst) != gen;
+		});
+	}
+	this->barrier_n_sleeping.fetch_sub(1, std::memory_order_relaxed);
+}
+
+std::vector<uint32_t> Thread_team
+::split(const std::vector<uint32_t> &weights_prefix, const int n_threads)
+{
+	const auto n_items = (uint32_t)weights_prefix.size() -1;
+	const auto total   = (uint64_t)weights_prefix.back();
+
+	std::vector<uint32_t> bounds(n_threads +1, n_items);
+	bounds[0] = 0;
+	for (auto t = 1; t < n_threads; t++)
+	{
+		const auto target = (uint32_t)(total * t / n_threads);
+		const auto it = std::lower_bound(weights_prefix.begin(), weights_prefix.end(), target);
+		bounds[t] = std::max(bounds[t -1], std::min(n_items, (uint32_t)(it - weights_prefix.begin())));
+	}
+
+	return bounds;
+}
@@ -0,0 +1,98 @@
+#ifndef THREAD_TEAM_HPP_
+#define THREAD_TEAM_HPP_
+
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <condition_variable>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Thread_team
+ *
+ * \brief Persistent team of threads executing the same task (SPMD style) with barrier-synchronized phases.
+ *
+ * The 'n_threads -1' workers are created once and sleep between two tasks: the cost of a 'run' is a wake-up, not a
+ * thread creation, so a team can be used for the short tasks (a frame decoding for instance). The calling thread is the
+ * member 0 of the team and takes part in each task. The workers don't inherit the affinity of the creating thread (a
+ * pinned simulation thread for instance): they can run on all the CPUs of the process (see 'Thread_pinning::unpin').
+ *
+ * Inside a task, 'barrier' waits until all the members reached it. The barrier spins, then yields, and finally sleeps
+ * on a condition variable: the short and balanced phases never pay a wake-up, and the members waiting for a slow one
+ * (or for an oversubscribed core) don't burn the CPU.
+ */
+class Thread_team
+{
+private:
+	const int n_threads;
+
+	std::vector<std::thread> workers;
+
+	std::mutex              mtx;
+	std::condition_variable cv_start;
+	std::condition_variable cv_done;
+	const std::function<void(const int)> *task;
+	uint64_t           generation; // incremented at each 'run'
+	int                n_running;  // number of workers still executing the current task
+	bool               stop;
+	std::exception_ptr error;
+
+	// the barrier counters are on different cache lines (no 'alignas': the team is allocated with a regular 'new')
+	char                  padding0[64];
+	std::atomic<int>      barrier_count;
+	char                  padding1[64];
+	std::atomic<unsigned> barrier_generation;
+	char                  padding2[64];
+
+	std::atomic<int>        barrier_n_sleeping; // number of members sleeping on 'barrier_cv'
+	std::mutex              barrier_mtx;
+	std::condition_variable barrier_cv;
+
+public:
+	/*!
+	 * \param n_threads: number of members of the team, the calling thread included (> 0).
+	 */
+	explicit Thread_team(const int n_threads);
+
+	virtual ~Thread_team();
+
+	Thread_team(const Thread_team&) = delete;
+	Thread_team& operator=(const Thread_team&) = delete;
+
+	inline int get_n_threads() const { return this->n_threads; }
+
+	/*!
+	 * \brief Execute 'task(tid)' on each member of the team ('tid' in [0, n_threads[) and wait for all of them.
+	 *
+	 * The first exception raised by a member is rethrown in the calling thread. A task that throws must not use the
+	 * barrier after the throw point on the other members (they would wait forever).
+	 */
+	void run(const std::function<void(const int tid)> &task);
+
+	/*!
+	 * \brief Wait until all the members of the team reached the barrier, to be called by all of them inside 'run'.
+	 */
+	void barrier();
+
+	/*!
+	 * \brief Balanced split of 'n_items' weighted items in 'n_threads' contiguous ranges.
+	 *
+	 * \param weights_prefix: prefix sum of the weights ('n_items +1' values, the first one is 0).
+	 * \return the 'n_threads +1' bounds of the ranges, the range of the member 't' is [bounds[t], bounds[t+1][.
+	 */
+	static std::vector<uint32_t> split(const std::vector<uint32_t> &weights_prefix, const int n_threads);
+
+private:
+	void worker(const int tid);
+};
+}
+}
+
+#endif /* THREAD_TEAM_HPP_ */
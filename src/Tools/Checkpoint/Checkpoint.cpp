@@ -0,0 +1,204 @@
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <iterator>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Checkpoint.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+const std::string aff3ct::tools::Checkpoint::magic   = "AFF3CTCK";
+const uint32_t    aff3ct::tools::Checkpoint::version = 1;
+
+namespace
+{
+template <typename T>
+void write_val(std::string &out, const T &val)
+{
+	out.append((const char*)&val, sizeof(T));
+}
+
+template <typename T>
+T read_val(const std::string &in, size_t &pos)
+{
+	if (pos + sizeof(T) > in.size())
+		throw runtime_error(__FILE__, __LINE__, __func__, "The checkpoint is truncated.");
+
+	T val;
+	std::memcpy((void*)&val, in.data() + pos, sizeof(T));
+	pos += sizeof(T);
+	return val;
+}
+
+std::string read_str(const std::string &in, size_t &pos)
+{
+	const auto size = (size_t)read_val<uint32_t>(in, pos);
+	if (pos + size > in.size())
+		throw runtime_error(__FILE__, __LINE__, __func__, "The checkpoint is truncated.");
+
+	auto str = in.substr(pos, size);
+	pos += size;
+	return str;
+}
+}
+
+Checkpoint
+::Checkpoint(const std::string &signature)
+: signature(signature), generation(0)
+{
+}
+
+void Checkpoint
+::load(const std::string &path)
+{
+	std::ifstream file(path, std::ios::in | std::ios::binary);
+	if (!file.is_open())
+	{
+		std::stringstream message;
+		message << "Impossible to open the checkpoint file ('path' = " << path << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	this->deserialize(data);
+	this->generation++;
+}
+
+void Checkpoint
+::save(const std::string &path) const
+{
+	const auto tmp_path = path + ".tmp";
+
+	{
+		std::ofstream file(tmp_path, std::ios::out | std::ios::binary | std::ios::trunc);
+		const auto data = this->serialize();
+		file.write(data.data(), data.size());
+
+		if (!file.good())
+		{
+			std::stringstream message;
+			message << "Impossible to write the checkpoint file ('tmp_path' = " << tmp_path << ").";
+			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	if (std::rename(tmp_path.c_str(), path.c_str()) != 0)
+	{
+		std::stringstream message;
+		message << "Impossible to rename the checkpoint file ('tmp_path' = " << tmp_path << ", 'path' = " << path
+		        << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+std::string Checkpoint
+::serialize() const
+{
+	std::string out = Checkpoint::magic;
+
+	write_val(out, Checkpoint::version);
+	write_val(out, (uint32_t)this->signature.size());
+	out += this->signature;
+	write_val(out, this->generation);
+	write_val(out, (uint32_t)this->points.size());
+
+	for (auto &p : this->points)
+	{
+		write_val(out, p.noise);
+		write_val(out, (uint8_t)(p.done ? 1 : 0));
+		write_val(out, p.elapsed);
+		write_val(out, (uint32_t)p.monitors.size());
+		for (auto &m : p.monitors)
+		{
+			write_val(out, (uint32_t)m.size());
+			out.append(m.data(), m.size());
+		}
+	}
+
+	return out;
+}
+
+void Checkpoint
+::deserialize(const std::string &data)
+{
+	if (data.compare(0, Checkpoint::magic.size(), Checkpoint::magic) != 0)
+		throw runtime_error(__FILE__, __LINE__, __func__, "The file is not a checkpoint.");
+
+	size_t pos = Checkpoint::magic.size();
+
+	const auto file_version = read_val<uint32_t>(data, pos);
+	if (file_version != Checkpoint::version)
+	{
+		std::stringstream message;
+		message << "'file_version' has to be equal to 'version' ('file_version' = " << file_version
+		        << ", 'version' = " << Checkpoint::version << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const auto file_signature = read_str(data, pos);
+	if (file_signature != this->signature)
+	{
+		std::stringstream message;
+		message << "The checkpoint has been saved by a different simulation ('file_signature' = " << file_signature
+		        << ", 'signature' = " << this->signature << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const auto file_generation = read_val<uint32_t>(data, pos);
+	const auto n_points        = read_val<uint32_t>(data, pos);
+
+	std::vector<Point> file_points;
+	for (uint32_t i = 0; i < n_points; i++)
+	{
+		Point p;
+		p.noise   = read_val<double >(data, pos);
+		p.done    = read_val<uint8_t>(data, pos) != 0;
+		p.elapsed = read_val<double >(data, pos);
+
+		const auto n_monitors = read_val<uint32_t>(data, pos);
+		for (uint32_t m = 0; m < n_monitors; m++)
+		{
+			const auto raw = read_str(data, pos);
+			p.monitors.push_back(std::vector<char>(raw.begin(), raw.end()));
+		}
+
+		file_points.push_back(p);
+	}
+
+	this->generation = file_generation;
+	this->points     = file_points;
+}
+
+uint32_t Checkpoint
+::get_generation() const
+{
+	return this->generation;
+}
+
+const Checkpoint::Point* Checkpoint
+::find(const double noise) const
+{
+	for (auto &p : this->points)
+		if (std::abs(p.noise - noise) < 1e-6)
+			return &p;
+
+	return nullptr;
+}
+
+void Checkpoint
+::update(const Point &point)
+{
+	for (auto &p : this->points)
+		if (std::abs(p.noise - point.noise) < 1e-6)
+		{
+			p = point;
+			return;
+		}
+
+	this->points.push_back(point);
+}
@@ -0,0 +1,82 @@
+#ifndef CHECKPOINT_HPP_
+#define CHECKPOINT_HPP_
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Checkpoint
+ *
+ * \brief Saves the progress of a simulation in a binary file to resume it later.
+ *
+ * A point is recorded for each simulated noise value: the reduced attributes of the monitors (raw bytes), the elapsed
+ * time and if the point is done. The 'generation' is the number of times the simulation has been resumed: the seeds of
+ * a resumed simulation depend on it, the frames simulated after a resume are then new frames and the counts of the
+ * different runs can be added (independent samples).
+ *
+ * Binary format (native endianness):
+ *   - "AFF3CTCK" (8 bytes), version (uint32), signature length (uint32), signature (chars), generation (uint32),
+ *   - number of points (uint32), and for each point:
+ *     noise (double), done (uint8), elapsed time in seconds (double), number of monitors (uint32), and for each
+ *     monitor: size (uint32), bytes.
+ */
+class Checkpoint
+{
+public:
+	struct Point
+	{
+		double                         noise;
+		bool                           done;
+		double                         elapsed; // in seconds
+		std::vector<std::vector<char>> monitors;
+	};
+
+private:
+	static const std::string magic;
+	static const uint32_t    version;
+
+	std::string        signature; // identifies the simulation parameters that have to be identical to resume
+	uint32_t           generation;
+	std::vector<Point> points;
+
+public:
+	explicit Checkpoint(const std::string &signature);
+	virtual ~Checkpoint() = default;
+
+	/*!
+	 * \brief Reads the checkpoint from a file and increments the generation (resume).
+	 *
+	 * Throws if the file can't be read or if its signature is different than the signature of the simulation.
+	 */
+	void load(const std::string &path);
+
+	/*!
+	 * \brief Writes the checkpoint in a temporary file and then renames it: the previous checkpoint is kept if the
+	 *        process is killed during the write.
+	 */
+	void save(const std::string &path) const;
+
+	std::string serialize  (                        ) const;
+	void        deserialize(const std::string &data);
+
+	uint32_t get_generation() const;
+
+	/*!
+	 * \brief Gets the point of a noise value (nullptr if the point has not been saved yet).
+	 */
+	const Point* find(const double noise) const;
+
+	/*!
+	 * \brief Adds the point or replaces the point with the same noise value.
+	 */
+	void update(const Point &point);
+};
+}
+}
+
+#endif /* CHECKPOINT_HPP_ */
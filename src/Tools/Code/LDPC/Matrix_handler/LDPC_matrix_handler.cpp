@@ -1,3 +1,4 @@
+#include <numeric>
 #include <functional>
 #include <sstream>
 #include <fstream>
@@ -169,125 +170,132 @@ bool LDPC_matrix_handler
 	return true;
 }
 
-Sparse_matrix LDPC_matrix_handler
-::transform_H_to_G_decomp_LU(const Sparse_matrix& H, Positions_vector& info_bits_pos)
+namespace
 {
-	H.is_of_way_throw(Matrix::Way::HORIZONTAL);
-	LDPC_matrix Hf = sparse_to_full<LDPC_matrix::value_type>(H);
+// pack H = [H1 H2] (horizontal, H2 is M x M) as [H2 H1] to invert H2 with a Gauss-Jordan elimination
+Bit_matrix pack_H2_H1(const Sparse_matrix& H)
+{
+	const auto M = H.get_n_rows();
+	const auto K = H.get_n_cols() - M;
 
-	auto Gf = LDPC_matrix_handler::transform_H_to_G_decomp_LU(Hf, info_bits_pos);
+	Bit_matrix A(M, H.get_n_cols());
+	for (size_t r = 0; r < M; r++)
+		for (auto c : H.get_cols_from_row(r))
+			A.set(r, (c >= K) ? c - K : c + M);
 
-	return full_to_sparse(Gf);
+	return A;
 }
 
-Sparse_matrix LDPC_matrix_handler
-::transform_H_to_G_identity(const Sparse_matrix& H, Positions_vector& info_bits_pos)
+// the Gauss-Jordan elimination of A = [H2 X] gives [I inv(H2).X]
+void invert_H2(Bit_matrix& A, const size_t M, const int n_threads)
 {
-	H.is_of_way_throw(Matrix::Way::HORIZONTAL);
-	LDPC_matrix Hf = sparse_to_full<LDPC_matrix::value_type>(H);
+	if (A.gauss_jordan(M, nullptr, n_threads) != M)
+	{
+		std::stringstream message;
+		message << "Matrix H2 (H = [H1 H2]) is not invertible";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+}
 
-	auto Gf = LDPC_matrix_handler::transform_H_to_G_identity(Hf, info_bits_pos);
+// P = inv(H2).H1 is the right part of the reduced [H2 H1], G = [I P'] (horizontal K x N), 'add' sets a connection
+template <class F>
+void decomp_LU_G(const Bit_matrix& A, const size_t M, const size_t N, F&& add)
+{
+	const auto K  = N - M;
+	const auto Pt = A.resize(M, K, Matrix::Origin::TOP_RIGHT).transpose(); // K x M
 
-	return full_to_sparse(Gf);
+	for (size_t k = 0; k < K; k++)
+	{
+		add(k, k);
+		for (auto m = Pt.find_next(k); m < M; m = Pt.find_next(k, m +1))
+			add(k, K + m);
+	}
 }
 
-void swap_columns(LDPC_matrix_handler::LDPC_matrix& mat, size_t idx1, size_t idx2)
+// G (vertical N x K) from the reduced H = [I P]: the rows are the parity part and then the identity, they are moved
+// back following the swapped columns, 'add' sets a connection
+template <class F>
+void identity_G(const Bit_matrix& R, const size_t M, const size_t N,
+                const LDPC_matrix_handler::Positions_pair_vector& swapped_cols,
+                LDPC_matrix_handler::Positions_vector& info_bits_pos, F&& add)
 {
-	auto n_row = mat.get_n_rows();
-	std::vector<LDPC_matrix_handler::LDPC_matrix::value_type> tmp(n_row);
-	for (size_t l = 0; l < n_row; l++) tmp[l]       = mat[l][idx1];
-	for (size_t l = 0; l < n_row; l++) mat[l][idx1] = mat[l][idx2];
-	for (size_t l = 0; l < n_row; l++) mat[l][idx2] = tmp[l];
-}
+	const auto K = N - M;
 
+	std::vector<size_t> src_rows(N);
+	std::iota(src_rows.begin(), src_rows.end(), 0);
+	for (auto l = swapped_cols.size(); l > 0; l--)
+		std::swap(src_rows[swapped_cols[l-1].first], src_rows[swapped_cols[l-1].second]);
 
-LDPC_matrix_handler::LDPC_matrix LU_decomp(const LDPC_matrix_handler::LDPC_matrix& Hp)
-{
-	using V = LDPC_matrix_handler::LDPC_matrix::value_type;
+	for (size_t r = 0; r < N; r++)
+	{
+		const auto s = src_rows[r];
+		if (s < R.get_n_rows())
+			for (auto c = R.find_next(s, M); c < N; c = R.find_next(s, c +1))
+				add(r, c - M);
+		else if (s >= M)
+			add(r, s - M);
+	}
 
-	Hp.is_of_way_throw(Matrix::Way::HORIZONTAL);
+	// return info bits positions
+	info_bits_pos.resize(K);
 
-	auto M = Hp.get_n_rows();
+	LDPC_matrix_handler::Positions_vector bits_pos(N);
+	std::iota(bits_pos.begin(), bits_pos.end(), 0);
 
-	LDPC_matrix_handler::LDPC_matrix Hinv = Hp.resize(M, 2 * M, Matrix::Origin::TOP_LEFT);
+	for (auto& p : swapped_cols)
+		std::swap(bits_pos[p.first], bits_pos[p.second]);
 
-	// Create identity on right part
-	for (size_t i = 0; i < M; i++)
-			Hinv[i][M + i] = 1;
+	std::copy(bits_pos.begin() + M, bits_pos.end(), info_bits_pos.begin());
+}
+}
 
-	// Gaussian elimination (Forward)
-	for (size_t r = 0; r < M; r++)
-	{
-		if (Hinv[r][r] == 0)
-		{
-			size_t r_swap = 0;
-			for (auto r2 = r + 1; r2 < M; r2++)
-			{
-				if (Hinv[r2][r] != 0)
-				{
-					r_swap = r2;
-					break;
-				}
-			}
+Sparse_matrix LDPC_matrix_handler
+::transform_H_to_G_decomp_LU(const Sparse_matrix& H, Positions_vector& info_bits_pos, const int n_threads)
+{
+	H.is_of_way_throw(Matrix::Way::HORIZONTAL);
 
-			if (r_swap == 0)
-			{
-				std::stringstream message;
-				message << "Matrix H2 (H = [H1 H2]) is not invertible";
-				throw runtime_error(__FILE__, __LINE__, __func__, message.str());
-			}
+	const auto M = H.get_n_rows();
+	const auto N = H.get_n_cols();
 
-			std::swap(Hinv[r], Hinv[r_swap]);
-		}
+	auto A = pack_H2_H1(H);
+	invert_H2(A, M, n_threads);
 
-		// XOR on lines
-		for (auto r2 = r + 1; r2 < M; r2++)
-		{
-			if (Hinv[r2][r] != 0)
-			{
-				const auto loop_size1 = (size_t)(2 * M / mipp::nElReg<V>());
-				for (size_t i = 0; i < loop_size1; i++)
-				{
-					const auto rLgn  = mipp::Reg<V>(&Hinv[r ][i * mipp::nElReg<V>()]);
-					const auto rLgn2 = mipp::Reg<V>(&Hinv[r2][i * mipp::nElReg<V>()]);
-					auto rLgn3       = rLgn2 ^ rLgn;
-					rLgn3.store(&Hinv[r2][i * mipp::nElReg<V>()]);
-				}
-				for (unsigned i = loop_size1 * mipp::nElReg<V>(); i < 2 * M; i++)
-					Hinv[r2][i] = Hinv[r2][i] ^ Hinv[r][i];
-			}
-		}
-	}
+	auto G = Sparse_matrix::zero(N - M, N);
+	decomp_LU_G(A, M, N, [&](const size_t r, const size_t c) { G.add_connection(r, c); });
 
-	// Gaussian elimination (Backward)
-	for (auto r = M - 1; r > 0; r--)
-	{
-		// XOR on lines
-		for (auto r2 = r; r2 > 0; r2--)
-		{
-			auto rm1 = r2 - 1;
-			if (Hinv[rm1][r] != 0)
-			{
-				const auto loop_size1 = (size_t)(2 * M / mipp::nElReg<V>());
-				for (size_t i = 0; i < loop_size1; i++)
-				{
-					const auto rLgn  = mipp::Reg<V>(&Hinv[r  ][i * mipp::nElReg<V>()]);
-					const auto rLgn2 = mipp::Reg<V>(&Hinv[rm1][i * mipp::nElReg<V>()]);
-					auto rLgn3       = rLgn2 ^ rLgn;
-					rLgn3.store(&Hinv[rm1][i * mipp::nElReg<V>()]);
-				}
-				for (auto i = loop_size1 * mipp::nElReg<V>(); i < 2 * M; i++)
-					Hinv[rm1][i] = Hinv[rm1][i] ^ Hinv[r][i];
-			}
-		}
-	}
+	info_bits_pos.resize(N - M);
+	std::iota(info_bits_pos.begin(), info_bits_pos.end(), 0);
+
+	return G;
+}
+
+Sparse_matrix LDPC_matrix_handler
+::transform_H_to_G_identity(const Sparse_matrix& H, Positions_vector& info_bits_pos, const int n_threads)
+{
+	H.is_of_way_throw(Matrix::Way::HORIZONTAL);
 
+	const auto M = H.get_n_rows();
+	const auto N = H.get_n_cols();
 
-	Hinv.self_resize(M, M, Matrix::Origin::TOP_RIGHT);
+	auto R = Bit_matrix::from_sparse(H);
+	const auto swapped_cols = LDPC_matrix_handler::form_diagonal(R, n_threads); // R = [I P]
 
-	return Hinv;
+	auto G = Sparse_matrix::zero(N, N - M);
+	identity_G(R, M, N, swapped_cols, info_bits_pos, [&](const size_t r, const size_t c) { G.add_connection(r, c); });
+
+	return G;
+}
+
+void swap_columns(LDPC_matrix_handler::LDPC_matrix& mat, size_t idx1, size_t idx2)
+{
+	auto n_row = mat.get_n_rows();
+	std::vector<LDPC_matrix_handler::LDPC_matrix::value_type> tmp(n_row);
+	for (size_t l = 0; l < n_row; l++) tmp[l]       = mat[l][idx1];
+	for (size_t l = 0; l < n_row; l++) mat[l][idx1] = mat[l][idx2];
+	for (size_t l = 0; l < n_row; l++) mat[l][idx2] = tmp[l];
 }
 
+
 /* // Benjamin's version
 template<bool allow_rank_deficient = true>
 LDPC_matrix_handler::LDPC_matrix LU_decomp2(const LDPC_matrix_handler::LDPC_matrix& Hp)
@@ -423,10 +431,22 @@ LDPC_matrix_handler::LDPC_matrix LDPC_matrix_handler
 
 	auto Ht = H.turn(Matrix::Way::HORIZONTAL);
 
-	auto M = Ht.get_n_rows();
-	Ht.self_resize(M, M, Matrix::Origin::TOP_RIGHT);
+	const auto M = Ht.get_n_rows();
+	const auto K = Ht.get_n_cols() - M;
 
-	return LU_decomp(tools::sparse_to_full<V>(Ht));
+	// [H2 I] -> [I inv(H2)]
+	Bit_matrix A(M, 2 * M);
+	for (size_t r = 0; r < M; r++)
+	{
+		for (auto c : Ht.get_cols_from_row(r))
+			if (c >= K)
+				A.set(r, c - K);
+		A.set(r, M + r);
+	}
+
+	invert_H2(A, M, 1);
+
+	return A.resize(M, M, Matrix::Origin::TOP_RIGHT).to_full<V>();
 }
 
 LDPC_matrix_handler::LDPC_matrix LDPC_matrix_handler
@@ -434,91 +454,46 @@ LDPC_matrix_handler::LDPC_matrix LDPC_matrix_handler
 {
 	H.is_of_way_throw(Matrix::Way::HORIZONTAL);
 
-	auto M = H.get_n_rows();
-	auto Hp = H.resize(M, M, Matrix::Origin::TOP_RIGHT); // parity part of H -> Horizontal M * M
-
-	return LU_decomp(Hp);
+	return LDPC_matrix_handler::LU_decomposition(full_to_sparse(H));
 }
 
 // Benjamin's version
 LDPC_matrix_handler::LDPC_matrix LDPC_matrix_handler
-::transform_H_to_G_decomp_LU(const LDPC_matrix& H, Positions_vector& info_bits_pos)
+::transform_H_to_G_decomp_LU(const LDPC_matrix& H, Positions_vector& info_bits_pos, const int n_threads)
 {
-	auto M = H.get_n_rows();
-	auto N = H.get_n_cols();
-	auto K = N - M;
-
-	LDPC_matrix Gp = LU_decomposition(H); // Gp is VERTICAL -> M * M
-
-
-	auto Hs = H.resize(M, K, Matrix::Origin::TOP_LEFT); // systematic part of H
-	Hs.self_transpose();
-	auto GH = bgemmt(Gp, Hs); // Gp * Hs -> horizontal M * K
-	// GH.self_resize(GH.get_n_rows(), GH.get_n_cols() - M, Matrix::Origin::TOP_LEFT); // remove right part
-	GH.self_transpose(); // now vertical K * M
-
-	// add identity on the left part
-	GH.self_resize(K, N, Matrix::Origin::TOP_RIGHT);
-	for (size_t r = 0; r < K; r++)
-		GH[r][r] = 1;
-
-	// GH is now G -> K * N
-
+	H.is_of_way_throw(Matrix::Way::HORIZONTAL);
 
-	// // check that G is good
-	// Hp.self_transpose(); // now vertical M*M
-	// auto GHp = bgemmt(Gp, Hp); // Gp * Hp
+	const auto M = H.get_n_rows();
+	const auto N = H.get_n_cols();
 
-	// // remove the identy
-	// auto min_size = std::min(GHp.get_n_rows(), GHp.get_n_cols());
-	// for (size_t r = 0; r < min_size; r++)
-	// 	GHp[r][r] = !GHp[r][r];
+	auto A = pack_H2_H1(full_to_sparse(H));
+	invert_H2(A, M, n_threads);
 
-	// if (!all_zeros(GHp))
-	// 	throw runtime_error(__FILE__, __LINE__, __func__, "Generated Gp from H is not good (Gp * Hp != Identity).");
+	LDPC_matrix G(N - M, N);
+	decomp_LU_G(A, M, N, [&](const size_t r, const size_t c) { G[r][c] = 1; });
+	G.parse_connections();
 
-	info_bits_pos.resize(K);
+	info_bits_pos.resize(N - M);
 	std::iota(info_bits_pos.begin(), info_bits_pos.end(), 0);
 
-	return GH;
+	return G;
 }
 
 // Valentin's version
 LDPC_matrix_handler::LDPC_matrix LDPC_matrix_handler
-::transform_H_to_G_identity(const LDPC_matrix& H, Positions_vector& info_bits_pos)
+::transform_H_to_G_identity(const LDPC_matrix& H, Positions_vector& info_bits_pos, const int n_threads)
 {
 	H.is_of_way_throw(Matrix::Way::HORIZONTAL);
-	auto G = H;
 
-	auto M = H.get_n_rows();
-	auto N = H.get_n_cols();
-	auto K = N - M;
-
-	auto swapped_cols = LDPC_matrix_handler::form_diagonal(G, Matrix::Origin::TOP_LEFT);
-	LDPC_matrix_handler::form_identity(G, Matrix::Origin::TOP_LEFT);
+	const auto M = H.get_n_rows();
+	const auto N = H.get_n_cols();
 
+	auto R = Bit_matrix::from_full(H);
+	const auto swapped_cols = LDPC_matrix_handler::form_diagonal(R, n_threads); // R = [I P]
 
-	// erase the just created M*M identity in the left part of H and add the K*K identity below
-	G.self_resize(N, K, Matrix::Origin::TOP_RIGHT);
-	for (auto i = M; i < N; i++) // Add rising diagonal identity at the end
-		G[i][i - M] = 1;
-
-	// G is now VERTICAL
-
-	// Re-organization: get G
-	for (auto l = swapped_cols.size(); l > 0; l--)
-		std::swap(G[swapped_cols[l-1].first], G[swapped_cols[l-1].second]);
-
-	// return info bits positions
-	info_bits_pos.resize(K);
-
-	Positions_vector bits_pos(N);
-	std::iota(bits_pos.begin(), bits_pos.end(), 0);
-
-	for (auto& p : swapped_cols)
-		std::swap(bits_pos[p.first], bits_pos[p.second]);
-
-	std::copy(bits_pos.begin() + M, bits_pos.end(), info_bits_pos.begin());
+	LDPC_matrix G(N, N - M);
+	identity_G(R, M, N, swapped_cols, info_bits_pos, [&](const size_t r, const size_t c) { G[r][c] = 1; });
+	G.parse_connections();
 
 	return G;
 }
@@ -575,57 +550,11 @@ LDPC_matrix_handler::Positions_pair_vector LDPC_matrix_handler
 	switch (o)
 	{
 		case Matrix::Origin::TOP_LEFT:
-			for (size_t i = 0; i < n_row; i++)
-			{
-				bool found = mat[i][i];
-
-				if (!found)
-				{
-					// try to find an other row which as a 1 in column i
-					for (auto j = i +1; j < n_row; j++)
-						if (mat[j][i])
-						{
-							std::swap(mat[i], mat[j]);
-							found = true;
-							break;
-						}
-
-
-					if (!found) // no other row after (i+1) of the same column i with a 1
-					{
-						for (auto j = i +1; j < n_col; j++) // find an other column which is good on row i
-						{
-							if (mat[i][j])
-							{
-								swapped_cols.push_back(std::make_pair(i,j));
-
-								swap_columns(mat, i, j);
-
-								found = true;
-								break;
-							}
-						}
-					}
-				}
-
-				if (found)
-				{
-					// there is a 1 on row i of the column i
-					// then remove any 1 of the column i from the row (i+1)
-					for (auto j = i +1; j < n_row; j++)
-		 				if (mat[j][i])
-							std::transform(mat[i].begin() + i, mat[i].end(), //ref
-							               mat[j].begin() + i, mat[j].begin() + i,
-							               std::not_equal_to<LDPC_matrix::value_type>());
-				}
-				else
-				{
-					// the row is the null vector then delete it
-					mat.erase_row(i);
-					i--;
-					n_row--;
-				}
-			}
+		{
+			auto bits = Bit_matrix::from_full(mat);
+			swapped_cols = LDPC_matrix_handler::form_diagonal(bits);
+			mat = bits.to_full<LDPC_matrix::value_type>();
+		}
 		break;
 		case Matrix::Origin::TOP_RIGHT:
 			for (size_t i = 0; i < n_row; i++)
@@ -820,15 +749,11 @@ void LDPC_matrix_handler
 	switch (o)
 	{
 		case Matrix::Origin::TOP_LEFT:
-			for (auto c = n_row - 1; c > 0; c--)
-			{
-				auto ref_row = c;
-				for (auto r = c; r > 0; r--)
-					if (mat[r - 1][c])
-						std::transform (mat[ref_row].begin() + c, mat[ref_row].end(), // ref
-						                mat[r - 1  ].begin() + c, mat[r - 1  ].begin() + c,
-						                std::not_equal_to<LDPC_matrix::value_type>());
-			}
+		{
+			auto bits = Bit_matrix::from_full(mat);
+			LDPC_matrix_handler::form_identity(bits);
+			mat = bits.to_full<LDPC_matrix::value_type>();
+		}
 		break;
 		case Matrix::Origin::TOP_RIGHT:
 			for (auto c = diff; c < (n_col - 1); c++)
@@ -866,6 +791,30 @@ void LDPC_matrix_handler
 	}
 }
 
+LDPC_matrix_handler::Positions_pair_vector LDPC_matrix_handler
+::form_diagonal(Bit_matrix& mat, const int n_threads)
+{
+	mat.self_turn(Matrix::Way::HORIZONTAL);
+
+	// same pivots and same swapped columns than the TOP_LEFT version on the LDPC_matrix, the null rows are erased
+	Positions_pair_vector swapped_cols;
+	mat.gauss_jordan(mat.get_n_cols(), &swapped_cols, n_threads);
+
+	return swapped_cols;
+}
+
+void LDPC_matrix_handler
+::form_identity(Bit_matrix& mat)
+{
+	mat.self_turn(Matrix::Way::HORIZONTAL);
+
+	const auto n_row = mat.get_n_rows();
+	for (auto c = n_row - 1; c > 0 && c < n_row; c--)
+		for (auto r = c; r > 0; r--)
+			if (mat.get(r - 1, c))
+				mat.xor_rows(r - 1, c, c);
+}
+
 Sparse_matrix LDPC_matrix_handler
 ::interleave_matrix(const Sparse_matrix& mat, Positions_vector& old_cols_pos)
 {
@@ -929,67 +878,47 @@ LDPC_matrix_handler::Positions_vector LDPC_matrix_handler
 bool LDPC_matrix_handler
 ::check_GH(const Sparse_matrix& H, const Sparse_matrix& G)
 {
-	Sparse_matrix GH;
+	if (H.get_way() == Matrix::Way::VERTICAL && G.get_way() == Matrix::Way::VERTICAL)
+		throw runtime_error(__FILE__, __LINE__, __func__, "G and H can't be both in VERTICAL way.");
+
+	const auto Hh = H.turn(Matrix::Way::HORIZONTAL); // M x N
+	const auto Gh = G.turn(Matrix::Way::HORIZONTAL); // K x N
 
-	switch (H.get_way())
+	if (Hh.get_n_cols() != Gh.get_n_cols())
 	{
-		case Matrix::Way::HORIZONTAL:
-			switch (G.get_way())
-			{
-				case Matrix::Way::HORIZONTAL:
-					GH = bgemmt(H, G);
-				break;
-				case Matrix::Way::VERTICAL:
-					GH = bgemm(H, G);
-				break;
-			}
-		break;
-		case Matrix::Way::VERTICAL:
-			switch (G.get_way())
-			{
-				case Matrix::Way::HORIZONTAL:
-					GH = bgemm(G, H);
-				break;
-				case Matrix::Way::VERTICAL:
-					throw runtime_error(__FILE__, __LINE__, __func__, "G and H can't be both in VERTICAL way.");
-				break;
-			}
-		break;
+		std::stringstream message;
+		message << "'H' and 'G' have to share the codeword dimension ('H' = " << H.get_n_rows() << "x" << H.get_n_cols()
+		        << ", 'G' = " << G.get_n_rows() << "x" << G.get_n_cols() << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the columns of G packed in 64-bit words (N x K)
+	Bit_matrix Gt(Gh.get_n_cols(), Gh.get_n_rows());
+	for (size_t k = 0; k < Gh.get_n_rows(); k++)
+		for (auto n : Gh.get_cols_from_row(k))
+			Gt.set(n, k);
+
+	// each check node has to be satisfied by all the rows of G
+	std::vector<Bit_matrix::word_t> chk(Gt.get_n_words());
+	for (size_t m = 0; m < Hh.get_n_rows(); m++)
+	{
+		std::fill(chk.begin(), chk.end(), (Bit_matrix::word_t)0);
+		for (auto n : Hh.get_cols_from_row(m))
+		{
+			const auto col = Gt[n];
+			for (size_t w = 0; w < chk.size(); w++)
+				chk[w] ^= col[w];
+		}
+
+		if (std::any_of(chk.begin(), chk.end(), [](const Bit_matrix::word_t x) { return x != 0; }))
+			return false;
 	}
 
-	return all_zeros(GH);
+	return true;
 }
 
 bool LDPC_matrix_handler
 ::check_GH(const LDPC_matrix& H, const LDPC_matrix& G)
 {
-	LDPC_matrix GH;
-
-	switch (H.get_way())
-	{
-		case Matrix::Way::HORIZONTAL:
-			switch (G.get_way())
-			{
-				case Matrix::Way::HORIZONTAL:
-					GH = bgemmt(H, G);
-				break;
-				case Matrix::Way::VERTICAL:
-					GH = bgemm(H, G);
-				break;
-			}
-		break;
-		case Matrix::Way::VERTICAL:
-			switch (G.get_way())
-			{
-				case Matrix::Way::HORIZONTAL:
-					GH = bgemm(G, H);
-				break;
-				case Matrix::Way::VERTICAL:
-					throw runtime_error(__FILE__, __LINE__, __func__, "G and H can't be both in VERTICAL way.");
-				break;
-			}
-		break;
-	}
-
-	return all_zeros(GH);
+	return LDPC_matrix_handler::check_GH(full_to_sparse(H), full_to_sparse(G));
 }
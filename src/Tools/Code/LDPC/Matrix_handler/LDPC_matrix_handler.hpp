@@ -9,6 +9,7 @@
 #include <mipp.h>
 
 #include "Tools/Algo/Matrix/matrix_utils.h"
+#include "Tools/Algo/Matrix/Bit_matrix/Bit_matrix.hpp"
 
 namespace aff3ct
 {
@@ -56,15 +57,23 @@ public:
 	/*
 	 * \brief Reorder rows and columns to create a diagonal of binary ones from the given origin of the matrix.
 	 * Matrix is turned in Horizontal way
+	 * With the TOP_LEFT origin, the work is done on a bit-packed matrix (see below) and the diagonal is an identity.
 	 * \return swapped columns positions pairs. Warning, a column might be swapped several times.
 	 */
 	static Positions_pair_vector form_diagonal(LDPC_matrix& mat, Matrix::Origin o = Matrix::Origin::TOP_LEFT);
 
+	/*
+	 * \brief Same as above with the TOP_LEFT origin on a bit-packed matrix (Gauss-Jordan elimination with the Method
+	 *        of the Four Russians): the rows above the diagonal are also cleared so the left part is the identity.
+	 */
+	static Positions_pair_vector form_diagonal(Bit_matrix& mat, const int n_threads = 1);
+
 	/*
 	 * Reorder rows and columns to create an identity of binary ones on the left part of the matrix.
 	 * This function need you call first form_diagonal().
 	 */
 	static void form_identity(LDPC_matrix& mat, Matrix::Origin o = Matrix::Origin::TOP_LEFT);
+	static void form_identity(Bit_matrix&  mat);
 
 	/*
 	 * \brief Compute a G matrix related to the given H matrix. This method favors a hallowed generator matrix build.
@@ -72,9 +81,12 @@ public:
 	 * \return G horizontal with a guarantee to have the identity on the left part.
 	 * \param info_bits_pos is filled with the positions (that are 0 to K-1) of the information bits.
 	 * \param H (in Horizontal way) is the parity matrix from which G is built.
+	 * \param n_threads is the number of threads used by the Gaussian elimination.
 	 */
-	static Sparse_matrix transform_H_to_G_decomp_LU(const Sparse_matrix& H, Positions_vector& info_bits_pos);
-	static LDPC_matrix   transform_H_to_G_decomp_LU(const LDPC_matrix&   H, Positions_vector& info_bits_pos);
+	static Sparse_matrix transform_H_to_G_decomp_LU(const Sparse_matrix& H, Positions_vector& info_bits_pos,
+	                                                const int n_threads = 1);
+	static LDPC_matrix   transform_H_to_G_decomp_LU(const LDPC_matrix&   H, Positions_vector& info_bits_pos,
+	                                                const int n_threads = 1);
 
 	/*
 	 * \brief Compute a G matrix related to the given H matrix. This method builds a matrix by creating an identity on
@@ -82,9 +94,12 @@ public:
 	 * \return G vertical with not necessary an identity.
 	 * \param info_bits_pos is filled with the positions (between 0 to N-1) of the information bits in G.
 	 * \param H (in Horizontal way) is the parity matrix from which G is built.
+	 * \param n_threads is the number of threads used by the Gaussian elimination.
 	 */
-	static Sparse_matrix transform_H_to_G_identity(const Sparse_matrix& H, Positions_vector& info_bits_pos);
-	static LDPC_matrix   transform_H_to_G_identity(const LDPC_matrix&   H, Positions_vector& info_bits_pos);
+	static Sparse_matrix transform_H_to_G_identity(const Sparse_matrix& H, Positions_vector& info_bits_pos,
+	                                               const int n_threads = 1);
+	static LDPC_matrix   transform_H_to_G_identity(const LDPC_matrix&   H, Positions_vector& info_bits_pos,
+	                                               const int n_threads = 1);
 
 	/*
 	 * integrate an interleaver inside the matrix to avoid this step.
@@ -104,6 +119,7 @@ public:
 
 	/*
 	 * inverse H2 (H = [H1 H2] with size(H2) = M x M) to allow encoding with p = H1 x inv(H2) x u
+	 * the inversion is a bit-packed Gauss-Jordan elimination (Method of the Four Russians)
 	 */
 	static LDPC_matrix LU_decomposition(const Sparse_matrix& H);
 	static LDPC_matrix LU_decomposition(const LDPC_matrix&   H);
@@ -112,7 +128,7 @@ public:
 	/*
 	 * \brief Compute a G.H to check if result is a null vector
 	 *        H and G can be permuted except both vertical, the function handle their order
-	 *        Best performance check is when do not have the same way
+	 *        G is packed in 64-bit words: each check node XORs the packed columns of G of its variable nodes
 	 * \return true if G.H == 0
 	 */
 	static bool check_GH(const Sparse_matrix& H, const Sparse_matrix& G);
@@ -121,7 +137,7 @@ public:
 	/*
 	 * \brief Compute a G.H to check if result is a null vector
 	 *        H and G can be permuted except both vertical, the function handle their order
-	 *        Best performance check is when both are horizontal
+	 *        The matrices are converted in sparse matrices and checked as above
 	 * \return true if G.H == 0
 	 */
 	static bool check_GH(const LDPC_matrix& H, const LDPC_matrix& G);
@@ -0,0 +1,53 @@
+#include <cmath>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Phi_table.hpp"
+
+using namespace aff3ct::tools;
+
+Phi_table
+::Phi_table(const int in_frac_bits, const int out_frac_bits)
+{
+	if (in_frac_bits < 0 || in_frac_bits > 12)
+	{
+		std::stringstream message;
+		message << "'in_frac_bits' has to be between 0 and 12 ('in_frac_bits' = " << in_frac_bits << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (out_frac_bits < 0 || out_frac_bits > 12)
+	{
+		std::stringstream message;
+		message << "'out_frac_bits' has to be between 0 and 12 ('out_frac_bits' = " << out_frac_bits << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	const auto in_lsb    = std::ldexp(1.0, -in_frac_bits);
+	const auto out_scale = std::ldexp(1.0, +out_frac_bits);
+
+	for (auto i = 0; i < 128; i++)
+	{
+		const auto x = i ? i * in_lsb : in_lsb / 4.0;
+		const auto v = std::min(127.0, std::round(Phi_table::phi(x) * out_scale));
+		this->table.push_back((int8_t)v);
+
+		if (v == 0.0)
+			break;
+	}
+
+	// the size is rounded up to a multiple of 16 with the last value
+	const auto last = this->table.back();
+	while (this->table.size() % 16)
+		this->table.push_back(last);
+}
+
+double Phi_table
+::phi(const double x)
+{
+	// -log(tanh(x/2)) = log((1 + e^-x) / (1 - e^-x)), accurate for the small and the large values of x
+	const auto e = std::exp(-x);
+	return std::log1p(e) - std::log1p(-e);
+}
@@ -0,0 +1,55 @@
+#ifndef PHI_TABLE_HPP_
+#define PHI_TABLE_HPP_
+
+#include <vector>
+#include <cstdint>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Phi_table
+ *
+ * \brief Lookup table of the fixed-point phi(x) = -log(tanh(x/2)) transform used by the table-driven SPA update
+ *        rules.
+ *
+ * The input x has 'in_frac_bits' fractional bits, the output has 'out_frac_bits' fractional bits and is saturated to
+ * 127. phi(0) is infinite: the entry 0 is evaluated at a quarter of the input LSB. The phi function decreases quickly
+ * so the table is small: it stops at the first null value (all the greater indexes give the last value) and its size
+ * is rounded up to a multiple of 16 (128 entries at most).
+ *
+ * The lookups of the int8_t and int16_t indexes are vectorized with byte shuffles (one shuffle and one blend per
+ * block of 16 entries) when SSSE3 or AVX2 are available.
+ */
+class Phi_table
+{
+private:
+	std::vector<int8_t> table;
+
+public:
+	Phi_table(const int in_frac_bits, const int out_frac_bits);
+
+	virtual ~Phi_table() = default;
+
+	inline int get_size() const { return (int)this->table.size(); }
+
+	/*!
+	 * \brief Value of the table for a positive index (the indexes greater than the size give the last value).
+	 */
+	inline int8_t operator()(const int idx) const;
+
+	/*!
+	 * \brief 'out[i] = table[idx[i]]' with 'idx[i]' in [0, get_size()[ ('idx' and 'out' can be the same).
+	 */
+	template <typename T>
+	inline void lookup(const T *idx, T *out, const int n) const;
+
+	static double phi(const double x);
+};
+}
+}
+
+#include "Phi_table.hxx"
+
+#endif /* PHI_TABLE_HPP_ */
@@ -0,0 +1,109 @@
+#include <algorithm>
+
+#if defined(__AVX2__) || defined(__SSSE3__)
+#include <immintrin.h>
+#endif
+
+#include "Phi_table.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+namespace phi_table
+{
+// vectorized lookups: return the number of processed elements, the remaining ones are processed by the caller
+template <typename T>
+inline int lookup_simd(const int8_t *tab, const int size, const T *idx, T *out, const int n)
+{
+	return 0;
+}
+
+inline int lookup_simd(const int8_t *tab, const int size, const int8_t *idx, int8_t *out, const int n)
+{
+	auto i = 0;
+#if defined(__AVX2__)
+	for (; i + 32 <= n; i += 32)
+	{
+		const auto id  = _mm256_loadu_si256((const __m256i*)(idx + i));
+		      auto res = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)tab)), id);
+		for (auto k = 16; k < size; k += 16)
+		{
+			const auto t = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)(tab + k)));
+			const auto m = _mm256_cmpgt_epi8(id, _mm256_set1_epi8((char)(k -1)));
+			res = _mm256_blendv_epi8(res, _mm256_shuffle_epi8(t, id), m);
+		}
+		_mm256_storeu_si256((__m256i*)(out + i), res);
+	}
+#endif
+#if defined(__SSSE3__)
+	for (; i + 16 <= n; i += 16)
+	{
+		const auto id  = _mm_loadu_si128((const __m128i*)(idx + i));
+		      auto res = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)tab), id);
+		for (auto k = 16; k < size; k += 16)
+		{
+			const auto t = _mm_loadu_si128((const __m128i*)(tab + k));
+			const auto m = _mm_cmpgt_epi8(id, _mm_set1_epi8((char)(k -1)));
+			res = _mm_or_si128(_mm_and_si128(m, _mm_shuffle_epi8(t, id)), _mm_andnot_si128(m, res));
+		}
+		_mm_storeu_si128((__m128i*)(out + i), res);
+	}
+#endif
+	return i;
+}
+
+inline int lookup_simd(const int8_t *tab, const int size, const int16_t *idx, int16_t *out, const int n)
+{
+	// the high byte of the 16-bit indexes is set to 0x80: the shuffles set the high bytes of the results to 0
+	auto i = 0;
+#if defined(__AVX2__)
+	for (; i + 16 <= n; i += 16)
+	{
+		const auto id  = _mm256_loadu_si256((const __m256i*)(idx + i));
+		const auto bid = _mm256_or_si256(id, _mm256_set1_epi16((short)0x8000));
+		      auto res = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)tab)), bid);
+		for (auto k = 16; k < size; k += 16)
+		{
+			const auto t = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)(tab + k)));
+			const auto m = _mm256_cmpgt_epi16(id, _mm256_set1_epi16((short)(k -1)));
+			res = _mm256_blendv_epi8(res, _mm256_shuffle_epi8(t, bid), m);
+		}
+		_mm256_storeu_si256((__m256i*)(out + i), res);
+	}
+#endif
+#if defined(__SSSE3__)
+	for (; i + 8 <= n; i += 8)
+	{
+		const auto id  = _mm_loadu_si128((const __m128i*)(idx + i));
+		const auto bid = _mm_or_si128(id, _mm_set1_epi16((short)0x8000));
+		      auto res = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)tab), bid);
+		for (auto k = 16; k < size; k += 16)
+		{
+			const auto t = _mm_loadu_si128((const __m128i*)(tab + k));
+			const auto m = _mm_cmpgt_epi16(id, _mm_set1_epi16((short)(k -1)));
+			res = _mm_or_si128(_mm_and_si128(m, _mm_shuffle_epi8(t, bid)), _mm_andnot_si128(m, res));
+		}
+		_mm_storeu_si128((__m128i*)(out + i), res);
+	}
+#endif
+	return i;
+}
+}
+
+int8_t Phi_table
+::operator()(const int idx) const
+{
+	return this->table[std::min(idx, this->get_size() -1)];
+}
+
+template <typename T>
+void Phi_table
+::lookup(const T *idx, T *out, const int n) const
+{
+	auto i = phi_table::lookup_simd(this->table.data(), this->get_size(), idx, out, n);
+	for (; i < n; i++)
+		out[i] = (T)this->table[idx[i]];
+}
+}
+}
@@ -0,0 +1,134 @@
+#ifndef UPDATE_RULE_SPA_TABLE_HPP
+#define UPDATE_RULE_SPA_TABLE_HPP
+
+#include <sstream>
+#include <cassert>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <algorithm>
+#include <type_traits>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Code/LDPC/Update_rule/SPA_table/Phi_table.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Update_rule_SPA_table
+ *
+ * \brief Fixed-point Sum Product Algorithm (in the phi domain, like the LSPA) with lookup tables, for the quantized
+ *        LLRs.
+ *
+ * The check node output is phi(sum_{i != j} phi(|x_i|)) with phi(x) = -log(tanh(x/2)). The LLRs have 'n_frac_bits'
+ * fractional bits, the phi domain values have 'n_phi_frac_bits' fractional bits and their sum is saturated to 127.
+ * With 4 fractional bits in the phi domain, the phi(0) values do not saturate the sum and the small phi values (the
+ * reliable LLRs) keep enough precision for the usual LLR formats. The results are the same than with the
+ * Update_rule_SPA_table_simd.
+ */
+template <typename R = int16_t>
+class Update_rule_SPA_table // Sum Product Algorithm (fixed-point)
+{
+protected:
+	const std::string name;
+	const Phi_table phi_in;  // LLR domain -> phi domain
+	const Phi_table phi_out; // phi domain -> LLR domain
+	std::vector<int> values;
+	int sign;
+	int sum;
+	int n_ite;
+	int ite;
+
+public:
+	Update_rule_SPA_table(const unsigned max_chk_node_degree, const int n_frac_bits, const int n_phi_frac_bits = 4)
+	: name("SPA_TABLE"), phi_in(n_frac_bits, n_phi_frac_bits), phi_out(n_phi_frac_bits, n_frac_bits),
+	  values(max_chk_node_degree), sign(0), sum(0), n_ite(0), ite(0)
+	{
+		if (max_chk_node_degree == 0)
+		{
+			std::stringstream message;
+			message << "'max_chk_node_degree' has to greater than 0.";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (!std::is_integral<R>::value)
+		{
+			std::stringstream message;
+			message << "The 'SPA_TABLE' update rule supports only integer datatypes.";
+			throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	virtual ~Update_rule_SPA_table()
+	{
+	}
+
+	std::string get_name() const
+	{
+		return this->name;
+	}
+
+	inline void begin_decoding(const int n_ite)
+	{
+		this->n_ite = n_ite;
+	}
+
+	inline void begin_ite(const int ite)
+	{
+		this->ite = ite;
+	}
+
+	// incoming values from the variable nodes into the check nodes
+	inline void begin_chk_node_in(const int chk_id, const int chk_degree)
+	{
+		assert(chk_degree <= (int)this->values.size());
+
+		this->sign = 0;
+		this->sum  = 0;
+	}
+
+	inline void compute_chk_node_in(const int var_id, const R var_val)
+	{
+		const auto res      = (int)this->phi_in(std::abs((int)var_val));
+		const auto var_sign = (var_val < 0) ? -1 : 0;
+
+		this->sign          ^= var_sign;
+		this->sum            = std::min(this->sum + res, 127);
+		this->values[var_id] = res;
+	}
+
+	inline void end_chk_node_in()
+	{
+	}
+
+	// outcomming values from the check nodes into the variable nodes
+	inline void begin_chk_node_out(const int chk_id, const int chk_degree)
+	{
+	}
+
+	inline R compute_chk_node_out(const int var_id, const R var_val)
+	{
+		const auto res_abs = (R)this->phi_out(this->sum - this->values[var_id]);
+		const auto res_sgn = this->sign ^ ((var_val < 0) ? -1 : 0);
+
+		return res_sgn ? (R)-res_abs : res_abs;
+	}
+
+	inline void end_chk_node_out()
+	{
+	}
+
+	inline void end_ite()
+	{
+	}
+
+	inline void end_decoding()
+	{
+	}
+};
+}
+}
+
+#endif /* UPDATE_RULE_SPA_TABLE_HPP */
@@ -0,0 +1,156 @@
+#ifndef UPDATE_RULE_SPA_TABLE_SIMD_HPP
+#ifdef __cpp_aligned_new
+#define UPDATE_RULE_SPA_TABLE_SIMD_HPP
+
+#include <sstream>
+#include <cassert>
+#include <vector>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <mipp.h>
+
+#include "Tools/Exception/exception.hpp"
+#include "Tools/Code/LDPC/Update_rule/SPA_table/Phi_table.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Update_rule_SPA_table_simd
+ *
+ * \brief SIMD version of the Update_rule_SPA_table (int8_t and int16_t LLRs), the phi transforms are vectorized
+ *        lookups in the tables (see Phi_table).
+ */
+template <typename R = int16_t>
+class Update_rule_SPA_table_simd // Sum Product Algorithm (fixed-point)
+{
+protected:
+	const std::string name;
+	const Phi_table phi_in;  // LLR domain -> phi domain
+	const Phi_table phi_out; // phi domain -> LLR domain
+	const mipp::Msk<mipp::N<R>()> false_msk;
+	const mipp::Reg<R> zero;
+	const mipp::Reg<R> sum_max;
+	const mipp::Reg<R> in_max;
+	const mipp::Reg<R> out_max;
+	const mipp::Reg<R> neg_max;
+	std::vector<mipp::Reg<R>> values;
+	mipp::vector<R> buffer;
+	mipp::Msk<mipp::N<R>()> sign;
+	mipp::Reg<R> sum;
+
+	int n_ite;
+	int ite;
+
+public:
+	Update_rule_SPA_table_simd(const unsigned max_chk_node_degree, const int n_frac_bits, const int n_phi_frac_bits = 4)
+	: name("SPA_TABLE"), phi_in(n_frac_bits, n_phi_frac_bits), phi_out(n_phi_frac_bits, n_frac_bits), false_msk(false),
+	  zero((R)0), sum_max((R)127), in_max((R)(phi_in.get_size() -1)), out_max((R)(phi_out.get_size() -1)),
+	  neg_max(-std::numeric_limits<R>::max()), values(max_chk_node_degree), buffer(mipp::N<R>()), sign(false),
+	  sum(zero), n_ite(0), ite(0)
+	{
+		if (max_chk_node_degree == 0)
+		{
+			std::stringstream message;
+			message << "'max_chk_node_degree' has to greater than 0.";
+			throw tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		if (!std::is_same<R, int8_t>::value && !std::is_same<R, int16_t>::value)
+		{
+			std::stringstream message;
+			message << "The 'SPA_TABLE' update rule supports only 'int8_t' or 'int16_t' datatypes.";
+			throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	virtual ~Update_rule_SPA_table_simd()
+	{
+	}
+
+	std::string get_name() const
+	{
+		return this->name;
+	}
+
+	// ----------------------------------------------------------------------------------------------------------------
+	// ----------------------------------------------------------------------------------------------------------------
+
+	inline void begin_decoding(const int n_ite)
+	{
+		this->n_ite = n_ite;
+	}
+
+	inline void begin_ite(const int ite)
+	{
+		this->ite = ite;
+	}
+
+	// incoming values from the variable nodes into the check nodes
+	inline void begin_chk_node_in(const int chk_id, const int chk_degree)
+	{
+		assert(chk_degree <= (int)this->values.size());
+
+		this->sign = this->false_msk;
+		this->sum  = this->zero;
+	}
+
+	inline void compute_chk_node_in(const int var_id, const mipp::Reg<R> var_val)
+	{
+		const auto var_abs  = mipp::min(mipp::abs(mipp::max(var_val, this->neg_max)), this->in_max);
+		const auto res      = this->lookup(this->phi_in, var_abs);
+		const auto var_sign = mipp::sign(var_val);
+
+		// saturated sum of positive values (the int8_t additions can wrap around)
+		const auto sum = this->sum + res;
+
+		this->sign          ^= var_sign;
+		this->sum            = mipp::min(mipp::blend(this->sum_max, sum, sum < this->zero), this->sum_max);
+		this->values[var_id] = res;
+	}
+
+	inline void end_chk_node_in()
+	{
+	}
+
+	// outcomming values from the check nodes into the variable nodes
+	inline void begin_chk_node_out(const int chk_id, const int chk_degree)
+	{
+	}
+
+	inline mipp::Reg<R> compute_chk_node_out(const int var_id, const mipp::Reg<R> var_val)
+	{
+		const auto res_idx = mipp::min(this->sum - this->values[var_id], this->out_max);
+		const auto res_abs = this->lookup(this->phi_out, res_idx);
+		const auto res_sng = this->sign ^ mipp::sign(var_val);
+
+		return mipp::copysign(res_abs, res_sng);
+	}
+
+	inline void end_chk_node_out()
+	{
+	}
+
+	inline void end_ite()
+	{
+	}
+
+	inline void end_decoding()
+	{
+	}
+
+protected:
+	inline mipp::Reg<R> lookup(const Phi_table &table, const mipp::Reg<R> idx)
+	{
+		idx.store(this->buffer.data());
+		table.lookup(this->buffer.data(), this->buffer.data(), mipp::N<R>());
+		return mipp::Reg<R>(this->buffer.data());
+	}
+};
+}
+}
+
+#endif
+#endif /* UPDATE_RULE_SPA_TABLE_SIMD_HPP */
@@ -4,8 +4,7 @@
 
 #include <cmath>
 #include <limits>
-#include <fstream>
-#include <iostream>
+#include <cstring>
 #include <algorithm>
 
 #include "Frozenbits_generator_GA.hpp"
@@ -14,7 +13,8 @@ using namespace aff3ct::tools;
 
 Frozenbits_generator_GA
 ::Frozenbits_generator_GA(const int K, const int N)
-: Frozenbits_generator(K, N), m((int)std::log2(N)), z((int)std::exp2(m), 0)
+: Frozenbits_generator(K, N), m((int)std::log2(N)), z(N, 0), z_cn(N / 2, 0), keys(N), keys_tmp(N),
+  channels_tmp(N), last_sigma(-1.0)
 {
 }
 
@@ -22,31 +22,87 @@ void Frozenbits_generator_GA
 ::evaluate()
 {
 	this-> check_noise();
-	
-	for (unsigned i = 0; i != this->best_channels.size(); i++)
-		this->best_channels[i] = i;
 
-	for (auto i = 0; i < std::exp2(m); i++)
-		z[i] = 2.0 / std::pow((double)this->n->get_noise(), 2.0);
+	const auto sigma = (double)this->n->get_noise();
+	if (sigma == last_sigma)
+		return; // the best channels are already up to date
 
-	for (auto l = 1; l <= m; l++)
+	// breadth-first evaluation: at the level 'l', 'z[j]' is the bit-channel 'j' of the code of size 2^l, its check
+	// node and its variable node children are the bit-channels '2j' and '2j +1' of the level 'l +1'
+	z[0] = 2.0 / (sigma * sigma);
+	for (auto l = 0; l < m; l++)
 	{
-		auto o1 = (int)std::exp2(m - l +1);
-		auto o2 = (int)std::exp2(m - l   );
+		const auto n_nodes = 1 << l;
 
-		for (auto t = 0; t < (int)std::exp2(l -1); t++)
+		const auto vec_loop_size = (n_nodes / mipp::nElReg<double>()) * mipp::nElReg<double>();
+		for (auto j = 0; j < vec_loop_size; j += mipp::nElReg<double>())
 		{
-			double T = z[t * o1];
-
-			z[t * o1] = phi_inv(1.0 - std::pow(1.0 - phi(T), 2.0));
-			if (z[t * o1] == HUGE_VAL)
-				z[t * o1] = T + M_LN2 / (alpha * gamma);
+			const auto r_z = mipp::Reg<double>(&z[j]);
+			this->check_node(r_z).store(&z_cn[j]);
+		}
+		for (auto j = vec_loop_size; j < n_nodes; j++)
+			z_cn[j] = this->check_node(z[j]);
 
-			z[t * o1 + o2] = 2.0 * T;
+		// backward loop: the nodes of the current level are overwritten after being read
+		for (auto j = n_nodes -1; j >= 0; j--)
+		{
+			z[2 * j +1] = 2.0 * z[j];
+			z[2 * j   ] = z_cn[j];
 		}
 	}
 
-	std::sort(this->best_channels.begin(), this->best_channels.end(), [this](int i1, int i2) { return z[i1] > z[i2]; });
+	this->sort_channels();
+	last_sigma = sigma;
+}
+
+void Frozenbits_generator_GA
+::sort_channels()
+{
+	// LSD radix sort by decreasing reliability: the bit patterns of the non-negative doubles are in the same order than
+	// their values, and the passes are stable so the ties stay in the increasing index order
+	constexpr int    n_bits    = 11;
+	constexpr int    n_passes  = (64 + n_bits -1) / n_bits;
+	constexpr size_t n_buckets = (size_t)1 << n_bits;
+
+	const auto n = (size_t)this->N;
+
+	std::vector<size_t> count(n_passes * n_buckets, 0);
+	for (size_t i = 0; i < n; i++)
+	{
+		double pos_z = z[i] + 0.0; // -0.0 becomes +0.0
+		uint64_t bits;
+		std::memcpy(&bits, &pos_z, sizeof(bits));
+
+		keys[i] = ~bits;
+		this->best_channels[i] = (uint32_t)i;
+		for (auto p = 0; p < n_passes; p++)
+			count[p * n_buckets + ((keys[i] >> (p * n_bits)) & (n_buckets -1))]++;
+	}
+
+	for (auto p = 0; p < n_passes; p++)
+	{
+		auto cnt = count.begin() + p * n_buckets;
+		if (std::find(cnt, cnt + n_buckets, n) != cnt + n_buckets)
+			continue; // all the keys have the same digit
+
+		size_t offset = 0;
+		for (size_t d = 0; d < n_buckets; d++)
+		{
+			const auto c = cnt[d];
+			cnt[d] = offset;
+			offset += c;
+		}
+
+		for (size_t i = 0; i < n; i++)
+		{
+			const auto dst = cnt[(keys[i] >> (p * n_bits)) & (n_buckets -1)]++;
+			keys_tmp    [dst] = keys[i];
+			channels_tmp[dst] = this->best_channels[i];
+		}
+
+		std::swap(keys, keys_tmp);
+		std::swap(this->best_channels, channels_tmp);
+	}
 }
 
 double Frozenbits_generator_GA
@@ -67,10 +123,52 @@ double Frozenbits_generator_GA
 		return std::pow(a * std::log(t) + b, c);
 }
 
+double Frozenbits_generator_GA
+::check_node(const double t) const
+{
+	// ln(phi(t))
+	const auto ln_phi = t < phi_pivot ? (0.0564 * t - 0.48560) * t : alpha * std::pow(t, gamma) + beta;
+
+	// ln(1 - (1 - phi(t))^2), the first expression is accurate when phi(t) is close to 1 (unreliable channel), the
+	// second one when phi(t) is close to 0 (reliable channel)
+	const auto ln_x = ln_phi > -M_LN2 ? std::log1p(-std::expm1(ln_phi) * std::expm1(ln_phi))
+	                                  : ln_phi + std::log(2.0 - std::exp(ln_phi));
+
+	// phi_inv(x) from ln(x)
+	if (ln_x > ln_phi_inv_pivot)
+		return 4.304964539 * -0.9567131408 * ln_x / (1 + std::sqrt(1 + 0.9567131408 * ln_x));
+	else
+		return std::pow(a * ln_x + b, c);
+}
+
+mipp::Reg<double> Frozenbits_generator_GA
+::check_node(const mipp::Reg<double> &t) const
+{
+	// same computations than the scalar version: both branches are computed and the invalid lanes (NaN) are
+	// discarded by the blends, 'expm1' and 'log1p' are accurately computed from 'exp' and 'log' (Kahan's tricks)
+	const mipp::Reg<double> one = 1.0;
+
+	const auto ln_phi_lo = (t * 0.0564 - 0.48560) * t;
+	const auto ln_phi_hi = mipp::exp(mipp::log(t) * gamma) * alpha + beta;
+	const auto ln_phi    = mipp::blend(ln_phi_lo, ln_phi_hi, t < mipp::Reg<double>(phi_pivot));
+
+	const auto u      = mipp::exp(ln_phi);
+	const auto expm1  = mipp::blend(ln_phi, (u - one) * ln_phi / mipp::log(u), u == one);
+	const auto y      = mipp::Reg<double>(0.0) - expm1 * expm1;
+	const auto v      = one + y;
+	const auto log1p  = mipp::blend(y, mipp::log(v) * y / (v - one), v == one);
+	const auto ln_x   = mipp::blend(log1p, ln_phi + mipp::log(mipp::Reg<double>(2.0) - u),
+	                                ln_phi > mipp::Reg<double>(-M_LN2));
+
+	const auto z_hi = ln_x * (4.304964539 * -0.9567131408) / (mipp::sqrt(ln_x * 0.9567131408 + one) + one);
+	const auto z_lo = mipp::exp(mipp::log(ln_x * a + b) * c);
+	return mipp::blend(z_hi, z_lo, ln_x > mipp::Reg<double>(ln_phi_inv_pivot));
+}
+
 void Frozenbits_generator_GA
 ::check_noise()
 {
 	Frozenbits_generator::check_noise();
 
 	this->n->is_of_type_throw(tools::Noise_type::SIGMA);
-}
\ No newline at end of file
+}
@@ -1,8 +1,11 @@
 #ifndef FROZENBITS_GENERATOR_GA_HPP_
 #define FROZENBITS_GENERATOR_GA_HPP_
 
+#include <cmath>
 #include <limits>
 #include <vector>
+#include <cstdint>
+#include <mipp.h>
 
 #include "Frozenbits_generator.hpp"
 
@@ -10,11 +13,26 @@ namespace aff3ct
 {
 namespace tools
 {
+/*!
+ * \class Frozenbits_generator_GA
+ *
+ * \brief Gaussian Approximation (GA) construction of the polar codes for the BI-AWGN channel.
+ *
+ * The polarization tree is evaluated level by level on contiguous arrays (SIMD computation of the check node
+ * transform). The 'phi' function and its inverse are composed in the logarithmic domain: the very reliable
+ * bit-channels of the long codes do not underflow. The best channels are sorted with a radix sort (linear in N) and
+ * they are not evaluated again if the noise did not change.
+ */
 class Frozenbits_generator_GA : public Frozenbits_generator
 {
 private:
 	const int m;
-	std::vector<double> z;
+	mipp::vector<double> z;
+	mipp::vector<double> z_cn;
+	std::vector<uint64_t> keys;
+	std::vector<uint64_t> keys_tmp;
+	std::vector<uint32_t> channels_tmp;
+	double last_sigma;
 
 	const double alpha = -0.4527;
 	const double beta  =  0.0218;
@@ -27,6 +45,8 @@ private:
 	const double phi_pivot     = 0.867861;
 	const double phi_inv_pivot = 0.6845772418;
 
+	const double ln_phi_inv_pivot = std::log(phi_inv_pivot);
+
 	const double bisection_max = std::numeric_limits<double>::max();
 
 public:
@@ -39,6 +59,13 @@ protected:
 	double phi    (double t);
 	double phi_inv(double t);
 	virtual void check_noise();
+
+private:
+	void sort_channels();
+
+	// check node transform: phi_inv(1 - (1 - phi(t))^2)
+	double            check_node(const double             t) const;
+	mipp::Reg<double> check_node(const mipp::Reg<double> &t) const;
 };
 }
 }
@@ -1,131 +1,304 @@
-#ifdef _MSC_VER
-#include <direct.h>
-#else
-#include <sys/stat.h>
+#ifndef _USE_MATH_DEFINES
+#define _USE_MATH_DEFINES
 #endif
-#include <dirent.h>
-#include <errno.h>
 
-#include <iostream>
-#include <fstream>
+#include <map>
+#include <cmath>
+#include <tuple>
+#include <queue>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <limits>
 #include <sstream>
 #include <iomanip>
-#include <cmath>
+#include <numeric>
+#include <algorithm>
+#include <functional>
 
 #include "Tools/Exception/exception.hpp"
-#include "Tools/Display/rang_format/rang_format.h"
+#include "Tools/Thread_pinning/Thread_pinning.hpp"
 
 #include "Frozenbits_generator_TV.hpp"
 
 using namespace aff3ct::tools;
 
-const int Frozenbits_generator_TV::Mu = 100;
-
 Frozenbits_generator_TV
-::Frozenbits_generator_TV(const int K, const int N,
-                          const std::string &awgn_codes_dir,
-                          const std::string &bin_pb_path)
-: Frozenbits_generator_file(K, N), m((int)std::log2(N)), awgn_codes_dir(awgn_codes_dir), bin_pb_path(bin_pb_path)
+::Frozenbits_generator_TV(const int K, const int N, const std::string &awgn_codes_dir, const int mu,
+                          const int n_threads)
+: Frozenbits_generator_file(K, N),
+  m((int)std::log2(N)),
+  awgn_codes_dir(awgn_codes_dir),
+  mu(mu),
+  n_threads(n_threads > 0 ? n_threads : std::max(1, (int)std::thread::hardware_concurrency()))
 {
+	if (mu < 4 || mu % 2)
+	{
+		std::stringstream message;
+		message << "'mu' has to be an even number greater or equal to 4 ('mu' = " << mu << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
 }
 
 void Frozenbits_generator_TV
 ::evaluate()
 {
-	this-> check_noise();
+	this->check_noise();
 
-	std::ostringstream s_stream;
-	s_stream << std::setiosflags(std::ios::fixed) << std::setprecision(3) << this->n->get_noise();
-	auto str_sigma = s_stream.str();
-	auto str_N = std::to_string(this->N);
-	auto str_m = std::to_string(m);
+	const auto sigma = this->n->get_noise();
 
-	DIR *dp;
-	if ((dp = opendir(awgn_codes_dir.c_str())) == nullptr)
+	// the precomputed files have the priority
+	if (!awgn_codes_dir.empty())
 	{
-		std::stringstream message;
-		message << "The following directory does not exist: '" + awgn_codes_dir + "'.";
-		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+		std::ostringstream s_stream;
+		s_stream << std::setiosflags(std::ios::fixed) << std::setprecision(3) << sigma;
+
+		const auto filename = awgn_codes_dir + "/" + std::to_string(m) + "/N" + std::to_string(this->N) + "_awgn_s" +
+		                      s_stream.str() + ".pc";
+
+		if (this->load_channels_file(filename, this->best_channels))
+			return;
 	}
-	else
+
+	using Key = std::tuple<int,float,int>;
+	static std::mutex mtx;
+	static std::map<Key, std::vector<uint32_t>> memo;
+
+	const Key key(this->N, sigma, this->mu);
 	{
-		closedir(dp);
-		auto sub_folder = awgn_codes_dir + "/" + str_m;
+		std::lock_guard<std::mutex> lock(mtx);
+		auto it = memo.find(key);
+		if (it != memo.end())
+		{
+			this->best_channels = it->second;
+			return;
+		}
+	}
+
+	this->best_channels = this->construct((double)sigma);
+
+	std::lock_guard<std::mutex> lock(mtx);
+	memo[key] = this->best_channels;
+}
+
+std::vector<uint32_t> Frozenbits_generator_TV
+::construct(const double sigma) const
+{
+	std::vector<double> error_probs(this->N);
 
-		if ((dp = opendir(sub_folder.c_str())) == nullptr)
+	// the first levels are evaluated to get enough independent subtrees to keep the threads busy
+	std::vector<std::pair<Channel,int>> subtrees(1, std::make_pair(awgn_channel(sigma, mu / 2), 0));
+	auto level = 0;
+	while (level < m && (int)subtrees.size() < 4 * n_threads)
+	{
+		std::vector<std::pair<Channel,int>> next;
+		for (auto &s : subtrees)
 		{
-			static std::mutex mutex_create_folder;
-			mutex_create_folder.lock();
-			if ((dp = opendir(sub_folder.c_str())) == nullptr)
-			{
-				// mkdir mod = rwx r.x r.x
-#ifdef _MSC_VER // Windows with MSVC
-				if (_mkdir(sub_folder.c_str()) != 0)
-				{
-#elif defined(_WIN32) // MinGW on Windows
-				if (mkdir(sub_folder.c_str()) != 0)
-				{
-#else // UNIX like
-				if (mkdir(sub_folder.c_str(), S_IRWXU | S_IRGRP | S_IXGRP | S_IROTH | S_IXOTH) != 0)
-				{
-#endif
-					mutex_create_folder.unlock();
-					std::stringstream message;
-					message << "Impossible to create '" + sub_folder + "'.";
-					throw runtime_error(__FILE__, __LINE__, __func__, message.str());
-				}
-			}
-			mutex_create_folder.unlock();
+			auto W_minus = transform(s.first, false); merge(W_minus, mu / 2);
+			auto W_plus  = transform(s.first, true ); merge(W_plus,  mu / 2);
+			next.push_back(std::make_pair(std::move(W_minus), s.second                        ));
+			next.push_back(std::make_pair(std::move(W_plus ), s.second + (1 << (m - level -1))));
 		}
-		else
-			closedir(dp);
+		subtrees = std::move(next);
+		level++;
+	}
 
-		auto filename = sub_folder + "/N" + str_N + "_awgn_s" + str_sigma + ".pc";
+	std::atomic<size_t> next_subtree(0);
+	auto worker = [&]()
+	{
+		for (auto s = next_subtree++; s < subtrees.size(); s = next_subtree++)
+			this->explore(subtrees[s].first, level, subtrees[s].second, error_probs);
+	};
 
-		if (!this->load_channels_file(filename, this->best_channels))
+	const auto n_workers = std::min((size_t)n_threads, subtrees.size());
+	std::vector<std::thread> threads;
+	for (size_t t = 1; t < n_workers; t++)
+		threads.push_back(std::thread([&worker]()
 		{
-#ifdef AFF3CT_POLAR_BOUNDS
-			static std::mutex mutex_write_file;
-			mutex_write_file.lock();
-			if (!this->load_channels_file(filename, this->best_channels))
+			// the helper threads don't keep the CPU of a pinned creator
+			Thread_pinning::unpin();
+			worker();
+		}));
+	worker();
+	for (auto &t : threads)
+		t.join();
+
+	// the most reliable channels first, the ties are broken in favor of the highest index
+	std::vector<uint32_t> best(this->N);
+	std::iota(best.begin(), best.end(), 0);
+	std::sort(best.begin(), best.end(), [&error_probs](const uint32_t i1, const uint32_t i2)
+	{
+		return error_probs[i1] < error_probs[i2] || (error_probs[i1] == error_probs[i2] && i1 > i2);
+	});
+
+	return best;
+}
+
+void Frozenbits_generator_TV
+::explore(const Channel &W, const int level, const int index, std::vector<double> &error_probs) const
+{
+	if (level == m)
+	{
+		error_probs[index] = error_prob(W);
+		return;
+	}
+
+	// same indexing than the GA method: the variable node transform sets the bit 'm - level -1' of the index
+	auto W_minus = transform(W, false);
+	merge(W_minus, mu / 2);
+	this->explore(W_minus, level +1, index, error_probs);
+
+	auto W_plus = transform(W, true);
+	merge(W_plus, mu / 2);
+	this->explore(W_plus, level +1, index + (1 << (m - level -1)), error_probs);
+}
+
+Frozenbits_generator_TV::Channel Frozenbits_generator_TV
+::awgn_channel(const double sigma, const int n_pairs)
+{
+	// BPSK (0 -> +1, 1 -> -1), the positive outputs are quantized on a fine uniform grid (the last interval goes to
+	// the infinity) and the intervals are merged: the result is a degraded version of the BI-AWGN channel
+	const auto n_fine = 64 * n_pairs;
+	const auto y_max  = 1.0 + 10.0 * sigma;
+	const auto Q      = [sigma](const double y, const double x) { return 0.5 * std::erfc((y - x) / (sigma * M_SQRT2)); };
+
+	Channel W;
+	W.reserve(n_fine);
+	for (auto i = 0; i < n_fine; i++)
+	{
+		const auto lo = y_max * i / n_fine;
+		const auto hi = y_max * (i +1) / n_fine;
+
+		const auto a = Q(lo, +1.0) - (i == n_fine -1 ? 0.0 : Q(hi, +1.0));
+		const auto b = Q(lo, -1.0) - (i == n_fine -1 ? 0.0 : Q(hi, -1.0));
+		if (a + b > 0.0)
+			W.push_back(std::make_pair(a, std::min(a, b)));
+	}
+
+	merge(W, n_pairs);
+	return W;
+}
+
+Frozenbits_generator_TV::Channel Frozenbits_generator_TV
+::transform(const Channel &W, const bool variable_node)
+{
+	// the ordered couples (i, j) and (j, i) give the same (or the conjugated) output pairs: only i <= j are
+	// computed, with a double weight if i != j
+	Channel R;
+	R.reserve(W.size() * (W.size() +1) / (variable_node ? 1 : 2));
+
+	const auto add = [&R](const double a, const double b)
+	{
+		if (a + b > 0.0)
+			R.push_back(a >= b ? std::make_pair(a, b) : std::make_pair(b, a));
+	};
+
+	for (size_t i = 0; i < W.size(); i++)
+		for (size_t j = i; j < W.size(); j++)
+		{
+			const auto w  = i == j ? 1.0 : 2.0;
+			const auto a1 = W[i].first, b1 = W[i].second;
+			const auto a2 = W[j].first, b2 = W[j].second;
+
+			if (variable_node) // W+(y1, y2, u1 | u2) = W(y1 | u1 ^ u2) W(y2 | u2)
 			{
-				auto cmd = bin_pb_path;
-				cmd += " --no-print";                                      // do not display anything
-				cmd += " -q " + std::to_string(Mu);                        // quality
-				cmd += " --awgn";                                          // type
-				cmd += " --sigma=" + std::to_string(this->n->get_noise()); // sigma value
-				cmd += " --log-length=" + str_m;                           // m
-				cmd += " -f=" + filename;                                  // filename
-
-				// std::clog << rang::tag::info << "Generating best channels positions file (\"" << filename << "\")...\r";
-				// fflush(stdout); fflush(stderr);
-
-				if (system(cmd.c_str()) == 0)
-				{
-					if (!this->load_channels_file(filename, this->best_channels))
-					{
-						mutex_write_file.unlock();
-						std::stringstream message;
-						message << "Can't open '" << filename << "' file.";
-						throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
-					}
-				}
-				else
-				{
-					mutex_write_file.unlock();
-					std::stringstream message;
-					message << "The following command failed: '" << cmd << "'.";
-					throw runtime_error(__FILE__, __LINE__, __func__, message.str());
-				}
+				add(w * a1 * a2, w * b1 * b2);
+				add(w * a1 * b2, w * b1 * a2);
+			}
+			else // W-(y1, y2 | u1) = 1/2 sum_u2 W(y1 | u1 ^ u2) W(y2 | u2)
+			{
+				add(w * (a1 * a2 + b1 * b2), w * (a1 * b2 + b1 * a2));
 			}
-			mutex_write_file.unlock();
-#else
-			std::stringstream message;
-			message << "Can't open '" << filename <<"' file.";
-			throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
-#endif
 		}
+
+	return R;
+}
+
+void Frozenbits_generator_TV
+::merge(Channel &W, const size_t n_pairs)
+{
+	// the pairs are sorted by likelihood ratio, only the neighbors are merged
+	std::sort(W.begin(), W.end(), [](const std::pair<double,double> &p1, const std::pair<double,double> &p2)
+	{
+		return p1.first / (p1.first + p1.second) < p2.first / (p2.first + p2.second);
+	});
+
+	if (W.size() <= n_pairs)
+		return;
+
+	// contribution of a pair to the mutual information
+	const auto C = [](const double a, const double b)
+	{
+		const auto s = a + b;
+		return (a > 0.0 ? a * std::log2(2.0 * a / s) : 0.0) + (b > 0.0 ? b * std::log2(2.0 * b / s) : 0.0);
+	};
+
+	const auto n = W.size();
+	std::vector<size_t>   next(n), prev(n);
+	std::vector<unsigned> version(n, 0);
+	std::vector<bool>     alive(n, true);
+	for (size_t i = 0; i < n; i++)
+	{
+		next[i] = i +1;
+		prev[i] = i -1; // out of range for i = 0
+	}
+
+	// loss of mutual information when the pair 'i' is merged with the next one
+	using Candidate = std::tuple<double, size_t, size_t, unsigned, unsigned>;
+	std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> heap;
+	const auto push = [&](const size_t i)
+	{
+		const auto j = next[i];
+		const auto loss = C(W[i].first, W[i].second) + C(W[j].first, W[j].second)
+		                - C(W[i].first + W[j].first, W[i].second + W[j].second);
+		heap.push(std::make_tuple(loss, i, j, version[i], version[j]));
+	};
+
+	for (size_t i = 0; i +1 < n; i++)
+		push(i);
+
+	auto n_alive = n;
+	while (n_alive > n_pairs)
+	{
+		const auto c = heap.top();
+		heap.pop();
+
+		const auto i = std::get<1>(c);
+		const auto j = std::get<2>(c);
+		if (!alive[i] || next[i] != j || version[i] != std::get<3>(c) || version[j] != std::get<4>(c))
+			continue; // outdated candidate
+
+		W[i].first  += W[j].first;
+		W[i].second += W[j].second;
+		alive[j] = false;
+		version[i]++;
+		n_alive--;
+
+		next[i] = next[j];
+		if (next[j] < n)
+			prev[next[j]] = i;
+
+		if (prev[i] < n)
+			push(prev[i]);
+		if (next[i] < n)
+			push(i);
 	}
+
+	size_t k = 0;
+	for (size_t i = 0; i < n; i++)
+		if (alive[i])
+			W[k++] = W[i];
+	W.resize(k);
+}
+
+double Frozenbits_generator_TV
+::error_prob(const Channel &W)
+{
+	// ML decision: the error probability of a pair is W(y|1) (W(y|0) >= W(y|1))
+	auto pe = 0.0;
+	for (auto &p : W)
+		pe += p.second;
+	return pe;
 }
 
 void Frozenbits_generator_TV
@@ -134,4 +307,4 @@ void Frozenbits_generator_TV
 	Frozenbits_generator::check_noise();
 
 	this->n->is_of_type_throw(tools::Noise_type::SIGMA);
-}
\ No newline at end of file
+}
@@ -3,7 +3,7 @@
 
 #include <string>
 #include <vector>
-#include <mutex>
+#include <utility>
 
 #include "Frozenbits_generator_file.hpp"
 
@@ -11,25 +11,59 @@ namespace aff3ct
 {
 namespace tools
 {
+/*!
+ * \class Frozenbits_generator_TV
+ *
+ * \brief Tal & Vardy construction of the polar codes for the BI-AWGN channel.
+ *
+ * Each bit-channel is approximated by a degraded channel with at most 'mu' output symbols: the BI-AWGN channel is
+ * quantized, then at each level of the polarization tree the check-node (W- = W [*] W) or the variable-node
+ * (W+ = W (*) W) transform is applied and the closest symbols (in likelihood ratio) are merged while the resulting
+ * channel has more than 'mu' symbols (greedy merge with the smallest loss of mutual information). The bit-channels are
+ * sorted by the error probability of their degraded approximation (an upper bound of the true error probability).
+ *
+ * The subtrees of the polarization tree are shared between threads and the best channels are memoized per
+ * (N, sigma, mu), so a noise value is evaluated only once per process.
+ *
+ * If 'awgn_codes_dir' is not empty and contains a best channels file for the current (N, sigma) (in the
+ * "<awgn_codes_dir>/<log2(N)>/N<N>_awgn_s<sigma>.pc" file), this file is read instead.
+ */
 class Frozenbits_generator_TV : public Frozenbits_generator_file
 {
 private:
 	const int m;
 	const std::string awgn_codes_dir;
-	const std::string bin_pb_path;
-
-	const static int Mu; // quality of channels generated
+	const int mu;        // maximum number of output symbols of the approximated bit-channels
+	const int n_threads; // number of threads used to evaluate the bit-channels
 
 public:
-	Frozenbits_generator_TV(const int K, const int N,
-	                        const std::string &awgn_codes_dir,
-	                        const std::string &bin_pb_path);
+	/*!
+	 * \param awgn_codes_dir: directory of the precomputed best channels files (optional).
+	 * \param mu:             maximum number of output symbols of the approximated channels (even, >= 4).
+	 * \param n_threads:      number of threads (if <= 0, the number of hardware threads).
+	 */
+	Frozenbits_generator_TV(const int K, const int N, const std::string &awgn_codes_dir = "", const int mu = 100,
+	                        const int n_threads = 0);
 
 	virtual ~Frozenbits_generator_TV() = default;
 
 protected:
 	void evaluate();
 	virtual void check_noise();
+
+private:
+	// symmetric channel: list of the (W(y|0), W(y|1)) pairs of the couples of conjugated outputs (y, -y), with
+	// W(y|0) >= W(y|1)
+	using Channel = std::vector<std::pair<double,double>>;
+
+	std::vector<uint32_t> construct(const double sigma) const;
+
+	void explore(const Channel &W, const int level, const int index, std::vector<double> &error_probs) const;
+
+	static Channel awgn_channel(const double sigma, const int n_pairs);
+	static Channel transform   (const Channel &W, const bool variable_node);
+	static void    merge       (Channel &W, const size_t n_pairs);
+	static double  error_prob  (const Channel &W);
 };
 }
 }
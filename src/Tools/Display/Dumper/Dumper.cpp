@@ -1,4 +1,5 @@
 #include <string>
+#include <iomanip>
 #include <vector>
 #include <sstream>
 #include <iostream>
@@ -158,9 +159,9 @@ void Dumper
 
 void Dumper
 ::write_header_text(std::ofstream &file, const unsigned n_data, const unsigned data_size,
-                    const std::vector<unsigned> &headers)
+                    const std::vector<unsigned> &headers, const int n_data_width)
 {
-	file << n_data    << std::endl << std::endl;
+	file << std::setw(n_data_width) << n_data << std::endl << std::endl;
 	file << data_size << std::endl << std::endl;
 	for (auto h : headers)
 		file << h << " ";
@@ -190,13 +191,35 @@ template <typename T>
 void Dumper
 ::_write_body_text(std::ofstream &file, const std::vector<std::vector<char>> &buffer, const unsigned size)
 {
-	for (auto b : buffer)
-	{
-		const auto data = (T*)b.data();
-		for (unsigned i = 0; i < size; i++)
-			file << +data[i] << " ";
-		file << std::endl << std::endl;
-	}
+	for (auto &b : buffer)
+		this->_write_frame_text<T>(file, b.data(), size);
+}
+
+void Dumper
+::write_frame_text(std::ofstream &file, const char *frame, const unsigned size, const std::type_index type)
+{
+	if      (type == typeid( int8_t )) this->_write_frame_text< int8_t >(file, frame, size);
+	else if (type == typeid(uint8_t )) this->_write_frame_text<uint8_t >(file, frame, size);
+	else if (type == typeid( int16_t)) this->_write_frame_text< int16_t>(file, frame, size);
+	else if (type == typeid(uint16_t)) this->_write_frame_text<uint16_t>(file, frame, size);
+	else if (type == typeid( int32_t)) this->_write_frame_text< int32_t>(file, frame, size);
+	else if (type == typeid(uint32_t)) this->_write_frame_text<uint32_t>(file, frame, size);
+	else if (type == typeid( int64_t)) this->_write_frame_text< int64_t>(file, frame, size);
+	else if (type == typeid(uint64_t)) this->_write_frame_text<uint64_t>(file, frame, size);
+	else if (type == typeid(float   )) this->_write_frame_text<float   >(file, frame, size);
+	else if (type == typeid(double  )) this->_write_frame_text<double  >(file, frame, size);
+	else
+		throw invalid_argument(__FILE__, __LINE__, __func__, "Unsupported data type.");
+}
+
+template <typename T>
+void Dumper
+::_write_frame_text(std::ofstream &file, const char *frame, const unsigned size)
+{
+	const auto data = (const T*)frame;
+	for (unsigned i = 0; i < size; i++)
+		file << +data[i] << " ";
+	file << std::endl << std::endl;
 }
 
 void Dumper
@@ -212,8 +235,8 @@ void Dumper
 void Dumper
 ::write_body_binary(std::ofstream &file, const std::vector<std::vector<char>> &buffer, const unsigned bytes)
 {
-	for (auto b : buffer)
-		file.write(reinterpret_cast<char*>(b.data()), b.size());
+	for (auto &b : buffer)
+		file.write(b.data(), b.size());
 }
 
 // ==================================================================================== explicit template instantiation
@@ -257,4 +280,11 @@ template void Dumper::_write_body_text<int32_t>(std::ofstream&, const std::vecto
 template void Dumper::_write_body_text<int64_t>(std::ofstream&, const std::vector<std::vector<char>>&, const unsigned);
 template void Dumper::_write_body_text<float  >(std::ofstream&, const std::vector<std::vector<char>>&, const unsigned);
 template void Dumper::_write_body_text<double >(std::ofstream&, const std::vector<std::vector<char>>&, const unsigned);
+
+template void Dumper::_write_frame_text<int8_t >(std::ofstream&, const char*, const unsigned);
+template void Dumper::_write_frame_text<int16_t>(std::ofstream&, const char*, const unsigned);
+template void Dumper::_write_frame_text<int32_t>(std::ofstream&, const char*, const unsigned);
+template void Dumper::_write_frame_text<int64_t>(std::ofstream&, const char*, const unsigned);
+template void Dumper::_write_frame_text<float  >(std::ofstream&, const char*, const unsigned);
+template void Dumper::_write_frame_text<double >(std::ofstream&, const char*, const unsigned);
 // ==================================================================================== explicit template instantiation
@@ -50,16 +50,19 @@ public:
 
 protected:
 	void write_header_text(std::ofstream &file, const unsigned n_data, const unsigned data_size,
-	                       const std::vector<unsigned> &headers);
+	                       const std::vector<unsigned> &headers, const int n_data_width = 0);
 	void write_body_text(std::ofstream &file, const std::vector<std::vector<char>> &buffer, const unsigned size,
 	                     const std::type_index type);
 	void write_header_binary(std::ofstream &file, const unsigned n_data, const unsigned data_size,
 	                         const std::vector<unsigned> &headers);
 	void write_body_binary(std::ofstream &file, const std::vector<std::vector<char>> &buffer, const unsigned bytes);
+	void write_frame_text(std::ofstream &file, const char *frame, const unsigned size, const std::type_index type);
 
 private:
 	template <typename T>
 	void _write_body_text(std::ofstream &file, const std::vector<std::vector<char>> &buffer, const unsigned size);
+	template <typename T>
+	void _write_frame_text(std::ofstream &file, const char *frame, const unsigned size);
 };
 }
 }
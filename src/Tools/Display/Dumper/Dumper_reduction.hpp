@@ -9,7 +9,7 @@ namespace aff3ct
 {
 namespace tools
 {
-class Dumper_reduction : Dumper
+class Dumper_reduction : protected Dumper
 {
 protected:
 	std::vector<std::unique_ptr<Dumper>>& dumpers;
@@ -22,7 +22,7 @@ public:
 	virtual void add  (const int frame_id = 0      );
 	virtual void clear(                            );
 
-private:
+protected:
 	void checks();
 };
 }
@@ -0,0 +1,255 @@
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Dumper_reduction_stream.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+namespace
+{
+// enough characters to rewrite any unsigned number of frames at the beginning of a text file
+const int n_data_width = 10;
+}
+
+Dumper_reduction_stream
+::Dumper_reduction_stream(std::vector<std::unique_ptr<Dumper>> &dumpers, const std::string &tmp_base_path)
+: Dumper_reduction(dumpers), tmp_base_path(tmp_base_path), stop_writer(false)
+{
+	if (tmp_base_path.empty())
+		throw invalid_argument(__FILE__, __LINE__, __func__, "'tmp_base_path' can't be empty.");
+
+	for (auto &d : dumpers)
+	{
+		auto stream = dynamic_cast<Dumper_stream*>(d.get());
+		if (stream == nullptr)
+			throw invalid_argument(__FILE__, __LINE__, __func__, "The dumpers have to be 'Dumper_stream' dumpers.");
+
+		this->streams.push_back(stream);
+	}
+
+	this->writer = std::thread(&Dumper_reduction_stream::writer_loop, this);
+}
+
+Dumper_reduction_stream
+::~Dumper_reduction_stream()
+{
+	this->stop_writer = true;
+	if (this->writer.joinable())
+		this->writer.join();
+
+	this->close_files(true);
+}
+
+void Dumper_reduction_stream
+::writer_loop()
+{
+	while (!this->stop_writer)
+	{
+		size_t n_records = 0;
+		{
+			std::lock_guard<std::mutex> lock(this->mtx_files);
+			for (auto s : this->streams)
+				n_records += this->drain(*s);
+		}
+
+		if (n_records == 0)
+			std::this_thread::sleep_for(std::chrono::microseconds(500));
+	}
+}
+
+size_t Dumper_reduction_stream
+::drain(Dumper_stream &stream)
+{
+	size_t n_records = 0;
+	while (!stream.is_empty())
+	{
+		// after an error the records are still popped, the producers would wait forever otherwise
+		if (this->writer_error.empty())
+		{
+			try
+			{
+				this->write_record(stream, stream.front());
+			}
+			catch (std::exception const& e)
+			{
+				this->writer_error = e.what();
+			}
+		}
+
+		stream.pop();
+		n_records++;
+	}
+
+	return n_records;
+}
+
+void Dumper_reduction_stream
+::wait_empty()
+{
+	for (auto s : this->streams)
+		while (!s->is_empty())
+			std::this_thread::sleep_for(std::chrono::microseconds(100));
+}
+
+void Dumper_reduction_stream
+::open_file(const Dumper_stream &stream, const size_t i)
+{
+	const auto size = stream.registered_data_size[i];
+	const auto bin  = stream.registered_data_bin [i];
+	const auto head = stream.registered_data_head[i];
+
+	const std::string path = this->tmp_base_path + "." + stream.registered_data_ext[i];
+
+	std::unique_ptr<std::ofstream> file;
+	if (bin)
+		file.reset(new std::ofstream(path, std::ofstream::out | std::ios_base::binary | std::ios_base::trunc));
+	else
+		file.reset(new std::ofstream(path, std::ofstream::out | std::ios_base::trunc));
+
+	if (!file->is_open())
+	{
+		std::stringstream message;
+		message << "Impossible to open the file ('path' = " << path << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the number of frames is rewritten when the file is closed
+	if (bin)
+		this->write_header_binary(*file, 0, size, head);
+	else
+		this->write_header_text(*file, 0, size, head, n_data_width);
+
+	this->files [i] = std::move(file);
+	this->paths [i] = path;
+	this->n_data[i] = 0;
+}
+
+void Dumper_reduction_stream
+::close_files(const bool remove)
+{
+	for (size_t i = 0; i < this->files.size(); i++)
+		if (this->files[i] != nullptr)
+		{
+			this->files[i]->close();
+			if (remove)
+				std::remove(this->paths[i].c_str());
+		}
+
+	this->files .clear();
+	this->paths .clear();
+	this->n_data.clear();
+}
+
+void Dumper_reduction_stream
+::write_record(const Dumper_stream &stream, const char *record)
+{
+	const auto n_registered = stream.registered_data_ptr.size();
+	if (this->files.size() != n_registered)
+	{
+		this->files .resize(n_registered);
+		this->paths .resize(n_registered);
+		this->n_data.resize(n_registered, 0);
+	}
+
+	int frame_id;
+	std::memcpy(&frame_id, record, sizeof(int));
+
+	for (size_t i = 0; i < n_registered; i++)
+		if ((unsigned)frame_id < stream.registered_data_n_frames[i])
+		{
+			if (this->files[i] == nullptr)
+				this->open_file(stream, i);
+
+			const auto size    = stream.registered_data_size  [i];
+			const auto size_of = stream.registered_data_sizeof[i];
+			const auto data    = record + stream.record_offsets[i];
+
+			if (stream.registered_data_bin[i])
+				this->files[i]->write(data, size * size_of);
+			else
+				this->write_frame_text(*this->files[i], data, size, stream.registered_data_type[i]);
+
+			this->n_data[i]++;
+		}
+}
+
+void Dumper_reduction_stream
+::dump(const std::string& base_path)
+{
+	this->checks();
+
+	if (base_path.empty())
+		throw invalid_argument(__FILE__, __LINE__, __func__, "'base_path' can't be empty.");
+
+	this->wait_empty();
+
+	std::lock_guard<std::mutex> lock(this->mtx_files);
+
+	if (!this->writer_error.empty())
+	{
+		std::stringstream message;
+		message << "The writer thread failed ('writer_error' = " << this->writer_error << ").";
+		this->writer_error.clear();
+		this->close_files(true);
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// the registered data are the same for all the dumpers (see 'checks')
+	const auto &ref = *this->streams[0];
+	const auto n_registered = ref.registered_data_ptr.size();
+
+	this->files .resize(n_registered);
+	this->paths .resize(n_registered);
+	this->n_data.resize(n_registered, 0);
+
+	for (size_t i = 0; i < n_registered; i++)
+	{
+		// the files without frames are written too
+		if (this->files[i] == nullptr)
+			this->open_file(ref, i);
+
+		auto &file = *this->files[i];
+		file.seekp(0);
+		if (ref.registered_data_bin[i])
+			file.write((char*)&this->n_data[i], sizeof(this->n_data[i]));
+		else
+			file << std::setw(n_data_width) << this->n_data[i];
+		file.close();
+
+		if (file.fail())
+		{
+			std::stringstream message;
+			message << "Impossible to write the file ('path' = " << this->paths[i] << ").";
+			this->close_files(true);
+			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+
+		const std::string path = base_path + "." + ref.registered_data_ext[i];
+		if (std::rename(this->paths[i].c_str(), path.c_str()) != 0)
+		{
+			std::stringstream message;
+			message << "Impossible to rename the file ('tmp_path' = " << this->paths[i] << ", 'path' = " << path
+			        << ").";
+			this->close_files(true);
+			throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+		}
+	}
+
+	this->close_files(false);
+}
+
+void Dumper_reduction_stream
+::clear()
+{
+	this->wait_empty();
+
+	std::lock_guard<std::mutex> lock(this->mtx_files);
+	this->writer_error.clear();
+	this->close_files(true);
+}
@@ -0,0 +1,63 @@
+#ifndef DUMPER_REDUCTION_STREAM_HPP_
+#define DUMPER_REDUCTION_STREAM_HPP_
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <fstream>
+
+#include "Dumper_stream.hpp"
+#include "Dumper_reduction.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Dumper_reduction_stream
+ *
+ * \brief Writes the frames of the 'Dumper_stream' dumpers while the simulation is running.
+ *
+ * A writer thread drains the queues of the dumpers and appends the frames to temporary files ('tmp_base_path.ext').
+ * At the end of a noise point, 'dump' waits for the queues to be empty, writes the number of frames in the header of
+ * the files and renames them ('base_path.ext'). The files have the same format as the ones of the
+ * 'Dumper_reduction' class: the number of frames of the text files is padded with spaces to be rewritten in place.
+ */
+class Dumper_reduction_stream : public Dumper_reduction
+{
+protected:
+	const std::string tmp_base_path;
+
+	std::vector<Dumper_stream*>                 streams;
+	std::vector<std::unique_ptr<std::ofstream>> files;  // one temporary file per registered data
+	std::vector<std::string>                    paths;  // paths of the temporary files
+	std::vector<unsigned>                       n_data; // number of frames written in each file
+
+	std::mutex        mtx_files;
+	std::atomic<bool> stop_writer;
+	std::string       writer_error;
+	std::thread       writer;
+
+public:
+	Dumper_reduction_stream(std::vector<std::unique_ptr<Dumper>> &dumpers, const std::string &tmp_base_path);
+	virtual ~Dumper_reduction_stream();
+
+	virtual void dump (const std::string& base_path);
+	virtual void clear(                            );
+
+protected:
+	void   writer_loop();
+	size_t drain      (Dumper_stream &stream);
+	void   wait_empty ();
+
+	void open_file   (const Dumper_stream &stream, const size_t i);
+	void close_files (const bool remove);
+	void write_record(const Dumper_stream &stream, const char *record);
+};
+}
+}
+
+#endif /* DUMPER_REDUCTION_STREAM_HPP_ */
@@ -0,0 +1,105 @@
+#include <thread>
+#include <cstring>
+#include <sstream>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Dumper_stream.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+Dumper_stream
+::Dumper_stream(const size_t capacity)
+: Dumper(), capacity(capacity), record_bytes(0), ready(false), head(0), tail(0)
+{
+	if (capacity == 0)
+	{
+		std::stringstream message;
+		message << "'capacity' has to be greater than 0 ('capacity' = " << capacity << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+void Dumper_stream
+::allocate_queue()
+{
+	this->record_offsets.clear();
+	this->record_bytes = sizeof(int); // the frame id
+	for (size_t i = 0; i < this->registered_data_ptr.size(); i++)
+	{
+		this->record_offsets.push_back((unsigned)this->record_bytes);
+		this->record_bytes += this->registered_data_size[i] * this->registered_data_sizeof[i];
+	}
+
+	this->queue.resize(this->capacity * this->record_bytes);
+	this->ready.store(true, std::memory_order_release);
+}
+
+void Dumper_stream
+::add(const unsigned n_err, const int frame_id)
+{
+	if (frame_id < 0)
+	{
+		std::stringstream message;
+		message << "'frame_id' has to be positive ('frame_id' = " << frame_id << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (n_err < this->add_threshold)
+		return;
+
+	if (!this->ready.load(std::memory_order_relaxed))
+		this->allocate_queue();
+
+	const auto head = this->head.load(std::memory_order_relaxed);
+
+	// the queue is full: wait for the writer thread
+	while (head - this->tail.load(std::memory_order_acquire) >= this->capacity)
+		std::this_thread::yield();
+
+	auto record = this->queue.data() + (head % this->capacity) * this->record_bytes;
+	std::memcpy(record, &frame_id, sizeof(int));
+
+	for (size_t i = 0; i < this->registered_data_ptr.size(); i++)
+		if ((unsigned)frame_id < this->registered_data_n_frames[i])
+		{
+			const auto bytes = this->registered_data_size[i] * this->registered_data_sizeof[i];
+			std::memcpy(record + this->record_offsets[i], this->registered_data_ptr[i] + bytes * frame_id, bytes);
+		}
+
+	this->head.store(head +1, std::memory_order_release);
+}
+
+void Dumper_stream
+::dump(const std::string& base_path)
+{
+	throw invalid_argument(__FILE__, __LINE__, __func__, "This method can't be called on this class.");
+}
+
+void Dumper_stream
+::clear()
+{
+	throw invalid_argument(__FILE__, __LINE__, __func__, "This method can't be called on this class.");
+}
+
+bool Dumper_stream
+::is_empty() const
+{
+	if (!this->ready.load(std::memory_order_acquire))
+		return true;
+
+	return this->tail.load(std::memory_order_acquire) == this->head.load(std::memory_order_acquire);
+}
+
+const char* Dumper_stream
+::front() const
+{
+	return this->queue.data() + (this->tail.load(std::memory_order_relaxed) % this->capacity) * this->record_bytes;
+}
+
+void Dumper_stream
+::pop()
+{
+	this->tail.store(this->tail.load(std::memory_order_relaxed) +1, std::memory_order_release);
+}
@@ -0,0 +1,62 @@
+#ifndef DUMPER_STREAM_HPP_
+#define DUMPER_STREAM_HPP_
+
+#include <atomic>
+#include <vector>
+#include <cstddef>
+
+#include "Dumper.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+class Dumper_reduction_stream;
+
+/*!
+ * \class Dumper_stream
+ *
+ * \brief Dumps the frames of one thread without buffering them: the 'add' method copies the registered data in a
+ *        bounded single producer / single consumer lock-free queue which is drained by the writer thread of a
+ *        'Dumper_reduction_stream'.
+ *
+ * A record of the queue contains the frame id and a slot for each registered data. The memory of the queue is
+ * allocated at the first call to 'add' (the data can't be registered after). When the queue is full, 'add' waits for
+ * the writer thread: the frames are never lost and the memory is constant.
+ */
+class Dumper_stream : public Dumper
+{
+	friend Dumper_reduction_stream;
+
+protected:
+	const size_t capacity; // number of records of the queue
+
+	std::vector<char>     queue;
+	std::vector<unsigned> record_offsets; // offset of each registered data in a record (in bytes)
+	size_t                record_bytes;
+
+	// the indexes of the producer and of the consumer are on different cache lines
+	std::atomic<bool>   ready; // true when the queue is allocated
+	std::atomic<size_t> head;  // next record to push (producer)
+	char                padding[64];
+	std::atomic<size_t> tail;  // next record to pop  (consumer)
+
+public:
+	explicit Dumper_stream(const size_t capacity = 256);
+	virtual ~Dumper_stream() = default;
+
+	virtual void dump (const std::string& base_path                );
+	virtual void add  (const unsigned n_err, const int frame_id = 0);
+	virtual void clear(                                            );
+
+protected:
+	void allocate_queue();
+
+	bool        is_empty() const;
+	const char* front   () const; // the record to pop (valid only if the queue is not empty)
+	void        pop     ();
+};
+}
+}
+
+#endif /* DUMPER_STREAM_HPP_ */
@@ -34,6 +34,13 @@ void Reporter_BFER<B>
 	BFER_cols.push_back(std::make_pair("BER", ""));
 	BFER_cols.push_back(std::make_pair("FER", ""));
 
+	if (this->monitor.get_ci_width() != 0.f || this->monitor.is_weighted())
+	{
+		// relative half widths of the confidence intervals
+		BFER_cols.push_back(std::make_pair("BER CI", "(+/- %)"));
+		BFER_cols.push_back(std::make_pair("FER CI", "(+/- %)"));
+	}
+
 	this->cols_groups.push_back(this->monitor_group);
 }
 
@@ -49,6 +56,17 @@ std::string format(unsigned long long val)
 	return os.str();
 }
 
+std::string format_ci(const std::pair<double,double>& interval, unsigned long long n_err, float rate)
+{
+	if (n_err == 0 || rate == 0.f)
+		return "-";
+
+	std::stringstream os;
+	os << std::setprecision(2) << std::fixed << 100. * (interval.second - interval.first) * 0.5 / (double)rate;
+
+	return os.str();
+}
+
 template <typename B>
 typename Reporter_BFER<B>::report_t Reporter_BFER<B>
 ::report(bool final)
@@ -70,6 +88,12 @@ typename Reporter_BFER<B>::report_t Reporter_BFER<B>
 	bfer_report.push_back(str_ber.str());
 	bfer_report.push_back(str_fer.str());
 
+	if (this->monitor.get_ci_width() != 0.f || this->monitor.is_weighted())
+	{
+		bfer_report.push_back(format_ci(this->monitor.get_ber_interval(), this->monitor.get_n_be(), this->monitor.get_ber()));
+		bfer_report.push_back(format_ci(this->monitor.get_fer_interval(), this->monitor.get_n_fe(), this->monitor.get_fer()));
+	}
+
 	return the_report;
 }
 
@@ -51,6 +51,11 @@ public:
 	report_t report(bool final = false);
 
 	void init();
+
+	/*
+	 * \brief count an already elapsed time in the throughput (the simulation is resumed from a checkpoint)
+	 */
+	void set_elapsed_time(const std::chrono::nanoseconds d);
 };
 }
 }
@@ -117,6 +117,14 @@ void Reporter_throughput<T>
 
 	t_report = std::chrono::steady_clock::now();
 }
+
+template <typename T>
+void Reporter_throughput<T>
+::set_elapsed_time(const std::chrono::nanoseconds d)
+{
+	t_report = std::chrono::steady_clock::now() -
+	           std::chrono::duration_cast<std::chrono::steady_clock::duration>(d);
+}
 }
 }
 
@@ -2,6 +2,7 @@
 #include <iomanip>
 
 #include "Tools/Display/rang_format/rang_format.h"
+#include "Tools/Perf/Counters/Perf_counters.hpp"
 
 #include "Statistics.hpp"
 
@@ -175,6 +176,126 @@ void Statistics
 	       << std::endl;
 }
 
+void Statistics
+::show_perf_task(const std::string           &module_sname,
+                 const std::string           &task_name,
+                 const uint64_t               n_frames,
+                 const std::vector<uint64_t> &perf_total,
+                 const std::vector<bool>     &perf_available,
+                       std::ostream          &stream)
+{
+	const auto per_frame = [&](const perf_evt e) -> std::string
+	{
+		std::stringstream ss;
+		if (perf_available[(int)e])
+		{
+			const auto v = (float)perf_total[(int)e] / (float)n_frames;
+			ss << std::setprecision(2) << (v > 99999.99f ? std::scientific : std::fixed) << std::setw(8) << v;
+		}
+		else
+			ss << std::setw(8) << "-";
+		return ss.str();
+	};
+
+	std::stringstream ssmodule, ssprocess, sssp, ssn_frames, ssipc;
+	ssmodule   << std::setw(12) << module_sname;
+	ssprocess  << std::setw(17) << task_name;
+	sssp       << std::setw( 7) << "*";
+	ssn_frames << std::setprecision(2) << (n_frames > 99999999 ? std::scientific : std::fixed) << std::setw(8)
+	           << n_frames;
+	if (perf_available[(int)perf_evt::CYCLES] && perf_available[(int)perf_evt::INSTRUCTIONS] &&
+	    perf_total[(int)perf_evt::CYCLES])
+		ssipc << std::setprecision(2) << std::fixed << std::setw(8)
+		      << (float)perf_total[(int)perf_evt::INSTRUCTIONS] / (float)perf_total[(int)perf_evt::CYCLES];
+	else
+		ssipc << std::setw(8) << "-";
+
+	stream << "# ";
+	stream << ssmodule  .str()                     << rang::style::bold << " | "  << rang::style::reset
+	       << ssprocess .str()                     << rang::style::bold << " | "  << rang::style::reset
+	       << sssp      .str()                     << rang::style::bold << " || " << rang::style::reset
+	       << ssn_frames.str()                     << rang::style::bold << " | "  << rang::style::reset
+	       << ssipc     .str()                     << rang::style::bold << " || " << rang::style::reset
+	       << per_frame(perf_evt::CYCLES       )   << rang::style::bold << " | "  << rang::style::reset
+	       << per_frame(perf_evt::INSTRUCTIONS )   << rang::style::bold << " | "  << rang::style::reset
+	       << per_frame(perf_evt::L1D_MISSES   )   << rang::style::bold << " | "  << rang::style::reset
+	       << per_frame(perf_evt::LLC_MISSES   )   << rang::style::bold << " | "  << rang::style::reset
+	       << per_frame(perf_evt::BRANCH_MISSES)   << ""
+	       << std::endl;
+}
+
+void Statistics
+::show_perf(const std::vector<std::vector<const module::Task*>> &tasks, std::ostream &stream)
+{
+	auto is_perf = false, is_measured = false;
+	for (auto &vt : tasks)
+		for (auto *t : vt)
+		{
+			is_perf     |= t->is_perf();
+			is_measured |= t->get_perf_n_calls() > 0;
+		}
+
+	if (!is_perf)
+		return;
+
+	if (!is_measured)
+	{
+		stream << "#" << std::endl;
+		stream << rang::tag::comment << rang::tag::warning
+		       << "The hardware counters are unavailable (not a Linux system, no PMU or 'perf_event_paranoid' level "
+		       << "too high)." << std::endl;
+		return;
+	}
+
+	const std::string sep1 = "-------------------------------------------||---------------------||------------------------------------------------------";
+	const std::string sep2 = "-------------|-------------------|---------||----------|----------||----------|----------|----------|----------|----------";
+
+	stream << "#" << std::endl;
+	stream << "# " << rang::style::bold << sep1 << rang::style::reset << std::endl;
+	stream << "# " << rang::style::bold << "   Hardware counters for the given task    ||    Basic counters   ||        Counted events per frame (user space)         " << rang::style::reset << std::endl;
+	stream << "# " << rang::style::bold << sep1 << rang::style::reset << std::endl;
+	stream << "# " << rang::style::bold << sep2 << rang::style::reset << std::endl;
+	stream << "# " << rang::style::bold << "      MODULE |              TASK |   TIMER ||   FRAMES |      IPC ||   CYCLES |    INSTR |  L1D MIS |  LLC MIS |   BR MIS" << rang::style::reset << std::endl;
+	stream << "# " << rang::style::bold << sep2 << rang::style::reset << std::endl;
+
+	std::vector<uint64_t> ttotal((size_t)perf_evt::SIZE, 0);
+	std::vector<bool>     tavailable((size_t)perf_evt::SIZE, true);
+	uint64_t              tn_frames = 0;
+
+	for (auto &vt : tasks)
+	{
+		std::vector<uint64_t> total((size_t)perf_evt::SIZE, 0);
+		std::vector<bool>     available((size_t)perf_evt::SIZE, false);
+		uint64_t              n_frames = 0;
+
+		for (auto *t : vt)
+		{
+			n_frames += (uint64_t)t->get_perf_n_calls() * (uint64_t)t->get_module().get_n_frames();
+			for (size_t e = 0; e < total.size(); e++)
+			{
+				total    [e] += t->get_perf_total    ()[e];
+				available[e]  = available[e] || t->get_perf_available()[e];
+			}
+		}
+
+		if (n_frames == 0)
+			continue;
+
+		Statistics::show_perf_task(vt[0]->get_module().get_short_name(), vt[0]->get_name(), n_frames, total,
+		                           available, stream);
+
+		tn_frames = std::max(tn_frames, n_frames);
+		for (size_t e = 0; e < total.size(); e++)
+		{
+			ttotal    [e] += total[e];
+			tavailable[e]  = tavailable[e] && available[e];
+		}
+	}
+
+	stream << "# " << rang::style::bold << sep2 << rang::style::reset << std::endl;
+	Statistics::show_perf_task("TOTAL", "*", tn_frames, ttotal, tavailable, stream);
+}
+
 void Statistics
 ::show(std::vector<const module::Module*> modules, const bool ordered, std::ostream &stream)
 {
@@ -276,6 +397,11 @@ void Statistics
 
 		Statistics::show_task(total_sec, "TOTAL", "*", ttask_n_elmts, ttask_n_calls,
 		                      ttask_tot_duration, ttask_min_duration, ttask_max_duration, stream);
+
+		std::vector<std::vector<const module::Task*>> vtasks;
+		for (auto *t : tasks)
+			vtasks.push_back({t});
+		Statistics::show_perf(vtasks, stream);
 	}
 	else
 	{
@@ -422,6 +548,8 @@ void Statistics
 
 		Statistics::show_task(total_sec, "TOTAL", "*", ttask_n_elmts, ttask_n_calls,
 		                      ttask_tot_duration, ttask_min_duration, ttask_max_duration, stream);
+
+		Statistics::show_perf(tasks, stream);
 	}
 	else
 	{
@@ -55,6 +55,15 @@ private:
 	                       const std::chrono::nanoseconds timer_min_duration,
 	                       const std::chrono::nanoseconds timer_max_duration,
 	                             std::ostream             &stream = std::cout);
+
+	static void show_perf(const std::vector<std::vector<const module::Task*>> &tasks, std::ostream &stream = std::cout);
+
+	static void show_perf_task(const std::string           &module_sname,
+	                           const std::string           &task_name,
+	                           const uint64_t               n_frames,
+	                           const std::vector<uint64_t> &perf_total,
+	                           const std::vector<bool>     &perf_available,
+	                                 std::ostream          &stream = std::cout);
 };
 
 using Stats = Statistics;
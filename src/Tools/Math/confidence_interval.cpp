@@ -0,0 +1,170 @@
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "confidence_interval.h"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+double aff3ct::tools::normal_quantile(const double p)
+{
+	if (p <= 0. || p >= 1.)
+	{
+		std::stringstream message;
+		message << "'p' has to be in ]0;1[ ('p' = " << p << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	// bisection on the cumulative distribution function: Phi(x) = erfc(-x / sqrt(2)) / 2
+	auto low = -40., up = 40.;
+	for (auto i = 0; i < 100; i++)
+	{
+		const auto mid = (low + up) * 0.5;
+		if (0.5 * std::erfc(-mid / std::sqrt(2.)) < p)
+			low = mid;
+		else
+			up = mid;
+	}
+
+	return (low + up) * 0.5;
+}
+
+// continued fraction of the incomplete beta function (modified Lentz's method)
+static double beta_cont_frac(const double a, const double b, const double x)
+{
+	const auto max_ite = 10000;
+	const auto eps     = 1e-15;
+	const auto fp_min  = 1e-300;
+
+	const auto qab = a + b;
+	const auto qap = a + 1.;
+	const auto qam = a - 1.;
+
+	auto c = 1.;
+	auto d = 1. - qab * x / qap;
+	if (std::abs(d) < fp_min) d = fp_min;
+	d = 1. / d;
+	auto h = d;
+
+	for (auto m = 1; m <= max_ite; m++)
+	{
+		const auto m2 = 2. * m;
+
+		auto aa = m * (b - m) * x / ((qam + m2) * (a + m2));
+		d = 1. + aa * d; if (std::abs(d) < fp_min) d = fp_min;
+		c = 1. + aa / c; if (std::abs(c) < fp_min) c = fp_min;
+		d = 1. / d;
+		h *= d * c;
+
+		aa = -(a + m) * (qab + m) * x / ((a + m2) * (qap + m2));
+		d = 1. + aa * d; if (std::abs(d) < fp_min) d = fp_min;
+		c = 1. + aa / c; if (std::abs(c) < fp_min) c = fp_min;
+		d = 1. / d;
+		const auto del = d * c;
+		h *= del;
+
+		if (std::abs(del - 1.) < eps)
+			break;
+	}
+
+	return h;
+}
+
+double aff3ct::tools::incomplete_beta(const double a, const double b, const double x)
+{
+	if (x <= 0.) return 0.;
+	if (x >= 1.) return 1.;
+
+	const auto log_bt = std::lgamma(a + b) - std::lgamma(a) - std::lgamma(b) + a * std::log(x) + b * std::log1p(-x);
+	const auto bt     = std::exp(log_bt);
+
+	// the continued fraction converges quickly for x < (a +1) / (a + b +2), else use the symmetry relation
+	if (x < (a + 1.) / (a + b + 2.))
+		return bt * beta_cont_frac(a, b, x) / a;
+	else
+		return 1. - bt * beta_cont_frac(b, a, 1. - x) / b;
+}
+
+// quantile of the beta distribution: x such as I_x(a, b) = p
+static double beta_quantile(const double a, const double b, const double p)
+{
+	auto low = 0., up = 1.;
+	for (auto i = 0; i < 200 && low < up; i++)
+	{
+		const auto mid = (low + up) * 0.5;
+		if (mid == low || mid == up)
+			break;
+
+		if (incomplete_beta(a, b, mid) < p)
+			low = mid;
+		else
+			up = mid;
+	}
+
+	return (low + up) * 0.5;
+}
+
+static void check_binomial(const double k, const double n, const double level)
+{
+	if (n <= 0.)
+	{
+		std::stringstream message;
+		message << "'n' has to be greater than 0 ('n' = " << n << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (k < 0. || k > n)
+	{
+		std::stringstream message;
+		message << "'k' has to be in [0;n] ('k' = " << k << ", 'n' = " << n << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	if (level <= 0. || level >= 1.)
+	{
+		std::stringstream message;
+		message << "'level' has to be in ]0;1[ ('level' = " << level << ").";
+		throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+	}
+}
+
+std::pair<double,double> aff3ct::tools::wilson_interval(const double k, const double n, const double level)
+{
+	check_binomial(k, n, level);
+
+	const auto z      = normal_quantile(1. - (1. - level) * 0.5);
+	const auto z2     = z * z;
+	const auto p      = k / n;
+	const auto denom  = 1. + z2 / n;
+	const auto center = (p + z2 / (2. * n)) / denom;
+	const auto half   = z * std::sqrt(p * (1. - p) / n + z2 / (4. * n * n)) / denom;
+
+	return std::make_pair(std::max(0., center - half), std::min(1., center + half));
+}
+
+std::pair<double,double> aff3ct::tools::clopper_pearson_interval(const double k, const double n, const double level)
+{
+	check_binomial(k, n, level);
+
+	const auto alpha = 1. - level;
+	const auto low   = k == 0. ? 0. : beta_quantile(k,      n - k + 1., alpha * 0.5     );
+	const auto up    = k == n  ? 1. : beta_quantile(k + 1., n - k,      1. - alpha * 0.5);
+
+	return std::make_pair(low, up);
+}
+
+std::pair<double,double> aff3ct::tools::binomial_interval(const double k, const double n, const double level,
+                                                         const CI_method method)
+{
+	switch (method)
+	{
+		case CI_method::WILSON:          return wilson_interval         (k, n, level);
+		case CI_method::CLOPPER_PEARSON: return clopper_pearson_interval(k, n, level);
+	}
+
+	throw invalid_argument(__FILE__, __LINE__, __func__, "Unknown 'method'.");
+}
@@ -0,0 +1,38 @@
+#ifndef CONFIDENCE_INTERVAL_H_
+#define CONFIDENCE_INTERVAL_H_
+
+#include <utility>
+
+namespace aff3ct
+{
+namespace tools
+{
+enum class CI_method { WILSON, CLOPPER_PEARSON };
+
+/*
+ * Quantile function (inverse of the cumulative distribution function) of the standard normal distribution
+ */
+double normal_quantile(const double p);
+
+/*
+ * Regularized incomplete beta function I_x(a, b)
+ */
+double incomplete_beta(const double a, const double b, const double x);
+
+/*
+ * Wilson score interval on the probability of a binomial distribution with 'k' successes in 'n' trials and with a
+ * 'level' confidence level (0.95 for 95%). Returns the lower and the upper bounds.
+ */
+std::pair<double,double> wilson_interval(const double k, const double n, const double level);
+
+/*
+ * Clopper-Pearson (exact) interval on the probability of a binomial distribution with 'k' successes in 'n' trials and
+ * with a 'level' confidence level. The bounds are the quantiles of beta distributions computed by bisection.
+ */
+std::pair<double,double> clopper_pearson_interval(const double k, const double n, const double level);
+
+std::pair<double,double> binomial_interval(const double k, const double n, const double level, const CI_method method);
+}
+}
+
+#endif /* CONFIDENCE_INTERVAL_H_ */
@@ -0,0 +1,104 @@
+/*!
+ * \file
+ * \brief Bit-sliced (transposed) representation of binary frames.
+ *
+ * \section LICENSE
+ * This file is under MIT license (https://opensource.org/licenses/MIT).
+ */
+#ifndef BIT_SLICE_HPP_
+#define BIT_SLICE_HPP_
+
+#include <vector>
+#include <cstdint>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Bit_slice
+ *
+ * \brief Packs the same element of several independent frames in one machine word (the bit 'f' of a word belongs to
+ *        the frame 'f') and provides the boolean arithmetic to process all the frames with one instruction.
+ *
+ * The small integers (counters, signed values) are stored in 'n_planes' words: the word 'k' contains the bit 'k' of
+ * the integer of each frame (two's complement for the signed values).
+ *
+ * \tparam W: the type of the words (an unsigned integer).
+ */
+template <typename W = uint64_t>
+struct Bit_slice
+{
+public:
+	static constexpr int n_lanes = (int)(sizeof(W) * 8); /*!< Number of frames packed in one word. */
+
+	/*!
+	 * \brief Packs up to 'n_lanes' binary frames (a non-zero value is a 1).
+	 *
+	 * \param in_data:     the frames, stored one after the other.
+	 * \param out_data:    the 'data_length' words.
+	 * \param data_length: the size of one frame.
+	 * \param n_frames:    the number of frames to pack (the other lanes are set to 0).
+	 */
+	template <typename B>
+	static void pack(const B* in_data, W* out_data, const int data_length, const int n_frames = n_lanes);
+
+	/*!
+	 * \brief Unpacks up to 'n_lanes' binary frames.
+	 *
+	 * \param in_data:     the 'data_length' words.
+	 * \param out_data:    the frames, stored one after the other.
+	 * \param data_length: the size of one frame.
+	 * \param n_frames:    the number of frames to unpack.
+	 */
+	template <typename B>
+	static void unpack(const W* in_data, B* out_data, const int data_length, const int n_frames = n_lanes);
+
+	/*!
+	 * \brief Unpacks a subset of the elements (the positions in 'pos') of up to 'n_lanes' binary frames.
+	 */
+	template <typename B>
+	static void unpack(const W* in_data, B* out_data, const std::vector<uint32_t> &pos,
+	                   const int n_frames = n_lanes);
+
+	/*!
+	 * \brief Mask with the 'n_frames' first lanes set.
+	 */
+	static inline W lanes(const int n_frames);
+
+	/*!
+	 * \brief Adds 1 to the integers of the lanes selected by 'mask' (modulo 2^'n_planes').
+	 */
+	static inline void inc(W* planes, const int n_planes, W mask);
+
+	/*!
+	 * \brief Subtracts 1 to the integers of the lanes selected by 'mask' (modulo 2^'n_planes').
+	 */
+	static inline void dec(W* planes, const int n_planes, W mask);
+
+	/*!
+	 * \brief Mask of the lanes where the unsigned integer is greater or equal to 'val'.
+	 */
+	static inline W ge(const W* planes, const int n_planes, const unsigned val);
+
+	/*!
+	 * \brief Mask of the lanes where the unsigned integer is equal to 'val'.
+	 */
+	static inline W eq(const W* planes, const int n_planes, const unsigned val);
+
+	/*!
+	 * \brief Mask of the lanes where the integer is not null.
+	 */
+	static inline W non_zero(const W* planes, const int n_planes);
+
+	/*!
+	 * \brief Minimal number of planes to store the unsigned integers in [0;'max_val'].
+	 */
+	static inline int n_planes(const unsigned max_val);
+};
+}
+}
+
+#include "Bit_slice.hxx"
+
+#endif /* BIT_SLICE_HPP_ */
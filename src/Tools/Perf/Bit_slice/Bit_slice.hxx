@@ -0,0 +1,146 @@
+#include <algorithm>
+
+#include "Bit_slice.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+template <typename W>
+constexpr int Bit_slice<W>::n_lanes;
+
+template <typename W>
+template <typename B>
+void Bit_slice<W>
+::pack(const B* in_data, W* out_data, const int data_length, const int n_frames)
+{
+	std::fill(out_data, out_data + data_length, (W)0);
+
+	for (auto f = 0; f < n_frames; f++)
+	{
+		const auto frame = in_data + f * data_length;
+		for (auto i = 0; i < data_length; i++)
+			out_data[i] |= (W)(frame[i] != (B)0) << f;
+	}
+}
+
+template <typename W>
+template <typename B>
+void Bit_slice<W>
+::unpack(const W* in_data, B* out_data, const int data_length, const int n_frames)
+{
+	for (auto f = 0; f < n_frames; f++)
+	{
+		auto frame = out_data + f * data_length;
+		for (auto i = 0; i < data_length; i++)
+			frame[i] = (B)((in_data[i] >> f) & (W)1);
+	}
+}
+
+template <typename W>
+template <typename B>
+void Bit_slice<W>
+::unpack(const W* in_data, B* out_data, const std::vector<uint32_t> &pos, const int n_frames)
+{
+	const auto data_length = (int)pos.size();
+	for (auto f = 0; f < n_frames; f++)
+	{
+		auto frame = out_data + f * data_length;
+		for (auto i = 0; i < data_length; i++)
+			frame[i] = (B)((in_data[pos[i]] >> f) & (W)1);
+	}
+}
+
+template <typename W>
+W Bit_slice<W>
+::lanes(const int n_frames)
+{
+	return n_frames >= n_lanes ? (W)~(W)0 : (((W)1 << n_frames) - (W)1);
+}
+
+template <typename W>
+void Bit_slice<W>
+::inc(W* planes, const int n_planes, W mask)
+{
+	// ripple-carry adder where the carry is the mask
+	for (auto k = 0; k < n_planes && mask; k++)
+	{
+		const auto carry = planes[k] & mask;
+		planes[k] ^= mask;
+		mask = carry;
+	}
+}
+
+template <typename W>
+void Bit_slice<W>
+::dec(W* planes, const int n_planes, W mask)
+{
+	// ripple-borrow subtractor where the borrow is the mask
+	for (auto k = 0; k < n_planes && mask; k++)
+	{
+		const auto borrow = ~planes[k] & mask;
+		planes[k] ^= mask;
+		mask = borrow;
+	}
+}
+
+template <typename W>
+W Bit_slice<W>
+::ge(const W* planes, const int n_planes, const unsigned val)
+{
+	if (n_planes < 32 && (val >> n_planes))
+		return (W)0;
+
+	// bit-serial comparison from the MSB
+	W gt = (W)0, eq = (W)~(W)0;
+	for (auto k = n_planes -1; k >= 0; k--)
+	{
+		if ((val >> k) & 1)
+			eq &= planes[k];
+		else
+		{
+			gt |= eq & planes[k];
+			eq &= ~planes[k];
+		}
+	}
+
+	return gt | eq;
+}
+
+template <typename W>
+W Bit_slice<W>
+::eq(const W* planes, const int n_planes, const unsigned val)
+{
+	if (n_planes < 32 && (val >> n_planes))
+		return (W)0;
+
+	W eq = (W)~(W)0;
+	for (auto k = 0; k < n_planes; k++)
+		eq &= ((val >> k) & 1) ? planes[k] : ~planes[k];
+
+	return eq;
+}
+
+template <typename W>
+W Bit_slice<W>
+::non_zero(const W* planes, const int n_planes)
+{
+	W nz = (W)0;
+	for (auto k = 0; k < n_planes; k++)
+		nz |= planes[k];
+
+	return nz;
+}
+
+template <typename W>
+int Bit_slice<W>
+::n_planes(const unsigned max_val)
+{
+	auto n = 1;
+	while (n < 32 && (max_val >> n))
+		n++;
+
+	return n;
+}
+}
+}
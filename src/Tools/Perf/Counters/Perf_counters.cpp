@@ -0,0 +1,141 @@
+#if defined(__linux__)
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+#include <cstring>
+
+#include "Perf_counters.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+#if defined(__linux__)
+static int open_event(const uint32_t type, const uint64_t config, const int group_fd)
+{
+	struct perf_event_attr attr;
+	std::memset(&attr, 0, sizeof(attr));
+	attr.size           = sizeof(attr);
+	attr.type           = type;
+	attr.config         = config;
+	attr.disabled       = group_fd == -1 ? 1 : 0; // the leader enables the whole group
+	attr.exclude_kernel = 1;
+	attr.exclude_hv     = 1;
+	attr.read_format    = PERF_FORMAT_GROUP;
+
+	// pid = 0 and cpu = -1: the calling thread on any CPU
+	return (int)syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0);
+}
+#endif
+
+Perf_counters
+::Perf_counters()
+: fds((int)perf_evt::SIZE, -1), positions((int)perf_evt::SIZE, -1), buffer((int)perf_evt::SIZE +1, 0), leader(-1),
+  n_opened(0)
+{
+#if defined(__linux__)
+	const auto cache = [](const uint64_t id, const uint64_t result) -> uint64_t
+	{
+		return id | ((uint64_t)PERF_COUNT_HW_CACHE_OP_READ << 8) | (result << 16);
+	};
+
+	const uint32_t types[(int)perf_evt::SIZE] = { PERF_TYPE_HARDWARE,
+	                                              PERF_TYPE_HARDWARE,
+	                                              PERF_TYPE_HW_CACHE,
+	                                              PERF_TYPE_HARDWARE,
+	                                              PERF_TYPE_HARDWARE };
+
+	const uint64_t configs[(int)perf_evt::SIZE] = { PERF_COUNT_HW_CPU_CYCLES,
+	                                                PERF_COUNT_HW_INSTRUCTIONS,
+	                                                cache(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_RESULT_MISS),
+	                                                PERF_COUNT_HW_CACHE_MISSES,
+	                                                PERF_COUNT_HW_BRANCH_MISSES };
+
+	// the first event which can be opened is the leader of the group
+	for (auto e = 0; e < (int)perf_evt::SIZE; e++)
+	{
+		const auto fd = open_event(types[e], configs[e], leader);
+		if (fd != -1)
+		{
+			if (leader == -1)
+				leader = fd;
+			fds      [e] = fd;
+			positions[e] = n_opened++;
+		}
+	}
+
+	if (leader != -1)
+	{
+		ioctl(leader, PERF_EVENT_IOC_RESET,  PERF_IOC_FLAG_GROUP);
+		ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+	}
+#endif
+}
+
+Perf_counters
+::~Perf_counters()
+{
+#if defined(__linux__)
+	for (auto fd : fds)
+		if (fd != -1)
+			close(fd);
+#endif
+}
+
+Perf_counters& Perf_counters
+::local()
+{
+	thread_local Perf_counters counters;
+	return counters;
+}
+
+std::string Perf_counters
+::get_name(const perf_evt evt)
+{
+	switch (evt)
+	{
+		case perf_evt::CYCLES:        return "cycles";
+		case perf_evt::INSTRUCTIONS:  return "instructions";
+		case perf_evt::L1D_MISSES:    return "L1D misses";
+		case perf_evt::LLC_MISSES:    return "LLC misses";
+		case perf_evt::BRANCH_MISSES: return "branch misses";
+		default:                      return "unknown";
+	}
+}
+
+bool Perf_counters
+::is_available() const
+{
+	return n_opened > 0;
+}
+
+bool Perf_counters
+::is_available(const perf_evt evt) const
+{
+	return positions[(int)evt] != -1;
+}
+
+bool Perf_counters
+::read(uint64_t values[(int)perf_evt::SIZE])
+{
+	for (auto e = 0; e < (int)perf_evt::SIZE; e++)
+		values[e] = 0;
+
+	if (!n_opened)
+		return false;
+
+#if defined(__linux__)
+	const auto n_bytes = (ssize_t)((n_opened +1) * sizeof(uint64_t));
+	if (::read(leader, buffer.data(), (size_t)n_bytes) != n_bytes)
+		return false;
+
+	for (auto e = 0; e < (int)perf_evt::SIZE; e++)
+		if (positions[e] != -1)
+			values[e] = buffer[1 + positions[e]];
+
+	return true;
+#else
+	return false;
+#endif
+}
@@ -0,0 +1,63 @@
+#ifndef PERF_COUNTERS_HPP_
+#define PERF_COUNTERS_HPP_
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace aff3ct
+{
+namespace tools
+{
+enum class perf_evt : uint8_t { CYCLES, INSTRUCTIONS, L1D_MISSES, LLC_MISSES, BRANCH_MISSES, SIZE };
+
+/*!
+ * \class Perf_counters
+ *
+ * \brief Hardware performance counters of the calling thread (Linux 'perf_event_open' system call).
+ *
+ * The counters are opened as a single group (they are scheduled together on the PMU and read with one system call).
+ * The user space only is counted, this is allowed by the default 'perf_event_paranoid' level of the kernel. The
+ * events which cannot be opened (no PMU in a virtual machine, missing event on the CPU, not a Linux system...) are
+ * marked as unavailable and are never read.
+ */
+class Perf_counters
+{
+private:
+	std::vector<int>      fds;       // file descriptor of each event (-1 if unavailable)
+	std::vector<int>      positions; // position of each event in the values of the group (-1 if unavailable)
+	std::vector<uint64_t> buffer;    // values read from the group: { nr, values[nr] }
+	int                   leader;    // file descriptor of the group leader (-1 if no event is available)
+	int                   n_opened;
+
+	Perf_counters();
+
+public:
+	~Perf_counters();
+
+	Perf_counters(const Perf_counters&) = delete;
+	Perf_counters& operator=(const Perf_counters&) = delete;
+
+	/*!
+	 * \brief Gets the counters of the calling thread (opened at the first call).
+	 */
+	static Perf_counters& local();
+
+	static std::string get_name(const perf_evt evt);
+
+	bool is_available(                  ) const;
+	bool is_available(const perf_evt evt) const;
+
+	/*!
+	 * \brief Reads the current values of the counters.
+	 *
+	 * \param values: the values of the counters indexed by 'perf_evt' (the unavailable events are set to 0).
+	 *
+	 * \return false if the counters could not be read.
+	 */
+	bool read(uint64_t values[(int)perf_evt::SIZE]);
+};
+}
+}
+
+#endif /* PERF_COUNTERS_HPP_ */
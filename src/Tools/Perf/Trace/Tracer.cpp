@@ -0,0 +1,312 @@
+#include <sstream>
+#include <iomanip>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Tracer.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+std::atomic<bool>                          aff3ct::tools::trace_enabled(false);
+std::mutex                                 aff3ct::tools::Tracer::mtx_names;
+std::vector<std::string>                   aff3ct::tools::Tracer::names;
+std::mutex                                 aff3ct::tools::Tracer::mtx_buffers;
+std::vector<std::unique_ptr<Trace_buffer>> aff3ct::tools::Tracer::buffers;
+size_t                                     aff3ct::tools::Tracer::buffer_size = 1 << 16;
+std::thread                                aff3ct::tools::Tracer::flusher;
+std::mutex                                 aff3ct::tools::Tracer::mtx_flusher;
+std::condition_variable                    aff3ct::tools::Tracer::cv_flusher;
+bool                                       aff3ct::tools::Tracer::stop_flusher = false;
+std::chrono::milliseconds                  aff3ct::tools::Tracer::flush_frequency = std::chrono::milliseconds(100);
+std::ofstream                              aff3ct::tools::Tracer::file;
+bool                                       aff3ct::tools::Tracer::first_event = true;
+int                                        aff3ct::tools::Tracer::pid = 0;
+uint64_t                                   aff3ct::tools::Tracer::tsc_origin = 0;
+double                                     aff3ct::tools::Tracer::tsc_per_us = 1000.;
+
+Trace_buffer
+::Trace_buffer(const size_t size, const uint32_t tid)
+: spans(size), mask(size -1), head(0), tail(0), n_dropped(0), tid(tid), thread_name(), in_use(true)
+{
+}
+
+size_t Trace_buffer
+::pop(std::vector<Span> &out)
+{
+	const auto t = tail.load(std::memory_order_relaxed);
+	const auto h = head.load(std::memory_order_acquire);
+
+	for (auto i = t; i < h; i++)
+		out.push_back(spans[i & mask]);
+
+	tail.store(h, std::memory_order_release);
+
+	return (size_t)(h - t);
+}
+
+uint64_t Trace_buffer
+::get_n_dropped() const
+{
+	return n_dropped.load(std::memory_order_relaxed);
+}
+
+namespace
+{
+// releases the buffer of a thread when the thread ends: the buffer can then be reused by a new thread
+struct Trace_buffer_holder
+{
+	Trace_buffer *buffer = nullptr;
+
+	~Trace_buffer_holder()
+	{
+		if (buffer != nullptr)
+			buffer->in_use.store(false, std::memory_order_release);
+	}
+};
+
+thread_local Trace_buffer_holder local_holder;
+}
+
+Trace_buffer& Tracer
+::local_buffer()
+{
+	if (local_holder.buffer != nullptr)
+		return *local_holder.buffer;
+
+	std::lock_guard<std::mutex> lock(mtx_buffers);
+
+	for (auto &b : buffers)
+	{
+		auto expected = false;
+		if (b->in_use.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+		{
+			b->thread_name.clear();
+			local_holder.buffer = b.get();
+			return *b;
+		}
+	}
+
+	buffers.push_back(std::unique_ptr<Trace_buffer>(new Trace_buffer(buffer_size, (uint32_t)buffers.size())));
+	local_holder.buffer = buffers.back().get();
+
+	return *local_holder.buffer;
+}
+
+uint32_t Tracer
+::register_name(const std::string &name)
+{
+	std::lock_guard<std::mutex> lock(mtx_names);
+
+	for (size_t i = 0; i < names.size(); i++)
+		if (names[i] == name)
+			return (uint32_t)i;
+
+	names.push_back(name);
+	return (uint32_t)(names.size() -1);
+}
+
+void Tracer
+::set_thread_name(const std::string &name)
+{
+	if (!is_enabled())
+		return;
+
+	auto &b = local_buffer();
+
+	std::lock_guard<std::mutex> lock(mtx_buffers);
+	b.thread_name = name;
+}
+
+void Tracer
+::calibrate()
+{
+#ifdef AFF3CT_TRACER_RDTSC
+	const auto t0_clk = std::chrono::steady_clock::now();
+	const auto t0_tsc = tsc();
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	const auto t1_tsc = tsc();
+	const auto t1_clk = std::chrono::steady_clock::now();
+
+	const auto d_us = std::chrono::duration<double, std::micro>(t1_clk - t0_clk).count();
+	tsc_per_us = d_us > 0. ? (double)(t1_tsc - t0_tsc) / d_us : 1000.;
+#else
+	tsc_per_us = 1000.; // the time stamps are in nanoseconds
+#endif
+	tsc_origin = tsc();
+}
+
+void Tracer
+::start(const std::string &path, const int pid, const size_t buffer_size, const std::chrono::milliseconds freq)
+{
+	if (is_enabled())
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, "The tracer is already started.");
+
+	if (buffer_size == 0)
+		throw tools::invalid_argument(__FILE__, __LINE__, __func__, "'buffer_size' has to be greater than 0.");
+
+	file.open(path, std::ios::out | std::ios::trunc);
+	if (!file.is_open())
+	{
+		std::stringstream message;
+		message << "Impossible to open the trace file ('path' = " << path << ").";
+		throw tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mtx_buffers);
+
+		size_t size = 1;
+		while (size < buffer_size)
+			size <<= 1;
+
+		// the buffers of the previous tracing are kept, they are reused by the new threads only if the size is the same
+		for (auto &b : buffers)
+		{
+			std::vector<Trace_buffer::Span> trash;
+			b->pop(trash);
+		}
+		if (size != Tracer::buffer_size)
+		{
+			for (auto &b : buffers)
+				b->in_use.store(true); // never reused
+			Tracer::buffer_size = size;
+		}
+	}
+
+	Tracer::pid             = pid;
+	Tracer::flush_frequency = freq;
+	Tracer::first_event     = true;
+	Tracer::stop_flusher    = false;
+
+	calibrate();
+
+	file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[" << std::endl;
+
+	trace_enabled.store(true);
+	flusher = std::thread(Tracer::flush_loop);
+}
+
+void Tracer
+::stop()
+{
+	if (!is_enabled())
+		return;
+
+	trace_enabled.store(false);
+
+	{
+		std::lock_guard<std::mutex> lock(mtx_flusher);
+		stop_flusher = true;
+	}
+	cv_flusher.notify_all();
+	flusher.join();
+
+	flush();
+
+	// thread names and number of dropped spans as metadata
+	std::lock_guard<std::mutex> lock(mtx_buffers);
+	for (auto &b : buffers)
+	{
+		if (!b->thread_name.empty())
+		{
+			file << (first_event ? "" : ",\n")
+			     << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid << ",\"tid\":" << b->tid
+			     << ",\"args\":{\"name\":\"" << escape(b->thread_name) << "\"}}";
+			first_event = false;
+		}
+
+		if (b->get_n_dropped())
+		{
+			file << (first_event ? "" : ",\n")
+			     << "{\"name\":\"dropped spans\",\"ph\":\"C\",\"ts\":0,\"pid\":" << pid << ",\"tid\":" << b->tid
+			     << ",\"args\":{\"n\":" << b->get_n_dropped() << "}}";
+			first_event = false;
+		}
+	}
+
+	file << std::endl << "]}" << std::endl;
+	file.close();
+}
+
+void Tracer
+::flush_loop()
+{
+	std::unique_lock<std::mutex> lock(mtx_flusher);
+	while (!stop_flusher)
+	{
+		cv_flusher.wait_for(lock, flush_frequency);
+		if (!stop_flusher)
+			flush();
+	}
+}
+
+void Tracer
+::flush()
+{
+	std::vector<std::pair<uint32_t, std::vector<Trace_buffer::Span>>> drained;
+	{
+		std::lock_guard<std::mutex> lock(mtx_buffers);
+		for (auto &b : buffers)
+		{
+			std::vector<Trace_buffer::Span> spans;
+			if (b->pop(spans))
+				drained.push_back(std::make_pair(b->tid, std::move(spans)));
+		}
+	}
+
+	if (drained.empty())
+		return;
+
+	std::vector<std::string> names_cpy;
+	{
+		std::lock_guard<std::mutex> lock(mtx_names);
+		names_cpy = names;
+	}
+
+	std::stringstream ss;
+	ss << std::fixed << std::setprecision(3);
+	for (auto &d : drained)
+		for (auto &s : d.second)
+		{
+			const auto ts  = (double)(int64_t)(s.t_begin - tsc_origin) / tsc_per_us;
+			const auto dur = (double)(s.t_end - s.t_begin) / tsc_per_us;
+			const auto &name = s.name_id < names_cpy.size() ? names_cpy[s.name_id] : std::string("unknown");
+
+			ss << (first_event ? "" : ",\n")
+			   << "{\"name\":\"" << escape(name) << "\",\"ph\":\"X\",\"ts\":" << ts << ",\"dur\":" << dur
+			   << ",\"pid\":" << pid << ",\"tid\":" << d.first << "}";
+			first_event = false;
+		}
+
+	file << ss.str();
+	file.flush();
+}
+
+std::string Tracer
+::escape(const std::string &str)
+{
+	std::string out;
+	for (auto c : str)
+	{
+		if (c == '"' || c == '\\')
+			out += '\\';
+		out += c;
+	}
+	return out;
+}
+
+uint64_t aff3ct::tools::trace_now()
+{
+	return Tracer::now();
+}
+
+uint32_t aff3ct::tools::trace_register_name(const std::string &name)
+{
+	return Tracer::register_name(name);
+}
+
+void aff3ct::tools::trace_span(const uint32_t name_id, const uint64_t t_begin)
+{
+	Tracer::span(name_id, t_begin);
+}
@@ -0,0 +1,187 @@
+#ifndef TRACER_HPP_
+#define TRACER_HPP_
+
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <cstdint>
+#include <fstream>
+#include <condition_variable>
+
+#if defined(__x86_64) || defined(__x86_64__) || defined(__i386) || defined(__i386__)
+#include <x86intrin.h>
+#define AFF3CT_TRACER_RDTSC
+#elif defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#define AFF3CT_TRACER_RDTSC
+#endif
+
+namespace aff3ct
+{
+namespace tools
+{
+// state of the tracer (also declared in 'Module/Task.hpp' to be checked inline by the modules)
+extern std::atomic<bool> trace_enabled;
+
+/*!
+ * \class Trace_buffer
+ *
+ * \brief Lock-free single producer (the traced thread) / single consumer (the flusher thread) ring buffer of spans.
+ *        When the buffer is full the new spans are dropped (and counted) instead of blocking the traced thread.
+ */
+class Trace_buffer
+{
+public:
+	struct Span
+	{
+		uint64_t t_begin; // time stamp counter at the beginning of the span
+		uint64_t t_end;   // time stamp counter at the end of the span
+		uint32_t name_id; // id of the name of the span (see 'Tracer::register_name()')
+	};
+
+private:
+	std::vector<Span>     spans;
+	const uint64_t        mask;
+	std::atomic<uint64_t> head;      // next position to write, only modified by the producer
+	std::atomic<uint64_t> tail;      // next position to read, only modified by the consumer
+	std::atomic<uint64_t> n_dropped;
+
+public:
+	const uint32_t    tid;
+	std::string       thread_name;
+	std::atomic<bool> in_use;        // a thread is currently attached to this buffer
+
+	Trace_buffer(const size_t size, const uint32_t tid);
+
+	inline void push(const uint64_t t_begin, const uint64_t t_end, const uint32_t name_id)
+	{
+		const auto h = head.load(std::memory_order_relaxed);
+		if (h - tail.load(std::memory_order_acquire) > mask)
+		{
+			n_dropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		auto &s = spans[h & mask];
+		s.t_begin = t_begin;
+		s.t_end   = t_end;
+		s.name_id = name_id;
+		head.store(h +1, std::memory_order_release);
+	}
+
+	size_t pop(std::vector<Span> &out);
+
+	uint64_t get_n_dropped() const;
+};
+
+/*!
+ * \class Tracer
+ *
+ * \brief Low-overhead timeline tracer: each thread records the spans of the tasks (and of the sub-timers of the
+ *        tasks) in its own lock-free ring buffer, stamped with the time stamp counter (rdtsc on x86, steady clock
+ *        elsewhere). A background thread drains the buffers and writes a Chrome trace file (JSON) that can be opened
+ *        in chrome://tracing or in the Perfetto UI (https://ui.perfetto.dev).
+ *
+ * When the tracer is not started, the cost of a traced span is a relaxed atomic load.
+ */
+class Tracer
+{
+private:
+	static std::mutex                                 mtx_names;
+	static std::vector<std::string>                   names;
+	static std::mutex                                 mtx_buffers;
+	static std::vector<std::unique_ptr<Trace_buffer>> buffers;
+	static size_t                                     buffer_size;
+	static std::thread                                flusher;
+	static std::mutex                                 mtx_flusher;
+	static std::condition_variable                    cv_flusher;
+	static bool                                       stop_flusher;
+	static std::chrono::milliseconds                  flush_frequency;
+	static std::ofstream                              file;
+	static bool                                       first_event;
+	static int                                        pid;
+	static uint64_t                                   tsc_origin;
+	static double                                     tsc_per_us;
+
+public:
+	/*!
+	 * \brief Starts the tracing, the spans are written in the file 'path'.
+	 *
+	 * \param path:            path of the Chrome trace file (JSON).
+	 * \param pid:             process id written in the trace (the MPI rank for instance).
+	 * \param buffer_size:     number of spans of the ring buffer of each thread (rounded up to a power of 2).
+	 * \param flush_frequency: period of the draining of the buffers.
+	 */
+	static void start(const std::string &path, const int pid = 0, const size_t buffer_size = 1 << 16,
+	                  const std::chrono::milliseconds flush_frequency = std::chrono::milliseconds(100));
+
+	/*!
+	 * \brief Stops the tracing, drains the buffers and closes the trace file.
+	 */
+	static void stop();
+
+	static inline bool is_enabled()
+	{
+		return trace_enabled.load(std::memory_order_relaxed);
+	}
+
+	/*!
+	 * \brief Registers a span name and returns its id. The ids are never invalidated (even after a 'stop()').
+	 */
+	static uint32_t register_name(const std::string &name);
+
+	/*!
+	 * \brief Names the current thread in the timeline.
+	 */
+	static void set_thread_name(const std::string &name);
+
+	static inline uint64_t tsc()
+	{
+#ifdef AFF3CT_TRACER_RDTSC
+		return (uint64_t)__rdtsc();
+#else
+		return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+	}
+
+	/*!
+	 * \brief Gets the beginning of a span (0 if the tracer is not enabled).
+	 */
+	static inline uint64_t now()
+	{
+		return is_enabled() ? tsc() : 0;
+	}
+
+	/*!
+	 * \brief Records a span of the current thread from 't_begin' (given by 'now()') to the current time.
+	 */
+	static inline void span(const uint32_t name_id, const uint64_t t_begin)
+	{
+		if (is_enabled() && t_begin)
+			local_buffer().push(t_begin, tsc(), name_id);
+	}
+
+private:
+	static Trace_buffer& local_buffer();
+	static void          flush       ();
+	static void          flush_loop  ();
+	static void          calibrate   ();
+	static std::string   escape      (const std::string &str);
+};
+
+/*
+ * Hooks of the tracer for the modules (also declared in 'Module/Task.hpp'), they are not inlined to keep this header
+ * (and the intrinsics of the time stamp counter) out of the headers of the modules.
+ */
+uint64_t trace_now          ();
+uint32_t trace_register_name(const std::string &name);
+void     trace_span         (const uint32_t name_id, const uint64_t t_begin);
+}
+}
+
+#endif /* TRACER_HPP_ */
@@ -0,0 +1,311 @@
+#if defined(__linux__)
+#include <sched.h>
+#include <dirent.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#endif
+#include <map>
+#include <tuple>
+#include <cctype>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+
+#include "Tools/Exception/exception.hpp"
+
+#include "Thread_pinning.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+pinning_policy   aff3ct::tools::Thread_pinning::policy = pinning_policy::NONE;
+std::vector<int> aff3ct::tools::Thread_pinning::order;
+std::vector<int> aff3ct::tools::Thread_pinning::numa_nodes;
+std::vector<int> aff3ct::tools::Thread_pinning::process;
+size_t           aff3ct::tools::Thread_pinning::offset = 0;
+bool             aff3ct::tools::Thread_pinning::huge_pages = false;
+
+namespace
+{
+struct Cpu_topology
+{
+	int cpu;
+	int package;  // physical package (socket)
+	int core;     // core id in the package
+	int node;     // NUMA node (0 if unknown)
+	int smt_rank; // rank of the hardware thread in its physical core
+};
+
+int read_int(const std::string &path, const int default_val)
+{
+	std::ifstream file(path);
+	int val;
+	if (file.is_open() && (file >> val))
+		return val;
+	return default_val;
+}
+
+int read_numa_node(const int cpu)
+{
+#if defined(__linux__)
+	// the 'cpuN' folder contains a 'nodeM' link to its NUMA node
+	const auto path = "/sys/devices/system/cpu/cpu" + std::to_string(cpu);
+	auto dir = opendir(path.c_str());
+	if (dir != nullptr)
+	{
+		auto node = 0;
+		while (auto entry = readdir(dir))
+		{
+			const std::string name = entry->d_name;
+			if (name.size() > 4 && name.compare(0, 4, "node") == 0 &&
+			    std::all_of(name.begin() +4, name.end(), ::isdigit))
+			{
+				node = std::stoi(name.substr(4));
+				break;
+			}
+		}
+		closedir(dir);
+		return node;
+	}
+#endif
+	return 0;
+}
+
+std::vector<Cpu_topology> read_topology(const std::vector<int> &cpus)
+{
+	std::vector<Cpu_topology> topo;
+	for (auto cpu : cpus)
+	{
+		const auto path = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/";
+		topo.push_back({cpu,
+		                read_int(path + "physical_package_id", 0),
+		                read_int(path + "core_id", cpu),
+		                read_numa_node(cpu),
+		                0});
+	}
+
+	// the hardware threads of a physical core are ranked in the order of their CPU ids
+	std::map<std::pair<int,int>, int> n_threads_per_core;
+	for (auto &t : topo)
+		t.smt_rank = n_threads_per_core[std::make_pair(t.package, t.core)]++;
+
+	return topo;
+}
+
+void sort_topology(std::vector<Cpu_topology> &topo, const bool scatter)
+{
+	// compact: one thread per physical core, node after node, then the other hardware threads
+	std::sort(topo.begin(), topo.end(), [](const Cpu_topology &a, const Cpu_topology &b)
+	{
+		return std::make_tuple(a.smt_rank, a.node, a.package, a.core, a.cpu) <
+		       std::make_tuple(b.smt_rank, b.node, b.package, b.core, b.cpu);
+	});
+
+	if (scatter)
+	{
+		// round-robin on the NUMA nodes, each node keeps the compact order
+		std::map<int, std::vector<Cpu_topology>> per_node;
+		for (auto &t : topo)
+			per_node[t.node].push_back(t);
+
+		std::vector<Cpu_topology> scattered;
+		for (size_t i = 0; scattered.size() < topo.size(); i++)
+			for (auto &n : per_node)
+				if (i < n.second.size())
+					scattered.push_back(n.second[i]);
+
+		topo = scattered;
+	}
+}
+}
+
+std::vector<int> Thread_pinning
+::get_allowed_cpus()
+{
+	std::vector<int> cpus;
+#if defined(__linux__)
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	if (sched_getaffinity(0, sizeof(set), &set) == 0)
+		for (auto c = 0; c < CPU_SETSIZE; c++)
+			if (CPU_ISSET(c, &set))
+				cpus.push_back(c);
+#endif
+	return cpus;
+}
+
+void Thread_pinning
+::init(const pinning_policy policy, const std::vector<int> &cpus, const size_t offset)
+{
+	Thread_pinning::policy = policy;
+	Thread_pinning::offset = offset;
+	Thread_pinning::order     .clear();
+	Thread_pinning::numa_nodes.clear();
+	Thread_pinning::process   .clear();
+
+	if (policy == pinning_policy::NONE)
+		return;
+
+	const auto allowed = Thread_pinning::get_allowed_cpus();
+	Thread_pinning::process = allowed;
+	if (allowed.empty())
+	{
+		// the affinity is not supported on this system
+		Thread_pinning::policy = pinning_policy::NONE;
+		return;
+	}
+
+	auto topo = read_topology(allowed);
+
+	if (policy == pinning_policy::LIST)
+	{
+		if (cpus.empty())
+			throw invalid_argument(__FILE__, __LINE__, __func__, "'cpus' can't be empty with the LIST policy.");
+
+		for (auto cpu : cpus)
+		{
+			auto it = std::find_if(topo.begin(), topo.end(), [cpu](const Cpu_topology &t) { return t.cpu == cpu; });
+			if (it == topo.end())
+			{
+				std::stringstream message;
+				message << "'cpu' is not allowed to the process ('cpu' = " << cpu << ").";
+				throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+			}
+
+			Thread_pinning::order     .push_back(it->cpu );
+			Thread_pinning::numa_nodes.push_back(it->node);
+		}
+		return;
+	}
+
+	sort_topology(topo, policy == pinning_policy::SCATTER);
+
+	for (auto &t : topo)
+	{
+		Thread_pinning::order     .push_back(t.cpu );
+		Thread_pinning::numa_nodes.push_back(t.node);
+	}
+}
+
+void Thread_pinning
+::pin(const int tid)
+{
+	if (Thread_pinning::policy == pinning_policy::NONE)
+		return;
+
+#if defined(__linux__)
+	const auto cpu = Thread_pinning::get_cpu(tid);
+
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	CPU_SET(cpu, &set);
+
+	const auto err = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+	if (err != 0)
+	{
+		std::stringstream message;
+		message << "'pthread_setaffinity_np' failed ('tid' = " << tid << ", 'cpu' = " << cpu << ", 'err' = " << err
+		        << ").";
+		throw runtime_error(__FILE__, __LINE__, __func__, message.str());
+	}
+#endif
+}
+
+void Thread_pinning
+::unpin()
+{
+	if (Thread_pinning::policy == pinning_policy::NONE)
+		return;
+
+#if defined(__linux__)
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	for (auto cpu : Thread_pinning::process)
+		CPU_SET(cpu, &set);
+
+	// the CPUs were allowed at the initialization, a failure only keeps the inherited affinity (it is not an error)
+	pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#endif
+}
+
+int Thread_pinning
+::get_cpu(const int tid)
+{
+	if (Thread_pinning::policy == pinning_policy::NONE)
+		return -1;
+
+	return Thread_pinning::order[(Thread_pinning::offset + (size_t)tid) % Thread_pinning::order.size()];
+}
+
+int Thread_pinning
+::get_numa_node(const int tid)
+{
+	if (Thread_pinning::policy == pinning_policy::NONE)
+		return -1;
+
+	return Thread_pinning::numa_nodes[(Thread_pinning::offset + (size_t)tid) % Thread_pinning::numa_nodes.size()];
+}
+
+pinning_policy Thread_pinning
+::get_policy()
+{
+	return Thread_pinning::policy;
+}
+
+pinning_policy Thread_pinning
+::str_to_policy(const std::string &str)
+{
+	     if (str == "NONE"   ) return pinning_policy::NONE;
+	else if (str == "COMPACT") return pinning_policy::COMPACT;
+	else if (str == "SCATTER") return pinning_policy::SCATTER;
+	else if (str == "LIST"   ) return pinning_policy::LIST;
+
+	std::stringstream message;
+	message << "Unknown pinning policy ('str' = " << str << ").";
+	throw invalid_argument(__FILE__, __LINE__, __func__, message.str());
+}
+
+std::string Thread_pinning
+::policy_to_str(const pinning_policy policy)
+{
+	switch (policy)
+	{
+		case pinning_policy::NONE:    return "NONE";
+		case pinning_policy::COMPACT: return "COMPACT";
+		case pinning_policy::SCATTER: return "SCATTER";
+		case pinning_policy::LIST:    return "LIST";
+	}
+
+	throw invalid_argument(__FILE__, __LINE__, __func__, "Unknown pinning policy.");
+}
+
+void Thread_pinning
+::set_huge_pages(const bool huge_pages)
+{
+	Thread_pinning::huge_pages = huge_pages;
+}
+
+bool Thread_pinning
+::is_huge_pages()
+{
+	return Thread_pinning::huge_pages;
+}
+
+void Thread_pinning
+::advise_huge_pages(void *ptr, const size_t n_bytes)
+{
+	if (!Thread_pinning::huge_pages)
+		return;
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+	const uintptr_t huge_page_size = 2 * 1024 * 1024;
+
+	const auto begin = ((uintptr_t)ptr + huge_page_size -1) & ~(huge_page_size -1);
+	const auto end   = ((uintptr_t)ptr + n_bytes)           & ~(huge_page_size -1);
+
+	// an advice is only a hint: a failure is not an error
+	if (end > begin)
+		madvise((void*)begin, (size_t)(end - begin), MADV_HUGEPAGE);
+#endif
+}
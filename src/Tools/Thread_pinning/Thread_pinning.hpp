@@ -0,0 +1,110 @@
+#ifndef THREAD_PINNING_HPP_
+#define THREAD_PINNING_HPP_
+
+#include <string>
+#include <vector>
+#include <cstddef>
+
+namespace aff3ct
+{
+namespace tools
+{
+enum class pinning_policy { NONE, COMPACT, SCATTER, LIST };
+
+/*!
+ * \class Thread_pinning
+ *
+ * \brief Pins the simulation threads on the CPUs (Linux only, no-op elsewhere).
+ *
+ * The CPUs are the ones allowed to the process (affinity mask at the initialization). The policies give the order in
+ * which the threads are placed:
+ *   - COMPACT: the physical cores of the first NUMA node, then of the next nodes, the hyper-threads come last,
+ *   - SCATTER: the NUMA nodes in turns (one core per node and per turn), the hyper-threads come last,
+ *   - LIST:    the explicit list of CPUs.
+ * The thread 'tid' is pinned on the CPU 'order[(offset + tid) % order.size()]'. A thread inherits the affinity of the
+ * thread which creates it: the main thread (which runs the chain 0) and the helper threads created by the modules
+ * (teams of threads for instance) are reset to the CPUs of the process with 'unpin()'.
+ *
+ * The memory of a thread's modules is local to its NUMA node when the thread is pinned before building them: the
+ * Linux default policy allocates a page on the node of the CPU which first touches it.
+ */
+class Thread_pinning
+{
+private:
+	static pinning_policy   policy;
+	static std::vector<int> order;      // CPUs in the order of the threads
+	static std::vector<int> numa_nodes; // NUMA node of each CPU of 'order'
+	static std::vector<int> process;    // CPUs allowed to the process at the initialization
+	static size_t           offset;
+	static bool             huge_pages;
+
+public:
+	/*!
+	 * \brief Computes the placement of the threads.
+	 *
+	 * \param policy: the pinning policy.
+	 * \param cpus:   the list of CPUs of the LIST policy (ignored by the others).
+	 * \param offset: the number of threads placed before the threads of this process (to share a node between many
+	 *                MPI processes for instance).
+	 */
+	static void init(const pinning_policy policy, const std::vector<int> &cpus = {}, const size_t offset = 0);
+
+	/*!
+	 * \brief Pins the calling thread on the CPU of the thread 'tid' (does nothing with the NONE policy).
+	 */
+	static void pin(const int tid);
+
+	/*!
+	 * \brief Resets the affinity of the calling thread to the CPUs allowed to the process (does nothing with the NONE
+	 *        policy). It never throws: it can be called at the beginning of any helper thread.
+	 */
+	static void unpin();
+
+	/*!
+	 * \brief Gets the CPU of the thread 'tid' (-1 with the NONE policy).
+	 */
+	static int get_cpu(const int tid);
+
+	/*!
+	 * \brief Gets the NUMA node of the thread 'tid' (-1 with the NONE policy or if unknown).
+	 */
+	static int get_numa_node(const int tid);
+
+	static pinning_policy get_policy();
+
+	static pinning_policy      str_to_policy(const std::string &str);
+	static std::string         policy_to_str(const pinning_policy policy);
+
+	/*!
+	 * \brief Enables the transparent huge pages for the large buffers (see 'advise_huge_pages').
+	 */
+	static void set_huge_pages(const bool huge_pages);
+	static bool is_huge_pages ();
+
+	/*!
+	 * \brief Advises the kernel to back the buffer with transparent huge pages (Linux 'madvise', only if the huge pages
+	 *        are enabled and only on the part of the buffer aligned on the huge page size). The advice only applies to
+	 *        the pages which are not touched yet.
+	 */
+	static void advise_huge_pages(void *ptr, const size_t n_bytes);
+
+	/*!
+	 * \brief Resizes the empty buffer 'vec' to 'n_elmts' elements: the memory is allocated, then advised (see
+	 *        'advise_huge_pages'), and only then the elements are constructed (first touch).
+	 */
+	template <class V>
+	static inline void resize_huge_pages(V &vec, const size_t n_elmts)
+	{
+		vec.reserve(n_elmts);
+		if (Thread_pinning::huge_pages && n_elmts)
+			Thread_pinning::advise_huge_pages((void*)vec.data(), n_elmts * sizeof(typename V::value_type));
+		vec.resize(n_elmts);
+	}
+
+private:
+	static std::vector<int> get_allowed_cpus();
+};
+}
+}
+
+#endif /* THREAD_PINNING_HPP_ */
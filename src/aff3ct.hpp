@@ -295,6 +295,9 @@
 #ifndef CHANNEL_RAYLEIGH_LLR_HPP_
 #include <Module/Channel/Rayleigh/Channel_Rayleigh_LLR.hpp>
 #endif
+#ifndef CHANNEL_RAYLEIGH_LLR_JAKES_HPP_
+#include <Module/Channel/Rayleigh/Channel_Rayleigh_LLR_Jakes.hpp>
+#endif
 #ifndef CHANNEL_RAYLEIGH_LLR_USER_HPP_
 #include <Module/Channel/Rayleigh/Channel_Rayleigh_LLR_user.hpp>
 #endif
@@ -421,6 +424,9 @@
 #ifndef DECODER_CHASE_STD_HPP_
 #include <Module/Decoder/Generic/Chase/Decoder_chase_std.hpp>
 #endif
+#ifndef DECODER_MAXIMUM_LIKELIHOOD_FAST_HPP_
+#include <Module/Decoder/Generic/ML/Decoder_maximum_likelihood_fast.hpp>
+#endif
 #ifndef DECODER_MAXIMUM_LIKELIHOO_HPP_
 #include <Module/Decoder/Generic/ML/Decoder_maximum_likelihood.hpp>
 #endif
@@ -442,6 +448,9 @@
 #ifndef DECODER_LDPC_PROBABILISTIC_PARALLEL_BIT_FLIPPING_HPP_
 #include <Module/Decoder/LDPC/BF/PPBF/Decoder_LDPC_probabilistic_parallel_bit_flipping.hpp>
 #endif
+#ifndef DECODER_LDPC_PROBABILISTIC_PARALLEL_BIT_FLIPPING_INTER_HPP_
+#include <Module/Decoder/LDPC/BF/PPBF/Decoder_LDPC_probabilistic_parallel_bit_flipping_inter.hpp>
+#endif
 #ifndef DECODER_LDPC_BP_HPP_
 #include <Module/Decoder/LDPC/BP/Decoder_LDPC_BP.hpp>
 #endif
@@ -451,15 +460,30 @@
 #ifndef DECODER_LDPC_BP_FLOODING_INTER_HPP_
 #include <Module/Decoder/LDPC/BP/Flooding/Decoder_LDPC_BP_flooding_inter.hpp>
 #endif
+#ifndef DECODER_LDPC_BP_FLOODING_THREADS_HPP_
+#include <Module/Decoder/LDPC/BP/Flooding/Decoder_LDPC_BP_flooding_threads.hpp>
+#endif
 #ifndef DECODER_LDPC_BP_FLOODING_GALLAGER_A_HPP_
 #include <Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_A.hpp>
 #endif
+#ifndef DECODER_LDPC_BP_FLOODING_GALLAGER_A_INTER_HPP_
+#include <Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_A_inter.hpp>
+#endif
 #ifndef DECODER_LDPC_BP_FLOODING_GALLAGER_B_HPP_
 #include <Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_B.hpp>
 #endif
+#ifndef DECODER_LDPC_BP_FLOODING_GALLAGER_B_INTER_HPP_
+#include <Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_B_inter.hpp>
+#endif
 #ifndef DECODER_LDPC_BP_FLOODING_GALLAGER_E_HPP_
 #include <Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_E.hpp>
 #endif
+#ifndef DECODER_LDPC_BP_FLOODING_GALLAGER_E_INTER_HPP_
+#include <Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_E_inter.hpp>
+#endif
+#ifndef DECODER_LDPC_BP_FLOODING_GALLAGER_INTER_HPP_
+#include <Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_inter.hpp>
+#endif
 #ifndef DECODER_LDPC_BP_FLOODING_SPA_HPP_
 #include <Module/Decoder/LDPC/BP/Flooding/SPA/Decoder_LDPC_BP_flooding_SPA.hpp>
 #endif
@@ -490,6 +514,9 @@
 #ifndef DECODER_POLAR_ASCL_MEM_FAST_SYS_CA
 #include <Module/Decoder/Polar/ASCL/Decoder_polar_ASCL_MEM_fast_CA_sys.hpp>
 #endif
+#ifndef DECODER_POLAR_SCAN_FAST_SYS_
+#include <Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_fast_sys.hpp>
+#endif
 #ifndef DECODER_POLAR_SCAN_NAIVE_H_
 #include <Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_naive.hpp>
 #endif
@@ -505,6 +532,9 @@
 #ifndef DECODER_POLAR_SC_NAIVE_SYS_
 #include <Module/Decoder/Polar/SC/Decoder_polar_SC_naive_sys.hpp>
 #endif
+#ifndef DECODER_POLAR_SCF_FAST_SYS_
+#include <Module/Decoder/Polar/SCF/Decoder_polar_SCF_fast_sys.hpp>
+#endif
 #ifndef DECODER_POLAR_SCF_NAIVE_
 #include <Module/Decoder/Polar/SCF/Decoder_polar_SCF_naive.hpp>
 #endif
@@ -883,6 +913,12 @@
 #ifndef BIT_PACKER_HPP_
 #include <Tools/Algo/Bit_packer.hpp>
 #endif
+#ifndef CONSTRUCTION_CACHE_HPP_
+#include <Tools/Algo/Construction_cache/Construction_cache.hpp>
+#endif
+#ifndef DISK_CACHE_HPP_
+#include <Tools/Algo/Construction_cache/Disk_cache.hpp>
+#endif
 #ifndef DRAW_GENERATOR_HPP_
 #include <Tools/Algo/Draw_generator/Draw_generator.hpp>
 #endif
@@ -898,6 +934,9 @@
 #ifndef EVENT_GENERATOR_MKL_HPP
 #include <Tools/Algo/Draw_generator/Event_generator/MKL/Event_generator_MKL.hpp>
 #endif
+#ifndef EVENT_GENERATOR_SPARSE_HPP
+#include <Tools/Algo/Draw_generator/Event_generator/Sparse/Event_generator_sparse.hpp>
+#endif
 #ifndef EVENT_GENERATOR_STD_HPP
 #include <Tools/Algo/Draw_generator/Event_generator/Standard/Event_generator_std.hpp>
 #endif
@@ -934,6 +973,12 @@
 #ifndef HISTOGRAM_H__
 #include <Tools/Algo/Histogram.hpp>
 #endif
+#ifndef MAPPED_TRACE_HPP_
+#include <Tools/Algo/Mapped_trace/Mapped_trace.hpp>
+#endif
+#ifndef BIT_MATRIX_HPP_
+#include <Tools/Algo/Matrix/Bit_matrix/Bit_matrix.hpp>
+#endif
 #ifndef FULL_MATRIX_HPP_
 #include <Tools/Algo/Matrix/Full_matrix/Full_matrix.hpp>
 #endif
@@ -967,12 +1012,18 @@
 #ifndef PRNG_MT19937_SIMD_HPP
 #include <Tools/Algo/PRNG/PRNG_MT19937_simd.hpp>
 #endif
+#ifndef BITONIC_SORTER_HPP
+#include <Tools/Algo/Sort/Bitonic_sorter.hpp>
+#endif
 #ifndef LC_SORTER_HPP
 #include <Tools/Algo/Sort/LC_sorter.hpp>
 #endif
 #ifndef LC_SORTER_SIMD_HPP
 #include <Tools/Algo/Sort/LC_sorter_simd.hpp>
 #endif
+#ifndef THREAD_TEAM_HPP_
+#include <Tools/Algo/Thread_team/Thread_team.hpp>
+#endif
 #ifndef BINARY_NODE_HPP_
 #include <Tools/Algo/Tree/Binary_node.hpp>
 #endif
@@ -1087,6 +1138,9 @@
 #ifndef AUTO_CLONED_UNIQUE_PTR_HPP__
 #include <Tools/auto_cloned_unique_ptr.hpp>
 #endif
+#ifndef CHECKPOINT_HPP_
+#include <Tools/Checkpoint/Checkpoint.hpp>
+#endif
 #ifndef BCH_POLYNOMIAL_GENERATOR_HPP
 #include <Tools/Code/BCH/BCH_polynomial_generator.hpp>
 #endif
@@ -1141,6 +1195,15 @@
 #ifndef UPDATE_RULE_OMS_SIMD_HPP
 #include <Tools/Code/LDPC/Update_rule/OMS/Update_rule_OMS_simd.hpp>
 #endif
+#ifndef PHI_TABLE_HPP_
+#include <Tools/Code/LDPC/Update_rule/SPA_table/Phi_table.hpp>
+#endif
+#ifndef UPDATE_RULE_SPA_TABLE_HPP
+#include <Tools/Code/LDPC/Update_rule/SPA_table/Update_rule_SPA_table.hpp>
+#endif
+#ifndef UPDATE_RULE_SPA_TABLE_SIMD_HPP
+#include <Tools/Code/LDPC/Update_rule/SPA_table/Update_rule_SPA_table_simd.hpp>
+#endif
 #ifndef UPDATE_RULE_SPA_HPP
 #include <Tools/Code/LDPC/Update_rule/SPA/Update_rule_SPA.hpp>
 #endif
@@ -1327,6 +1390,12 @@
 #ifndef DUMPER_REDUCTION_HPP_
 #include <Tools/Display/Dumper/Dumper_reduction.hpp>
 #endif
+#ifndef DUMPER_REDUCTION_STREAM_HPP_
+#include <Tools/Display/Dumper/Dumper_reduction_stream.hpp>
+#endif
+#ifndef DUMPER_STREAM_HPP_
+#include <Tools/Display/Dumper/Dumper_stream.hpp>
+#endif
 #ifndef FRAME_TRACE_HPP
 #include <Tools/Display/Frame_trace/Frame_trace.hpp>
 #endif
@@ -1441,6 +1510,9 @@
 #ifndef INTERLEAVER_CORE_USER_HPP
 #include <Tools/Interleaver/User/Interleaver_core_user.hpp>
 #endif
+#ifndef CONFIDENCE_INTERVAL_H_
+#include <Tools/Math/confidence_interval.h>
+#endif
 #ifndef DISTRIBUTION_HPP__
 #include <Tools/Math/Distribution/Distribution.hpp>
 #endif
@@ -1483,6 +1555,9 @@
 #ifndef SIGMA_HPP_
 #include <Tools/Noise/Sigma.hpp>
 #endif
+#ifndef BIT_SLICE_HPP_
+#include <Tools/Perf/Bit_slice/Bit_slice.hpp>
+#endif
 #ifndef HARD_DECIDE_H_
 #include <Tools/Perf/common/hard_decide.h>
 #endif
@@ -1492,6 +1567,9 @@
 #ifndef COMPUTE_PARITY_H_
 #include <Tools/Perf/compute_parity.h>
 #endif
+#ifndef PERF_COUNTERS_HPP_
+#include <Tools/Perf/Counters/Perf_counters.hpp>
+#endif
 #ifndef BITWISE_DIFF_H__
 #include <Tools/Perf/distance/Bitwise_diff.h>
 #endif
@@ -1507,6 +1585,9 @@
 #ifndef REORDERER_HPP_
 #include <Tools/Perf/Reorderer/Reorderer.hpp>
 #endif
+#ifndef TRACER_HPP_
+#include <Tools/Perf/Trace/Tracer.hpp>
+#endif
 #ifndef TRANSPOSE_AVX_H
 #include <Tools/Perf/Transpose/transpose_AVX.h>
 #endif
@@ -1540,6 +1621,9 @@
 #ifndef SYSTEM_FUNCTIONS_H_
 #include <Tools/system_functions.h>
 #endif
+#ifndef THREAD_PINNING_HPP_
+#include <Tools/Thread_pinning/Thread_pinning.hpp>
+#endif
 #ifndef TYPES_H_
 #include <Tools/types.h>
 #endif
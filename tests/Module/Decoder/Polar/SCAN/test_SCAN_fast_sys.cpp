@@ -0,0 +1,146 @@
+/*
+ * Unit test of the Decoder_polar_SCAN_fast_sys: the intra-frame SIMD decoder has to give exactly the same soft and
+ * hard outputs than the sequential one on the same frames (for all the node types, including the nodes smaller than
+ * a SIMD register). Without the REP and the SPC nodes (their soft feedbacks are computed in one step), both decoders
+ * have to give exactly the same outputs than the Decoder_polar_SCAN_naive_sys.
+ *
+ * usage: aff3ct-test-SCAN-fast-sys
+ */
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+
+#include "Tools/Code/Polar/API/API_polar_dynamic_seq.hpp"
+#include "Tools/Code/Polar/API/API_polar_dynamic_intra.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r0.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r0_left.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r1.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_std.hpp"
+#include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_naive_sys.hpp"
+#include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_fast_sys.hpp"
+
+using namespace aff3ct;
+
+using B = int;
+using R = float;
+
+using Decoder_seq   = module::Decoder_polar_SCAN_fast_sys<B,R,tools::API_polar_dynamic_seq  <B,R>>;
+using Decoder_intra = module::Decoder_polar_SCAN_fast_sys<B,R,tools::API_polar_dynamic_intra<B,R>>;
+
+constexpr int n_ite    = 4;  // number of SCAN iterations
+constexpr int n_frames = 50; // number of frames per code
+
+// the frozen bits are the N - K positions with the smallest Hamming weights (Reed-Muller like construction)
+std::vector<bool> build_frozen_bits(const int K, const int N)
+{
+	std::vector<int> idx(N);
+	for (auto i = 0; i < N; i++)
+		idx[i] = i;
+
+	auto weight = [](int v) { auto w = 0; for (; v; v >>= 1) w += v & 1; return w; };
+	std::stable_sort(idx.begin(), idx.end(), [&](const int a, const int b) { return weight(a) < weight(b); });
+
+	std::vector<bool> frozen_bits(N, false);
+	for (auto i = 0; i < N - K; i++)
+		frozen_bits[idx[i]] = true;
+	return frozen_bits;
+}
+
+// the patterns of the nodes decoded as in the Decoder_polar_SCAN_naive_sys
+std::vector<std::unique_ptr<tools::Pattern_polar_i>> build_patterns_naive()
+{
+	std::vector<std::unique_ptr<tools::Pattern_polar_i>> patterns;
+	patterns.push_back(std::unique_ptr<tools::Pattern_polar_i>(new tools::Pattern_polar_std    ));
+	patterns.push_back(std::unique_ptr<tools::Pattern_polar_i>(new tools::Pattern_polar_r0_left));
+	patterns.push_back(std::unique_ptr<tools::Pattern_polar_i>(new tools::Pattern_polar_r0     ));
+	patterns.push_back(std::unique_ptr<tools::Pattern_polar_i>(new tools::Pattern_polar_r1     ));
+	return patterns;
+}
+
+// returns the number of failed checks
+int check_outputs(const std::string &test, const std::vector<R> &soft_ref, const std::vector<R> &soft,
+                  const std::vector<B> &hard_ref, const std::vector<B> &hard)
+{
+	auto n_fails = 0;
+
+	if (!std::equal(soft_ref.begin(), soft_ref.end(), soft.begin()))
+	{
+		std::cerr << "FAILED: " << test << ", the soft outputs differ." << std::endl;
+		n_fails++;
+	}
+
+	if (!std::equal(hard_ref.begin(), hard_ref.end(), hard.begin()))
+	{
+		std::cerr << "FAILED: " << test << ", the hard decisions differ." << std::endl;
+		n_fails++;
+	}
+
+	return n_fails;
+}
+
+// returns the number of failed checks
+int check(const int K, const int N, std::mt19937 &gen)
+{
+	const auto frozen_bits = build_frozen_bits(K, N);
+	const auto code = "(K = " + std::to_string(K) + ", N = " + std::to_string(N) + ")";
+
+	module::Decoder_polar_SCAN_naive_sys<B,R> dec_naive    (K, N, n_ite, frozen_bits);
+	Decoder_seq                               dec_seq      (K, N, n_ite, frozen_bits);
+	Decoder_intra                             dec_intra    (K, N, n_ite, frozen_bits);
+	Decoder_seq                               dec_seq_std  (K, N, n_ite, frozen_bits, build_patterns_naive(), 2, 3);
+	Decoder_intra                             dec_intra_std(K, N, n_ite, frozen_bits, build_patterns_naive(), 2, 3);
+
+	std::normal_distribution<R> dist((R)1, (R)1);
+
+	auto n_fails = 0;
+	for (auto f = 0; f < n_frames; f++)
+	{
+		// the all-zero codeword with a BPSK modulation and an AWGN channel (the LLRs are scaled by 2)
+		std::vector<R> Y_N(N);
+		for (auto &y : Y_N)
+			y = 2 * dist(gen);
+
+		std::vector<R> soft_naive(N), soft_seq(N), soft_intra(N), soft_seq_std(N), soft_intra_std(N);
+		std::vector<B> hard_naive(K), hard_seq(K), hard_intra(K), hard_seq_std(K), hard_intra_std(K);
+
+		// the naive decoder keeps its soft feedbacks from a frame to the other until it is reset
+		dec_naive.reset(); dec_naive.decode_siso(Y_N, soft_naive);
+		dec_naive.reset(); dec_naive.decode_siho(Y_N, hard_naive);
+
+		dec_seq      .decode_siso(Y_N, soft_seq      ); dec_seq      .decode_siho(Y_N, hard_seq      );
+		dec_intra    .decode_siso(Y_N, soft_intra    ); dec_intra    .decode_siho(Y_N, hard_intra    );
+		dec_seq_std  .decode_siso(Y_N, soft_seq_std  ); dec_seq_std  .decode_siho(Y_N, hard_seq_std  );
+		dec_intra_std.decode_siso(Y_N, soft_intra_std); dec_intra_std.decode_siho(Y_N, hard_intra_std);
+
+		const auto frame = " " + code + ", frame " + std::to_string(f);
+		n_fails += check_outputs("INTRA vs seq"   + frame, soft_seq,   soft_intra,     hard_seq,   hard_intra    );
+		n_fails += check_outputs("seq vs naive"   + frame, soft_naive, soft_seq_std,   hard_naive, hard_seq_std  );
+		n_fails += check_outputs("INTRA vs naive" + frame, soft_naive, soft_intra_std, hard_naive, hard_intra_std);
+	}
+
+	return n_fails;
+}
+
+int main(int argc, char** argv)
+{
+	std::mt19937 gen(123);
+
+	auto n_fails = 0;
+	// the small codes have nodes smaller than a SIMD register at all the levels of the tree
+	for (auto N : {8, 16, 32, 64, 256, 1024})
+		for (auto rate : {4, 2})
+			n_fails += check(N - N / rate, N, gen);
+
+	if (n_fails)
+	{
+		std::cerr << n_fails << " check(s) failed." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::cout << "All the checks passed." << std::endl;
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,111 @@
+/*
+ * Unit test of the importance sampling (IS) weighting of the BFER monitor, on uncoded BPSK frames sent over the AWGN
+ * channel (a bit is wrong when the sign of its LLR is wrong):
+ *   - without bias (scale = 1, shift = 0) the weights are 1 and the weighted FER and BER are the plain ones,
+ *   - with a biased noise (scaled and/or shifted) the weighted FER and BER estimate the true ones: they are compared
+ *     with the exact error rates of the uncoded BPSK.
+ *
+ * usage: aff3ct-test-importance-sampling
+ */
+#include <cmath>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+
+#include "Tools/Noise/Sigma.hpp"
+#include "Module/Channel/AWGN/Channel_AWGN_LLR.hpp"
+#include "Module/Monitor/BFER/Monitor_BFER.hpp"
+
+using namespace aff3ct;
+
+constexpr int N        = 16;   // number of bits per frame
+constexpr int n_frames = 8;    // number of frames per call
+constexpr int n_calls  = 5000; // number of calls: 40000 frames
+
+// simulate 'n_calls' * 'n_frames' frames, 'plain' ignores the weights and 'weighted' uses them
+void simulate(const float sigma, const float scale, const float shift, const int seed,
+              module::Monitor_BFER<int> &plain, module::Monitor_BFER<int> &weighted)
+{
+	module::Channel_AWGN_LLR<float> channel(N, seed, false, tools::Sigma<float>(sigma), n_frames);
+	channel.set_importance_sampling(scale, shift);
+	weighted.activate_weighting(true);
+
+	std::vector<int  > U(N * n_frames), V(N * n_frames);
+	std::vector<float> X(N * n_frames), Y(N * n_frames);
+	for (auto c = 0; c < n_calls; c++)
+	{
+		for (auto i = 0; i < N * n_frames; i++)
+		{
+			U[i] = (i * 7 + c) % 3 == 0; // the weighting does not depend on the bit values
+			X[i] = U[i] ? -1.f : 1.f;
+		}
+
+		channel.add_noise(X, Y);
+
+		for (auto i = 0; i < N * n_frames; i++)
+			V[i] = Y[i] < 0.f;
+
+		weighted.set_weights(channel.get_is_weights());
+		plain   .check_errors(U, V);
+		weighted.check_errors(U, V);
+	}
+}
+
+bool close(const double val, const double ref, const double rel_tol)
+{
+	return std::abs(val - ref) <= rel_tol * std::abs(ref);
+}
+
+int main(int argc, char** argv)
+{
+	auto n_fails = 0;
+
+	// without bias the weighted error rates are the plain ones (on the same frames)
+	{
+		module::Monitor_BFER<int> plain(N, 0, 0, false, n_frames), weighted(N, 0, 0, false, n_frames);
+		simulate(0.5f, 1.f, 0.f, 42, plain, weighted);
+
+		if (weighted.get_n_fe() != plain.get_n_fe() || weighted.get_n_be() != plain.get_n_be() ||
+		    weighted.get_w_fe() != (double)plain.get_n_fe() || weighted.get_w_be() != (double)plain.get_n_be() ||
+		    !close(weighted.get_fer(), plain.get_fer(), 1e-6) || !close(weighted.get_ber(), plain.get_ber(), 1e-6))
+		{
+			std::cerr << "FAILED: without bias, weighted FER = " << weighted.get_fer() << " (plain FER = "
+			          << plain.get_fer() << "), weighted BER = " << weighted.get_ber() << " (plain BER = "
+			          << plain.get_ber() << ")." << std::endl;
+			n_fails++;
+		}
+	}
+
+	// with a bias the weighted error rates estimate the exact ones
+	const float sigma = 0.4f;
+	const auto ber_ref = 0.5 * std::erfc(1.0 / (sigma * std::sqrt(2.0))); // Q(1 / sigma)
+	const auto fer_ref = 1.0 - std::pow(1.0 - ber_ref, N);
+
+	struct Bias { float scale; float shift; };
+	for (auto bias : {Bias{1.5f, 0.f}, Bias{1.f, 0.15f}, Bias{1.2f, 0.1f}})
+	{
+		module::Monitor_BFER<int> plain(N, 0, 0, false, n_frames), weighted(N, 0, 0, false, n_frames);
+		simulate(sigma, bias.scale, bias.shift, 7, plain, weighted);
+
+		// the biased noise makes the errors more frequent: the plain FER overestimates the true one
+		if (!close(weighted.get_fer(), fer_ref, 0.1) || !close(weighted.get_ber(), ber_ref, 0.1) ||
+		    plain.get_fer() <= fer_ref)
+		{
+			std::cerr << "FAILED: scale = " << bias.scale << ", shift = " << bias.shift << ", weighted FER = "
+			          << weighted.get_fer() << " (exact FER = " << fer_ref << ", biased FER = " << plain.get_fer()
+			          << "), weighted BER = " << weighted.get_ber() << " (exact BER = " << ber_ref << ")."
+			          << std::endl;
+			n_fails++;
+		}
+	}
+
+	if (n_fails)
+	{
+		std::cerr << n_fails << " check(s) failed." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::cout << "All the checks passed." << std::endl;
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,109 @@
+/*
+ * Unit test of the MPI reductions of the BFER monitors: each process checks different frames with its own monitors
+ * and the reduced number of frames, of wrong frames and of wrong bits have to be the sums of the counters of all the
+ * monitors of all the processes (summed here with a plain 'MPI_Allreduce'). The blocking and the non-blocking
+ * ('MPI_Iallreduce') reductions are checked after several rounds of frames.
+ *
+ * usage: mpirun -np 4 aff3ct-test-monitor-reduction-MPI
+ */
+#include <memory>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <mpi.h>
+
+#include "Module/Monitor/BFER/Monitor_BFER.hpp"
+#include "Module/Monitor/Monitor_reduction_MPI.hpp"
+
+using namespace aff3ct;
+
+constexpr int K          = 32; // number of bits per frame
+constexpr int n_monitors = 3;  // number of monitors per process (one per simulation thread)
+constexpr int n_rounds   = 3;  // number of reductions per mode
+
+// the number of frames and of wrong bits depend on the process, on the monitor and on the round
+void check_frames(module::Monitor_BFER<int> &monitor, const int rank, const int m, const int round)
+{
+	std::vector<int> U(K, 0), V(K, 0);
+	const auto n_frames = 5 + 3 * rank + 7 * m + round;
+	for (auto f = 0; f < n_frames; f++)
+	{
+		const auto n_errors = (f + rank + m + round) % 4; // 0 to 3 wrong bits
+		for (auto i = 0; i < K; i++)
+			V[i] = i < n_errors ? 1 : 0;
+		monitor.check_errors(U, V);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	MPI_Init(&argc, &argv);
+
+	int rank, np;
+	MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+	MPI_Comm_size(MPI_COMM_WORLD, &np);
+
+	auto n_fails = 0;
+	{
+		std::vector<std::unique_ptr<module::Monitor_BFER<int>>> monitors;
+		for (auto m = 0; m < n_monitors; m++)
+			monitors.push_back(std::unique_ptr<module::Monitor_BFER<int>>(new module::Monitor_BFER<int>(K, 0)));
+
+		module::Monitor_reduction_MPI<module::Monitor_BFER<int>> reduction(monitors);
+		module::Monitor_reduction::check_reducible();
+
+		for (auto async : {false, true})
+		{
+			module::Monitor_reduction::set_async(async);
+			module::Monitor_reduction::reset_all();
+
+			for (auto round = 0; round < n_rounds; round++)
+			{
+				for (auto m = 0; m < n_monitors; m++)
+					check_frames(*monitors[m], rank, m, round);
+
+				// the expected counters: the sums over the local monitors and over the processes
+				unsigned long long local[3] = {0, 0, 0}, global[3];
+				for (auto &mnt : monitors)
+				{
+					local[0] += mnt->get_n_analyzed_fra();
+					local[1] += mnt->get_n_fe();
+					local[2] += mnt->get_n_be();
+				}
+				MPI_Allreduce(local, global, 3, MPI_UNSIGNED_LONG_LONG, MPI_SUM, MPI_COMM_WORLD);
+
+				// a forced reduction is complete in both modes
+				module::Monitor_reduction::reduce_all(false, true);
+
+				if (reduction.get_n_analyzed_fra() != global[0] || reduction.get_n_fe() != global[1] ||
+				    reduction.get_n_be() != global[2])
+				{
+					std::cerr << "FAILED: rank " << rank << ", " << (async ? "non-blocking" : "blocking")
+					          << " reduction, round " << round << ": n_fra = " << reduction.get_n_analyzed_fra()
+					          << " (expected " << global[0] << "), n_fe = " << reduction.get_n_fe() << " (expected "
+					          << global[1] << "), n_be = " << reduction.get_n_be() << " (expected " << global[2]
+					          << ")." << std::endl;
+					n_fails++;
+				}
+			}
+
+			// the final reduction of a noise point
+			module::Monitor_reduction::is_done_all(false, true);
+		}
+	}
+
+	int n_fails_all;
+	MPI_Allreduce(&n_fails, &n_fails_all, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+	MPI_Finalize();
+
+	if (n_fails_all)
+	{
+		if (rank == 0)
+			std::cerr << n_fails_all << " check(s) failed." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	if (rank == 0)
+		std::cout << "All the checks passed (" << np << " processes)." << std::endl;
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,148 @@
+/*
+ * Unit test of the Bitonic_sorter: the selected values are compared with the ones of std::partial_sort for K on both
+ * sides of 'max_K', for power of 2 and non-power of 2 numbers of elements and for a number of elements growing beyond
+ * the size given to the constructor. The positions have to be distinct and valid, the ties can be broken differently
+ * from the reference. With the integers, the lowest value (e.g. -128 for int8_t) has to be selected as the largest
+ * absolute value.
+ *
+ * usage: aff3ct-test-bitonic-sorter
+ */
+#include <set>
+#include <random>
+#include <string>
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+
+#include "Tools/Algo/Sort/Bitonic_sorter.hpp"
+
+using namespace aff3ct;
+
+template <typename T>
+std::string type_name();
+
+template <> std::string type_name<int8_t >() { return "int8";   }
+template <> std::string type_name<int16_t>() { return "int16";  }
+template <> std::string type_name<int32_t>() { return "int32";  }
+template <> std::string type_name<float  >() { return "float";  }
+template <> std::string type_name<double >() { return "double"; }
+
+// returns the number of failed checks
+template <typename T>
+int check(tools::Bitonic_sorter<T> &sorter, std::mt19937 &gen, const int n_elmts, const int K, const bool abs)
+{
+	std::uniform_int_distribution<int> dist(-100, 100);
+
+	std::vector<T> values(n_elmts), ref(n_elmts);
+	for (auto i = 0; i < n_elmts; i++)
+	{
+		values[i] = (T)dist(gen);
+		ref   [i] = abs ? (T)std::abs(values[i]) : values[i];
+	}
+	std::partial_sort(ref.begin(), ref.begin() + K, ref.end());
+
+	std::vector<int> pos(K, -1);
+	if (abs) sorter.partial_sort_abs(values.data(), pos, n_elmts, K);
+	else     sorter.partial_sort    (values.data(), pos, n_elmts, K);
+
+	auto valid = std::set<int>(pos.begin(), pos.end()).size() == (size_t)K;
+	for (auto k = 0; k < K && valid; k++)
+	{
+		valid = pos[k] >= 0 && pos[k] < n_elmts;
+		if (valid)
+			valid = (abs ? (T)std::abs(values[pos[k]]) : values[pos[k]]) == ref[k];
+	}
+
+	if (!valid)
+		std::cerr << "FAILED: type = " << type_name<T>() << ", n_elmts = " << n_elmts << ", K = " << K
+		          << (abs ? ", abs" : "") << std::endl;
+
+	return valid ? 0 : 1;
+}
+
+// returns the number of failed checks
+template <typename T>
+int check_lowest(const int n_elmts, const int K)
+{
+	// the lowest value is at position 0, the other absolute values are all different and smaller
+	std::vector<T> values(n_elmts);
+	values[0] = std::numeric_limits<T>::min();
+	for (auto i = 1; i < n_elmts; i++)
+		values[i] = (T)(i % 2 ? i : -i);
+
+	tools::Bitonic_sorter<T> sorter(n_elmts);
+	std::vector<int> pos(K, -1);
+	sorter.partial_sort_abs(values.data(), pos, n_elmts, K);
+
+	auto valid = true;
+	for (auto k = 0; k < K && valid; k++)
+		valid = pos[k] == ((k == n_elmts -1) ? 0 : k +1);
+
+	if (!valid)
+		std::cerr << "FAILED: type = " << type_name<T>() << ", n_elmts = " << n_elmts << ", K = " << K
+		          << ", abs of the lowest value" << std::endl;
+
+	return valid ? 0 : 1;
+}
+
+template <typename T>
+int test()
+{
+	const auto max_K = tools::Bitonic_sorter<T>::max_K;
+	const std::vector<int> all_n = {2, 8, 16, 31, 32, 64, 100, 128, 250, 256, 1000, 1024, 4096};
+	const std::vector<int> all_K = {1, 2, 3, 4, 7, 8, 16, 17, max_K -1, max_K, max_K +1, 2 * max_K, 100};
+
+	std::mt19937 gen(0);
+	auto n_failures = 0;
+
+	// one sorter per number of elements
+	for (auto n_elmts : all_n)
+	{
+		tools::Bitonic_sorter<T> sorter(n_elmts);
+		for (auto K : all_K)
+			if (K <= n_elmts)
+				for (auto abs : {false, true})
+					n_failures += check<T>(sorter, gen, n_elmts, K, abs);
+	}
+
+	// one sorter for a growing number of elements (the buffers have to be resized)
+	for (auto abs : {false, true})
+	{
+		tools::Bitonic_sorter<T> sorter(4);
+		for (auto n_elmts : all_n)
+			for (auto K : all_K)
+				if (K <= n_elmts)
+					n_failures += check<T>(sorter, gen, n_elmts, K, abs);
+	}
+
+	// the absolute value of the lowest integer overflows
+	if (std::numeric_limits<T>::is_integer)
+		for (auto n_elmts : {4, 8, 64, 100})
+			for (auto K : {1, 3, max_K, n_elmts -1, n_elmts})
+				if (K <= n_elmts)
+					n_failures += check_lowest<T>(n_elmts, K);
+
+	return n_failures;
+}
+
+int main(int argc, char** argv)
+{
+	auto n_failures = 0;
+	n_failures += test<int8_t >();
+	n_failures += test<int16_t>();
+	n_failures += test<int32_t>();
+	n_failures += test<float  >();
+	n_failures += test<double >();
+
+	if (n_failures)
+	{
+		std::cerr << n_failures << " check(s) failed." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::cout << "All the checks passed." << std::endl;
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,358 @@
+/*
+ * Unit test of the transformations of a parity matrix H into a generator matrix G: the bit-packed Gaussian eliminations
+ * of the LDPC_matrix_handler (with 1 and several threads) are compared with the previous byte-wise eliminations (copied
+ * below as the reference). G and the positions of the information bits have to be the same, and G.H has to be null.
+ * The matrices are random (with an invertible or a singular parity part) and the reference H matrices given on the
+ * command line (AList or QC files of the 'conf' repository). The identity method is only compared on the full rank
+ * matrices (the previous implementation did not support the other ones).
+ *
+ * usage: aff3ct-test-H-to-G [H_file ...]
+ */
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+#include <numeric>
+#include <iostream>
+#include <algorithm>
+#include <exception>
+#include <functional>
+
+#include "Tools/Algo/Matrix/matrix_utils.h"
+#include "Tools/Code/LDPC/Matrix_handler/LDPC_matrix_handler.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+using LDPC_matrix           = LDPC_matrix_handler::LDPC_matrix;
+using Positions_vector      = LDPC_matrix_handler::Positions_vector;
+using Positions_pair_vector = LDPC_matrix_handler::Positions_pair_vector;
+
+namespace ref
+{
+// ----------------------------------------------------------------- byte-wise eliminations (previous implementation)
+void swap_columns(LDPC_matrix& mat, size_t idx1, size_t idx2)
+{
+	for (size_t l = 0; l < mat.get_n_rows(); l++)
+		std::swap(mat[l][idx1], mat[l][idx2]);
+}
+
+void xor_row(const LDPC_matrix& mat, const size_t src, LDPC_matrix& dst_mat, const size_t dst, const size_t from)
+{
+	std::transform(mat[src].begin() + from, mat[src].end(), dst_mat[dst].begin() + from, dst_mat[dst].begin() + from,
+	               std::not_equal_to<LDPC_matrix::value_type>());
+}
+
+// returns false if H2 is not invertible
+bool LU_decomp(const LDPC_matrix& Hp, LDPC_matrix& Hinv)
+{
+	auto M = Hp.get_n_rows();
+
+	Hinv = Hp.resize(M, 2 * M, Matrix::Origin::TOP_LEFT);
+	for (size_t i = 0; i < M; i++)
+		Hinv[i][M + i] = 1;
+
+	// Gaussian elimination (Forward)
+	for (size_t r = 0; r < M; r++)
+	{
+		if (Hinv[r][r] == 0)
+		{
+			size_t r_swap = 0;
+			for (auto r2 = r + 1; r2 < M; r2++)
+				if (Hinv[r2][r] != 0)
+				{
+					r_swap = r2;
+					break;
+				}
+
+			if (r_swap == 0)
+				return false;
+
+			std::swap(Hinv[r], Hinv[r_swap]);
+		}
+
+		for (auto r2 = r + 1; r2 < M; r2++)
+			if (Hinv[r2][r] != 0)
+				xor_row(Hinv, r, Hinv, r2, 0);
+	}
+
+	// Gaussian elimination (Backward)
+	for (auto r = M - 1; r > 0; r--)
+		for (auto r2 = r; r2 > 0; r2--)
+			if (Hinv[r2 - 1][r] != 0)
+				xor_row(Hinv, r, Hinv, r2 - 1, 0);
+
+	Hinv.self_resize(M, M, Matrix::Origin::TOP_RIGHT);
+	return true;
+}
+
+bool transform_H_to_G_decomp_LU(const LDPC_matrix& H, LDPC_matrix& G, Positions_vector& info_bits_pos)
+{
+	auto M = H.get_n_rows();
+	auto N = H.get_n_cols();
+	auto K = N - M;
+
+	LDPC_matrix Gp;
+	if (!LU_decomp(H.resize(M, M, Matrix::Origin::TOP_RIGHT), Gp))
+		return false;
+
+	// G = [I_K | (Gp * Hs)^T] with Hs the systematic part of H (the product skips the null bits of the sparse Hs)
+	G = LDPC_matrix(K, N);
+	for (size_t r = 0; r < K; r++)
+		G[r][r] = 1;
+	for (size_t m = 0; m < M; m++)
+		for (size_t k = 0; k < K; k++)
+			if (H[m][k])
+				for (size_t l = 0; l < M; l++)
+					G[k][K + l] ^= Gp[l][m];
+
+	info_bits_pos.resize(K);
+	std::iota(info_bits_pos.begin(), info_bits_pos.end(), 0);
+
+	return true;
+}
+
+// the null rows are erased (H is not full rank)
+Positions_pair_vector form_diagonal(LDPC_matrix& mat)
+{
+	auto n_row = mat.get_n_rows();
+	auto n_col = mat.get_n_cols();
+
+	Positions_pair_vector swapped_cols;
+	for (size_t i = 0; i < n_row; i++)
+	{
+		bool found = mat[i][i];
+
+		if (!found)
+		{
+			for (auto j = i +1; j < n_row; j++)
+				if (mat[j][i])
+				{
+					std::swap(mat[i], mat[j]);
+					found = true;
+					break;
+				}
+
+			if (!found)
+				for (auto j = i +1; j < n_col; j++)
+					if (mat[i][j])
+					{
+						swapped_cols.push_back(std::make_pair(i,j));
+						swap_columns(mat, i, j);
+						found = true;
+						break;
+					}
+		}
+
+		if (found)
+		{
+			for (auto j = i +1; j < n_row; j++)
+				if (mat[j][i])
+					xor_row(mat, i, mat, j, i);
+		}
+		else
+		{
+			mat.erase_row(i);
+			i--;
+			n_row--;
+		}
+	}
+
+	return swapped_cols;
+}
+
+void form_identity(LDPC_matrix& mat)
+{
+	for (auto c = mat.get_n_rows() - 1; c > 0; c--)
+		for (auto r = c; r > 0; r--)
+			if (mat[r - 1][c])
+				xor_row(mat, c, mat, r - 1, c);
+}
+
+// returns false if H is not full rank (the previous implementation did not support it)
+bool transform_H_to_G_identity(const LDPC_matrix& H, LDPC_matrix& G, Positions_vector& info_bits_pos)
+{
+	auto mat = H;
+
+	auto M = H.get_n_rows();
+	auto N = H.get_n_cols();
+	auto K = N - M;
+
+	auto swapped_cols = form_diagonal(mat);
+	if (mat.get_n_rows() != M)
+		return false;
+	form_identity(mat);
+
+	// the right part of 'mat' above the K*K identity (G is VERTICAL N*K)
+	G = LDPC_matrix(N, K);
+	for (size_t i = 0; i < M; i++)
+		std::copy(mat[i].begin() + M, mat[i].end(), G[i].begin());
+	for (auto i = M; i < N; i++)
+		G[i][i - M] = 1;
+
+	for (auto l = swapped_cols.size(); l > 0; l--)
+		std::swap(G[swapped_cols[l-1].first], G[swapped_cols[l-1].second]);
+
+	info_bits_pos.resize(K);
+	Positions_vector bits_pos(N);
+	std::iota(bits_pos.begin(), bits_pos.end(), 0);
+	for (auto& p : swapped_cols)
+		std::swap(bits_pos[p.first], bits_pos[p.second]);
+	std::copy(bits_pos.begin() + M, bits_pos.end(), info_bits_pos.begin());
+
+	return true;
+}
+}
+
+// ------------------------------------------------------------------------------------------------------------ checks
+bool same(const LDPC_matrix& A, const LDPC_matrix& B)
+{
+	if (A.get_n_rows() != B.get_n_rows() || A.get_n_cols() != B.get_n_cols())
+		return false;
+
+	for (size_t r = 0; r < A.get_n_rows(); r++)
+		if (A[r] != B[r])
+			return false;
+
+	return true;
+}
+
+// returns the number of failed checks
+int check(const Sparse_matrix& H_file, const std::string& name)
+{
+	auto n_fails = 0;
+	const auto H  = H_file.turn(Matrix::Way::HORIZONTAL);
+	const auto Hf = sparse_to_full<LDPC_matrix::value_type>(H);
+
+	LDPC_matrix G_ref;
+	Positions_vector pos_ref;
+	if (ref::transform_H_to_G_identity(Hf, G_ref, pos_ref))
+	{
+		for (auto n_threads : {1, 3})
+		{
+			Positions_vector pos;
+			const auto G = LDPC_matrix_handler::transform_H_to_G_identity(H, pos, n_threads);
+			if (!same(sparse_to_full<LDPC_matrix::value_type>(G), G_ref) || pos != pos_ref ||
+			    !LDPC_matrix_handler::check_GH(H, G))
+			{
+				std::cerr << "FAILED: identity method, " << name << ", n_threads = " << n_threads << std::endl;
+				n_fails++;
+			}
+		}
+
+		Positions_vector pos;
+		const auto G = LDPC_matrix_handler::transform_H_to_G_identity(Hf, pos);
+		if (!same(G, G_ref) || pos != pos_ref)
+		{
+			std::cerr << "FAILED: identity method (full matrix), " << name << std::endl;
+			n_fails++;
+		}
+	}
+
+	const auto invertible = ref::transform_H_to_G_decomp_LU(Hf, G_ref, pos_ref);
+
+	for (auto n_threads : {1, 3})
+	{
+		try
+		{
+			Positions_vector pos;
+			const auto G = LDPC_matrix_handler::transform_H_to_G_decomp_LU(H, pos, n_threads);
+			if (!invertible || !same(sparse_to_full<LDPC_matrix::value_type>(G), G_ref) || pos != pos_ref ||
+			    !LDPC_matrix_handler::check_GH(H, G))
+			{
+				std::cerr << "FAILED: LU method, " << name << ", n_threads = " << n_threads << std::endl;
+				n_fails++;
+			}
+		}
+		catch (const std::exception&)
+		{
+			// a singular parity part has to be detected by both implementations
+			if (invertible)
+			{
+				std::cerr << "FAILED: LU method (unexpected exception), " << name << ", n_threads = " << n_threads
+				          << std::endl;
+				n_fails++;
+			}
+		}
+	}
+
+	return n_fails;
+}
+
+// GF(2) product of a random unit lower triangular matrix and a random unit upper triangular matrix (invertible)
+LDPC_matrix random_invertible(const size_t M, std::mt19937 &gen, std::bernoulli_distribution &bit)
+{
+	LDPC_matrix L(M, M), U(M, M), P(M, M);
+	for (size_t i = 0; i < M; i++)
+	{
+		L[i][i] = U[i][i] = 1;
+		for (size_t j = 0; j < i; j++)
+		{
+			L[i][j] = bit(gen);
+			U[j][i] = bit(gen);
+		}
+	}
+
+	for (size_t i = 0; i < M; i++)
+		for (size_t k = 0; k < M; k++)
+			if (L[i][k])
+				ref::xor_row(U, k, P, i, 0);
+
+	return P;
+}
+
+int main(int argc, char** argv)
+{
+	auto n_fails = 0;
+
+	for (auto seed = 0; seed < 40; seed++)
+	{
+		std::mt19937 gen(seed);
+		const auto M = 2 + (int)(gen() % 150);
+		const auto K = 1 + (int)(gen() % 150);
+		const auto N = M + K;
+		std::bernoulli_distribution bit(0.02 + (gen() % 100) / 300.);
+
+		// H = [H1 H2] with H2 invertible: H is full rank, the columns are shuffled to force the columns swaps
+		LDPC_matrix Hf(M, N);
+		const auto H2 = random_invertible(M, gen, bit);
+		for (auto r = 0; r < M; r++)
+		{
+			for (auto c = 0; c < K; c++)
+				Hf[r][c] = bit(gen);
+			std::copy(H2[r].begin(), H2[r].end(), Hf[r].begin() + K);
+		}
+
+		const auto name = "random H " + std::to_string(M) + "x" + std::to_string(N) + " (seed " + std::to_string(seed)
+		                + ")";
+		n_fails += check(full_to_sparse(Hf), name);
+
+		std::vector<size_t> cols(N);
+		std::iota(cols.begin(), cols.end(), 0);
+		std::shuffle(cols.begin(), cols.end(), gen);
+		LDPC_matrix Hs(M, N);
+		for (auto r = 0; r < M; r++)
+			for (auto c = 0; c < N; c++)
+				Hs[r][c] = Hf[r][cols[c]];
+		n_fails += check(full_to_sparse(Hs), name + ", shuffled");
+
+		// random H without structure: H may not be full rank and H2 may be singular
+		for (auto r = 0; r < M; r++)
+			for (auto c = 0; c < N; c++)
+				Hs[r][c] = bit(gen);
+		n_fails += check(full_to_sparse(Hs), name + ", no structure");
+	}
+
+	for (auto i = 1; i < argc; i++)
+		n_fails += check(LDPC_matrix_handler::read(argv[i]), argv[i]);
+
+	if (n_fails)
+	{
+		std::cerr << n_fails << " check(s) failed." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::cout << "All the checks passed." << std::endl;
+	return EXIT_SUCCESS;
+}